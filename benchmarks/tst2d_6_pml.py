@@ -0,0 +1,50 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+# ----------------------------------------------------------------------------------------
+#  Gaussian laser absorbed by the perfectly matched layers (east, south and north)
+
+import math
+
+l0 = 2.0*math.pi		# laser wavelength
+t0 = l0					# optical cicle
+Lsim = [20.*l0,20.*l0]	# length of the simulation
+Tsim = 40.*t0			# duration of the simulation
+resx = 10.				# nb of cells in on laser wavelength
+rest = 20.				# time of timestep in one optical cycle 
+
+Main(
+    geometry = "2d3v",
+    
+    interpolation_order = 2 ,
+    
+    cell_length = [l0/resx,l0/resx],
+    sim_length  = Lsim,
+    
+    number_of_patches = [ 8, 8 ],
+    
+    timestep = t0/rest,
+    sim_time = Tsim,
+     
+    bc_em_type_x = ['silver-muller', 'pml'],
+    bc_em_type_y = ['pml'],
+    
+    pml_cells = 10,
+    pml_order = 3,
+    pml_reflection = 1.e-8,
+    
+    random_seed = 0
+)
+
+LaserGaussian2D(
+    a0              = 1.,
+    omega           = 1.,
+    focus           = [Lsim[0]/2., Lsim[1]/2.],
+    waist           = 6.,
+    incidence_angle = 0.4,
+    time_envelope   = tgaussian(center=6.*t0, fwhm=5.*t0)
+)
+
+
+globalEvery = int(rest)
+
+DiagScalar(every=globalEvery)
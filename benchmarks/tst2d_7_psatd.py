@@ -0,0 +1,82 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+# ----------------------------------------------------------------------------------------
+#  Electromagnetic pulse in a periodic thermal plasma, with the pseudo-spectral solver beyond the CFL of the Yee solver
+
+import math
+
+l0 = 2.0*math.pi		# wavelength
+t0 = l0					# optical cicle
+Lsim = [8.*l0,8.*l0]	# length of the simulation
+Tsim = 10.*t0			# duration of the simulation
+resx = 10.				# nb of cells in on wavelength
+dx = l0/resx
+
+Main(
+    geometry = "2d3v",
+    
+    interpolation_order = 2 ,
+    
+    cell_length = [dx,dx],
+    sim_length  = Lsim,
+    
+    number_of_patches = [ 4, 4 ],
+    
+    maxwell_sol = "PSATD",
+    psatd_guard_cells = 8,
+    
+    # 1.3 times the CFL of the Yee solver, smaller than the cell length
+    timestep = 1.3*dx/math.sqrt(2.),
+    sim_time = Tsim,
+     
+    bc_em_type_x = ['periodic'],
+    bc_em_type_y = ['periodic'],
+    
+    random_seed = 0
+)
+
+Species(
+	species_type = 'ion',
+	initPosition_type = 'regular',
+	initMomentum_type = 'cold',
+	ionization_model = 'none',
+	n_part_per_cell = 4,
+	c_part_max = 1.0,
+	mass = 1836.0,
+	charge = 1.0,
+	nb_density = 0.5,
+	mean_velocity = [0.,0.,0.],
+	temperature = [0.],
+	time_frozen = 100000000.0,
+	bc_part_type_west  = 'none',
+	bc_part_type_east  = 'none',
+	bc_part_type_south = 'none',
+	bc_part_type_north = 'none'
+)
+Species(
+	species_type = 'eon',
+	initPosition_type = 'regular',
+	initMomentum_type = 'mj',
+	ionization_model = 'none',
+	n_part_per_cell = 4,
+	c_part_max = 1.0,
+	mass = 1.0,
+	charge = -1.0,
+	nb_density = 0.5,
+	mean_velocity = [0.,0.,0.],
+	temperature = [0.01],
+	time_frozen = 0.0,
+	bc_part_type_west  = 'none',
+	bc_part_type_east  = 'none',
+	bc_part_type_south = 'none',
+	bc_part_type_north = 'none'
+)
+
+ExtField(
+    field = ["Ez"],
+    profile = gaussian(0.1, xfwhm=l0, xcenter=Lsim[0]/2., yfwhm=l0, ycenter=Lsim[1]/2.)
+)
+
+globalEvery = 10
+
+DiagScalar(every=globalEvery)
@@ -0,0 +1,76 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+# ----------------------------------------------------------------------------------------
+#  Laser envelope in an underdense plasma : ponderomotive electrons, frozen ions
+
+import math
+
+dx = 1.
+dy = 2.
+Lsim = [128., 96.]
+laser_fwhm = 20.
+
+Main(
+    geometry = "2d3v",
+    
+    interpolation_order = 2,
+    
+    cell_length = [dx, dy],
+    sim_length  = Lsim,
+    
+    number_of_patches = [ 8, 4 ],
+    
+    timestep = 0.5,
+    sim_time = 150.,
+     
+    bc_em_type_x = ['silver-muller'],
+    bc_em_type_y = ['silver-muller'],
+    
+    random_seed = 0
+)
+
+Species(
+    species_type = "ion",
+    initPosition_type = "regular",
+    initMomentum_type = "cold",
+    n_part_per_cell = 4,
+    c_part_max = 1.0,
+    mass = 1836.0,
+    charge = 1.0,
+    charge_density = trapezoidal(0.01, xvacuum=20., xplateau=200.),
+    time_frozen = 10000.,
+    bc_part_type_west  = "supp",
+    bc_part_type_east  = "supp",
+    bc_part_type_south = "supp",
+    bc_part_type_north = "supp"
+)
+
+Species(
+    species_type = "electron",
+    initPosition_type = "regular",
+    initMomentum_type = "cold",
+    n_part_per_cell = 4,
+    c_part_max = 1.0,
+    mass = 1.0,
+    charge = -1.0,
+    charge_density = trapezoidal(0.01, xvacuum=20., xplateau=200.),
+    dynamics_type = "norm",
+    ponderomotive_dynamics = True,
+    time_frozen = 0.,
+    bc_part_type_west  = "supp",
+    bc_part_type_east  = "supp",
+    bc_part_type_south = "supp",
+    bc_part_type_north = "supp"
+)
+
+LaserGaussian2D(
+    boxSide         = "west",
+    a0              = 2.,
+    omega           = 1.,
+    focus           = [0., Lsim[1]/2.],
+    waist           = 20.,
+    time_envelope   = tgaussian(center=laser_fwhm, fwhm=laser_fwhm),
+    envelope        = True
+)
+
+DiagScalar(every = 20)
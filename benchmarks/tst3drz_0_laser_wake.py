@@ -0,0 +1,58 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+# ----------------------------------------------------------------------------------------
+#  Quasi-3D cylindrical geometry : laser (mode m=1) driving a wake (mode m=0) in an underdense plasma
+
+import math
+
+l0 = 2.0*math.pi		# laser wavelength
+dx = l0/16.
+dr = l0/4.
+Lsim = [24.*l0, 8.*l0]
+laser_fwhm = 5.*l0
+
+Main(
+    geometry = "3drz",
+    nmodes = 2,
+    
+    interpolation_order = 2,
+    
+    cell_length = [dx, dr],
+    sim_length  = Lsim,
+    
+    number_of_patches = [ 8, 2 ],
+    
+    timestep_over_CFL = 0.95,
+    sim_time = 30.*l0,
+     
+    bc_em_type_x = ['silver-muller'],
+    bc_em_type_y = ['silver-muller'],
+    
+    random_seed = 0
+)
+
+Species(
+    species_type = "electron",
+    initPosition_type = "regular",
+    initMomentum_type = "cold",
+    n_part_per_cell = 4,
+    c_part_max = 1.0,
+    mass = 1.0,
+    charge = -1.0,
+    charge_density = trapezoidal(0.005, xvacuum=4.*l0, xplateau=100.*l0),
+    time_frozen = 0.,
+    bc_part_type_west  = "supp",
+    bc_part_type_east  = "supp",
+    bc_part_type_north = "supp"
+)
+
+LaserGaussian2D(
+    boxSide         = "west",
+    a0              = 1.,
+    omega           = 1.,
+    focus           = [6.*l0, 0.],
+    waist           = 3.*l0,
+    time_envelope   = tgaussian(center=laser_fwhm, fwhm=laser_fwhm)
+)
+
+DiagScalar(every = 50)
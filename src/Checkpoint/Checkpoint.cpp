@@ -17,6 +17,7 @@
 #include "Patch.h"
 #include "SimWindow.h"
 #include "ElectroMagn.h"
+#include "ElectroMagnBC.h"
 #include "Species.h"
 #include "VectorPatch.h"
 
@@ -201,6 +202,31 @@ void Checkpoint::dumpPatch( ElectroMagn* EMfields, std::vector<Species*> vecSpec
 	dumpFieldsPerProc(patch_gid, EMfields->By_avg);
 	dumpFieldsPerProc(patch_gid, EMfields->Bz_avg);
     }
+    if (EMfields->envelope!=NULL) {
+	dumpFieldsPerProc(patch_gid, EMfields->envelope->A_re);
+	dumpFieldsPerProc(patch_gid, EMfields->envelope->A_im);
+	dumpFieldsPerProc(patch_gid, EMfields->envelope->A0_re);
+	dumpFieldsPerProc(patch_gid, EMfields->envelope->A0_im);
+	dumpFieldsPerProc(patch_gid, EMfields->envelope->Phi);
+	dumpFieldsPerProc(patch_gid, EMfields->envelope->GradPhi_x);
+	dumpFieldsPerProc(patch_gid, EMfields->envelope->GradPhi_y);
+    }
+    for (unsigned int k=0 ; k<EMfields->modesE.size() ; k++) {
+	dumpFieldsPerProc(patch_gid, EMfields->modesE[k]);
+	dumpFieldsPerProc(patch_gid, EMfields->modesB[k]);
+    }
+    // Auxiliary fields of the boundary conditions (PML), empty if the patch is outside the layer
+    for (unsigned int bcId=0 ; bcId<EMfields->emBoundCond.size() ; bcId++ ) {
+	if (! EMfields->emBoundCond[bcId]) continue;
+	vector< vector<double>* > aux;
+	EMfields->emBoundCond[bcId]->auxiliaryFields( aux );
+	for (unsigned int i=0 ; i<aux.size() ; i++) {
+	    if ( aux[i]->size() == 0 ) continue;
+	    ostringstream name("");
+	    name << "BC" << bcId << "-aux" << i;
+	    H5::vect(patch_gid, name.str(), *aux[i]);
+	}
+    }
 	
     H5Fflush( patch_gid, H5F_SCOPE_GLOBAL );
     H5::attr(patch_gid, "species", vecSpecies.size());    
@@ -227,20 +253,20 @@ void Checkpoint::dumpPatch( ElectroMagn* EMfields, std::vector<Species*> vecSpec
 	    for (unsigned int i=0; i<vecSpecies[ispec]->particles->Position.size(); i++) {
 		ostringstream my_name("");
                 my_name << "Position-" << i;
-                H5::vect(gid,my_name.str(), vecSpecies[ispec]->particles->Position[i]);
+                H5::vect(gid,my_name.str(), vecSpecies[ispec]->particles->Position[i][0], vecSpecies[ispec]->particles->size(), H5T_NATIVE_DOUBLE);
 	    }
 			
 	    for (unsigned int i=0; i<vecSpecies[ispec]->particles->Momentum.size(); i++) {
 		ostringstream my_name("");
                 my_name << "Momentum-" << i;
-                H5::vect(gid,my_name.str(), vecSpecies[ispec]->particles->Momentum[i]);
+                H5::vect(gid,my_name.str(), vecSpecies[ispec]->particles->Momentum[i][0], vecSpecies[ispec]->particles->size(), H5T_NATIVE_DOUBLE);
 	    }
 			
-            H5::vect(gid,"Weight", vecSpecies[ispec]->particles->Weight);
-            H5::vect(gid,"Charge", vecSpecies[ispec]->particles->Charge);
+            H5::vect(gid,"Weight", vecSpecies[ispec]->particles->Weight[0], vecSpecies[ispec]->particles->size(), H5T_NATIVE_DOUBLE);
+            H5::vect(gid,"Charge", vecSpecies[ispec]->particles->Charge[0], vecSpecies[ispec]->particles->size(), H5T_NATIVE_SHORT);
 
             if (vecSpecies[ispec]->particles->tracked) {
-                H5::vect(gid,"Id", vecSpecies[ispec]->particles->Id);
+                H5::vect(gid,"Id", vecSpecies[ispec]->particles->Id[0], vecSpecies[ispec]->particles->size(), H5T_NATIVE_UINT);
             }
 
 
@@ -377,6 +403,33 @@ void Checkpoint::restartPatch( ElectroMagn* EMfields,std::vector<Species*> &vecS
 	restartFieldsPerProc(patch_gid, EMfields->By_avg);
 	restartFieldsPerProc(patch_gid, EMfields->Bz_avg);
     }
+    if (EMfields->envelope!=NULL) {
+	restartFieldsPerProc(patch_gid, EMfields->envelope->A_re);
+	restartFieldsPerProc(patch_gid, EMfields->envelope->A_im);
+	restartFieldsPerProc(patch_gid, EMfields->envelope->A0_re);
+	restartFieldsPerProc(patch_gid, EMfields->envelope->A0_im);
+	restartFieldsPerProc(patch_gid, EMfields->envelope->Phi);
+	restartFieldsPerProc(patch_gid, EMfields->envelope->GradPhi_x);
+	restartFieldsPerProc(patch_gid, EMfields->envelope->GradPhi_y);
+    }
+    for (unsigned int k=0 ; k<EMfields->modesE.size() ; k++) {
+	restartFieldsPerProc(patch_gid, EMfields->modesE[k]);
+	restartFieldsPerProc(patch_gid, EMfields->modesB[k]);
+    }
+    for (unsigned int bcId=0 ; bcId<EMfields->emBoundCond.size() ; bcId++ ) {
+	if (! EMfields->emBoundCond[bcId]) continue;
+	vector< vector<double>* > aux;
+	EMfields->emBoundCond[bcId]->auxiliaryFields( aux );
+	for (unsigned int i=0 ; i<aux.size() ; i++) {
+	    ostringstream name("");
+	    name << "BC" << bcId << "-aux" << i;
+	    // absent if the patch was outside the layer, or along x once the window has moved
+	    if ( aux[i]->size() == 0 || H5Lexists(patch_gid, name.str().c_str(), H5P_DEFAULT) <= 0 ) continue;
+	    did = H5Dopen(patch_gid, name.str().c_str(), H5P_DEFAULT);
+	    H5Dread(did, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &(*aux[i])[0]);
+	    H5Dclose(did);
+	}
+    }
 	
     aid = H5Aopen(patch_gid, "species", H5T_NATIVE_UINT);
     unsigned int vecSpeciesSize=0;
@@ -195,9 +195,9 @@ void CollisionalIonization::prepare3(double timestep, int n_cluster_per_cell)
 }
 
 // Method to apply the ionization
-void CollisionalIonization::apply(Particles *p1, int i1, Particles *p2, int i2)
+void CollisionalIonization::apply(Particles *p1, int i1, Particles *p2, int i2, Random &random)
 {
-    static double gamma_s, gamma1, gamma2;
+    double gamma_s, gamma1, gamma2;
     gamma1 = p1->lor_fac(i1);
     gamma2 = p2->lor_fac(i2);
     // Calculate lorentz factor in the frame of ion
@@ -207,20 +207,21 @@ void CollisionalIonization::apply(Particles *p1, int i1, Particles *p2, int i2)
         - p1->momentum(2,i1)*p2->momentum(2,i2);
     // Calculate the rest of the stuff
     if( electronFirst ) {
-        calculate(gamma_s, gamma1, gamma2, p1, i1, p2, i2);
+        calculate(gamma_s, gamma1, gamma2, p1, i1, p2, i2, random);
     } else {
-        calculate(gamma_s, gamma2, gamma1, p2, i2, p1, i1);
+        calculate(gamma_s, gamma2, gamma1, p2, i2, p1, i1, random);
     }
 }
 
 // Method used by ::apply so that we are sure that electrons are the first species
 void CollisionalIonization::calculate(double gamma_s, double gammae, double gammai, 
-    Particles *pe, int ie, Particles *pi, int ii)
+    Particles *pe, int ie, Particles *pi, int ii, Random &random)
 {
-    static double We, Wi; // weights
-    static double U1, U2; // random number
-    static double a, x, cs, w, e, pr, p2, WeWi, WiWe, cum_prob, cp;
-    static int i, j, k, p, kmax;
+    // (no static variables : the collisions of different patches run in parallel)
+    double We, Wi; // weights
+    double U1, U2; // random number
+    double a, x, cs, w, e, pr, p2, WeWi, WiWe, cum_prob, cp;
+    int i, j, k, p, kmax;
     
     // Get ion charge
     Zstar = pi->charge(ii);
@@ -236,7 +237,7 @@ void CollisionalIonization::calculate(double gamma_s, double gammae, double gamm
     WiWe = 1./WeWi;
     
     // Make a random number to choose if ionization or not
-    U1 = (double)rand() / RAND_MAX;
+    U1 = random.uniform();
     
     // Loop for multiple ionization
     // k+1 is the number of ionizations
@@ -288,7 +289,7 @@ void CollisionalIonization::calculate(double gamma_s, double gammae, double gamm
         if( U1 < cum_prob ) break;
         
         // Otherwise, we do the ionization
-        U2 = (double)rand() / RAND_MAX;
+        U2 = random.uniform();
         p2 = gamma_s*gamma_s - 1.;
         // Ionize the atom and create electron
         if( U2 < WeWi ) {
@@ -338,17 +339,7 @@ void CollisionalIonization::finish(Species *s1, Species *s2, Params &params, Pat
     if( electronFirst ) {electron_species = s1;}
     else {electron_species = s2;}
     
-    for (unsigned int i=0; i < new_electrons.size(); i++) {
-        
-        unsigned int ibin = (int) (new_electrons.position(0,i) / params.cell_length[0]) - ( patch->getCellStartingGlobalIndex(0) + params.oversize[0] );
-        new_electrons.cp_particle(i, *(electron_species->particles), electron_species->bmin[ibin] );
-        
-        electron_species->bmax[ibin]++;
-        for (unsigned int ii=ibin+1; ii<electron_species->bmin.size(); ii++) {
-            electron_species->bmin[ii]++;
-            electron_species->bmax[ii]++;
-        }
-    }
+    electron_species->importParticles( new_electrons );
     new_electrons.clear();
 }
 
@@ -7,6 +7,7 @@
 #include "Tools.h"
 #include "Species.h"
 #include "Params.h"
+#include "Random.h"
 
 class Patch;
 
@@ -41,7 +42,7 @@ public:
     virtual void prepare2(Particles *p1, int i1, Particles *p2, int i2, bool);
     virtual void prepare3(double, int);
     //! Method to apply the ionization
-    virtual void apply(Particles *p1, int i1, Particles *p2, int i2);
+    virtual void apply(Particles *p1, int i1, Particles *p2, int i2, Random &random);
     //! Method to finish the ionization and put new electrons in place
     virtual void finish(Species *s1, Species *s2, Params&, Patch*);
     
@@ -93,7 +94,7 @@ private:
     std::vector<double> prob;
     
     //! Method called by ::apply to calculate the ionization, being sure that electrons are the first species
-    void calculate(double, double, double, Particles *pe, int ie, Particles *pi, int ii);
+    void calculate(double, double, double, Particles *pe, int ie, Particles *pi, int ii, Random &random);
     
     //! Quantities used during computation
     int Zstar; // ion charge
@@ -112,7 +113,7 @@ public:
     
     void prepare2(Particles*, int, Particles*, int, bool){};
     void prepare3(double, int){};
-    void apply(Particles*, int, Particles*, int){};
+    void apply(Particles*, int, Particles*, int, Random&){};
     void finish(Species*, Species*, Params&, Patch*) {};
 };
 
@@ -417,6 +417,10 @@ void Collisions::collide(Params& params, Patch* patch, int itime)
     coeff2 = 2.817940327e-15*params.referenceAngularFrequency_SI/299792458.; // re omega / c
     n_cluster_per_cell = 1./((double)params.n_cell_per_cluster);
     
+    // Random numbers of this collisions block, patch and timestep
+    Random random(params.random_seed, patch->Hindex());
+    random.seek( Random::STREAM_COLLISIONS + n_collisions, itime );
+    
     // Loop on bins
     for (unsigned int ibin=0 ; ibin<nbins ; ibin++) {
         
@@ -455,8 +459,7 @@ void Collisions::collide(Params& params, Patch* patch, int itime)
         //    (It does not really exchange them, it is just a temporary re-indexing)
         index1.resize(npart1);
         for (unsigned int i=0; i<npart1; i++) index1[i] = i; // first, we make an ordered array
-        //! \todo benchmark and improve the shuffling method ?
-        random_shuffle(index1.begin(), index1.end()); // shuffle the index array
+        random.shuffle(index1); // shuffle the index array
         if (intra_collisions) { // In the case of collisions within one species
             npairs = (int) ceil(((double)npart1)/2.); // half as many pairs as macro-particles
             index2.resize(npairs);
@@ -587,10 +590,9 @@ void Collisions::collide(Params& params, Patch* patch, int itime)
             if (s>smax) s = smax;
             
             // Pick the deflection angles according to Nanbu's theory
-            cosX = cos_chi(s);
+            cosX = cos_chi(s, random);
             sinX = sqrt( 1. - cosX*cosX );
-            //!\todo make a faster rand by preallocating ??
-            phi = twoPi * ((double)rand() / RAND_MAX);
+            phi = twoPi * random.uniform();
             
             // Calculate combination of angles
             sinXcosPhi = sinX*cos(phi);
@@ -611,8 +613,7 @@ void Collisions::collide(Params& params, Patch* patch, int itime)
             
             // Random number to choose whether deflection actually applies.
             // This is to conserve energy in average when weights are not equal.
-            //!\todo make a faster rand by preallocating ??
-            U = ((double)rand() / RAND_MAX);
+            U = random.uniform();
             
             // Go back to the lab frame and store the results in the particle array
             vcp = COM_vx * newpx_COM + COM_vy * newpy_COM + COM_vz * newpz_COM;
@@ -630,7 +631,7 @@ void Collisions::collide(Params& params, Patch* patch, int itime)
             }
             
             // Handle ionization
-            Ionization->apply(p1, i1, p2, i2);
+            Ionization->apply(p1, i1, p2, i2, random);
             
             if( debug ) {
                 smean    += s;
@@ -697,12 +698,11 @@ void Collisions::collide(Params& params, Patch* patch, int itime)
 // It involves the "s" parameter (~ collision frequency * deflection expectation)
 //   and a random number "U".
 // Technique slightly modified in http://dx.doi.org/10.1063/1.4742167
-inline double Collisions::cos_chi(double s)
+inline double Collisions::cos_chi(double s, Random &random)
 {
     
     double A, invA;
-    //!\todo make a faster rand by preallocating ??
-    double U = (double)rand() / RAND_MAX;
+    double U = random.uniform();
     
     if( s < 0.1 ) {
         if ( U<0.0001 ) U=0.0001; // ensures cos_chi > 0
@@ -84,7 +84,7 @@ private:
     //! Contains the debye length in each cluster, computed each timestep
     static std::vector<double> debye_length_squared; 
     
-    static double cos_chi(double);
+    static double cos_chi(double, Random&);
     
     int atomic_number;
     
@@ -5,6 +5,7 @@
 #include "Patch.h"
 #include "SmileiMPI.h"
 
+class MaxwellSweepHook;
 
 class Diagnostic {
 
@@ -33,6 +34,9 @@ public :
     //! Writes out a global diag diag.
     virtual bool write(int timestep) {};
     
+    //! Operation of the diag done during the fused Maxwell sweep of this timestep (NULL if none). Only by patch master for local diags.
+    virtual MaxwellSweepHook* sweepHook( int timestep ) { return NULL; };
+    
     //! Time selection
     TimeSelection * timeSelection;
     
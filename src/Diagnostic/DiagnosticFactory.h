@@ -21,7 +21,8 @@ public:
         if ( params.geometry == "1d3v" ) {
             diag = new DiagnosticFields1D(params, smpi, patch, idiag);
         }
-        else if ( params.geometry == "2d3v" ) {
+        else if ( params.geometry == "2d3v" || params.geometry == "3drz" ) {
+            // 3drz : the azimuthal modes are written as 2D fields on the (x,r) grid
             diag = new DiagnosticFields2D(params, smpi, patch, idiag);
         }
         else {
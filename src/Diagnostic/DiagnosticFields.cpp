@@ -16,6 +16,7 @@ DiagnosticFields::DiagnosticFields( Params &params, SmileiMPI* smpi, Patch* patc
     PyTools::extract("time_average", time_average, "DiagFields", ndiag);
     if( time_average < 1 )
         time_average = 1;
+    avg_in_sweep_timestep = -1;
     
     // Verify that only one diag of this type exists
     int tavg;
@@ -161,6 +162,15 @@ bool DiagnosticFields::prepare( int timestep )
 }
 
 
+MaxwellSweepHook* DiagnosticFields::sweepHook( int timestep )
+{
+    if( time_average<=1 || !prepare( timestep ) ) return NULL;
+    
+    avg_in_sweep_timestep = timestep;
+    return &avgFieldsHook;
+}
+
+
 void DiagnosticFields::run( SmileiMPI* smpi, VectorPatch& vecPatches, int timestep )
 {
     
@@ -168,8 +178,8 @@ void DiagnosticFields::run( SmileiMPI* smpi, VectorPatch& vecPatches, int timest
     
     setFileSplitting( smpi, vecPatches );
     
-    // If time-averaging, increment the average
-    if( time_average>1 )
+    // If time-averaging, increment the average (unless done in the Maxwell sweep)
+    if( time_average>1 && timestep!=avg_in_sweep_timestep )
         for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++)
             vecPatches(ipatch)->EMfields->incrementAvgFields(timestep);
     
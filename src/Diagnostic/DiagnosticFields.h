@@ -2,7 +2,15 @@
 #define DIAGNOSTICFIELDS_H
 
 #include "Diagnostic.h"
+#include "ElectroMagn.h"
 
+//! Increment of the time-averaged fields, done block by block in the fused Maxwell sweep
+class AvgFieldsSweepHook : public MaxwellSweepHook {
+public :
+    void operator() ( ElectroMagn* EMfields, unsigned int istart, unsigned int iend, unsigned int jstart, unsigned int jend ) override {
+        EMfields->incrementAvgFields( istart, iend, jstart, jend );
+    }
+};
 
 class DiagnosticFields  : public Diagnostic {
 
@@ -23,6 +31,9 @@ public :
     
     virtual void run( SmileiMPI* smpi, VectorPatch& vecPatches, int timestep ) override;
     
+    //! The averaged fields are incremented in the Maxwell sweep when time-averaging at this timestep
+    virtual MaxwellSweepHook* sweepHook( int timestep ) override;
+    
     virtual void writeField(hid_t, int) = 0;
     
 protected :
@@ -34,6 +45,11 @@ protected :
     //! Number of timesteps for time averaging
     int time_average;
     
+    //! Increment of the averaged fields in the Maxwell sweep
+    AvgFieldsSweepHook avgFieldsHook;
+    //! Last timestep at which the averaged fields were incremented in the Maxwell sweep
+    int avg_in_sweep_timestep;
+    
     //! Property list for collective dataset write, set for // IO.
     hid_t write_plist;
     
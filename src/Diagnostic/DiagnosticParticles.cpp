@@ -219,8 +219,9 @@ void DiagnosticParticles::run( Patch* patch, int timestep )
     Species *s;
     Particles *p;
     vector<int> index_array;
-    vector<double> *x, *y, *z, *px, *py, *pz, *w, *chi=NULL, axis_array, data_array;
-    vector<short> *q;
+    aligned_vector<double> *x, *y, *z, *px, *py, *pz, *w, *chi=NULL;
+    vector<double> axis_array, data_array;
+    aligned_vector<short> *q;
     int nbins = vecSpecies[0]->bmin.size(); // number of bins in the particles binning
     int bmin, bmax, axissize, ind;
     double axismin, axismax, mass, coeff;
@@ -208,6 +208,9 @@ void DiagnosticScalar::compute( Patch* patch, int timestep )
         append("Ntot_"+nameSpec,nPart);
         append("Zavg_"+nameSpec,charge_avg);
         append("Ukin_"+nameSpec,ener_tot);
+        // weight of the macro-particles merged since the last output
+        if (vecSpecies[ispec]->Merge)
+            append("Wmrg_"+nameSpec,cell_volume*vecSpecies[ispec]->getMergedWeight());
         
         // incremement the total kinetic energy
         Ukin += ener_tot;
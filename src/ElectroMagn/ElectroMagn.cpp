@@ -2,6 +2,7 @@
 
 #include <limits>
 #include <iostream>
+#include <algorithm>
 
 #include "Params.h"
 #include "Species.h"
@@ -13,6 +14,8 @@
 #include "Patch.h"
 #include "Profile.h"
 #include "SolverFactory.h"
+#include "LaserEnvelope2D.h"
+#include "Field2D.h"
 
 using namespace std;
 
@@ -66,6 +69,8 @@ nrj_new_fields (  0.               )
     By_avg=NULL;
     Bz_avg=NULL;
     
+    envelope=NULL;
+    
     // Species charge currents and density
     Jx_s.resize(n_species);
     Jy_s.resize(n_species);
@@ -111,19 +116,38 @@ void ElectroMagn::finishInitialization(int nspecies, Patch* patch)
     allFields.push_back(Jz_ );
     allFields.push_back(rho_);
 
+    // Optional fields, only if allocated
     for (int ispec=0; ispec<nspecies; ispec++) {
+        if (!Jx_s[ispec]) continue;
         allFields.push_back(Jx_s[ispec] );
         allFields.push_back(Jy_s[ispec] );
         allFields.push_back(Jz_s[ispec] );
         allFields.push_back(rho_s[ispec]);
     }
-                
-    allFields_avg.push_back(Ex_avg);
-    allFields_avg.push_back(Ey_avg);
-    allFields_avg.push_back(Ez_avg);
-    allFields_avg.push_back(Bx_avg);
-    allFields_avg.push_back(By_avg);
-    allFields_avg.push_back(Bz_avg);
+    
+    if (Ex_avg) {
+        allFields_avg.push_back(Ex_avg);
+        allFields_avg.push_back(Ey_avg);
+        allFields_avg.push_back(Ez_avg);
+        allFields_avg.push_back(Bx_avg);
+        allFields_avg.push_back(By_avg);
+        allFields_avg.push_back(Bz_avg);
+    }
+    
+    if (envelope) {
+        allFields.push_back(envelope->A_re     );
+        allFields.push_back(envelope->A_im     );
+        allFields.push_back(envelope->Phi      );
+        allFields.push_back(envelope->GradPhi_x);
+        allFields.push_back(envelope->GradPhi_y);
+        allFields.push_back(envelope->Chi      );
+    }
+    
+    allFields.insert( allFields.end(), modesE  .begin(), modesE  .end() );
+    allFields.insert( allFields.end(), modesB  .begin(), modesB  .end() );
+    allFields.insert( allFields.end(), modesB_m.begin(), modesB_m.end() );
+    allFields.insert( allFields.end(), modesJ  .begin(), modesJ  .end() );
+    allFields.insert( allFields.end(), modesRho.begin(), modesRho.end() );
     
 }
 
@@ -167,6 +191,17 @@ ElectroMagn::~ElectroMagn()
     
     delete MaxwellFaradaySolver_;
     
+    delete envelope;
+    
+    for (unsigned int k=0 ; k<modesE.size() ; k++) {
+        delete modesE  [k];
+        delete modesB  [k];
+        delete modesB_m[k];
+        delete modesJ  [k];
+    }
+    for (unsigned int k=0 ; k<modesRho.size() ; k++)
+        delete modesRho[k];
+    
     //antenna cleanup
     for (vector<Antenna>::iterator antenna=antennas.begin(); antenna!=antennas.end(); antenna++ ) {
         delete antenna->field;
@@ -186,6 +221,89 @@ ElectroMagn::~ElectroMagn()
 //     - boundaryConditions
 //     - vecPatches::exchangeB (patch & MPI sync)
 //     - centerMagneticFields
+// or, with fused_maxwell :
+//     - solveMaxwellFused
+//     - boundaryConditions
+//     - vecPatches::exchangeB (patch & MPI sync)
+//     - centerMagneticFieldsBorders
+
+
+// Size of the blocks of rows of the fused Maxwell sweep : the ~12 fields of a block fit in a 256 kB L2 cache
+static const unsigned int sweep_block_bytes = 262144;
+static const unsigned int sweep_fields      = 12;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Interior of the fused Maxwell sweep : the borders of oversize+1 cells are changed by the boundary conditions
+// and the exchange of B, they are centered after them
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagn::sweepInterior( unsigned int* b )
+{
+    unsigned int nx = dimDual[0];
+    unsigned int ny = (nDim_field>1) ? dimDual[1] : 1;
+    b[0] = min( oversize[0]+1, nx );
+    b[1] = max( nx-b[0], b[0] );
+    b[2] = (nDim_field>1) ? min( oversize[1]+1, ny ) : 0;
+    b[3] = max( ny-b[2], b[2] );
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Fused Maxwell solver : one sweep over the patch by blocks of rows of the dual grid, which stay in cache
+//   - Ampere leads by one row : Faraday on the row i needs E on the row i+1,
+//     Ampere on the row i needs B^n on the row i+1 (not yet advanced)
+//   - on each block : save B^n in B_m, Faraday, center B_m and apply the hooks (interior only)
+//   - gives the same results as the separate passes
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagn::solveMaxwellFused( vector<MaxwellSweepHook*>& hooks )
+{
+    unsigned int nx = dimDual[0];
+    unsigned int ny = (nDim_field>1) ? dimDual[1] : 1;
+    unsigned int b[4];
+    sweepInterior( b );
+    unsigned int block_rows = max( sweep_block_bytes / (sweep_fields*ny*(unsigned int)sizeof(double)), 2u );
+    
+    unsigned int ampere_end = 0;
+    for (unsigned int istart=0 ; istart<nx ; istart+=block_rows) {
+        unsigned int iend = min( istart+block_rows, nx );
+        
+        solveMaxwellAmpere( ampere_end, min(iend+1, nx) );
+        ampere_end = min(iend+1, nx);
+        
+        saveMagneticFields( istart, iend );
+        (*MaxwellFaradaySolver_)( this, istart, iend );
+        
+        unsigned int i0 = max(istart, b[0]), i1 = min(iend, b[1]);
+        if ( i0 >= i1 || b[2] >= b[3] ) continue;
+        centerMagneticFields( i0, i1, b[2], b[3] );
+        for (unsigned int ihook=0 ; ihook<hooks.size() ; ihook++)
+            (*hooks[ihook])( this, i0, i1, b[2], b[3] );
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Center B (and apply the hooks) on the borders left by solveMaxwellFused
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagn::centerMagneticFieldsBorders( vector<MaxwellSweepHook*>& hooks )
+{
+    unsigned int nx = dimDual[0];
+    unsigned int ny = (nDim_field>1) ? dimDual[1] : 1;
+    unsigned int b[4];
+    sweepInterior( b );
+    
+    // West and east borders (whole rows), then south and north borders of the interior rows
+    unsigned int block[4][4] = { { 0,    b[0], 0,    ny   },
+                                 { b[1], nx,   0,    ny   },
+                                 { b[0], b[1], 0,    b[2] },
+                                 { b[0], b[1], b[3], ny   } };
+    for (unsigned int iblock=0 ; iblock<4 ; iblock++) {
+        unsigned int* r = block[iblock];
+        if ( r[0] >= r[1] || r[2] >= r[3] ) continue;
+        centerMagneticFields( r[0], r[1], r[2], r[3] );
+        for (unsigned int ihook=0 ; ihook<hooks.size() ; ihook++)
+            (*hooks[ihook])( this, r[0], r[1], r[2], r[3] );
+    }
+}
 
 
 
@@ -206,6 +324,15 @@ void ElectroMagn::boundaryConditions(int itime, double time_dual, Patch* patch,
     }
 }
 
+void ElectroMagn::boundaryConditionsE(double time_dual, Patch* patch, SimWindow* simWindow)
+{
+    bool moving = (simWindow) && (simWindow->isMoving(time_dual));
+    for (unsigned int iBC=0 ; iBC<emBoundCond.size() ; iBC++) {
+        if ( emBoundCond[iBC]==NULL || (moving && iBC<2) ) continue;
+        emBoundCond[iBC]->apply_E(this, time_dual, patch);
+    }
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Method used to create a dump of the data contained in ElectroMagn
 // ---------------------------------------------------------------------------------------------------------------------
@@ -246,11 +373,18 @@ void ElectroMagn::restartRhoJ()
     Jy_ ->put_to(0.);
     Jz_ ->put_to(0.);
     rho_->put_to(0.);
+    if (envelope)
+        envelope->Chi->put_to(0.);
+    for (unsigned int k=0 ; k<modesJ.size() ; k++)
+        modesJ[k]->put_to(0.);
+    for (unsigned int k=0 ; k<modesRho.size() ; k++)
+        modesRho[k]->put_to(0.);
 }
 
 void ElectroMagn::restartRhoJs()
 {
     for (unsigned int ispec=0 ; ispec < n_species ; ispec++) {
+        if (!Jx_s[ispec]) continue;
         Jx_s [ispec]->put_to(0.);
         Jy_s [ispec]->put_to(0.);
         Jz_s [ispec]->put_to(0.);
@@ -261,12 +395,85 @@ void ElectroMagn::restartRhoJs()
     Jy_ ->put_to(0.);
     Jz_ ->put_to(0.);
     rho_->put_to(0.);
+    for (unsigned int k=0 ; k<modesJ.size() ; k++)
+        modesJ[k]->put_to(0.);
+    for (unsigned int k=0 ; k<modesRho.size() ; k++)
+        modesRho[k]->put_to(0.);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// One pass of the 3-point filter (w, 1-2w, w) along each direction of a 1D or 2D field (the borders are unchanged)
+//   - along x, the row i-1 is kept unfiltered in a buffer, so that the rows i-1, i and i+1 are combined elementwise
+//   - along y, each row is copied to a buffer before being filtered in place
+// ---------------------------------------------------------------------------------------------------------------------
+static void filterPass( Field* field, double w )
+{
+    const double c = 1.-2.*w;
+    const unsigned int nx = field->dims_[0];
+    const unsigned int ny = field->dims_.size()>1 ? field->dims_[1] : 1;
+    double* data = field->data_;
+    vector<double> previous( ny ), current( ny );
+    
+    if ( nx > 2 ) {
+        for (unsigned int j=0 ; j<ny ; j++)
+            previous[j] = data[j];
+        for (unsigned int i=1 ; i<nx-1 ; i++) {
+            double* __restrict__ row = &data[i*ny];
+            const double* __restrict__ next = &data[(i+1)*ny];
+            double* __restrict__ prev = &previous[0];
+            double* __restrict__ curr = &current[0];
+            #pragma omp simd
+            for (unsigned int j=0 ; j<ny ; j++) {
+                curr[j] = row[j];
+                row[j] = c*curr[j] + w*( prev[j] + next[j] );
+            }
+            previous.swap( current );
+        }
+    }
+    
+    if ( ny > 2 ) {
+        for (unsigned int i=0 ; i<nx ; i++) {
+            double* __restrict__ row = &data[i*ny];
+            double* __restrict__ curr = &current[0];
+            #pragma omp simd
+            for (unsigned int j=0 ; j<ny ; j++)
+                curr[j] = row[j];
+            #pragma omp simd
+            for (unsigned int j=1 ; j<ny-1 ; j++)
+                row[j] = c*curr[j] + w*( curr[j-1] + curr[j+1] );
+        }
+    }
+}
+
+void ElectroMagn::binomialCurrentFilter( unsigned int passes, bool compensation )
+{
+    Field* J[3] = { Jx_, Jy_, Jz_ };
+    for (unsigned int icomp=0 ; icomp<3 ; icomp++) {
+        for (unsigned int ipass=0 ; ipass<passes ; ipass++)
+            filterPass( J[icomp], 0.25 );
+        // (1-k^2/4)^passes (1+passes k^2/4) = 1 + O(k^4) for the normalized wavenumber k
+        if ( compensation )
+            filterPass( J[icomp], -0.25*(double)passes );
+    }
 }
 
 void ElectroMagn::laserDisabled()
 {
     if ( emBoundCond.size() )
 	emBoundCond[0]->laserDisabled();
+    if ( envelope )
+        envelope->laserDisabled();
+}
+
+void ElectroMagn::auxiliaryFieldsXDisabled()
+{
+    for (unsigned int iBC=0 ; iBC<2 && iBC<emBoundCond.size() ; iBC++) {
+        if ( emBoundCond[iBC]==NULL ) continue;
+        vector< vector<double>* > aux;
+        emBoundCond[iBC]->auxiliaryFields( aux );
+        for (unsigned int i=0 ; i<aux.size() ; i++)
+            vector<double>().swap( *aux[i] );
+    }
 }
 
 double ElectroMagn::computeNRJ() {
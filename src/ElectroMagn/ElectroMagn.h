@@ -18,6 +18,8 @@ class ElectroMagnBC;
 class SimWindow;
 class Patch;
 class Solver;
+class PoissonMultigrid;
+class LaserEnvelope2D;
 
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -43,6 +45,18 @@ struct Antenna {
     Field* field;
 };
 
+// ---------------------------------------------------------------------------------------------------------------------
+//! Operation hooked into the fused Maxwell sweep (ElectroMagn::solveMaxwellFused), applied to each block of the
+//! patch once E and the centered B are final there (e.g. the increment of the time-averaged fields)
+// ---------------------------------------------------------------------------------------------------------------------
+class MaxwellSweepHook
+{
+public:
+    virtual ~MaxwellSweepHook() {};
+    //! Apply to the block [istart,iend[ x [jstart,jend[ of the dual grid (jstart=0, jend=1 in 1D)
+    virtual void operator() ( ElectroMagn* EMfields, unsigned int istart, unsigned int iend, unsigned int jstart, unsigned int jend ) = 0;
+};
+
 //! class ElectroMagn: generic class containing all information on the electromagnetic fields and currents
 class ElectroMagn
 {
@@ -129,6 +143,18 @@ public:
     //! time-average z-component of the magnetic field
     Field* Bz_avg;
 
+    //! Envelope of the laser (NULL if no Laser block has envelope = True)
+    LaserEnvelope2D* envelope;
+
+    //! Azimuthal modes m=1..nmodes-1 of the 3drz geometry (empty otherwise), the real mode 0 being in Ex_ ... rho_ :
+    //! modesE[ ((m-1)*2+p)*3+c ] with p=0 (real part), 1 (imaginary part) and c=0 (l), 1 (r), 2 (theta)
+    std::vector<Field*> modesE;
+    std::vector<Field*> modesB;
+    std::vector<Field*> modesB_m;
+    std::vector<Field*> modesJ;
+    //! Azimuthal modes of the charge density : modesRho[ (m-1)*2+p ]
+    std::vector<Field*> modesRho;
+
     //! all Fields in electromagn (filled in ElectromagnFactory.h)
     std::vector<Field*> allFields;
 
@@ -141,6 +167,13 @@ public:
     std::vector<Field*> Jy_s;
     std::vector<Field*> Jz_s;
     std::vector<Field*> rho_s;
+    
+    //! Densities in which the species ispec deposits on diagnostic steps :
+    //! its own ones if they are allocated (output by a DiagFields), the total ones otherwise
+    inline Field* Jx_diag ( unsigned int ispec ) { return Jx_s [ispec] ? Jx_s [ispec] : Jx_ ; }
+    inline Field* Jy_diag ( unsigned int ispec ) { return Jy_s [ispec] ? Jy_s [ispec] : Jy_ ; }
+    inline Field* Jz_diag ( unsigned int ispec ) { return Jz_s [ispec] ? Jz_s [ispec] : Jz_ ; }
+    inline Field* rho_diag( unsigned int ispec ) { return rho_s[ispec] ? rho_s[ispec] : rho_; }
     //! Number of bins
     unsigned int nbin;
     //! Cluster width
@@ -180,6 +213,11 @@ public:
 
     //! Method used to sum all species densities and currents to compute the total charge density and currents
     virtual void computeTotalRhoJ() = 0;
+    
+    //! Smooth the total currents by passes of the binomial filter (1/4,1/2,1/4) in each direction,
+    //! followed if compensation by the pass (-passes/4,1+passes/2,-passes/4)
+    //! (the outer passes(+1) layers of the patch are wrong : they are extra guard cells, see Params)
+    void binomialCurrentFilter( unsigned int passes, bool compensation );
 
     // --------------------------------------
     //  --------- PATCH IN PROGRESS ---------
@@ -191,6 +229,14 @@ public:
     virtual double compute_pAp() = 0;
     virtual void update_pand_r(double r_dot_r, double p_dot_Ap) = 0;
     virtual void update_p(double rnew_dot_rnew, double r_dot_r) = 0;
+    //! Multigrid preconditioned CG (poisson_solver = "mgcg") : z_ and the multigrid of the nodes owned by the patch
+    virtual void initPoissonMultigrid() = 0;
+    //! Sum of the residual on the nodes owned by the patch (right hand side of the coarse problem)
+    virtual double compute_rsum() = 0;
+    //! z = V-cycle(r) + z_coarse on the nodes owned by the patch, 0 elsewhere (to be summed with the neighbours)
+    virtual void precondition_r(double z_coarse) = 0;
+    virtual double compute_rz() = 0;
+    virtual void update_pz(double rznew_dot_rnew, double rz_dot_r) = 0;
     virtual void initE(Patch *patch) = 0;
     virtual void centeringE( std::vector<double> E_Add ) = 0;
 
@@ -208,6 +254,9 @@ public:
     Field* r_;
     Field* p_;
     Field* Ap_;
+    //! Preconditioned residual
+    Field* z_;
+    PoissonMultigrid* poissonMG_;
 
     // --------------------------------------
     // --------------------------------------
@@ -223,10 +272,29 @@ public:
     virtual void saveMagneticFields() = 0;
     virtual void centerMagneticFields() = 0;
     void boundaryConditions(int itime, double time_dual, Patch* patch, Params &params, SimWindow* simWindow);
+    //! Boundary conditions on E, applied between Maxwell-Ampere and Maxwell-Faraday (PML)
+    void boundaryConditionsE(double time_dual, Patch* patch, SimWindow* simWindow);
+
+    //! Same operations restricted to the rows [istart,iend[ of the dual grid (the primal fields stop at their last row)
+    virtual void solveMaxwellAmpere(unsigned int istart, unsigned int iend) = 0;
+    virtual void saveMagneticFields(unsigned int istart, unsigned int iend) = 0;
+    //! Center B on the block [istart,iend[ x [jstart,jend[ of the dual grid
+    virtual void centerMagneticFields(unsigned int istart, unsigned int iend, unsigned int jstart, unsigned int jend) = 0;
+
+    //! Fused Maxwell solver : save B, Ampere, Faraday and centering of B in one sweep by blocks of rows,
+    //! the borders (oversize+1 cells) are centered afterwards by centerMagneticFieldsBorders
+    void solveMaxwellFused( std::vector<MaxwellSweepHook*>& hooks );
+    //! Center B on the borders left by solveMaxwellFused (after the boundary conditions and the exchange of B)
+    void centerMagneticFieldsBorders( std::vector<MaxwellSweepHook*>& hooks );
 
     void laserDisabled();
+    //! The boundary conditions along x are not applied while the window moves : free their auxiliary fields (PML),
+    //! which are then neither sent with the patches nor dumped
+    void auxiliaryFieldsXDisabled();
     
     virtual void incrementAvgFields(unsigned int time_step) = 0;
+    //! Increment the averaged fields on the block [istart,iend[ x [jstart,jend[ of the dual grid
+    virtual void incrementAvgFields(unsigned int istart, unsigned int iend, unsigned int jstart, unsigned int jend) = 0;
         
     //! compute Poynting on borders
     virtual void computePoynting() = 0;
@@ -292,10 +360,13 @@ public:
         */
 
         int emSize = 9+4; // 3 x (E, B, Bm) + 3 x J, rho
-        if (true) // For now, no test to compute or not per species
-            emSize += n_species * 4; // 3 x J, rho
-        if (true) // For now, no test to compute or not average
+        for (unsigned int ispec=0 ; ispec<n_species ; ispec++)
+            if (Jx_s[ispec]) emSize += 4; // 3 x J, rho
+        if (Ex_avg)
             emSize += 6; // 3 x (E, B)
+        if (envelope)
+            emSize += 8; // 2 x 2 x A, Phi, 2 x GradPhi, Chi
+        emSize += modesE.size() + modesB.size() + modesB_m.size() + modesJ.size() + modesRho.size();
 
         for (size_t i=0 ; i<nDim_field ; i++)
             emSize *= dimPrim[i];
@@ -309,6 +380,9 @@ public:
 
 private:
     
+    //! Interior [i0,i1[ x [j0,j1[ of the dual grid centered by the fused Maxwell sweep : b = {i0,i1,j0,j1}
+    void sweepInterior( unsigned int* b );
+    
     //! Accumulate nrj lost with moving window
     double nrj_mw_lost;
 
@@ -5,6 +5,7 @@
 #include <sstream>
 #include <string>
 #include <iostream>
+#include <algorithm>
 
 #include "Params.h"
 #include "Field1D.h"
@@ -13,6 +14,7 @@
 
 #include "Profile.h"
 #include "MF_Solver1D_Yee.h"
+#include "PoissonMultigrid.h"
 
 #include "ElectroMagnBC.h"
 
@@ -73,13 +75,15 @@ isEastern(patch->isEastern())
     //         (*By_m)(i) = (*By_)(i);
     //     }
     //     
-    // Allocation of time-averaged EM fields
-    Ex_avg  = new Field1D(dimPrim, 0, false, "Ex_avg");
-    Ey_avg  = new Field1D(dimPrim, 1, false, "Ey_avg");
-    Ez_avg  = new Field1D(dimPrim, 2, false, "Ez_avg");
-    Bx_avg  = new Field1D(dimPrim, 0, true,  "Bx_avg");
-    By_avg  = new Field1D(dimPrim, 1, true,  "By_avg");
-    Bz_avg  = new Field1D(dimPrim, 2, true,  "Bz_avg");
+    // Allocation of the time-averaged EM fields (only if a DiagFields averages them)
+    if (params.has_avg_fields) {
+        Ex_avg  = new Field1D(dimPrim, 0, false, "Ex_avg");
+        Ey_avg  = new Field1D(dimPrim, 1, false, "Ey_avg");
+        Ez_avg  = new Field1D(dimPrim, 2, false, "Ez_avg");
+        Bx_avg  = new Field1D(dimPrim, 0, true,  "Bx_avg");
+        By_avg  = new Field1D(dimPrim, 1, true,  "By_avg");
+        Bz_avg  = new Field1D(dimPrim, 2, true,  "Bz_avg");
+    }
     
     // Total charge currents and densities
     Jx_   = new Field1D(dimPrim, 0, false, "Jx");
@@ -87,9 +91,10 @@ isEastern(patch->isEastern())
     Jz_   = new Field1D(dimPrim, 2, false, "Jz");
     rho_  = new Field1D(dimPrim, "Rho" );
     
-    // Charge currents currents and density for each species
-    
+    // Charge currents currents and density for each species (only if a DiagFields outputs them,
+    // otherwise the species deposit directly in the total ones)
     for (unsigned int ispec=0; ispec<n_species; ispec++) {
+        if ( !params.speciesFieldsDumped(vecSpecies[ispec]->species_type) ) continue;
         Jx_s[ispec]  = new Field1D(dimPrim, 0, false, ("Jx_"+vecSpecies[ispec]->species_type).c_str());
         Jy_s[ispec]  = new Field1D(dimPrim, 1, false, ("Jy_"+vecSpecies[ispec]->species_type).c_str());
         Jz_s[ispec]  = new Field1D(dimPrim, 2, false, ("Jz_"+vecSpecies[ispec]->species_type).c_str());
@@ -196,6 +201,8 @@ void ElectroMagn1D::initPoisson(Patch *patch)
     r_   = new Field1D(dimPrim);    // residual vector
     p_   = new Field1D(dimPrim);    // direction vector
     Ap_  = new Field1D(dimPrim);    // A*p vector
+    z_   = NULL;
+    poissonMG_ = NULL;
 
     double       dx_sq          = dx*dx;
 
@@ -253,6 +260,48 @@ void ElectroMagn1D::update_p(double rnew_dot_rnew, double r_dot_r)
         (*p_)(i) = (*r_)(i) + beta_k * (*p_)(i);
 } // update_p
 
+void ElectroMagn1D::initPoissonMultigrid()
+{
+    // The operator of compute_Ap is scaled by dx^2
+    z_ = new Field1D(dimPrim);      // preconditioned residual
+    poissonMG_ = new PoissonMultigrid( index_max_p_[0]-index_min_p_[0]+1, 1, 1., 0. );
+} // initPoissonMultigrid
+
+double ElectroMagn1D::compute_rsum()
+{
+    double r_sum_local(0.);
+    for (unsigned int i=index_min_p_[0] ; i<=index_max_p_[0] ; i++)
+        r_sum_local += (*r_)(i);
+    return r_sum_local;
+} // compute_rsum
+
+void ElectroMagn1D::precondition_r(double z_coarse)
+{
+    unsigned int i0 = index_min_p_[0];
+    for (unsigned int i=i0 ; i<=index_max_p_[0] ; i++)
+        poissonMG_->rhs(i-i0,0) = (*r_)(i);
+    poissonMG_->vcycle();
+    
+    z_->put_to(0.);
+    for (unsigned int i=i0 ; i<=index_max_p_[0] ; i++)
+        (*z_)(i) = poissonMG_->solution(i-i0,0) + z_coarse;
+} // precondition_r
+
+double ElectroMagn1D::compute_rz()
+{
+    double r_dot_z_local(0.);
+    for (unsigned int i=index_min_p_[0] ; i<=index_max_p_[0] ; i++)
+        r_dot_z_local += (*r_)(i)*(*z_)(i);
+    return r_dot_z_local;
+} // compute_rz
+
+void ElectroMagn1D::update_pz(double rznew_dot_rnew, double rz_dot_r)
+{
+    double beta_k = rznew_dot_rnew/rz_dot_r;
+    for (unsigned int i=0 ; i<dimPrim[0] ; i++)
+        (*p_)(i) = (*z_)(i) + beta_k * (*p_)(i);
+} // update_pz
+
 void ElectroMagn1D::initE(Patch *patch)
 {
     Field1D* Ex1D  = static_cast<Field1D*>(Ex_);
@@ -273,6 +322,8 @@ void ElectroMagn1D::initE(Patch *patch)
     delete r_;
     delete p_;
     delete Ap_;
+    if (z_) delete z_;
+    if (poissonMG_) delete poissonMG_;
 
 } // initE
 
@@ -293,6 +344,11 @@ void ElectroMagn1D::centeringE( std::vector<double> E_Add )
 // Save the former Magnetic-Fields (used to center them)
 // ---------------------------------------------------------------------------------------------------------------------
 void ElectroMagn1D::saveMagneticFields()
+{
+    saveMagneticFields( 0, dimDual[0] );
+}
+
+void ElectroMagn1D::saveMagneticFields(unsigned int istart, unsigned int iend)
 {
     // Static cast of the fields
     Field1D* Bx1D   = static_cast<Field1D*>(Bx_);
@@ -303,11 +359,11 @@ void ElectroMagn1D::saveMagneticFields()
     Field1D* Bz1D_m = static_cast<Field1D*>(Bz_m);
     
     // for Bx^(p)
-    for (unsigned int i=0 ; i<dimPrim[0] ; i++) {
+    for (unsigned int i=istart ; i<min(iend,dimPrim[0]) ; i++) {
         (*Bx1D_m)(i)=(*Bx1D)(i);
     }
     //for By^(d) & Bz^(d)
-    for (unsigned int i=0 ; i<dimDual[0] ; i++) {
+    for (unsigned int i=istart ; i<iend ; i++) {
         (*By1D_m)(i) = (*By1D)(i);
         (*Bz1D_m)(i) = (*Bz1D)(i);
     }
@@ -320,6 +376,11 @@ void ElectroMagn1D::saveMagneticFields()
 // Maxwell solver using the FDTD scheme
 // ---------------------------------------------------------------------------------------------------------------------
 void ElectroMagn1D::solveMaxwellAmpere()
+{
+    solveMaxwellAmpere( 0, dimDual[0] );
+}
+
+void ElectroMagn1D::solveMaxwellAmpere(unsigned int istart, unsigned int iend)
 {
     
     Field1D* Ex1D = static_cast<Field1D*>(Ex_);
@@ -336,12 +397,12 @@ void ElectroMagn1D::solveMaxwellAmpere()
     // --------------------
     // Calculate the electrostatic field ex on the dual grid
     //for (unsigned int ix=0 ; ix<nx_d ; ix++){
-    for (unsigned int ix=0 ; ix<dimDual[0] ; ix++) {
+    for (unsigned int ix=istart ; ix<iend ; ix++) {
         (*Ex1D)(ix)= (*Ex1D)(ix) - timestep* (*Jx1D)(ix) ;
     }
     // Transverse fields ey, ez  are defined on the primal grid
     //for (unsigned int ix=0 ; ix<nx_p ; ix++) {
-    for (unsigned int ix=0 ; ix<dimPrim[0] ; ix++) {
+    for (unsigned int ix=istart ; ix<min(iend,dimPrim[0]) ; ix++) {
         (*Ey1D)(ix)= (*Ey1D)(ix) - dt_ov_dx * ( (*Bz1D)(ix+1) - (*Bz1D)(ix)) - timestep * (*Jy1D)(ix) ;
         (*Ez1D)(ix)= (*Ez1D)(ix) + dt_ov_dx * ( (*By1D)(ix+1) - (*By1D)(ix)) - timestep * (*Jz1D)(ix) ;
     }
@@ -353,6 +414,11 @@ void ElectroMagn1D::solveMaxwellAmpere()
 // Center the Magnetic Fields (used to push the particle)
 // ---------------------------------------------------------------------------------------------------------------------
 void ElectroMagn1D::centerMagneticFields()
+{
+    centerMagneticFields( 0, dimDual[0], 0, 1 );
+}
+
+void ElectroMagn1D::centerMagneticFields(unsigned int istart, unsigned int iend, unsigned int jstart, unsigned int jend)
 {
     // Static cast of the fields
     Field1D* Bx1D   = static_cast<Field1D*>(Bx_);
@@ -363,12 +429,12 @@ void ElectroMagn1D::centerMagneticFields()
     Field1D* Bz1D_m = static_cast<Field1D*>(Bz_m);
     
     // for Bx^(p)
-    for (unsigned int i=0 ; i<dimPrim[0] ; i++) {
+    for (unsigned int i=istart ; i<min(iend,dimPrim[0]) ; i++) {
         (*Bx1D_m)(i) = ( (*Bx1D)(i)+ (*Bx1D_m)(i))*0.5 ;
     }
     
     // for By^(d) & Bz^(d)
-    for (unsigned int i=0 ; i<dimDual[0] ; i++) {
+    for (unsigned int i=istart ; i<iend ; i++) {
         (*By1D_m)(i)= ((*By1D)(i)+(*By1D_m)(i))*0.5 ;
         (*Bz1D_m)(i)= ((*Bz1D)(i)+(*Bz1D_m)(i))*0.5 ;
     }
@@ -381,6 +447,11 @@ void ElectroMagn1D::centerMagneticFields()
 // Reset/Increment the averaged fields
 // ---------------------------------------------------------------------------------------------------------------------
 void ElectroMagn1D::incrementAvgFields(unsigned int time_step)
+{
+    incrementAvgFields( 0, dimDual[0], 0, 1 );
+}
+
+void ElectroMagn1D::incrementAvgFields(unsigned int istart, unsigned int iend, unsigned int jstart, unsigned int jend)
 {
     // Static cast of the fields
     Field1D* Ex1D     = static_cast<Field1D*>(Ex_);
@@ -397,14 +468,14 @@ void ElectroMagn1D::incrementAvgFields(unsigned int time_step)
     Field1D* Bz1D_avg = static_cast<Field1D*>(Bz_avg);
     
     // for Ey^(p), Ez^(p) & Bx^(p)
-    for (unsigned int i=0 ; i<dimPrim[0] ; i++) {
+    for (unsigned int i=istart ; i<min(iend,dimPrim[0]) ; i++) {
         (*Ey1D_avg)(i) += (*Ey1D)(i);
         (*Ez1D_avg)(i) += (*Ez1D)(i);
         (*Bx1D_avg)(i) += (*Bx1D_m)(i);
     }
     
     // for Ex^(d), By^(d) & Bz^(d)
-    for (unsigned int i=0 ; i<dimDual[0] ; i++) {
+    for (unsigned int i=istart ; i<iend ; i++) {
         (*Ex1D_avg)(i) += (*Ex1D)(i);
         (*By1D_avg)(i) += (*By1D_m)(i);
         (*Bz1D_avg)(i) += (*Bz1D_m)(i);
@@ -424,7 +495,9 @@ void ElectroMagn1D::computeTotalRhoJ()
     Field1D* Jz1D    = static_cast<Field1D*>(Jz_);
     Field1D* rho1D   = static_cast<Field1D*>(rho_);
     
+    // Species depositing in their own densities (the others deposited in the total ones)
     for (unsigned int ispec=0; ispec<n_species; ispec++) {
+        if (!Jx_s[ispec]) continue;
         Field1D* Jx1D_s  = static_cast<Field1D*>(Jx_s[ispec]);
         Field1D* Jy1D_s  = static_cast<Field1D*>(Jy_s[ispec]);
         Field1D* Jz1D_s  = static_cast<Field1D*>(Jz_s[ispec]);
@@ -28,6 +28,11 @@ public:
     double compute_pAp();
     void update_pand_r(double r_dot_r, double p_dot_Ap);
     void update_p(double rnew_dot_rnew, double r_dot_r);
+    void initPoissonMultigrid();
+    double compute_rsum();
+    void precondition_r(double z_coarse);
+    double compute_rz();
+    void update_pz(double rznew_dot_rnew, double rz_dot_r);
     void initE(Patch *patch);
     void centeringE( std::vector<double> E_Add );
 
@@ -45,15 +50,19 @@ public:
     
     //! Method used to solve Maxwell-Ampere equation
     void solveMaxwellAmpere();
+    void solveMaxwellAmpere(unsigned int istart, unsigned int iend);
 
     //! Method used to save the Magnetic fields (used to center them)
     void saveMagneticFields();
+    void saveMagneticFields(unsigned int istart, unsigned int iend);
 
     //! Method used to center the Magnetic fields (used to push the particles)
     void centerMagneticFields();
+    void centerMagneticFields(unsigned int istart, unsigned int iend, unsigned int jstart, unsigned int jend);
     
     //! Method used to reset/increment the averaged fields
     void incrementAvgFields(unsigned int time_step);
+    void incrementAvgFields(unsigned int istart, unsigned int iend, unsigned int jstart, unsigned int jend);
     
     //! Method used to compute the total charge density and currents by summing over all species
     void computeTotalRhoJ();
@@ -7,9 +7,11 @@
 
 #include "Params.h"
 #include "Field2D.h"
+#include "PoissonMultigrid.h"
 
 #include "Patch.h"
 #include <cstring>
+#include <algorithm>
 
 #include "Profile.h"
 
@@ -84,16 +86,20 @@ isNorthern(patch->isNorthern())
     Jz_   = new Field2D(dimPrim, 2, false, "Jz");
     rho_  = new Field2D(dimPrim, "Rho" );
     
-    // Allocation of the time-averaged EM fields
-    Ex_avg  = new Field2D(dimPrim, 0, false, "Ex_avg");
-    Ey_avg  = new Field2D(dimPrim, 1, false, "Ey_avg");
-    Ez_avg  = new Field2D(dimPrim, 2, false, "Ez_avg");
-    Bx_avg  = new Field2D(dimPrim, 0, true,  "Bx_avg");
-    By_avg  = new Field2D(dimPrim, 1, true,  "By_avg");
-    Bz_avg  = new Field2D(dimPrim, 2, true,  "Bz_avg");
+    // Allocation of the time-averaged EM fields (only if a DiagFields averages them)
+    if (params.has_avg_fields) {
+        Ex_avg  = new Field2D(dimPrim, 0, false, "Ex_avg");
+        Ey_avg  = new Field2D(dimPrim, 1, false, "Ey_avg");
+        Ez_avg  = new Field2D(dimPrim, 2, false, "Ez_avg");
+        Bx_avg  = new Field2D(dimPrim, 0, true,  "Bx_avg");
+        By_avg  = new Field2D(dimPrim, 1, true,  "By_avg");
+        Bz_avg  = new Field2D(dimPrim, 2, true,  "Bz_avg");
+    }
     
-    // Charge currents currents and density for each species
+    // Charge currents currents and density for each species (only if a DiagFields outputs them,
+    // otherwise the species deposit directly in the total ones)
     for (unsigned int ispec=0; ispec<n_species; ispec++) {
+        if ( !params.speciesFieldsDumped(vecSpecies[ispec]->species_type) ) continue;
         Jx_s[ispec]  = new Field2D(dimPrim, 0, false, ("Jx_"+vecSpecies[ispec]->species_type).c_str());
         Jy_s[ispec]  = new Field2D(dimPrim, 1, false, ("Jy_"+vecSpecies[ispec]->species_type).c_str());
         Jz_s[ispec]  = new Field2D(dimPrim, 2, false, ("Jz_"+vecSpecies[ispec]->species_type).c_str());
@@ -208,6 +214,8 @@ void ElectroMagn2D::initPoisson(Patch *patch)
     r_   = new Field2D(dimPrim);    // residual vector
     p_   = new Field2D(dimPrim);    // direction vector
     Ap_  = new Field2D(dimPrim);    // A*p vector
+    z_   = NULL;
+    poissonMG_ = NULL;
 
     
     for (unsigned int i=0; i<nx_p; i++) {
@@ -325,6 +333,64 @@ void ElectroMagn2D::update_p(double rnew_dot_rnew, double r_dot_r)
     }
 } // update_p
 
+void ElectroMagn2D::initPoissonMultigrid()
+{
+    z_ = new Field2D(dimPrim);      // preconditioned residual
+    poissonMG_ = new PoissonMultigrid( index_max_p_[0]-index_min_p_[0]+1, index_max_p_[1]-index_min_p_[1]+1,
+                                       1.0/(dx*dx), 1.0/(dy*dy) );
+} // initPoissonMultigrid
+
+double ElectroMagn2D::compute_rsum()
+{
+    double r_sum_local(0.);
+    for (unsigned int i=index_min_p_[0]; i<=index_max_p_[0]; i++) {
+        for (unsigned int j=index_min_p_[1]; j<=index_max_p_[1]; j++) {
+            r_sum_local += (*r_)(i,j);
+        }
+    }
+    return r_sum_local;
+} // compute_rsum
+
+void ElectroMagn2D::precondition_r(double z_coarse)
+{
+    unsigned int i0 = index_min_p_[0];
+    unsigned int j0 = index_min_p_[1];
+    for (unsigned int i=i0; i<=index_max_p_[0]; i++) {
+        for (unsigned int j=j0; j<=index_max_p_[1]; j++) {
+            poissonMG_->rhs(i-i0,j-j0) = (*r_)(i,j);
+        }
+    }
+    poissonMG_->vcycle();
+    
+    z_->put_to(0.);
+    for (unsigned int i=i0; i<=index_max_p_[0]; i++) {
+        for (unsigned int j=j0; j<=index_max_p_[1]; j++) {
+            (*z_)(i,j) = poissonMG_->solution(i-i0,j-j0) + z_coarse;
+        }
+    }
+} // precondition_r
+
+double ElectroMagn2D::compute_rz()
+{
+    double r_dot_z_local(0.);
+    for (unsigned int i=index_min_p_[0]; i<=index_max_p_[0]; i++) {
+        for (unsigned int j=index_min_p_[1]; j<=index_max_p_[1]; j++) {
+            r_dot_z_local += (*r_)(i,j)*(*z_)(i,j);
+        }
+    }
+    return r_dot_z_local;
+} // compute_rz
+
+void ElectroMagn2D::update_pz(double rznew_dot_rnew, double rz_dot_r)
+{
+    double beta_k = rznew_dot_rnew/rz_dot_r;
+    for (unsigned int i=0; i<nx_p; i++) {
+        for(unsigned int j=0; j<ny_p; j++) {
+            (*p_)(i,j) = (*z_)(i,j) + beta_k * (*p_)(i,j);
+        }
+    }
+} // update_pz
+
 void ElectroMagn2D::initE(Patch *patch)
 {
     Field2D* Ex2D  = static_cast<Field2D*>(Ex_);
@@ -371,6 +437,8 @@ void ElectroMagn2D::initE(Patch *patch)
     delete r_;
     delete p_;
     delete Ap_;
+    if (z_) delete z_;
+    if (poissonMG_) delete poissonMG_;
 
 } // initE
 
@@ -402,6 +470,11 @@ void ElectroMagn2D::centeringE( std::vector<double> E_Add )
 // Save the former Magnetic-Fields (used to center them)
 // ---------------------------------------------------------------------------------------------------------------------
 void ElectroMagn2D::saveMagneticFields()
+{
+    saveMagneticFields( 0, nx_d );
+}
+
+void ElectroMagn2D::saveMagneticFields(unsigned int istart, unsigned int iend)
 {
     // Static cast of the fields
     Field2D* Bx2D   = static_cast<Field2D*>(Bx_);
@@ -411,33 +484,15 @@ void ElectroMagn2D::saveMagneticFields()
     Field2D* By2D_m = static_cast<Field2D*>(By_m);
     Field2D* Bz2D_m = static_cast<Field2D*>(Bz_m);
     
-    // Magnetic field Bx^(p,d)
-    for (unsigned int i=0 ; i<nx_p ; i++) {
-        memcpy(&((*Bx2D_m)(i,0)), &((*Bx2D)(i,0)),ny_d*sizeof(double) );
-        //for (unsigned int j=0 ; j<ny_d ; j++) {
-        //    (*Bx2D_m)(i,j)=(*Bx2D)(i,j);
-        //}
-    
-    // Magnetic field By^(d,p)
+    for (unsigned int i=istart ; i<iend ; i++) {
+        // Magnetic field Bx^(p,d)
+        if (i<nx_p)
+            memcpy(&((*Bx2D_m)(i,0)), &((*Bx2D)(i,0)),ny_d*sizeof(double) );
+        // Magnetic field By^(d,p)
         memcpy(&((*By2D_m)(i,0)), &((*By2D)(i,0)),ny_p*sizeof(double) );
-        //for (unsigned int j=0 ; j<ny_p ; j++) {
-        //    (*By2D_m)(i,j)=(*By2D)(i,j);
-        //}
-    
-    // Magnetic field Bz^(d,d)
+        // Magnetic field Bz^(d,d)
         memcpy(&((*Bz2D_m)(i,0)), &((*Bz2D)(i,0)),ny_d*sizeof(double) );
-        //for (unsigned int j=0 ; j<ny_d ; j++) {
-        //    (*Bz2D_m)(i,j)=(*Bz2D)(i,j);
-        //}
     }// end for i
-        memcpy(&((*By2D_m)(nx_p,0)), &((*By2D)(nx_p,0)),ny_p*sizeof(double) );
-        //for (unsigned int j=0 ; j<ny_p ; j++) {
-        //    (*By2D_m)(nx_p,j)=(*By2D)(nx_p,j);
-        //}
-        memcpy(&((*Bz2D_m)(nx_p,0)), &((*Bz2D)(nx_p,0)),ny_d*sizeof(double) );
-        //for (unsigned int j=0 ; j<ny_d ; j++) {
-        //    (*Bz2D_m)(nx_p,j)=(*Bz2D)(nx_p,j);
-        //}
     
 }//END saveMagneticFields
 
@@ -447,6 +502,15 @@ void ElectroMagn2D::saveMagneticFields()
 // Solve the Maxwell-Ampere equation
 // ---------------------------------------------------------------------------------------------------------------------
 void ElectroMagn2D::solveMaxwellAmpere()
+{
+    solveMaxwellAmpere( 0, nx_d );
+#ifdef _PATCH_DEBUG
+    cout << "\tEx = "  << Ex_->norm() << endl;
+    cout << "\tEy = "  << Ey_->norm() << endl;
+#endif
+}
+
+void ElectroMagn2D::solveMaxwellAmpere(unsigned int istart, unsigned int iend)
 {
     // Static-cast of the fields
     Field2D* Ex2D = static_cast<Field2D*>(Ex_);
@@ -458,32 +522,48 @@ void ElectroMagn2D::solveMaxwellAmpere()
     Field2D* Jx2D = static_cast<Field2D*>(Jx_);
     Field2D* Jy2D = static_cast<Field2D*>(Jy_);
     Field2D* Jz2D = static_cast<Field2D*>(Jz_);
-    // Electric field Ex^(d,p)
-    for (unsigned int i=0 ; i<nx_d ; i++) {
-        for (unsigned int j=0 ; j<ny_p ; j++) {
-            (*Ex2D)(i,j) += -timestep*(*Jx2D)(i,j) + dt_ov_dy * ( (*Bz2D)(i,j+1) - (*Bz2D)(i,j) );
+    // Rows are contiguous : the j loops run on flat pointers to the rows and are vectorized
+    // The row i of E only needs the rows i and i+1 of B
+    for (unsigned int i=istart ; i<iend ; i++) {
+        // Electric field Ex^(d,p)
+        {
+            double* __restrict__ Ex = &(*Ex2D)(i,0);
+            const double* __restrict__ Jx = &(*Jx2D)(i,0);
+            const double* __restrict__ Bz = &(*Bz2D)(i,0);
+            #pragma omp simd
+            for (unsigned int j=0 ; j<ny_p ; j++) {
+                Ex[j] += -timestep*Jx[j] + dt_ov_dy * ( Bz[j+1] - Bz[j] );
+            }
         }
-    }
-    
-    // Electric field Ey^(p,d)
-    for (unsigned int i=0 ; i<nx_p ; i++) {
-        for (unsigned int j=0 ; j<ny_d ; j++) {
-            (*Ey2D)(i,j) += -timestep*(*Jy2D)(i,j) - dt_ov_dx * ( (*Bz2D)(i+1,j) - (*Bz2D)(i,j) );
+        if (i>=nx_p) continue;
+        
+        // Electric field Ey^(p,d)
+        {
+            double* __restrict__ Ey = &(*Ey2D)(i,0);
+            const double* __restrict__ Jy  = &(*Jy2D)(i,0);
+            const double* __restrict__ Bz  = &(*Bz2D)(i,0);
+            const double* __restrict__ Bzp = &(*Bz2D)(i+1,0);
+            #pragma omp simd
+            for (unsigned int j=0 ; j<ny_d ; j++) {
+                Ey[j] += -timestep*Jy[j] - dt_ov_dx * ( Bzp[j] - Bz[j] );
+            }
         }
-    }
-    
-    // Electric field Ez^(p,p)
-    for (unsigned int i=0 ;  i<nx_p ; i++) {
-        for (unsigned int j=0 ; j<ny_p ; j++) {
-            (*Ez2D)(i,j) += -timestep*(*Jz2D)(i,j)
-            +               dt_ov_dx * ( (*By2D)(i+1,j) - (*By2D)(i,j) )
-            -               dt_ov_dy * ( (*Bx2D)(i,j+1) - (*Bx2D)(i,j) );
+        
+        // Electric field Ez^(p,p)
+        {
+            double* __restrict__ Ez = &(*Ez2D)(i,0);
+            const double* __restrict__ Jz  = &(*Jz2D)(i,0);
+            const double* __restrict__ By  = &(*By2D)(i,0);
+            const double* __restrict__ Byp = &(*By2D)(i+1,0);
+            const double* __restrict__ Bx  = &(*Bx2D)(i,0);
+            #pragma omp simd
+            for (unsigned int j=0 ; j<ny_p ; j++) {
+                Ez[j] += -timestep*Jz[j]
+                +               dt_ov_dx * ( Byp[j] - By[j] )
+                -               dt_ov_dy * ( Bx[j+1] - Bx[j] );
+            }
         }
     }
-#ifdef _PATCH_DEBUG
-    cout << "\tEx = "  << Ex_->norm() << endl;
-    cout << "\tEy = "  << Ey_->norm() << endl;
-#endif
 
 }//END solveMaxwellAmpere
 
@@ -492,6 +572,14 @@ void ElectroMagn2D::solveMaxwellAmpere()
 // Center the Magnetic Fields (used to push the particle)
 // ---------------------------------------------------------------------------------------------------------------------
 void ElectroMagn2D::centerMagneticFields()
+{
+    centerMagneticFields( 0, nx_d, 0, ny_d );
+#ifdef _PATCH_DEBUG
+    cout << "\tBz_m = "  << Bz_m->norm() << endl;
+#endif
+}
+
+void ElectroMagn2D::centerMagneticFields(unsigned int istart, unsigned int iend, unsigned int jstart, unsigned int jend)
 {
     // Static cast of the fields
     Field2D* Bx2D   = static_cast<Field2D*>(Bx_);
@@ -500,39 +588,39 @@ void ElectroMagn2D::centerMagneticFields()
     Field2D* Bx2D_m = static_cast<Field2D*>(Bx_m);
     Field2D* By2D_m = static_cast<Field2D*>(By_m);
     Field2D* Bz2D_m = static_cast<Field2D*>(Bz_m);
-    
-    // Magnetic field Bx^(p,d)
-    for (unsigned int i=0 ; i<nx_p ; i++) {
-        for (unsigned int j=0 ; j<ny_d ; j++) {
-            (*Bx2D_m)(i,j) = ( (*Bx2D)(i,j) + (*Bx2D_m)(i,j) )*0.5;
-        }
-//    }
-    
-    // Magnetic field By^(d,p)
-//    for (unsigned int i=0 ; i<nx_d ; i++) {
-        for (unsigned int j=0 ; j<ny_p ; j++) {
-            (*By2D_m)(i,j) = ( (*By2D)(i,j) + (*By2D_m)(i,j) )*0.5;
-        }
-//    }
-    
-    // Magnetic field Bz^(d,d)
-//    for (unsigned int i=0 ; i<nx_d ; i++) {
-        for (unsigned int j=0 ; j<ny_d ; j++) {
-            (*Bz2D_m)(i,j) = ( (*Bz2D)(i,j) + (*Bz2D_m)(i,j) )*0.5;
-        } // end for j
-      } // end for i
-        for (unsigned int j=0 ; j<ny_p ; j++) {
-            (*By2D_m)(nx_p,j) = ( (*By2D)(nx_p,j) + (*By2D_m)(nx_p,j) )*0.5;
-        }
-        for (unsigned int j=0 ; j<ny_d ; j++) {
-            (*Bz2D_m)(nx_p,j) = ( (*Bz2D)(nx_p,j) + (*Bz2D_m)(nx_p,j) )*0.5;
-        } // end for j
-/*    cout << "\tBx_m = "  << Bx_m->norm() << endl;
-      cout << "\tBy_m = "  << By_m->norm() << endl;*/
-#ifdef _PATCH_DEBUG
-    cout << "\tBz_m = "  << Bz_m->norm() << endl;
-#endif
-
+    unsigned int jend_p = min(jend, ny_p);
+    
+    for (unsigned int i=istart ; i<iend ; i++) {
+        // Magnetic field Bx^(p,d)
+        if (i<nx_p) {
+            double* __restrict__ Bxm = &(*Bx2D_m)(i,0);
+            const double* __restrict__ Bx = &(*Bx2D)(i,0);
+            #pragma omp simd
+            for (unsigned int j=jstart ; j<jend ; j++) {
+                Bxm[j] = ( Bx[j] + Bxm[j] )*0.5;
+            }
+        }
+        
+        // Magnetic field By^(d,p)
+        {
+            double* __restrict__ Bym = &(*By2D_m)(i,0);
+            const double* __restrict__ By = &(*By2D)(i,0);
+            #pragma omp simd
+            for (unsigned int j=jstart ; j<jend_p ; j++) {
+                Bym[j] = ( By[j] + Bym[j] )*0.5;
+            }
+        }
+        
+        // Magnetic field Bz^(d,d)
+        {
+            double* __restrict__ Bzm = &(*Bz2D_m)(i,0);
+            const double* __restrict__ Bz = &(*Bz2D)(i,0);
+            #pragma omp simd
+            for (unsigned int j=jstart ; j<jend ; j++) {
+                Bzm[j] = ( Bz[j] + Bzm[j] )*0.5;
+            }
+        }
+    } // end for i
     
 }//END centerMagneticFields
 
@@ -543,65 +631,31 @@ void ElectroMagn2D::centerMagneticFields()
 // ---------------------------------------------------------------------------------------------------------------------
 void ElectroMagn2D::incrementAvgFields(unsigned int time_step)
 {
-    // Static cast of the fields
-    Field2D* Ex2D     = static_cast<Field2D*>(Ex_);
-    Field2D* Ey2D     = static_cast<Field2D*>(Ey_);
-    Field2D* Ez2D     = static_cast<Field2D*>(Ez_);
-    Field2D* Bx2D_m   = static_cast<Field2D*>(Bx_m);
-    Field2D* By2D_m   = static_cast<Field2D*>(By_m);
-    Field2D* Bz2D_m   = static_cast<Field2D*>(Bz_m);
-    Field2D* Ex2D_avg = static_cast<Field2D*>(Ex_avg);
-    Field2D* Ey2D_avg = static_cast<Field2D*>(Ey_avg);
-    Field2D* Ez2D_avg = static_cast<Field2D*>(Ez_avg);
-    Field2D* Bx2D_avg = static_cast<Field2D*>(Bx_avg);
-    Field2D* By2D_avg = static_cast<Field2D*>(By_avg);
-    Field2D* Bz2D_avg = static_cast<Field2D*>(Bz_avg);
+    incrementAvgFields( 0, nx_d, 0, ny_d );
+}
+
+void ElectroMagn2D::incrementAvgFields(unsigned int istart, unsigned int iend, unsigned int jstart, unsigned int jend)
+{
+    // Fields and averaged fields, in the order Ex^(d,p), Ey^(p,d), Ez^(p,p), Bx^(p,d), By^(d,p), Bz^(d,d)
+    Field2D* F[6]     = { static_cast<Field2D*>(Ex_), static_cast<Field2D*>(Ey_), static_cast<Field2D*>(Ez_),
+                          static_cast<Field2D*>(Bx_m), static_cast<Field2D*>(By_m), static_cast<Field2D*>(Bz_m) };
+    Field2D* F_avg[6] = { static_cast<Field2D*>(Ex_avg), static_cast<Field2D*>(Ey_avg), static_cast<Field2D*>(Ez_avg),
+                          static_cast<Field2D*>(Bx_avg), static_cast<Field2D*>(By_avg), static_cast<Field2D*>(Bz_avg) };
     
     // increment the time-averaged fields
-    
-    // Electric field Ex^(d,p)
-    for (unsigned int i=0 ; i<nx_d ; i++) {
-        for (unsigned int j=0 ; j<ny_p ; j++) {
-            (*Ex2D_avg)(i,j) += (*Ex2D)(i,j);
-        }
-    }
-    
-    // Electric field Ey^(p,d)
-    for (unsigned int i=0 ; i<nx_p ; i++) {
-        for (unsigned int j=0 ; j<ny_d ; j++) {
-            (*Ey2D_avg)(i,j) += (*Ey2D)(i,j);
-        }
-    }
-    
-    // Electric field Ez^(p,p)
-    for (unsigned int i=0 ;  i<nx_p ; i++) {
-        for (unsigned int j=0 ; j<ny_p ; j++) {
-            (*Ez2D_avg)(i,j) += (*Ez2D)(i,j);
-        }
-    }
-    
-    // Magnetic field Bx^(p,d)
-    for (unsigned int i=0 ; i<nx_p ; i++) {
-        for (unsigned int j=0 ; j<ny_d ; j++) {
-            (*Bx2D_avg)(i,j) += (*Bx2D_m)(i,j);
-        }
-    }
-    
-    // Magnetic field By^(d,p)
-    for (unsigned int i=0 ; i<nx_d ; i++) {
-        for (unsigned int j=0 ; j<ny_p ; j++) {
-            (*By2D_avg)(i,j) += (*By2D_m)(i,j);
-        }
-    }
-    
-    // Magnetic field Bz^(d,d)
-    for (unsigned int i=0 ; i<nx_d ; i++) {
-        for (unsigned int j=0 ; j<ny_d ; j++) {
-            (*Bz2D_avg)(i,j) += (*Bz2D_m)(i,j);
+    for (unsigned int ifield=0 ; ifield<6 ; ifield++) {
+        unsigned int i1 = min( iend, F[ifield]->dims_[0] );
+        unsigned int j1 = min( jend, F[ifield]->dims_[1] );
+        for (unsigned int i=istart ; i<i1 ; i++) {
+            double* __restrict__ f_avg = &(*F_avg[ifield])(i,0);
+            const double* __restrict__ f = &(*F[ifield])(i,0);
+            #pragma omp simd
+            for (unsigned int j=jstart ; j<j1 ; j++) {
+                f_avg[j] += f[j];
+            }
         }
     }
     
-    
 }//END incrementAvgFields
 
 
@@ -621,33 +675,26 @@ void ElectroMagn2D::computeTotalRhoJ()
     // -----------------------------------
     // Species currents and charge density
     // -----------------------------------
+    // Species depositing in their own densities (the others deposited in the total ones)
     for (unsigned int ispec=0; ispec<n_species; ispec++) {
+        if (!Jx_s[ispec]) continue;
         Field2D* Jx2D_s  = static_cast<Field2D*>(Jx_s[ispec]);
         Field2D* Jy2D_s  = static_cast<Field2D*>(Jy_s[ispec]);
         Field2D* Jz2D_s  = static_cast<Field2D*>(Jz_s[ispec]);
         Field2D* rho2D_s = static_cast<Field2D*>(rho_s[ispec]);
         
-        // Charge density rho^(p,p) to 0
         for (unsigned int i=0 ; i<nx_p ; i++) {
             for (unsigned int j=0 ; j<ny_p ; j++) {
-                if(ispec==0){
-                    (*rho2D)(i,j) = 0.;
-                    (*Jx2D)(i,j)  = 0.;
-                    (*Jy2D)(i,j)  = 0.;
-                    (*Jz2D)(i,j)  = 0.;
-                }
                 (*rho2D)(i,j) += (*rho2D_s)(i,j);
                 (*Jx2D)(i,j) += (*Jx2D_s)(i,j);
                 (*Jy2D)(i,j) += (*Jy2D_s)(i,j);
                 (*Jz2D)(i,j) += (*Jz2D_s)(i,j);
             }
-            if(ispec==0) (*Jy2D)(i,ny_p) = 0. ;
             (*Jy2D)(i,ny_p) += (*Jy2D_s)(i,ny_p);
         }
         
         {
             for (unsigned int j=0 ; j<ny_p ; j++) {
-                if(ispec==0) (*Jx2D)(nx_p,j) = 0. ;
                 (*Jx2D)(nx_p,j) += (*Jx2D_s)(nx_p,j);
             }
         }
@@ -0,0 +1,213 @@
+#include "ElectroMagn3DRZ.h"
+
+#include <cmath>
+
+#include <sstream>
+#include <algorithm>
+
+#include "Params.h"
+#include "Field2D.h"
+#include "Patch.h"
+
+using namespace std;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor for ElectroMagn3DRZ
+// ---------------------------------------------------------------------------------------------------------------------
+ElectroMagn3DRZ::ElectroMagn3DRZ(Params &params, vector<Species*>& vecSpecies, Patch* patch) :
+  ElectroMagn2D(params, vecSpecies, patch)
+{
+    dr       = cell_length[1];
+    dt_ov_dr = timestep/dr;
+    dt_ov_dl = timestep/cell_length[0];
+
+    // Modes m>0 : Field*_mode_<m>_re and Field*_mode_<m>_im, with the staggering of the 2D components
+    string part_name[2] = { "_re", "_im" };
+    for (unsigned int m=1 ; m<params.nmodes ; m++) {
+        for (unsigned int p=0 ; p<2 ; p++) {
+            ostringstream suffix("");
+            suffix << "_mode_" << m << part_name[p];
+            string s = suffix.str();
+            modesE  .push_back( new Field2D(dimPrim, 0, false, "Ex"+s) );
+            modesE  .push_back( new Field2D(dimPrim, 1, false, "Ey"+s) );
+            modesE  .push_back( new Field2D(dimPrim, 2, false, "Ez"+s) );
+            modesB  .push_back( new Field2D(dimPrim, 0, true,  "Bx"+s) );
+            modesB  .push_back( new Field2D(dimPrim, 1, true,  "By"+s) );
+            modesB  .push_back( new Field2D(dimPrim, 2, true,  "Bz"+s) );
+            modesB_m.push_back( new Field2D(dimPrim, 0, true,  "Bx_m"+s) );
+            modesB_m.push_back( new Field2D(dimPrim, 1, true,  "By_m"+s) );
+            modesB_m.push_back( new Field2D(dimPrim, 2, true,  "Bz_m"+s) );
+            modesJ  .push_back( new Field2D(dimPrim, 0, false, "Jx"+s) );
+            modesJ  .push_back( new Field2D(dimPrim, 1, false, "Jy"+s) );
+            modesJ  .push_back( new Field2D(dimPrim, 2, false, "Jz"+s) );
+            modesRho.push_back( new Field2D(dimPrim, "Rho"+s) );
+        }
+    }
+
+    // Parts : the mode 0, then the modes m>0
+    unsigned int nparts = 1 + modesRho.size();
+    El_ .resize(nparts); Er_ .resize(nparts); Et_ .resize(nparts);
+    Bl_ .resize(nparts); Br_ .resize(nparts); Bt_ .resize(nparts);
+    Bl_m.resize(nparts); Br_m.resize(nparts); Bt_m.resize(nparts);
+    Jl_ .resize(nparts); Jr_ .resize(nparts); Jt_ .resize(nparts);
+    Rho_.resize(nparts);
+    for (unsigned int k=0 ; k<nparts ; k++) {
+        if (k==0) {
+            El_ [k] = static_cast<Field2D*>(Ex_ );
+            Er_ [k] = static_cast<Field2D*>(Ey_ );
+            Et_ [k] = static_cast<Field2D*>(Ez_ );
+            Bl_ [k] = static_cast<Field2D*>(Bx_ );
+            Br_ [k] = static_cast<Field2D*>(By_ );
+            Bt_ [k] = static_cast<Field2D*>(Bz_ );
+            Bl_m[k] = static_cast<Field2D*>(Bx_m);
+            Br_m[k] = static_cast<Field2D*>(By_m);
+            Bt_m[k] = static_cast<Field2D*>(Bz_m);
+            Jl_ [k] = static_cast<Field2D*>(Jx_ );
+            Jr_ [k] = static_cast<Field2D*>(Jy_ );
+            Jt_ [k] = static_cast<Field2D*>(Jz_ );
+            Rho_[k] = static_cast<Field2D*>(rho_);
+        } else {
+            unsigned int c = 3*(k-1);
+            El_ [k] = static_cast<Field2D*>(modesE  [c  ]);
+            Er_ [k] = static_cast<Field2D*>(modesE  [c+1]);
+            Et_ [k] = static_cast<Field2D*>(modesE  [c+2]);
+            Bl_ [k] = static_cast<Field2D*>(modesB  [c  ]);
+            Br_ [k] = static_cast<Field2D*>(modesB  [c+1]);
+            Bt_ [k] = static_cast<Field2D*>(modesB  [c+2]);
+            Bl_m[k] = static_cast<Field2D*>(modesB_m[c  ]);
+            Br_m[k] = static_cast<Field2D*>(modesB_m[c+1]);
+            Bt_m[k] = static_cast<Field2D*>(modesB_m[c+2]);
+            Jl_ [k] = static_cast<Field2D*>(modesJ  [c  ]);
+            Jr_ [k] = static_cast<Field2D*>(modesJ  [c+1]);
+            Jt_ [k] = static_cast<Field2D*>(modesJ  [c+2]);
+            Rho_[k] = static_cast<Field2D*>(modesRho[k-1]);
+        }
+    }
+
+    // Radii of the nodes : j_glob*dr (primal), (j_glob-1/2)*dr (dual)
+    int jglob0 = patch->getCellStartingGlobalIndex(1);
+    j_axis  = -jglob0;
+    j_first = max( 0, 1-jglob0 );
+    r_p.resize(ny_p); inv_r_p.resize(ny_p);
+    r_d.resize(ny_d); inv_r_d.resize(ny_d);
+    for (unsigned int j=0 ; j<ny_p ; j++) {
+        r_p[j] = (double)(jglob0+(int)j)*dr;
+        inv_r_p[j] = (jglob0+(int)j > 0) ? 1./r_p[j] : 0.;
+    }
+    for (unsigned int j=0 ; j<ny_d ; j++) {
+        r_d[j] = ((double)(jglob0+(int)j)-0.5)*dr;
+        inv_r_d[j] = (jglob0+(int)j > 0) ? 1./r_d[j] : 0.;
+    }
+
+}//END constructor Electromagn3DRZ
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor for Electromagn3DRZ (the modes are deleted by ElectroMagn)
+// ---------------------------------------------------------------------------------------------------------------------
+ElectroMagn3DRZ::~ElectroMagn3DRZ()
+{
+}//END ElectroMagn3DRZ
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Save the former Magnetic-Fields (used to center them)
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagn3DRZ::saveMagneticFields()
+{
+    for (unsigned int k=0 ; k<nparts() ; k++) {
+        Bl_m[k]->copyFrom( Bl_[k] );
+        Br_m[k]->copyFrom( Br_[k] );
+        Bt_m[k]->copyFrom( Bt_[k] );
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Solve the Maxwell-Ampere equation
+//   El += dt/(r dr) d(r Bt) + i m dt/r Br - dt Jl
+//   Er += -dt dBt/dl - i m dt/r Bl - dt Jr
+//   Et += dt dBr/dl - dt dBl/dr - dt Jt
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagn3DRZ::solveMaxwellAmpere()
+{
+    solveMaxwellAmpere( 0, nx_d );
+}
+
+void ElectroMagn3DRZ::solveMaxwellAmpere(unsigned int istart, unsigned int iend)
+{
+    const double* __restrict__ rd  = &r_d[0];
+    const double* __restrict__ irp = &inv_r_p[0];
+    const double* __restrict__ ird = &inv_r_d[0];
+
+    for (unsigned int k=0 ; k<nparts() ; k++) {
+        const double c_dt = imFactor(k)*timestep;
+        const unsigned int ko = partner(k);
+        // Rows are contiguous : the j loops run on flat pointers to the rows and are vectorized
+        for (unsigned int i=istart ; i<iend ; i++) {
+            // Electric field El^(d,p)
+            {
+                double* __restrict__ El = &(*El_[k])(i,0);
+                const double* __restrict__ Jl  = &(*Jl_[k])(i,0);
+                const double* __restrict__ Bt  = &(*Bt_[k])(i,0);
+                const double* __restrict__ Bro = &(*Br_[ko])(i,0);
+                #pragma omp simd
+                for (unsigned int j=j_first ; j<ny_p ; j++) {
+                    El[j] += -timestep*Jl[j] + dt_ov_dr*irp[j] * ( rd[j+1]*Bt[j+1] - rd[j]*Bt[j] )
+                    +        c_dt*irp[j] * Bro[j];
+                }
+            }
+            if (i>=nx_p) continue;
+
+            // Electric field Er^(p,d)
+            {
+                double* __restrict__ Er = &(*Er_[k])(i,0);
+                const double* __restrict__ Jr  = &(*Jr_[k])(i,0);
+                const double* __restrict__ Bt  = &(*Bt_[k])(i,0);
+                const double* __restrict__ Btp = &(*Bt_[k])(i+1,0);
+                const double* __restrict__ Blo = &(*Bl_[ko])(i,0);
+                #pragma omp simd
+                for (unsigned int j=j_first ; j<ny_d ; j++) {
+                    Er[j] += -timestep*Jr[j] - dt_ov_dl * ( Btp[j] - Bt[j] )
+                    -        c_dt*ird[j] * Blo[j];
+                }
+            }
+
+            // Electric field Et^(p,p)
+            {
+                double* __restrict__ Et = &(*Et_[k])(i,0);
+                const double* __restrict__ Jt  = &(*Jt_[k])(i,0);
+                const double* __restrict__ Br  = &(*Br_[k])(i,0);
+                const double* __restrict__ Brp = &(*Br_[k])(i+1,0);
+                const double* __restrict__ Bl  = &(*Bl_[k])(i,0);
+                #pragma omp simd
+                for (unsigned int j=j_first ; j<ny_p ; j++) {
+                    Et[j] += -timestep*Jt[j]
+                    +        dt_ov_dl * ( Brp[j] - Br[j] )
+                    -        dt_ov_dr * ( Bl[j+1] - Bl[j] );
+                }
+            }
+        }
+    }
+
+}//END solveMaxwellAmpere
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Center the Magnetic Fields (used to push the particle)
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagn3DRZ::centerMagneticFields()
+{
+    for (unsigned int k=0 ; k<nparts() ; k++) {
+        Field2D* B [3] = { Bl_ [k], Br_ [k], Bt_ [k] };
+        Field2D* Bm[3] = { Bl_m[k], Br_m[k], Bt_m[k] };
+        for (unsigned int c=0 ; c<3 ; c++) {
+            double* __restrict__ bm = Bm[c]->data_;
+            const double* __restrict__ b = B[c]->data_;
+            unsigned int n = B[c]->globalDims_;
+            #pragma omp simd
+            for (unsigned int i=0 ; i<n ; i++)
+                bm[i] = ( b[i] + bm[i] )*0.5;
+        }
+    }
+}
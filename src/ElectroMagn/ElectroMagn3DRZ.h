@@ -0,0 +1,61 @@
+#ifndef ELECTROMAGN3DRZ_H
+#define ELECTROMAGN3DRZ_H
+
+#include "ElectroMagn2D.h"
+#include "Field2D.h"
+
+class Params;
+
+//! class ElectroMagn3DRZ containing the electromagnetic fields & currents for 3drz simulations
+//!   - the fields are decomposed in azimuthal modes F = sum_m Re[ F_m exp(-i m theta) ] on the 2D grid (l=x, r=y)
+//!   - the components l, r, theta are stored as x, y, z with the same staggering as in 2d3v : the real mode 0 in
+//!     Ex_ ... rho_ (all the 2D methods apply to it), the modes m>0 in ElectroMagn::modesE ...
+//!   - a part k is the mode 0 (k=0) or the real (k=2m-1) or imaginary (k=2m) part of the mode m>0
+//!   - the axis r=0 is the primal node j_axis of the southern patches
+class ElectroMagn3DRZ : public ElectroMagn2D
+{
+public:
+    //! Constructor for ElectroMagn3DRZ
+    ElectroMagn3DRZ(Params &params, std::vector<Species*>& vecSpecies, Patch* patch);
+
+    //! Destructor for ElectroMagn3DRZ
+    ~ElectroMagn3DRZ();
+
+    //! Maxwell-Ampere equation for all the modes on the nodes off the axis (see ElectroMagnBC3DRZ_Axis)
+    void solveMaxwellAmpere();
+    void solveMaxwellAmpere(unsigned int istart, unsigned int iend);
+
+    //! Save and center the magnetic fields of all the modes
+    void saveMagneticFields();
+    void centerMagneticFields();
+
+    //! Number of parts : the mode 0, the real and imaginary parts of the modes m>0
+    inline unsigned int nparts() { return El_.size(); }
+    //! Azimuthal number of the part k
+    inline unsigned int mode( unsigned int k ) { return (k+1)/2; }
+    //! Part coupled to k by the derivative along theta : d/dtheta = -i m, and i m (re, im) = (-m im, m re)
+    inline unsigned int partner( unsigned int k ) { return k==0 ? 0 : ( k%2 ? k+1 : k-1 ); }
+    inline double imFactor( unsigned int k ) { return k==0 ? 0. : ( k%2 ? -(double)mode(k) : (double)mode(k) ); }
+
+    //! Components l, r, theta of the fields, currents and density of each part
+    std::vector<Field2D*> El_, Er_, Et_;
+    std::vector<Field2D*> Bl_, Br_, Bt_;
+    std::vector<Field2D*> Bl_m, Br_m, Bt_m;
+    std::vector<Field2D*> Jl_, Jr_, Jt_;
+    std::vector<Field2D*> Rho_;
+
+    //! Radii of the primal and dual nodes of the patch, and their inverse (0 for the nodes at r<=0)
+    std::vector<double> r_p, r_d, inv_r_p, inv_r_d;
+    //! First primal and dual node of the patch above the axis (global index >= 1), the ones below are set by the
+    //! axis condition
+    unsigned int j_first;
+    //! Local index of the axis (meaningful only if the patch is southern)
+    int j_axis;
+
+    //! Radial step
+    double dr;
+    double dt_ov_dr;
+    double dt_ov_dl;
+};
+
+#endif
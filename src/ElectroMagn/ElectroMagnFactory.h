@@ -5,11 +5,13 @@
 #include "ElectroMagn.h"
 #include "ElectroMagn1D.h"
 #include "ElectroMagn2D.h"
+#include "ElectroMagn3DRZ.h"
 #include "ElectroMagnBC.h"
 
 #include "Patch.h"
 #include "Params.h"
 #include "Laser.h"
+#include "LaserEnvelope2D.h"
 #include "Tools.h"
 
 class ElectroMagnFactory {
@@ -22,6 +24,9 @@ public:
         else if ( params.geometry == "2d3v" ) {
             EMfields = new ElectroMagn2D(params, vecSpecies, patch);
         }
+        else if ( params.geometry == "3drz" ) {
+            EMfields = new ElectroMagn3DRZ(params, vecSpecies, patch);
+        }
         else {
             ERROR( "Unknown geometry : " << params.geometry );
         }
@@ -33,7 +38,11 @@ public:
         int nlaser = PyTools::nComponents("Laser");
         for (int ilaser = 0; ilaser < nlaser; ilaser++) {
             Laser * laser = new Laser(params, ilaser, patch);
-            if     ( laser->boxSide == "west" && EMfields->emBoundCond[0]) {
+            if     ( laser->envelope ) {
+                // Injected by the envelope solver, not by the boundary conditions on B
+                EMfields->envelope = new LaserEnvelope2D(params, patch, laser);
+            }
+            else if( laser->boxSide == "west" && EMfields->emBoundCond[0]) {
                 if( patch->isWestern() ) laser->createFields(params, patch);
                 EMfields->emBoundCond[0]->vecLaser.push_back( laser );
             }
@@ -112,6 +121,8 @@ public:
             newEMfields = new ElectroMagn1D(params, vecSpecies, patch);
         } else if ( params.geometry == "2d3v" ) {
             newEMfields = new ElectroMagn2D(params, vecSpecies, patch);
+        } else if ( params.geometry == "3drz" ) {
+            newEMfields = new ElectroMagn3DRZ(params, vecSpecies, patch);
         }
         
         // -----------------
@@ -136,6 +147,12 @@ public:
             }
         }
         
+        // -----------------
+        // Clone laser envelope
+        // -----------------
+        if( EMfields->envelope )
+            newEMfields->envelope = new LaserEnvelope2D(EMfields->envelope, params, patch);
+        
         // -----------------
         // Clone ExtFields properties
         // -----------------
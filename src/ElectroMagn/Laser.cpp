@@ -22,6 +22,9 @@ Laser::Laser(Params &params, int ilaser, Patch* patch)
         ERROR(errorPrefix << ": boxSide must be `west` or `east`");
     }
     
+    envelope = false;
+    PyTools::extract("envelope",envelope,"Laser",ilaser);
+    
     // Profiles
     profiles.resize(0);
     PyObject *chirp_profile, *time_profile;
@@ -39,6 +42,9 @@ Laser::Laser(Params &params, int ilaser, Patch* patch)
     spacetime.resize(2, false);
     if( space_time ) {
         
+        if( envelope )
+            ERROR(errorPrefix << ": a laser with envelope = True must be defined by its envelopes, not by space_time_profile");
+        
         spacetime[0] = (bool)(space_time_profile[0]);
         spacetime[1] = (bool)(space_time_profile[1]);
         
@@ -59,7 +65,7 @@ Laser::Laser(Params &params, int ilaser, Patch* patch)
         name << "Laser[" << ilaser <<"].space_time_profile[0]";
         if( spacetime[0] ) {
             p = new Profile(space_time_profile[0], params.nDim_field, name.str());
-            profiles.push_back( new LaserProfileNonSeparable(p) );
+            profiles.push_back( new LaserProfileNonSeparable(p, true) );
             info << "\t\t\tfirst  axis : " << p->getInfo() << endl;
         } else {
             profiles.push_back( new LaserProfileNULL() );
@@ -70,7 +76,7 @@ Laser::Laser(Params &params, int ilaser, Patch* patch)
         name << "Laser[" << ilaser <<"].space_time_profile[1]";
         if( spacetime[1] ) {
             p = new Profile(space_time_profile[1], params.nDim_field, name.str());
-            profiles.push_back( new LaserProfileNonSeparable(p) );
+            profiles.push_back( new LaserProfileNonSeparable(p, false) );
             info << "\t\t\tsecond axis : " << p->getInfo();
         } else {
             profiles.push_back( new LaserProfileNULL() );
@@ -90,7 +96,7 @@ Laser::Laser(Params &params, int ilaser, Patch* patch)
         if( !phase )
             ERROR(errorPrefix << ": missing `phase`");
         
-        info << "\t\t" << errorPrefix << ": custom profile" << endl;
+        info << "\t\t" << errorPrefix << ": custom profile" << (envelope?" (envelope model)":"") << endl;
         
         bool space_dims = params.geometry=="3d3v" ? 2 : 1;
         
@@ -150,6 +156,7 @@ Laser::Laser(Params &params, int ilaser, Patch* patch)
 Laser::Laser(Laser* laser, Params& params)
 {
     boxSide   = laser->boxSide;
+    envelope  = laser->envelope;
     spacetime = laser->spacetime;
     profiles.resize(0);
     if( spacetime[0] || spacetime[1] ) {
@@ -233,7 +240,7 @@ void LaserProfileSeparable::createFields(Params& params, Patch* patch)
         space_envelope = new Field1D(dim);
         phase          = new Field1D(dim);
         
-    } else if( params.geometry=="2d3v" ) {
+    } else if( params.geometry=="2d3v" || params.geometry=="3drz" ) {
         
         unsigned int ny_p = params.n_space[1]+1+2*params.oversize[1];
         unsigned int ny_d = ny_p+1;
@@ -244,6 +251,8 @@ void LaserProfileSeparable::createFields(Params& params, Patch* patch)
         phase          = new Field1D(dim);
         
     }
+    retarded_time.resize(space_envelope->dims_[0]);
+    time_envelope.resize(space_envelope->dims_[0]);
 }
 
 void LaserProfileSeparable::initFields(Params& params, Patch* patch)
@@ -256,7 +265,7 @@ void LaserProfileSeparable::initFields(Params& params, Patch* patch)
         (*space_envelope)(0) = spaceProfile->valueAt(yp);
         (*phase         )(0) = phaseProfile->valueAt(yp);
         
-    } else if( params.geometry=="2d3v" ) {
+    } else if( params.geometry=="2d3v" || params.geometry=="3drz" ) {
         
         unsigned int ny_p = params.n_space[1]+1+2*params.oversize[1];
         unsigned int ny_d = ny_p+1;
@@ -286,6 +295,72 @@ double LaserProfileSeparable::getAmplitude(std::vector<double> pos, double t, in
            * sin( omega_*t - (*phase)(j) );
 }
 
+// Amplitudes of a separable laser profile on all the cells of the border.
+// The chirp is evaluated once. The time envelope is evaluated once if the phase is uniform
+// (the usual case), otherwise once on the array of retarded times.
+void LaserProfileSeparable::addAmplitudes(double t, std::vector<double> &amplitudes)
+{
+    unsigned int n = amplitudes.size();
+    double omega_ = omega * chirpProfile->valueAt(t);
+    double * env = &((*space_envelope)(0));
+    double * phi = &((*phase)(0));
+    
+    bool uniform_phase = true;
+    for (unsigned int j=1 ; j<n ; j++) {
+        if( phi[j] != phi[0] ) {
+            uniform_phase = false;
+            break;
+        }
+    }
+    
+    if( uniform_phase ) {
+        double a = timeProfile->valueAt(t - phi[0]/omega_) * sin( omega_*t - phi[0] );
+        for (unsigned int j=0 ; j<n ; j++)
+            amplitudes[j] += a * env[j];
+    } else {
+        for (unsigned int j=0 ; j<n ; j++)
+            retarded_time[j] = t - phi[j]/omega_;
+        timeProfile->valuesAt(retarded_time, time_envelope);
+        for (unsigned int j=0 ; j<n ; j++)
+            amplitudes[j] += time_envelope[j] * env[j] * sin( omega_*t - phi[j] );
+    }
+}
+
+
+void LaserProfileNonSeparable::createFields(Params& params, Patch* patch)
+{
+    if( params.geometry=="1d3v" ) {
+        
+        // only one point in 1D
+        coordinates.resize(1, vector<double>(1, 0.));
+        
+    } else if( params.geometry=="2d3v" || params.geometry=="3drz" ) {
+        
+        unsigned int ny_p = params.n_space[1]+1+2*params.oversize[1];
+        unsigned int ny_d = ny_p+1;
+        double dy = params.cell_length[1];
+        unsigned int n = primal ? ny_p : ny_d;
+        
+        // same positions as the arrays of LaserProfileSeparable::initFields
+        coordinates.resize(1, vector<double>(n));
+        double yp = patch->getDomainLocalMin(1) - ((primal?0.:0.5) + params.oversize[1])*dy;
+        for (unsigned int j=0 ; j<n ; j++) {
+            yp += dy;
+            coordinates[0][j] = yp;
+        }
+        
+    }
+    values.resize(coordinates[0].size());
+}
+
+// Amplitudes of a non-separable laser profile on all the cells of the border, in one call
+void LaserProfileNonSeparable::addAmplitudes(double t, std::vector<double> &amplitudes)
+{
+    spaceAndTimeProfile->valuesAt(coordinates, t, values);
+    for (unsigned int j=0 ; j<amplitudes.size() ; j++)
+        amplitudes[j] += values[j];
+}
+
 //Destructor
 LaserProfileNonSeparable::~LaserProfileNonSeparable()
 {
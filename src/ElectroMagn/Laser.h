@@ -23,6 +23,8 @@ public:
     LaserProfile() {};
     ~LaserProfile() {};
     virtual double getAmplitude(std::vector<double> pos, double t, int j) {return 0.;};
+    //! Adds the amplitudes at time t to all the cells of the border (arrays created by createFields)
+    virtual void addAmplitudes(double t, std::vector<double> &amplitudes) {};
     virtual std::string getInfo() { return "?"; };
     virtual void createFields(Params& params, Patch* patch) {};
     virtual void initFields  (Params& params, Patch* patch) {};
@@ -34,6 +36,7 @@ public:
 //  --------------------------------------------------------------------------------------------------------------------
 class Laser {
 friend class SmileiMPI;
+friend class LaserEnvelope2D;
 public:
     //! Normal laser constructor
     Laser(Params &params, int ilaser, Patch* patch);
@@ -50,6 +53,14 @@ public:
     inline double getAmplitude1(std::vector<double> pos, double t, int j) {
         return profiles[1]->getAmplitude(pos, t, j);
     }
+    //! Adds the amplitudes of all the cells of the border at time t (By, primal in y)
+    inline void addAmplitudes0(double t, std::vector<double> &amplitudes) {
+        profiles[0]->addAmplitudes(t, amplitudes);
+    }
+    //! Adds the amplitudes of all the cells of the border at time t (Bz, dual in y)
+    inline void addAmplitudes1(double t, std::vector<double> &amplitudes) {
+        profiles[1]->addAmplitudes(t, amplitudes);
+    }
     
     void createFields(Params& params, Patch* patch)
     {
@@ -65,6 +76,9 @@ public:
     //! Side (west/east) from which the laser enters the box
     std::string boxSide;
     
+    //! Laser described by its envelope (see LaserEnvelope2D) instead of the boundary conditions on B
+    bool envelope;
+    
     //! Disables the laser
     void disable();
     
@@ -83,6 +97,7 @@ private:
 // Laser profile for separable space and time
 class LaserProfileSeparable : public LaserProfile {
 friend class SmileiMPI;
+friend class LaserEnvelope2D;
 public:
     LaserProfileSeparable(double, Profile*, Profile*, Profile*, Profile*, bool);
     LaserProfileSeparable(LaserProfileSeparable*);
@@ -90,27 +105,37 @@ public:
     void createFields(Params& params, Patch* patch);
     void initFields  (Params& params, Patch* patch);
     double getAmplitude(std::vector<double> pos, double t, int j);
+    void addAmplitudes(double t, std::vector<double> &amplitudes);
 private:
     bool primal;
     double omega;
     Profile *timeProfile, *chirpProfile, *spaceProfile, *phaseProfile;
     Field *space_envelope, *phase;
+    //! Buffers for the time envelope when the phase is not uniform
+    std::vector<double> retarded_time, time_envelope;
 };
 
 // Laser profile for non-separable space and time
 class LaserProfileNonSeparable : public LaserProfile {
 friend class SmileiMPI;
 public:
-    LaserProfileNonSeparable(Profile * spaceAndTimeProfile)
-     : spaceAndTimeProfile(spaceAndTimeProfile) {};
+    LaserProfileNonSeparable(Profile * spaceAndTimeProfile, bool primal)
+     : spaceAndTimeProfile(spaceAndTimeProfile), primal(primal) {};
     LaserProfileNonSeparable(LaserProfileNonSeparable* lp)
-     : spaceAndTimeProfile(lp->spaceAndTimeProfile) {};
+     : spaceAndTimeProfile(lp->spaceAndTimeProfile), primal(lp->primal) {};
     ~LaserProfileNonSeparable();
+    void createFields(Params& params, Patch* patch);
     inline double getAmplitude(std::vector<double> pos, double t, int j) {
         return spaceAndTimeProfile->valueAt(pos, t);
     }
+    void addAmplitudes(double t, std::vector<double> &amplitudes);
 private:
     Profile * spaceAndTimeProfile;
+    bool primal;
+    //! Transverse coordinates of the border cells, coordinates[idim][j]
+    std::vector<std::vector<double> > coordinates;
+    //! Buffer for the profile values
+    std::vector<double> values;
 };
 
 // Null laser profile
@@ -0,0 +1,238 @@
+#include "LaserEnvelope2D.h"
+
+#include <cmath>
+#include <algorithm>
+
+#include "Params.h"
+#include "Patch.h"
+#include "Laser.h"
+#include "Field2D.h"
+#include "Profile.h"
+#include "Tools.h"
+
+using namespace std;
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor for LaserEnvelope2D
+// ---------------------------------------------------------------------------------------------------------------------
+LaserEnvelope2D::LaserEnvelope2D(Params& params, Patch* patch, Laser* laser) :
+    laser( laser ),
+    laser_active( true )
+{
+    init( params, patch );
+}
+
+// Cloning constructor
+LaserEnvelope2D::LaserEnvelope2D(LaserEnvelope2D* envelope, Params& params, Patch* patch) :
+    laser( new Laser(envelope->laser, params) ),
+    laser_active( envelope->laser_active )
+{
+    init( params, patch );
+}
+
+LaserEnvelope2D::~LaserEnvelope2D()
+{
+    delete laser;
+    delete A_re;
+    delete A_im;
+    delete A0_re;
+    delete A0_im;
+    delete Phi;
+    delete GradPhi_x;
+    delete GradPhi_y;
+    delete Chi;
+}
+
+
+void LaserEnvelope2D::init(Params& params, Patch* patch)
+{
+    LaserProfileSeparable* profile_y = static_cast<LaserProfileSeparable*>( laser->profiles[0] );
+    LaserProfileSeparable* profile_z = static_cast<LaserProfileSeparable*>( laser->profiles[1] );
+    k0 = profile_y->omega;
+    dt = params.timestep;
+    dx = params.cell_length[0];
+    dy = params.cell_length[1];
+    oversize_x = params.oversize[0];
+    oversize_y = params.oversize[1];
+
+    // All fields on the primal grid
+    vector<unsigned int> dimPrim(2);
+    dimPrim[0] = params.n_space[0]+1+2*params.oversize[0];
+    dimPrim[1] = params.n_space[1]+1+2*params.oversize[1];
+    A_re      = new Field2D(dimPrim, "Env_A_re"     );
+    A_im      = new Field2D(dimPrim, "Env_A_im"     );
+    A0_re     = new Field2D(dimPrim, "Env_A0_re"    );
+    A0_im     = new Field2D(dimPrim, "Env_A0_im"    );
+    Phi       = new Field2D(dimPrim, "Env_Phi"      );
+    GradPhi_x = new Field2D(dimPrim, "Env_GradPhi_x");
+    GradPhi_y = new Field2D(dimPrim, "Env_GradPhi_y");
+    Chi       = new Field2D(dimPrim, "Env_Chi"      );
+
+    if ( !patch->isWestern() ) return;
+
+    // Injected envelope : the two polarizations are combined in |A|^2 = (Sy^2 + Sz^2)/omega^2 (B = omega a),
+    // with the phase of the dominant one
+    unsigned int ny = dimPrim[1];
+    injection_amplitude.resize( ny );
+    injection_phase    .resize( ny );
+    retarded_time      .resize( ny );
+    time_envelope      .resize( ny );
+    vector<double> y(1);
+    for (unsigned int j=0 ; j<ny ; j++) {
+        y[0] = patch->getDomainLocalMin(1) + ( (double)j - (double)oversize_y )*dy;
+        double Sy = profile_y->spaceProfile->valueAt( y );
+        double Sz = profile_z->spaceProfile->valueAt( y );
+        injection_amplitude[j] = sqrt( Sy*Sy + Sz*Sz ) / k0;
+        injection_phase    [j] = ( abs(Sy) >= abs(Sz) ? profile_y : profile_z )->phaseProfile->valueAt( y );
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Explicit step of the envelope equation : the new envelope is computed in A0 (it only needs A0 at the same node),
+// then A and A0 are swapped
+// ---------------------------------------------------------------------------------------------------------------------
+void LaserEnvelope2D::compute()
+{
+    unsigned int nx = A_re->dims_[0];
+    unsigned int ny = A_re->dims_[1];
+
+    // (1 + i k0 dt) / (1 + k0^2 dt^2) = cr + i ci
+    const double cr = 1./( 1. + k0*k0*dt*dt );
+    const double ci = k0*dt*cr;
+    const double k0dt = k0*dt;
+    const double dt2 = dt*dt;
+    const double dt2_ov_dx2 = dt2/(dx*dx);
+    const double dt2_ov_dy2 = dt2/(dy*dy);
+    // 2 i k0 dt^2 dA/dx = i k0 dt^2/dx ( A(i+1)-A(i-1) )
+    const double k0dt2_ov_dx = k0*dt2/dx;
+
+    for (unsigned int i=1 ; i<nx-1 ; i++) {
+        const double* __restrict__ ar   = &(A_re->data_[ i   *ny]);
+        const double* __restrict__ ai   = &(A_im->data_[ i   *ny]);
+        const double* __restrict__ ar_m = &(A_re->data_[(i-1)*ny]);
+        const double* __restrict__ ai_m = &(A_im->data_[(i-1)*ny]);
+        const double* __restrict__ ar_p = &(A_re->data_[(i+1)*ny]);
+        const double* __restrict__ ai_p = &(A_im->data_[(i+1)*ny]);
+        const double* __restrict__ chi  = &(Chi ->data_[ i   *ny]);
+        double* __restrict__ a0r = &(A0_re->data_[i*ny]);
+        double* __restrict__ a0i = &(A0_im->data_[i*ny]);
+        #pragma omp simd
+        for (unsigned int j=1 ; j<ny-1 ; j++) {
+            double rhs_r = dt2_ov_dx2*( ar_p[j] - 2.*ar[j] + ar_m[j] ) + dt2_ov_dy2*( ar[j+1] - 2.*ar[j] + ar[j-1] )
+                         - k0dt2_ov_dx*( ai_p[j] - ai_m[j] ) - dt2*chi[j]*ar[j]
+                         + 2.*ar[j] - ( a0r[j] - k0dt*a0i[j] );
+            double rhs_i = dt2_ov_dx2*( ai_p[j] - 2.*ai[j] + ai_m[j] ) + dt2_ov_dy2*( ai[j+1] - 2.*ai[j] + ai[j-1] )
+                         + k0dt2_ov_dx*( ar_p[j] - ar_m[j] ) - dt2*chi[j]*ai[j]
+                         + 2.*ai[j] - ( a0i[j] + k0dt*a0r[j] );
+            a0r[j] = cr*rhs_r - ci*rhs_i;
+            a0i[j] = ci*rhs_r + cr*rhs_i;
+        }
+    }
+
+    // The outer layer keeps the former values of A0, replaced by the exchange or the boundary conditions
+    swap_ranges( A_re->data_, A_re->data_+A_re->globalDims_, A0_re->data_ );
+    swap_ranges( A_im->data_, A_im->data_+A_im->globalDims_, A0_im->data_ );
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Boundary conditions of the envelope on the borders of the box
+// ---------------------------------------------------------------------------------------------------------------------
+void LaserEnvelope2D::boundaryConditions(Patch* patch, double t)
+{
+    unsigned int nx = A_re->dims_[0];
+    unsigned int ny = A_re->dims_[1];
+    double* ar = A_re->data_;
+    double* ai = A_im->data_;
+
+    if ( patch->isWestern() ) {
+        for (unsigned int k=0 ; k<oversize_x*ny ; k++) {
+            ar[k] = 0.;
+            ai[k] = 0.;
+        }
+        // a = T(t-phi/omega) S sin(omega t - phi) = Re[ i T S exp(i phi) exp(-i omega t) ] at x = 0
+        if ( laser_active && injection_amplitude.size() ) {
+            LaserProfileSeparable* profile = static_cast<LaserProfileSeparable*>( laser->profiles[0] );
+            double* ar_b = &ar[oversize_x*ny];
+            double* ai_b = &ai[oversize_x*ny];
+            bool uniform_phase = true;
+            for (unsigned int j=1 ; j<ny ; j++) {
+                if ( injection_phase[j] != injection_phase[0] ) {
+                    uniform_phase = false;
+                    break;
+                }
+            }
+            if ( uniform_phase ) {
+                time_envelope.assign( ny, profile->timeProfile->valueAt( t - injection_phase[0]/k0 ) );
+            } else {
+                for (unsigned int j=0 ; j<ny ; j++)
+                    retarded_time[j] = t - injection_phase[j]/k0;
+                profile->timeProfile->valuesAt( retarded_time, time_envelope );
+            }
+            for (unsigned int j=0 ; j<ny ; j++) {
+                double a = time_envelope[j] * injection_amplitude[j];
+                ar_b[j] = -a * sin( injection_phase[j] );
+                ai_b[j] =  a * cos( injection_phase[j] );
+            }
+        }
+    }
+
+    if ( patch->isEastern() ) {
+        for (unsigned int k=(nx-oversize_x)*ny ; k<nx*ny ; k++) {
+            ar[k] = 0.;
+            ai[k] = 0.;
+        }
+    }
+
+    if ( patch->isSouthern() ) {
+        for (unsigned int i=0 ; i<nx ; i++) {
+            for (unsigned int j=0 ; j<oversize_y ; j++) {
+                ar[i*ny+j] = 0.;
+                ai[i*ny+j] = 0.;
+            }
+        }
+    }
+
+    if ( patch->isNorthern() ) {
+        for (unsigned int i=0 ; i<nx ; i++) {
+            for (unsigned int j=ny-oversize_y ; j<ny ; j++) {
+                ar[i*ny+j] = 0.;
+                ai[i*ny+j] = 0.;
+            }
+        }
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Phi = |A|^2/2 on all the nodes, centered gradient on the interior nodes
+// ---------------------------------------------------------------------------------------------------------------------
+void LaserEnvelope2D::computePhi()
+{
+    unsigned int nx = A_re->dims_[0];
+    unsigned int ny = A_re->dims_[1];
+    const double* __restrict__ ar = A_re->data_;
+    const double* __restrict__ ai = A_im->data_;
+    double* __restrict__ phi = Phi->data_;
+
+    #pragma omp simd
+    for (unsigned int k=0 ; k<nx*ny ; k++)
+        phi[k] = 0.5*( ar[k]*ar[k] + ai[k]*ai[k] );
+
+    const double one_ov_2dx = 0.5/dx;
+    const double one_ov_2dy = 0.5/dy;
+    for (unsigned int i=1 ; i<nx-1 ; i++) {
+        const double* __restrict__ phi_i = &phi[ i   *ny];
+        const double* __restrict__ phi_m = &phi[(i-1)*ny];
+        const double* __restrict__ phi_p = &phi[(i+1)*ny];
+        double* __restrict__ gx = &(GradPhi_x->data_[i*ny]);
+        double* __restrict__ gy = &(GradPhi_y->data_[i*ny]);
+        #pragma omp simd
+        for (unsigned int j=1 ; j<ny-1 ; j++) {
+            gx[j] = one_ov_2dx*( phi_p[j] - phi_m[j] );
+            gy[j] = one_ov_2dy*( phi_i[j+1] - phi_i[j-1] );
+        }
+    }
+}
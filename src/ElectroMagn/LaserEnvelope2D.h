@@ -0,0 +1,73 @@
+/*! @file LaserEnvelope2D.h
+
+ @brief LaserEnvelope2D.h  complex envelope of a laser on the primal grid of a 2D patch
+
+ The laser vector potential is a = Re[ A exp( i k0 (x-t) ) ], with k0 the laser frequency. The envelope A obeys
+     lap A - d2A/dt2 + 2 i k0 ( dA/dx + dA/dt ) = chi A
+ where chi = sum of q^2 w / (m gamma) over the particles with ponderomotive dynamics (see Projector::susceptibility).
+ It is advanced by the explicit centered scheme
+     A(n+1) = (1 + i k0 dt)/(1 + k0^2 dt^2) [ dt^2 ( lap A + 2 i k0 dA/dx - chi A ) + 2 A - (1 + i k0 dt) A(n-1) ]
+ so that the grid only needs to resolve the envelope, not the wavelength.
+ */
+
+#ifndef LASERENVELOPE2D_H
+#define LASERENVELOPE2D_H
+
+#include <vector>
+
+class Params;
+class Patch;
+class Laser;
+class Field2D;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class LaserEnvelope2D
+//!   - the envelope is injected on the first node of the western border (Dirichlet condition), from the separable
+//!     profile of the Laser block with envelope = True
+//!   - it is set to 0 in the guard cells of the other borders of the box (reflecting borders)
+//!   - Phi = |A|^2/2 is the cycle-averaged ponderomotive potential of the particles
+//  --------------------------------------------------------------------------------------------------------------------
+class LaserEnvelope2D
+{
+public:
+    //! Creator for LaserEnvelope2D (takes ownership of the laser)
+    LaserEnvelope2D(Params& params, Patch* patch, Laser* laser);
+    //! Cloning constructor
+    LaserEnvelope2D(LaserEnvelope2D* envelope, Params& params, Patch* patch);
+    ~LaserEnvelope2D();
+
+    //! Advance the envelope from time n to n+1 on the interior nodes (the outer layer must then be exchanged)
+    void compute();
+    //! Injection of the laser at time t on the western border, 0 in the guard cells of the box borders
+    void boundaryConditions(Patch* patch, double t);
+    //! Ponderomotive potential and its gradient, from the exchanged envelope
+    void computePhi();
+
+    //! Stops the injection (moving window)
+    inline void laserDisabled() { laser_active = false; }
+
+    //! Real and imaginary parts of the envelope at time n (A) and n-1 (A0)
+    Field2D *A_re, *A_im, *A0_re, *A0_im;
+    //! Ponderomotive potential and its gradient
+    Field2D *Phi, *GradPhi_x, *GradPhi_y;
+    //! Susceptibility of the plasma
+    Field2D *Chi;
+
+private:
+    //! Allocation of the fields, injection profile if the patch is on the western border
+    void init(Params& params, Patch* patch);
+
+    Laser* laser;
+    bool laser_active;
+    //! Laser frequency
+    double k0;
+    double dt, dx, dy;
+    unsigned int oversize_x, oversize_y;
+
+    //! Amplitude and phase of the injected envelope on the nodes of the western border
+    std::vector<double> injection_amplitude, injection_phase;
+    //! Buffers for the time envelope when the phase is not uniform
+    std::vector<double> retarded_time, time_envelope;
+};
+
+#endif
@@ -0,0 +1,94 @@
+#include "PoissonCoarseGrid.h"
+
+#include <cmath>
+#include <algorithm>
+
+using namespace std;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor for PoissonCoarseGrid : assemble and factorize the coarse operator
+// ---------------------------------------------------------------------------------------------------------------------
+PoissonCoarseGrid::PoissonCoarseGrid(Params& params)
+{
+    unsigned int npx = params.number_of_patches[0];
+    npy = (params.nDim_field > 1) ? params.number_of_patches[1] : 1;
+    n = npx*npy;
+    m = npy;
+    band.assign( n*(m+1), 0. );
+
+    // Weights of the borders : number of crossing edges x coefficient of the stencil (see ElectroMagnXD::compute_Ap)
+    //   - the patches at xmin and xmax also own the ghost nodes, the operator is scaled by dx^2 in 1D
+    double wx;
+    vector<double> wy(npx, 0.);
+    bool periodic_y = false;
+    if (params.nDim_field == 1) {
+        wx = 1.;
+    } else {
+        wx = (double)params.n_space[1] / (params.cell_length[0]*params.cell_length[0]);
+        for (unsigned int px=0 ; px<npx ; px++) {
+            unsigned int nx_owned = params.n_space[0];
+            if (px == 0)     nx_owned += params.oversize[0];
+            if (px == npx-1) nx_owned += params.oversize[0]+1;
+            wy[px] = (double)nx_owned / (params.cell_length[1]*params.cell_length[1]);
+        }
+        periodic_y = ( params.bc_em_type_y[0] == "periodic" );
+    }
+
+    for (unsigned int px=0 ; px<npx ; px++) {
+        for (unsigned int py=0 ; py<npy ; py++) {
+            unsigned int I = px*npy + py;
+            if (px+1 < npx)
+                addEdge( I, I+npy, wx );
+            if (py+1 < npy)
+                addEdge( I, I+1, wy[px] );
+            else if (periodic_y)
+                addEdge( I, px*npy, wy[px] );
+        }
+        // Walls at xmin and xmax (the potential is 0 outside)
+        for (unsigned int py=0 ; py<npy ; py++) {
+            if (px == 0)     L( px*npy+py, px*npy+py ) += wx;
+            if (px == npx-1) L( px*npy+py, px*npy+py ) += wx;
+        }
+    }
+
+    // Band Cholesky factorization
+    for (unsigned int i=0 ; i<n ; i++) {
+        unsigned int j0 = (i>m) ? i-m : 0;
+        for (unsigned int j=j0 ; j<=i ; j++) {
+            double s = L(i,j);
+            for (unsigned int k=max(j0, (j>m)?j-m:0) ; k<j ; k++)
+                s -= L(i,k)*L(j,k);
+            L(i,j) = (i==j) ? sqrt(s) : s/L(j,j);
+        }
+    }
+}
+
+
+void PoissonCoarseGrid::addEdge( unsigned int I, unsigned int J, double w )
+{
+    if (I == J) return;
+    L(I,I) += w;
+    L(J,J) += w;
+    L( max(I,J), min(I,J) ) -= w;
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Solve P^T A P x = b, i.e. (L L^T) x = -b
+// ---------------------------------------------------------------------------------------------------------------------
+void PoissonCoarseGrid::solve( vector<double>& b )
+{
+    for (unsigned int i=0 ; i<n ; i++) {
+        double s = -b[i];
+        for (unsigned int k=(i>m)?i-m:0 ; k<i ; k++)
+            s -= L(i,k)*b[k];
+        b[i] = s/L(i,i);
+    }
+    for (unsigned int i=n ; i-- > 0 ; ) {
+        double s = b[i];
+        for (unsigned int k=i+1 ; k<=min(i+m, n-1) ; k++)
+            s -= L(k,i)*b[k];
+        b[i] = s/L(i,i);
+    }
+}
+
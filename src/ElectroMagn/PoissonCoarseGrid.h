@@ -0,0 +1,56 @@
+/*! @file PoissonCoarseGrid.h
+
+ @brief PoissonCoarseGrid.h  coarse problem of the multigrid preconditioned conjugate gradient, one node per patch
+
+ Used as the global part of the preconditioner of the conjugate gradient (see VectorPatch::solvePoisson)
+ */
+
+#ifndef POISSONCOARSEGRID_H
+#define POISSONCOARSEGRID_H
+
+#include <vector>
+
+#include "Params.h"
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class PoissonCoarseGrid
+//!   - the potential is constant on the nodes owned by a patch : the coarse operator P^T A P couples the patches
+//!     by the number of edges of the Poisson stencil crossing their common border
+//!   - the patch (px,py) is the node px*npy+py : the matrix is banded (half-bandwidth npy, periodic in y included)
+//!   - it is factorized once (Cholesky) and solved redundantly by all the MPI processes
+//  --------------------------------------------------------------------------------------------------------------------
+class PoissonCoarseGrid
+{
+public:
+    //! Creator for PoissonCoarseGrid
+    PoissonCoarseGrid(Params& params);
+    ~PoissonCoarseGrid() {}
+
+    //! Node of the patch of coordinates Pcoordinates
+    inline unsigned int index( std::vector<unsigned int>& Pcoordinates ) {
+        return (Pcoordinates.size()>1) ? Pcoordinates[0]*npy + Pcoordinates[1] : Pcoordinates[0];
+    }
+
+    //! Number of nodes (patches)
+    inline unsigned int size() {
+        return n;
+    }
+
+    //! Replace b by the solution of P^T A P x = b
+    void solve( std::vector<double>& b );
+
+private:
+    //! Add the coupling w between the nodes I and J to the (positive definite) matrix -P^T A P
+    void addEdge( unsigned int I, unsigned int J, double w );
+
+    //! Lower band of -P^T A P, then of its Cholesky factor : L(i,i-d) is band[i*(m+1)+d]
+    inline double& L( unsigned int i, unsigned int j ) {
+        return band[ i*(m+1) + i-j ];
+    }
+
+    unsigned int npy, n, m;
+    std::vector<double> band;
+};
+
+#endif
+
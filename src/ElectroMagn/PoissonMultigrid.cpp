@@ -0,0 +1,181 @@
+#include "PoissonMultigrid.h"
+
+using namespace std;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor for PoissonMultigrid : build the hierarchy of levels
+// ---------------------------------------------------------------------------------------------------------------------
+PoissonMultigrid::PoissonMultigrid(unsigned int nx, unsigned int ny, double cx, double cy)
+{
+    Level l;
+    l.nx = nx;
+    l.ny = ny;
+    l.cx = cx;
+    l.cy = cy;
+    while (true) {
+        l.coarsen_x = (l.nx >= 3);
+        l.coarsen_y = (l.ny >= 3);
+        l.u  .assign( (l.nx+2)*(l.ny+2), 0. );
+        l.f  .assign( (l.nx+2)*(l.ny+2), 0. );
+        l.res.assign( (l.nx+2)*(l.ny+2), 0. );
+        levels.push_back( l );
+        if ( !l.coarsen_x && !l.coarsen_y ) break;
+
+        // Coarse grid operator : same stencil with twice the cell length
+        if (l.coarsen_x) {
+            l.nx  = (l.nx-1)/2;
+            l.cx *= 0.25;
+        }
+        if (l.coarsen_y) {
+            l.ny  = (l.ny-1)/2;
+            l.cy *= 0.25;
+        }
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// V-cycle on the level ilevel from a zero initial guess
+//   - the post-smoothing sweeps are done in the reverse order of the pre-smoothing ones (symmetric cycle)
+// ---------------------------------------------------------------------------------------------------------------------
+void PoissonMultigrid::vcycle( unsigned int ilevel )
+{
+    Level& l = levels[ilevel];
+    l.u.assign( l.u.size(), 0. );
+
+    if ( ilevel == levels.size()-1 ) {
+        for (unsigned int is=0 ; is<n_coarsest/2 ; is++) {
+            relax( l, 0 );
+            relax( l, 1 );
+        }
+        for (unsigned int is=0 ; is<n_coarsest/2 ; is++) {
+            relax( l, 1 );
+            relax( l, 0 );
+        }
+        return;
+    }
+
+    for (unsigned int is=0 ; is<n_smooth ; is++) {
+        relax( l, 0 );
+        relax( l, 1 );
+    }
+
+    residual( l );
+    restriction( l, levels[ilevel+1] );
+    vcycle( ilevel+1 );
+    prolongate( levels[ilevel+1], l );
+
+    for (unsigned int is=0 ; is<n_smooth ; is++) {
+        relax( l, 1 );
+        relax( l, 0 );
+    }
+
+} // END vcycle
+
+
+void PoissonMultigrid::relax( Level& l, unsigned int color )
+{
+    unsigned int stride = l.ny+2;
+    double inv_diag = 1./( 2.*(l.cx+l.cy) );
+    double* u = &l.u[0];
+    const double* f = &l.f[0];
+
+    for (unsigned int i=1 ; i<=l.nx ; i++) {
+        for (unsigned int j=1+(i+1+color)%2 ; j<=l.ny ; j+=2) {
+            unsigned int k = i*stride+j;
+            u[k] = ( l.cx*(u[k-stride]+u[k+stride]) + l.cy*(u[k-1]+u[k+1]) - f[k] ) * inv_diag;
+        }
+    }
+} // END relax
+
+
+void PoissonMultigrid::residual( Level& l )
+{
+    unsigned int stride = l.ny+2;
+    double diag = 2.*(l.cx+l.cy);
+    const double* u = &l.u[0];
+    const double* f = &l.f[0];
+    double* res = &l.res[0];
+
+    for (unsigned int i=1 ; i<=l.nx ; i++) {
+        for (unsigned int j=1 ; j<=l.ny ; j++) {
+            unsigned int k = i*stride+j;
+            res[k] = f[k] - ( l.cx*(u[k-stride]+u[k+stride]) + l.cy*(u[k-1]+u[k+1]) - diag*u[k] );
+        }
+    }
+} // END residual
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Full weighting restriction : weights 1/4, 1/2, 1/4 around the fine node 2k+1 in the coarsened directions
+// ---------------------------------------------------------------------------------------------------------------------
+void PoissonMultigrid::restriction( Level& l, Level& c )
+{
+    unsigned int stride  = l.ny+2;
+    unsigned int cstride = c.ny+2;
+    int ix0 = l.coarsen_x ? -1 : 0;
+    int iy0 = l.coarsen_y ? -1 : 0;
+    const double w[3] = { 0.25, 0.5, 0.25 };
+
+    for (unsigned int ic=1 ; ic<=c.nx ; ic++) {
+        unsigned int i = l.coarsen_x ? 2*ic : ic;
+        for (unsigned int jc=1 ; jc<=c.ny ; jc++) {
+            unsigned int j = l.coarsen_y ? 2*jc : jc;
+            double sum = 0.;
+            for (int di=ix0 ; di<=-ix0 ; di++) {
+                double wx = l.coarsen_x ? w[di+1] : 1.;
+                for (int dj=iy0 ; dj<=-iy0 ; dj++) {
+                    double wy = l.coarsen_y ? w[dj+1] : 1.;
+                    sum += wx*wy * l.res[ (i+di)*stride + j+dj ];
+                }
+            }
+            c.f[ ic*cstride + jc ] = sum;
+        }
+    }
+} // END restriction
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// (Bi)linear prolongation, transpose of the restriction up to the factor 2 per coarsened direction
+//   - the fine node 2k+1 is the coarse node k, the fine node 2k is between the coarse nodes k-1 and k
+// ---------------------------------------------------------------------------------------------------------------------
+void PoissonMultigrid::prolongate( Level& c, Level& l )
+{
+    unsigned int stride  = l.ny+2;
+    unsigned int cstride = c.ny+2;
+
+    for (unsigned int i=1 ; i<=l.nx ; i++) {
+        // coarse neighbours of the fine node i-1 (in padded indices)
+        unsigned int icm, icp;
+        double wxm, wxp;
+        if (!l.coarsen_x) {
+            icm = icp = i;
+            wxm = 1.; wxp = 0.;
+        } else if ( (i-1)%2 == 1 ) {
+            icm = icp = i/2;
+            wxm = 1.; wxp = 0.;
+        } else {
+            icm = (i-1)/2;
+            icp = icm+1;
+            wxm = wxp = 0.5;
+        }
+        for (unsigned int j=1 ; j<=l.ny ; j++) {
+            unsigned int jcm, jcp;
+            double wym, wyp;
+            if (!l.coarsen_y) {
+                jcm = jcp = j;
+                wym = 1.; wyp = 0.;
+            } else if ( (j-1)%2 == 1 ) {
+                jcm = jcp = j/2;
+                wym = 1.; wyp = 0.;
+            } else {
+                jcm = (j-1)/2;
+                jcp = jcm+1;
+                wym = wyp = 0.5;
+            }
+            l.u[ i*stride + j ] += wxm*wym*c.u[ icm*cstride + jcm ] + wxm*wyp*c.u[ icm*cstride + jcp ]
+                +                  wxp*wym*c.u[ icp*cstride + jcm ] + wxp*wyp*c.u[ icp*cstride + jcp ];
+        }
+    }
+} // END prolongate
+
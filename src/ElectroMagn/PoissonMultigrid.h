@@ -0,0 +1,75 @@
+/*! @file PoissonMultigrid.h
+
+ @brief PoissonMultigrid.h  geometric multigrid V-cycle for the Poisson equation on the nodes owned by a patch
+
+ Used as the local part of the preconditioner of the conjugate gradient (see VectorPatch::solvePoisson)
+ */
+
+#ifndef POISSONMULTIGRID_H
+#define POISSONMULTIGRID_H
+
+#include <vector>
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class PoissonMultigrid
+//!   - solves cx ( u(i-1,j)+u(i+1,j) ) + cy ( u(i,j-1)+u(i,j+1) ) - 2(cx+cy) u(i,j) = f(i,j) on nx x ny nodes,
+//!     with u = 0 outside (ny=1 and cy=0 in 1D)
+//!   - the coarse node k of a level is the fine node 2k+1, a direction is coarsened while it has at least 3 nodes
+//!   - red-black Gauss-Seidel smoother, full weighting restriction and (bi)linear prolongation :
+//!     the V-cycle is a symmetric operator, as required by the conjugate gradient
+//  --------------------------------------------------------------------------------------------------------------------
+class PoissonMultigrid
+{
+public:
+    //! Creator for PoissonMultigrid
+    PoissonMultigrid(unsigned int nx, unsigned int ny, double cx, double cy);
+    ~PoissonMultigrid() {}
+
+    //! Right hand side at the node (i,j) of the finest level
+    inline double& rhs(unsigned int i, unsigned int j) {
+        return levels[0].f[ (i+1)*(levels[0].ny+2) + j+1 ];
+    }
+    //! Solution at the node (i,j) of the finest level
+    inline double solution(unsigned int i, unsigned int j) {
+        return levels[0].u[ (i+1)*(levels[0].ny+2) + j+1 ];
+    }
+
+    //! One V-cycle from a zero initial guess
+    void vcycle() {
+        vcycle(0);
+    }
+
+    //! Number of smoothing sweeps before and after the coarse grid correction
+    static const unsigned int n_smooth   = 2;
+    //! Number of sweeps on the coarsest level
+    static const unsigned int n_coarsest = 20;
+
+private:
+    //! Arrays of a level are stored with a layer of zeros around the nodes : node (i,j) is at (i+1)*(ny+2)+j+1
+    struct Level {
+        unsigned int nx, ny;
+        double cx, cy;
+        //! Directions coarsened to get the next level
+        bool coarsen_x, coarsen_y;
+        std::vector<double> u, f, res;
+    };
+
+    void vcycle( unsigned int ilevel );
+
+    //! Gauss-Seidel sweep on the nodes of parity color ( (i+j)%2 )
+    void relax( Level& l, unsigned int color );
+
+    //! res = f - A u
+    void residual( Level& l );
+
+    //! Full weighting of the residual of the level l to the right hand side of the level c
+    void restriction( Level& l, Level& c );
+
+    //! u of the level l += (bi)linear interpolation of u of the level c
+    void prolongate( Level& c, Level& l );
+
+    std::vector<Level> levels;
+};
+
+#endif
+
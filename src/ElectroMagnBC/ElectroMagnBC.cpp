@@ -2,6 +2,8 @@
 #include <cstdlib>
 #include <iostream>
 #include <string>
+#include <cmath>
+#include <algorithm>
 
 #include "ElectroMagnBC.h"
 
@@ -40,3 +42,36 @@ void ElectroMagnBC::laserDisabled()
     vecLaser.resize(0);
 }
 
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Coefficients of the perfectly matched layer (CPML with kappa=1, alpha=0)
+//   - sigma_max = -(order+1) ln(R) / (2 thickness) gives the reflection coefficient R at normal incidence
+//   - the ghost nodes beyond the box keep sigma_max
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagnBC::pmlCoefficients( Params &params, Patch* patch, unsigned int axis, unsigned int side, bool dual,
+                                     vector<double> &a, vector<double> &b, unsigned int &i0, unsigned int &i1 )
+{
+    unsigned int n = params.n_space[axis] + 1 + 2*params.oversize[axis] + (dual ? 1 : 0);
+    double thickness = (double)params.pml_cells;
+    double sigma_max = -(params.pml_order+1.) * log(params.pml_reflection)
+    /                  ( 2. * thickness * params.cell_length[axis] );
+    
+    a.assign( n, 0. );
+    b.assign( n, 1. );
+    i0 = n;
+    i1 = 0;
+    for (unsigned int i=0 ; i<n ; i++) {
+        // position of the node in cells, from the min border of the box
+        double x = (double)( patch->Pcoordinates[axis]*params.n_space[axis] + i ) - (double)params.oversize[axis]
+        -          (dual ? 0.5 : 0.);
+        double depth = (side==0) ? thickness - x : x - ( (double)params.n_space_global[axis] - thickness );
+        if (depth <= 0.) continue;
+        double sigma = sigma_max * pow( min(depth, thickness)/thickness, (double)params.pml_order );
+        b[i] = exp( -sigma*dt );
+        a[i] = b[i] - 1.;
+        i0 = min( i0, i );
+        i1 = i+1;
+    }
+    if (i0 > i1) i0 = i1;
+}
@@ -22,6 +22,11 @@ public:
     virtual void apply_xmax(ElectroMagn* EMfields, double time_dual, Patch* patch) = 0;
     virtual void apply_ymin(ElectroMagn* EMfields, double time_dual, Patch* patch) = 0;
     virtual void apply_ymax(ElectroMagn* EMfields, double time_dual, Patch* patch) = 0;
+    //! Correction of E right after the Maxwell-Ampere equation (before Maxwell-Faraday), used by the PML
+    virtual void apply_E(ElectroMagn* EMfields, double time_dual, Patch* patch) {}
+    //! Arrays which evolve with the fields (auxiliary fields of the PML) : sent with the patch (SmileiMPI) and saved
+    //! in the checkpoints
+    virtual void auxiliaryFields( std::vector< std::vector<double>* > &aux ) {}
     void laserDisabled();
 
     virtual void save_fields_BC1D(Field*) {}
@@ -36,6 +41,13 @@ protected:
     //! time-step
     double dt;
 
+    //! Coefficients of the convolutional PML at the nodes of the patch along an axis : psi = b psi + a dF/dx
+    //!   - side 0 (1) : layer of params.pml_cells cells at the min (max) border of the box
+    //!   - conductivity sigma = sigma_max (depth/thickness)^pml_order, b = exp(-sigma dt), a = b-1
+    //!   - [i0,i1[ : nodes inside the layer (empty if the patch does not cross the layer)
+    void pmlCoefficients( Params &params, Patch* patch, unsigned int axis, unsigned int side, bool dual,
+                          std::vector<double> &a, std::vector<double> &b, unsigned int &i0, unsigned int &i1 );
+
 };
 
 #endif
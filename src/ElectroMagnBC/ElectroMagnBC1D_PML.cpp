@@ -0,0 +1,94 @@
+#include "ElectroMagnBC1D_PML.h"
+
+#include <cstdlib>
+#include <algorithm>
+
+#include "Params.h"
+#include "Patch.h"
+#include "ElectroMagn.h"
+#include "Field1D.h"
+#include "Tools.h"
+
+using namespace std;
+
+ElectroMagnBC1D_PML::ElectroMagnBC1D_PML( Params &params, Patch* patch, unsigned int i_boundary )
+  : ElectroMagnBC( params, patch )
+{
+    dt_ov_dx = dt/params.cell_length[0];
+    
+    pmlCoefficients( params, patch, 0, i_boundary, false, a_p, b_p, ip0, ip1 );
+    pmlCoefficients( params, patch, 0, i_boundary, true,  a_d, b_d, id0, id1 );
+    // B is computed by Maxwell-Faraday on the dual nodes 1 to nx_d-2 only
+    id0 = max( id0, 1u );
+    id1 = min( id1, (unsigned int)a_d.size()-1 );
+    if (id0 > id1) id0 = id1;
+    
+    psi_Ey.resize( ip1-ip0, 0. );
+    psi_Ez.resize( ip1-ip0, 0. );
+    psi_By.resize( id1-id0, 0. );
+    psi_Bz.resize( id1-id0, 0. );
+}
+
+ElectroMagnBC1D_PML::~ElectroMagnBC1D_PML()
+{
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Correction of E in the layer : the auxiliary fields store dt*psi
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagnBC1D_PML::apply_E(ElectroMagn* EMfields, double time_dual, Patch* patch)
+{
+    Field1D* Ey1D = static_cast<Field1D*>(EMfields->Ey_);
+    Field1D* Ez1D = static_cast<Field1D*>(EMfields->Ez_);
+    Field1D* By1D = static_cast<Field1D*>(EMfields->By_);
+    Field1D* Bz1D = static_cast<Field1D*>(EMfields->Bz_);
+    
+    for (unsigned int i=ip0 ; i<ip1 ; i++) {
+        double a = a_p[i]*dt_ov_dx, b = b_p[i];
+        psi_Ey[i-ip0] = b*psi_Ey[i-ip0] + a*( (*Bz1D)(i+1) - (*Bz1D)(i) );
+        psi_Ez[i-ip0] = b*psi_Ez[i-ip0] + a*( (*By1D)(i+1) - (*By1D)(i) );
+        (*Ey1D)(i) -= psi_Ey[i-ip0];
+        (*Ez1D)(i) += psi_Ez[i-ip0];
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Correction of B in the layer, on the nodes computed by Maxwell-Faraday
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagnBC1D_PML::apply_B(ElectroMagn* EMfields)
+{
+    Field1D* Ey1D = static_cast<Field1D*>(EMfields->Ey_);
+    Field1D* Ez1D = static_cast<Field1D*>(EMfields->Ez_);
+    Field1D* By1D = static_cast<Field1D*>(EMfields->By_);
+    Field1D* Bz1D = static_cast<Field1D*>(EMfields->Bz_);
+    
+    for (unsigned int i=id0 ; i<id1 ; i++) {
+        double a = a_d[i]*dt_ov_dx, b = b_d[i];
+        psi_By[i-id0] = b*psi_By[i-id0] + a*( (*Ez1D)(i) - (*Ez1D)(i-1) );
+        psi_Bz[i-id0] = b*psi_Bz[i-id0] + a*( (*Ey1D)(i) - (*Ey1D)(i-1) );
+        (*By1D)(i) += psi_By[i-id0];
+        (*Bz1D)(i) -= psi_Bz[i-id0];
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Apply Boundary Conditions : each instance handles its own layer
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagnBC1D_PML::apply_xmin(ElectroMagn* EMfields, double time_dual, Patch* patch)
+{
+    apply_B( EMfields );
+}
+void ElectroMagnBC1D_PML::apply_xmax(ElectroMagn* EMfields, double time_dual, Patch* patch)
+{
+    apply_B( EMfields );
+}
+void ElectroMagnBC1D_PML::apply_ymin(ElectroMagn* EMfields, double time_dual, Patch* patch)
+{
+}
+void ElectroMagnBC1D_PML::apply_ymax(ElectroMagn* EMfields, double time_dual, Patch* patch)
+{
+}
+
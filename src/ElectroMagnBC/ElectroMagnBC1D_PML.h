@@ -0,0 +1,53 @@
+#ifndef ELECTROMAGNBC1D_PML_H
+#define ELECTROMAGNBC1D_PML_H
+
+#include <vector>
+
+#include "ElectroMagnBC.h"
+
+class Params;
+class ElectroMagn;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class ElectroMagnBC1D_PML : convolutional perfectly matched layer, see ElectroMagnBC2D_PML
+//  --------------------------------------------------------------------------------------------------------------------
+class ElectroMagnBC1D_PML : public ElectroMagnBC {
+public:
+    //! Creator for ElectroMagnBC1D_PML, i_boundary : 0 xmin, 1 xmax
+    ElectroMagnBC1D_PML( Params &params, Patch* patch, unsigned int i_boundary );
+    ~ElectroMagnBC1D_PML();
+    
+    virtual void apply_xmin(ElectroMagn* EMfields, double time_dual, Patch* patch);
+    virtual void apply_xmax(ElectroMagn* EMfields, double time_dual, Patch* patch);
+    virtual void apply_ymin(ElectroMagn* EMfields, double time_dual, Patch* patch);
+    virtual void apply_ymax(ElectroMagn* EMfields, double time_dual, Patch* patch);
+    virtual void apply_E(ElectroMagn* EMfields, double time_dual, Patch* patch);
+    
+    virtual void auxiliaryFields( std::vector< std::vector<double>* > &aux ) {
+        aux.push_back( &psi_Ey );
+        aux.push_back( &psi_Ez );
+        aux.push_back( &psi_By );
+        aux.push_back( &psi_Bz );
+    }
+    
+private:
+    
+    //! Correction of B in the layer
+    void apply_B(ElectroMagn* EMfields);
+    
+    //! Ratio of the time-step by the spatial-step dt/dx
+    double dt_ov_dx;
+    
+    //! CPML coefficients on the primal and dual nodes
+    std::vector<double> a_p, b_p, a_d, b_d;
+    
+    //! Nodes of the patch inside the layer (primal [ip0,ip1[, dual [id0,id1[)
+    unsigned int ip0, ip1, id0, id1;
+    
+    //! Auxiliary fields of Ey, Ez, By and Bz, stored for the nodes inside the layer only
+    std::vector<double> psi_Ey, psi_Ez, psi_By, psi_Bz;
+    
+};
+
+#endif
+
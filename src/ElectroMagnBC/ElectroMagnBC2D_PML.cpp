@@ -0,0 +1,179 @@
+#include "ElectroMagnBC2D_PML.h"
+
+#include <cstdlib>
+#include <algorithm>
+
+#include "Params.h"
+#include "Patch.h"
+#include "ElectroMagn.h"
+#include "Field2D.h"
+#include "Tools.h"
+
+using namespace std;
+
+ElectroMagnBC2D_PML::ElectroMagnBC2D_PML( Params &params, Patch* patch, unsigned int i_boundary )
+  : ElectroMagnBC( params, patch )
+{
+    axis = i_boundary/2;
+    
+    // number of nodes of the primal and dual grid in the x-direction
+    nx_p = params.n_space[0]+1+2*params.oversize[0];
+    nx_d = nx_p+1;
+    // number of nodes of the primal and dual grid in the y-direction
+    ny_p = params.n_space[1]+1+2*params.oversize[1];
+    ny_d = ny_p+1;
+    
+    dt_ov_dl = dt/params.cell_length[axis];
+    
+    pmlCoefficients( params, patch, axis, i_boundary%2, false, a_p, b_p, ip0, ip1 );
+    pmlCoefficients( params, patch, axis, i_boundary%2, true,  a_d, b_d, id0, id1 );
+    // B is computed by Maxwell-Faraday on the dual nodes 1 to n_d-2 only
+    unsigned int n_d = (axis==0) ? nx_d : ny_d;
+    id0 = max( id0, 1u );
+    id1 = min( id1, n_d-1 );
+    if (id0 > id1) id0 = id1;
+    
+    unsigned int np_layer = ip1-ip0;
+    unsigned int nd_layer = id1-id0;
+    if (axis == 0) {
+        psi_E1.resize( np_layer*ny_d, 0. ); // Ey
+        psi_E2.resize( np_layer*ny_p, 0. ); // Ez
+        psi_B1.resize( nd_layer*ny_p, 0. ); // By
+        psi_B2.resize( nd_layer*ny_d, 0. ); // Bz
+    } else {
+        psi_E1.resize( nx_d*np_layer, 0. ); // Ex
+        psi_E2.resize( nx_p*np_layer, 0. ); // Ez
+        psi_B1.resize( nx_p*nd_layer, 0. ); // Bx
+        psi_B2.resize( nx_d*nd_layer, 0. ); // Bz
+    }
+}
+
+ElectroMagnBC2D_PML::~ElectroMagnBC2D_PML()
+{
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Correction of E in the layer : the auxiliary fields store dt*psi
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagnBC2D_PML::apply_E(ElectroMagn* EMfields, double time_dual, Patch* patch)
+{
+    if ( ip0 == ip1 ) return;
+    
+    // Static cast of the fields
+    Field2D* Ex2D = static_cast<Field2D*>(EMfields->Ex_);
+    Field2D* Ey2D = static_cast<Field2D*>(EMfields->Ey_);
+    Field2D* Ez2D = static_cast<Field2D*>(EMfields->Ez_);
+    Field2D* Bx2D = static_cast<Field2D*>(EMfields->Bx_);
+    Field2D* By2D = static_cast<Field2D*>(EMfields->By_);
+    Field2D* Bz2D = static_cast<Field2D*>(EMfields->Bz_);
+    
+    if (axis == 0) {
+        for (unsigned int i=ip0 ; i<ip1 ; i++) {
+            double a = a_p[i]*dt_ov_dl, b = b_p[i];
+            // Ey^(p,d) : - dBz/dx
+            double* psi = &psi_E1[(i-ip0)*ny_d];
+            for (unsigned int j=0 ; j<ny_d ; j++) {
+                psi[j] = b*psi[j] + a*( (*Bz2D)(i+1,j) - (*Bz2D)(i,j) );
+                (*Ey2D)(i,j) -= psi[j];
+            }
+            // Ez^(p,p) : + dBy/dx
+            psi = &psi_E2[(i-ip0)*ny_p];
+            for (unsigned int j=0 ; j<ny_p ; j++) {
+                psi[j] = b*psi[j] + a*( (*By2D)(i+1,j) - (*By2D)(i,j) );
+                (*Ez2D)(i,j) += psi[j];
+            }
+        }
+    } else {
+        unsigned int n_layer = ip1-ip0;
+        for (unsigned int i=0 ; i<nx_d ; i++) {
+            // Ex^(d,p) : + dBz/dy
+            double* psi = &psi_E1[i*n_layer];
+            for (unsigned int j=ip0 ; j<ip1 ; j++) {
+                psi[j-ip0] = b_p[j]*psi[j-ip0] + a_p[j]*dt_ov_dl*( (*Bz2D)(i,j+1) - (*Bz2D)(i,j) );
+                (*Ex2D)(i,j) += psi[j-ip0];
+            }
+            if (i == nx_p) continue;
+            // Ez^(p,p) : - dBx/dy
+            psi = &psi_E2[i*n_layer];
+            for (unsigned int j=ip0 ; j<ip1 ; j++) {
+                psi[j-ip0] = b_p[j]*psi[j-ip0] + a_p[j]*dt_ov_dl*( (*Bx2D)(i,j+1) - (*Bx2D)(i,j) );
+                (*Ez2D)(i,j) -= psi[j-ip0];
+            }
+        }
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Correction of B in the layer, on the nodes computed by Maxwell-Faraday
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagnBC2D_PML::apply_B(ElectroMagn* EMfields)
+{
+    if ( id0 == id1 ) return;
+    
+    // Static cast of the fields
+    Field2D* Ex2D = static_cast<Field2D*>(EMfields->Ex_);
+    Field2D* Ey2D = static_cast<Field2D*>(EMfields->Ey_);
+    Field2D* Ez2D = static_cast<Field2D*>(EMfields->Ez_);
+    Field2D* Bx2D = static_cast<Field2D*>(EMfields->Bx_);
+    Field2D* By2D = static_cast<Field2D*>(EMfields->By_);
+    Field2D* Bz2D = static_cast<Field2D*>(EMfields->Bz_);
+    
+    if (axis == 0) {
+        for (unsigned int i=id0 ; i<id1 ; i++) {
+            double a = a_d[i]*dt_ov_dl, b = b_d[i];
+            // By^(d,p) : + dEz/dx
+            double* psi = &psi_B1[(i-id0)*ny_p];
+            for (unsigned int j=0 ; j<ny_p ; j++) {
+                psi[j] = b*psi[j] + a*( (*Ez2D)(i,j) - (*Ez2D)(i-1,j) );
+                (*By2D)(i,j) += psi[j];
+            }
+            // Bz^(d,d) : - dEy/dx
+            psi = &psi_B2[(i-id0)*ny_d];
+            for (unsigned int j=1 ; j<ny_d-1 ; j++) {
+                psi[j] = b*psi[j] + a*( (*Ey2D)(i,j) - (*Ey2D)(i-1,j) );
+                (*Bz2D)(i,j) -= psi[j];
+            }
+        }
+    } else {
+        unsigned int n_layer = id1-id0;
+        for (unsigned int i=0 ; i<nx_d-1 ; i++) {
+            // Bx^(p,d) : - dEz/dy
+            double* psi = &psi_B1[i*n_layer];
+            for (unsigned int j=id0 ; j<id1 ; j++) {
+                psi[j-id0] = b_d[j]*psi[j-id0] + a_d[j]*dt_ov_dl*( (*Ez2D)(i,j) - (*Ez2D)(i,j-1) );
+                (*Bx2D)(i,j) -= psi[j-id0];
+            }
+            if (i == 0) continue;
+            // Bz^(d,d) : + dEx/dy
+            psi = &psi_B2[i*n_layer];
+            for (unsigned int j=id0 ; j<id1 ; j++) {
+                psi[j-id0] = b_d[j]*psi[j-id0] + a_d[j]*dt_ov_dl*( (*Ex2D)(i,j) - (*Ex2D)(i,j-1) );
+                (*Bz2D)(i,j) += psi[j-id0];
+            }
+        }
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Apply Boundary Conditions : each instance handles its own layer
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagnBC2D_PML::apply_xmin(ElectroMagn* EMfields, double time_dual, Patch* patch)
+{
+    apply_B( EMfields );
+}
+void ElectroMagnBC2D_PML::apply_xmax(ElectroMagn* EMfields, double time_dual, Patch* patch)
+{
+    apply_B( EMfields );
+}
+void ElectroMagnBC2D_PML::apply_ymin(ElectroMagn* EMfields, double time_dual, Patch* patch)
+{
+    apply_B( EMfields );
+}
+void ElectroMagnBC2D_PML::apply_ymax(ElectroMagn* EMfields, double time_dual, Patch* patch)
+{
+    apply_B( EMfields );
+}
+
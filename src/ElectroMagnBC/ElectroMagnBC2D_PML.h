@@ -0,0 +1,64 @@
+#ifndef ELECTROMAGNBC2D_PML_H
+#define ELECTROMAGNBC2D_PML_H
+
+#include <vector>
+
+#include "ElectroMagnBC.h"
+
+class Params;
+class ElectroMagn;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class ElectroMagnBC2D_PML : convolutional perfectly matched layer (Roden & Gedney, Microw. Opt. Technol. Lett. 27, 334)
+//!   - the layer is made of the last pml_cells cells of the box along the border, where Maxwell's equations are
+//!     modified by the auxiliary fields psi : dF/dx -> dF/dx + psi, psi = b psi + a dF/dx
+//!   - E is corrected right after Maxwell-Ampere (apply_E), B right after Maxwell-Faraday (apply_xmin ...)
+//!   - the outermost nodes of the box are never updated and keep their initial value (perfect conductor)
+//  --------------------------------------------------------------------------------------------------------------------
+class ElectroMagnBC2D_PML : public ElectroMagnBC {
+public:
+    //! Creator for ElectroMagnBC2D_PML, i_boundary : 0 xmin, 1 xmax, 2 ymin, 3 ymax
+    ElectroMagnBC2D_PML( Params &params, Patch* patch, unsigned int i_boundary );
+    ~ElectroMagnBC2D_PML();
+    
+    virtual void apply_xmin(ElectroMagn* EMfields, double time_dual, Patch* patch);
+    virtual void apply_xmax(ElectroMagn* EMfields, double time_dual, Patch* patch);
+    virtual void apply_ymin(ElectroMagn* EMfields, double time_dual, Patch* patch);
+    virtual void apply_ymax(ElectroMagn* EMfields, double time_dual, Patch* patch);
+    virtual void apply_E(ElectroMagn* EMfields, double time_dual, Patch* patch);
+    
+    virtual void auxiliaryFields( std::vector< std::vector<double>* > &aux ) {
+        aux.push_back( &psi_E1 );
+        aux.push_back( &psi_E2 );
+        aux.push_back( &psi_B1 );
+        aux.push_back( &psi_B2 );
+    }
+    
+private:
+    
+    //! Correction of B in the layer
+    void apply_B(ElectroMagn* EMfields);
+    
+    //! Axis normal to the layer (0 : x, 1 : y)
+    unsigned int axis;
+    
+    //! Number of nodes on the primal and dual grids in the x and y directions
+    unsigned int nx_p, nx_d, ny_p, ny_d;
+    
+    //! dt/dx or dt/dy, along the axis
+    double dt_ov_dl;
+    
+    //! CPML coefficients on the primal and dual nodes along the axis
+    std::vector<double> a_p, b_p, a_d, b_d;
+    
+    //! Nodes of the patch inside the layer along the axis (primal [ip0,ip1[, dual [id0,id1[)
+    unsigned int ip0, ip1, id0, id1;
+    
+    //! Auxiliary fields of the components of E and B with a derivative along the axis
+    //!   (x : Ey, Ez, By, Bz ; y : Ex, Ez, Bx, Bz), stored for the nodes inside the layer only
+    std::vector<double> psi_E1, psi_E2, psi_B1, psi_B2;
+    
+};
+
+#endif
+
@@ -53,6 +53,10 @@ ElectroMagnBC2D_SM::ElectroMagnBC2D_SM( Params &params, Patch* patch )
     Bz_yvalmin_Trans.resize(nx_d,0.); // dual in the x-direction
     Bz_yvalmax_Trans.resize(nx_d,0.);
     
+    // Laser amplitudes
+    By_laser.resize(ny_p);
+    Bz_laser.resize(ny_d);
+    
     
     // -----------------------------------------------------
     // Parameters for the Silver-Mueller boundary conditions
@@ -174,18 +178,18 @@ void ElectroMagnBC2D_SM::apply_xmin(ElectroMagn* EMfields, double time_dual, Pat
         Field2D* By2D = static_cast<Field2D*>(EMfields->By_);
         Field2D* Bz2D = static_cast<Field2D*>(EMfields->Bz_);
         
+        // Lasers, on all the cells of the border at once
+        By_laser.assign(ny_p, 0.);
+        Bz_laser.assign(ny_d, 0.);
+        for (unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++) {
+            vecLaser[ilaser]->addAmplitudes0(time_dual, By_laser);
+            vecLaser[ilaser]->addAmplitudes1(time_dual, Bz_laser);
+        }
+        
         // for By^(d,p)
-        vector<double> yp(1);
-        yp[0] = patch->getDomainLocalMin(1) - EMfields->oversize[1]*dy;
         for (unsigned int j=0 ; j<ny_p ; j++) {
             
-            double byW = 0.;
-            yp[0] += dy;
-            
-            // Lasers
-            for (unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++) {
-                byW += vecLaser[ilaser]->getAmplitude0(yp, time_dual, j);
-            }
+            double byW = By_laser[j];
             
             /*(*By2D)(0,j) = Alpha_SM_W   * (*Ez2D)(0,j)
             +              Beta_SM_W    * (*By2D)(1,j)
@@ -203,17 +207,9 @@ void ElectroMagnBC2D_SM::apply_xmin(ElectroMagn* EMfields, double time_dual, Pat
         
         
         // for Bz^(d,d)
-        vector<double> yd(1);
-        yd[0] = patch->getDomainLocalMin(1) - (0.5+EMfields->oversize[1])*dy;
         for (unsigned int j=0 ; j<ny_d ; j++) {
             
-            double bzW = 0.;
-            yd[0] += dy;
-            
-            // Lasers
-            for (unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++) {
-                bzW += vecLaser[ilaser]->getAmplitude1(yd, time_dual, j);
-            }
+            double bzW = Bz_laser[j];
             
             /*(*Bz2D)(0,j) = -Alpha_SM_W * (*Ey2D)(0,j)
             +               Beta_SM_W  * (*Bz2D)(1,j)
@@ -244,18 +240,18 @@ void ElectroMagnBC2D_SM::apply_xmax(ElectroMagn* EMfields, double time_dual, Pat
         Field2D* By2D = static_cast<Field2D*>(EMfields->By_);
         Field2D* Bz2D = static_cast<Field2D*>(EMfields->Bz_);
         
+        // Lasers, on all the cells of the border at once
+        By_laser.assign(ny_p, 0.);
+        Bz_laser.assign(ny_d, 0.);
+        for (unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++) {
+            vecLaser[ilaser]->addAmplitudes0(time_dual, By_laser);
+            vecLaser[ilaser]->addAmplitudes1(time_dual, Bz_laser);
+        }
+        
         // for By^(d,p)
-        vector<double> yp(1);
-        yp[0] = patch->getDomainLocalMin(1) - EMfields->oversize[1]*dy;
         for (unsigned int j=0 ; j<ny_p ; j++) {
             
-            double byE = 0.;
-            yp[0] += dy;
-            
-            // Lasers
-            for (unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++) {
-                byE += vecLaser[ilaser]->getAmplitude0(yp, time_dual, j);
-            }
+            double byE = By_laser[j];
             
             /*(*By2D)(nx_d-1,j) = Alpha_SM_E   * (*Ez2D)(nx_p-1,j)
             +                   Beta_SM_E    * (*By2D)(nx_d-2,j)
@@ -273,17 +269,9 @@ void ElectroMagnBC2D_SM::apply_xmax(ElectroMagn* EMfields, double time_dual, Pat
         
         
         // for Bz^(d,d)
-        vector<double> yd(1);
-        yd[0] = patch->getDomainLocalMin(1) - (0.5+EMfields->oversize[1])*dy;
         for (unsigned int j=0 ; j<ny_d ; j++) {
             
-            double bzE = 0.;
-            yd[0] += dy;
-            
-            // Lasers
-            for (unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++) {
-                bzE += vecLaser[ilaser]->getAmplitude1(yd, time_dual, j);
-            }
+            double bzE = Bz_laser[j];
             
             /*(*Bz2D)(nx_d-1,j) = -Alpha_SM_E * (*Ey2D)(nx_p-1,j)
             +                    Beta_SM_E  * (*Bz2D)(nx_d-2,j)
@@ -34,6 +34,9 @@ private:
      std::vector<double>  Bz_xvalmin_Long, Bz_xvalmax_Long, By_xvalmin_Long, By_xvalmax_Long, Bx_xvalmin_Long, Bx_xvalmax_Long,
                           Bz_yvalmin_Trans, Bz_yvalmax_Trans, By_yvalmin_Trans, By_yvalmax_Trans, Bx_yvalmin_Trans, Bx_yvalmax_Trans;
     
+    //! Laser amplitudes on the x-border, for By (primal in y) and Bz (dual in y)
+    std::vector<double> By_laser, Bz_laser;
+    
     //! Conversion factor from degree to radian
     double conv_deg2rad;
     
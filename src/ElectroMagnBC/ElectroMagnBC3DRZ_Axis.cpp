@@ -0,0 +1,137 @@
+
+#include "ElectroMagnBC3DRZ_Axis.h"
+
+#include "Params.h"
+#include "Patch.h"
+#include "ElectroMagn3DRZ.h"
+#include "Field2D.h"
+#include "Tools.h"
+
+using namespace std;
+
+ElectroMagnBC3DRZ_Axis::ElectroMagnBC3DRZ_Axis( Params &params, Patch* patch )
+  : ElectroMagnBC( params, patch )
+{
+    // number of nodes of the primal and dual grid in the x-direction
+    nx_p = params.n_space[0]+1+2*params.oversize[0];
+    nx_d = nx_p+1;
+    
+    dt_ov_dl = dt/params.cell_length[0];
+    dt_ov_dr = dt/params.cell_length[1];
+}
+
+ElectroMagnBC3DRZ_Axis::~ElectroMagnBC3DRZ_Axis()
+{
+}
+
+
+// Nodes of the row f below the axis : f[j] = parity * f[mirror-j] for j<ja
+// (mirror = 2 ja for the primal nodes, 2 ja + 1 for the dual nodes)
+static inline void mirrorRow( double* f, int ja, int mirror, double parity )
+{
+    for (int j=0 ; j<ja ; j++)
+        f[j] = parity * f[mirror-j];
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// E on the axis : El^(d,p) and Et^(p,p) at r=0, Er^(p,d) at r=-dr/2
+//   - m=0 : El from the flux of Bt through the disk of radius dr/2, Et = 0, Er(-dr/2) = -Er(dr/2)
+//   - m=1 : El = 0, Et = -i Er interpolated at r=0, Er = i Et on the axis
+//   - m>1 : all the components vanish on the axis
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagnBC3DRZ_Axis::apply_E(ElectroMagn* EMfields, double time_dual, Patch* patch)
+{
+    if ( !patch->isSouthern() ) return;
+    
+    ElectroMagn3DRZ* EM = static_cast<ElectroMagn3DRZ*>(EMfields);
+    const int ja = EM->j_axis;
+    
+    // El and Et on the axis (Et of the mode 1 needs Er of the other part, unchanged here)
+    for (unsigned int k=0 ; k<EM->nparts() ; k++) {
+        unsigned int m = EM->mode(k);
+        Field2D* El = EM->El_[k];
+        Field2D* Et = EM->Et_[k];
+        for (unsigned int i=0 ; i<nx_d ; i++) {
+            if (m==0)
+                (*El)(i,ja) += 4.*dt_ov_dr * (*EM->Bt_[k])(i,ja+1) - dt * (*EM->Jl_[k])(i,ja);
+            else
+                (*El)(i,ja) = 0.;
+            if (i>=nx_p) continue;
+            if (m==1) {
+                double s = EM->imFactor(k); // i X = s X_partner
+                (*Et)(i,ja) = -( 4.*s*(*EM->Er_[EM->partner(k)])(i,ja+1) + (*Et)(i,ja+1) )/3.;
+            }
+            else
+                (*Et)(i,ja) = 0.;
+        }
+    }
+    
+    // Er below the axis, and all the nodes below the axis
+    for (unsigned int k=0 ; k<EM->nparts() ; k++) {
+        unsigned int m = EM->mode(k);
+        double parity_l = m%2 ? -1. : 1.;
+        for (unsigned int i=0 ; i<nx_p ; i++) {
+            double* Er = &(*EM->Er_[k])(i,0);
+            if (m==1)
+                Er[ja] = 2.*EM->imFactor(k)*(*EM->Et_[EM->partner(k)])(i,ja) - Er[ja+1];
+            else
+                Er[ja] = -Er[ja+1];
+            mirrorRow( Er, ja, 2*ja+1, -parity_l );
+            mirrorRow( &(*EM->Et_[k])(i,0), ja, 2*ja, -parity_l );
+        }
+        for (unsigned int i=0 ; i<nx_d ; i++)
+            mirrorRow( &(*EM->El_[k])(i,0), ja, 2*ja, parity_l );
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// B on the axis : Br^(d,p) at r=0, Bl^(p,d) and Bt^(d,d) at r=-dr/2
+//   - m=0 : Br = 0, Bl(-dr/2) = Bl(dr/2), Bt(-dr/2) = -Bt(dr/2)
+//   - m=1 : Br from Maxwell-Faraday with El/r ~ El(dr)/dr, Bt = -i Br on the axis, Bl(-dr/2) = -Bl(dr/2)
+//   - m>1 : Br = 0, Bl(-dr/2) = -Bl(dr/2), Bt(-dr/2) = -Bt(dr/2)
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagnBC3DRZ_Axis::apply_ymin(ElectroMagn* EMfields, double time_dual, Patch* patch)
+{
+    if ( !patch->isSouthern() ) return;
+    
+    ElectroMagn3DRZ* EM = static_cast<ElectroMagn3DRZ*>(EMfields);
+    const int ja = EM->j_axis;
+    
+    // Br and Bl on the axis
+    for (unsigned int k=0 ; k<EM->nparts() ; k++) {
+        unsigned int m = EM->mode(k);
+        Field2D* Br = EM->Br_[k];
+        Field2D* Et = EM->Et_[k];
+        for (unsigned int i=0 ; i<nx_d ; i++) {
+            if (m!=1)
+                (*Br)(i,ja) = 0.;
+            else if (i>0 && i<nx_d-1)
+                (*Br)(i,ja) += EM->imFactor(k)*dt_ov_dr * (*EM->El_[EM->partner(k)])(i,ja+1)
+                +              dt_ov_dl * ( (*Et)(i,ja) - (*Et)(i-1,ja) );
+        }
+        for (unsigned int i=0 ; i<nx_p ; i++) {
+            double* Bl = &(*EM->Bl_[k])(i,0);
+            Bl[ja] = m==0 ? Bl[ja+1] : -Bl[ja+1];
+        }
+    }
+    
+    // Bt below the axis, and all the nodes below the axis
+    for (unsigned int k=0 ; k<EM->nparts() ; k++) {
+        unsigned int m = EM->mode(k);
+        double parity_l = m%2 ? -1. : 1.;
+        for (unsigned int i=0 ; i<nx_d ; i++) {
+            double* Bt = &(*EM->Bt_[k])(i,0);
+            if (m==1)
+                Bt[ja] = -2.*EM->imFactor(k)*(*EM->Br_[EM->partner(k)])(i,ja) - Bt[ja+1];
+            else
+                Bt[ja] = -Bt[ja+1];
+            mirrorRow( Bt, ja, 2*ja+1, -parity_l );
+            mirrorRow( &(*EM->Br_[k])(i,0), ja, 2*ja, -parity_l );
+        }
+        for (unsigned int i=0 ; i<nx_p ; i++)
+            mirrorRow( &(*EM->Bl_[k])(i,0), ja, 2*ja+1, parity_l );
+    }
+}
+
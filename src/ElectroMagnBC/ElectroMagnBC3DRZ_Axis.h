@@ -0,0 +1,42 @@
+
+#ifndef ELECTROMAGNBC3DRZ_AXIS_H
+#define ELECTROMAGNBC3DRZ_AXIS_H
+
+#include "ElectroMagnBC.h"
+
+class Params;
+class ElectroMagn;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class ElectroMagnBC3DRZ_Axis : fields of the azimuthal modes on the axis r=0 of the 3drz geometry (southern patches)
+//!   - E on the axis after Maxwell-Ampere (apply_E), B on the axis after Maxwell-Faraday (apply_ymin)
+//!   - the nodes below the axis are the mirror of the ones above : F(-r) = (-1)^m F(r) for the l component,
+//!     (-1)^(m+1) F(r) for the r and theta components
+//  --------------------------------------------------------------------------------------------------------------------
+class ElectroMagnBC3DRZ_Axis : public ElectroMagnBC {
+public:
+    ElectroMagnBC3DRZ_Axis( Params &params, Patch* patch );
+    ~ElectroMagnBC3DRZ_Axis();
+    
+    virtual void apply_xmin(ElectroMagn* EMfields, double time_dual, Patch* patch) {}
+    virtual void apply_xmax(ElectroMagn* EMfields, double time_dual, Patch* patch) {}
+    virtual void apply_ymin(ElectroMagn* EMfields, double time_dual, Patch* patch);
+    virtual void apply_ymax(ElectroMagn* EMfields, double time_dual, Patch* patch) {}
+    virtual void apply_E(ElectroMagn* EMfields, double time_dual, Patch* patch);
+    
+private:
+    
+    //! Number of nodes on the primal grid in the x-direction
+    unsigned int nx_p;
+    
+    //! Number of nodes on the dual grid in the x-direction
+    unsigned int nx_d;
+    
+    //! Ratio of the time-step by the spatial-steps dt/dl, dt/dr
+    double dt_ov_dl;
+    double dt_ov_dr;
+    
+};
+
+#endif
+
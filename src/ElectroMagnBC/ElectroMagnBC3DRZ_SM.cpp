@@ -0,0 +1,247 @@
+
+#include "ElectroMagnBC3DRZ_SM.h"
+
+#include <cstdlib>
+
+#include <iostream>
+#include <string>
+#include <algorithm>
+
+#include "Params.h"
+#include "Patch.h"
+#include "ElectroMagn3DRZ.h"
+#include "Field2D.h"
+#include "Tools.h"
+#include "Laser.h"
+
+using namespace std;
+
+ElectroMagnBC3DRZ_SM::ElectroMagnBC3DRZ_SM( Params &params, Patch* patch )
+  : ElectroMagnBC( params, patch )
+{
+    // number of nodes of the primal and dual grid in the x-direction
+    nx_p = params.n_space[0]+1+2*params.oversize[0];
+    nx_d = nx_p+1;
+    // number of nodes of the primal and dual grid in the r-direction
+    ny_p = params.n_space[1]+1+2*params.oversize[1];
+    ny_d = ny_p+1;
+    
+    dt_ov_dx = dt/params.cell_length[0];
+    dt_ov_dy = dt/params.cell_length[1];
+    
+    // BCs at the x-border
+    for (unsigned int side=0 ; side<2 ; side++) {
+        Bl_xval[side].resize(ny_d,0.); // dual in the r-direction
+        Br_xval[side].resize(ny_p,0.); // primal in the r-direction
+        Bt_xval[side].resize(ny_d,0.); // dual in the r-direction
+    }
+    // BCs at r = r_max
+    Bl_rmax.resize(nx_p,0.); // primal in the x-direction
+    Br_rmax.resize(nx_d,0.); // dual in the x-direction
+    Bt_rmax.resize(nx_d,0.); // dual in the x-direction
+    zeros.resize( max(nx_d,ny_d), 0. );
+    
+    // Laser amplitudes
+    By_laser   .resize(ny_p);
+    Bz_laser   .resize(ny_d);
+    Br_laser_im.resize(ny_p);
+    Bt_laser_im.resize(ny_d);
+    
+    // -----------------------------------------------------
+    // Parameters for the Silver-Mueller boundary conditions (see ElectroMagnBC2D_SM)
+    // -----------------------------------------------------
+    
+    // West boundary
+    double factor = 1.0 / (1.0 + dt_ov_dx);
+    Alpha_SM_W    = 2.0                * factor;
+    Beta_SM_W     = - (1.0-dt_ov_dx)   * factor;
+    Gamma_SM_W    = 4.0                * factor;
+    Delta_SM_W    = - dt_ov_dy         * factor;
+    Epsilon_SM_W  = dt_ov_dy           * factor;
+    
+    // East boundary
+    factor        = 1.0 / (-1.0 - dt_ov_dx);
+    Alpha_SM_E    = 2.0                * factor;
+    Beta_SM_E     = - (-1.0+dt_ov_dx)  * factor;
+    Gamma_SM_E    = -4.0               * factor;
+    Delta_SM_E    = - dt_ov_dy         * factor;
+    Epsilon_SM_E  = dt_ov_dy           * factor;
+    
+    // North boundary (r = r_max)
+    factor        = 1.0 / (-1.0 - dt_ov_dy);
+    Alpha_SM_N    = 2.0                * factor;
+    Beta_SM_N     = - (-1.0+dt_ov_dy)  * factor;
+    Delta_SM_N    = - dt_ov_dx         * factor;
+    Epsilon_SM_N  = dt_ov_dx           * factor;
+    
+}
+
+ElectroMagnBC3DRZ_SM::~ElectroMagnBC3DRZ_SM()
+{
+}
+
+void ElectroMagnBC3DRZ_SM::save_fields_BC2D_Long(Field* my_field) {
+    Field2D* field2D=static_cast<Field2D*>(my_field);
+    
+    if (field2D->name=="Bx"){
+        // (Bl)^(pd)
+        for (unsigned int j=0; j<ny_d; j++) {
+            Bl_xval[0][j]=(*field2D)(0,j);
+            Bl_xval[1][j]=(*field2D)(nx_p-1,j);
+        }
+    }
+    
+    if (field2D->name=="By"){
+        // (Br)^(dp)
+        for (unsigned int j=0; j<ny_p; j++) {
+            Br_xval[0][j]=(*field2D)(0,j);
+            Br_xval[1][j]=(*field2D)(nx_d-1,j);
+        }
+    }
+    
+    if (field2D->name=="Bz"){
+        // (Bt)^(dd)
+        for (unsigned int j=0; j<ny_d; j++) {
+            Bt_xval[0][j]=(*field2D)(0,j);
+            Bt_xval[1][j]=(*field2D)(nx_d-1,j);
+        }
+    }
+    
+}
+
+void ElectroMagnBC3DRZ_SM::save_fields_BC2D_Trans(Field* my_field) {
+    Field2D* field2D=static_cast<Field2D*>(my_field);
+    
+    if (field2D->name=="Bx"){
+        // (Bl)^(pd)
+        for (unsigned int i=0; i<nx_p; i++)
+            Bl_rmax[i]=(*field2D)(i,ny_d-1);
+    }
+    
+    if (field2D->name=="By"){
+        // (Br)^(dp)
+        for (unsigned int i=0; i<nx_d; i++)
+            Br_rmax[i]=(*field2D)(i,ny_p-1);
+    }
+    
+    if (field2D->name=="Bz"){
+        // (Bt)^(dd)
+        for (unsigned int i=0; i<nx_d; i++)
+            Bt_rmax[i]=(*field2D)(i,ny_d-1);
+    }
+    
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Silver-Muller condition on Br^(d,p) and Bt^(d,d) at an x-border, for all the modes
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagnBC3DRZ_SM::applyLong( ElectroMagn3DRZ* EM, double time_dual, unsigned int i0, unsigned int i1, unsigned int ip,
+                                      unsigned int side, double alpha, double beta, double gamma, double delta, double epsilon )
+{
+    // Lasers, on all the cells of the border at once
+    By_laser.assign(ny_p, 0.);
+    Bz_laser.assign(ny_d, 0.);
+    for (unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++) {
+        vecLaser[ilaser]->addAmplitudes0(time_dual, By_laser);
+        vecLaser[ilaser]->addAmplitudes1(time_dual, Bz_laser);
+    }
+    // Imaginary parts of the mode 1, interpolated on the staggering of Br and Bt
+    for (unsigned int j=0 ; j<ny_p ; j++)
+        Br_laser_im[j] = 0.5*( Bz_laser[j] + Bz_laser[j+1] );
+    Bt_laser_im[0] = -By_laser[0];
+    for (unsigned int j=1 ; j<ny_p ; j++)
+        Bt_laser_im[j] = -0.5*( By_laser[j-1] + By_laser[j] );
+    Bt_laser_im[ny_d-1] = -By_laser[ny_p-1];
+    
+    for (unsigned int k=0 ; k<EM->nparts() ; k++) {
+        Field2D* Er2D = EM->Er_[k];
+        Field2D* Et2D = EM->Et_[k];
+        Field2D* Bl2D = EM->Bl_[k];
+        Field2D* Br2D = EM->Br_[k];
+        Field2D* Bt2D = EM->Bt_[k];
+        
+        // Static fields (mode 0) and lasers (mode 1)
+        const double* Bl_val = k==0 ? &Bl_xval[side][0] : &zeros[0];
+        const double* Br_val = k==0 ? &Br_xval[side][0] : &zeros[0];
+        const double* Bt_val = k==0 ? &Bt_xval[side][0] : &zeros[0];
+        const double* Br_las = k==1 ? &By_laser[0] : ( k==2 ? &Br_laser_im[0] : &zeros[0] );
+        const double* Bt_las = k==1 ? &Bz_laser[0] : ( k==2 ? &Bt_laser_im[0] : &zeros[0] );
+        
+        // for Br^(d,p)
+        for (unsigned int j=0 ; j<ny_p ; j++) {
+            (*Br2D)(i0,j) = alpha   * (*Et2D)(ip,j)
+            +               beta    *( (*Br2D)(i1,j)-Br_val[j])
+            +               gamma   * Br_las[j]
+            +               delta   *( (*Bl2D)(ip,j+1)-Bl_val[j+1] )
+            +               epsilon *( (*Bl2D)(ip,j)-Bl_val[j] )
+            +               Br_val[j];
+        }//j  ---end compute Br
+        
+        // for Bt^(d,d)
+        for (unsigned int j=0 ; j<ny_d ; j++) {
+            (*Bt2D)(i0,j) = -alpha * (*Er2D)(ip,j)
+            +               beta   *( (*Bt2D)(i1,j)- Bt_val[j])
+            +               gamma  * Bt_las[j]
+            +               Bt_val[j];
+        }//j  ---end compute Bt
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Apply Boundary Conditions
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagnBC3DRZ_SM::apply_xmin(ElectroMagn* EMfields, double time_dual, Patch* patch)
+{
+    if ( patch->isWestern() )
+        applyLong( static_cast<ElectroMagn3DRZ*>(EMfields), time_dual, 0, 1, 0, 0,
+                   Alpha_SM_W, Beta_SM_W, Gamma_SM_W, Delta_SM_W, Epsilon_SM_W );
+}
+
+void ElectroMagnBC3DRZ_SM::apply_xmax(ElectroMagn* EMfields, double time_dual, Patch* patch)
+{
+    if ( patch->isEastern() )
+        applyLong( static_cast<ElectroMagn3DRZ*>(EMfields), time_dual, nx_d-1, nx_d-2, nx_p-1, 1,
+                   Alpha_SM_E, Beta_SM_E, Gamma_SM_E, Delta_SM_E, Epsilon_SM_E );
+}
+
+void ElectroMagnBC3DRZ_SM::apply_ymax(ElectroMagn* EMfields, double time_dual, Patch* patch)
+{
+    if ( patch->isNorthern() ) {
+        
+        ElectroMagn3DRZ* EM = static_cast<ElectroMagn3DRZ*>(EMfields);
+        
+        for (unsigned int k=0 ; k<EM->nparts() ; k++) {
+            Field2D* El2D = EM->El_[k];
+            Field2D* Et2D = EM->Et_[k];
+            Field2D* Bl2D = EM->Bl_[k];
+            Field2D* Br2D = EM->Br_[k];
+            Field2D* Bt2D = EM->Bt_[k];
+            
+            // Static fields (mode 0)
+            const double* Bl_val = k==0 ? &Bl_rmax[0] : &zeros[0];
+            const double* Br_val = k==0 ? &Br_rmax[0] : &zeros[0];
+            const double* Bt_val = k==0 ? &Bt_rmax[0] : &zeros[0];
+            
+            // for Bl^(p,d)
+            for (unsigned int i=0 ; i<nx_p ; i++) {
+                (*Bl2D)(i,ny_d-1) = -Alpha_SM_N   * (*Et2D)(i,ny_p-1)
+                +                   Beta_SM_N    *( (*Bl2D)(i,ny_d-2) -Bl_val[i])
+                +                   Delta_SM_N   *( (*Br2D)(i+1,ny_p-1) -Br_val[i+1])
+                +                   Epsilon_SM_N *( (*Br2D)(i,ny_p-1) -Br_val[i])
+                +                   Bl_val[i];
+            }//i  ---end Bl
+            
+            // for Bt^(d,d)
+            for (unsigned int i=0 ; i<nx_d ; i++) {
+                (*Bt2D)(i,ny_d-1) = Alpha_SM_N * (*El2D)(i,ny_p-1)
+                +                   Beta_SM_N  *( (*Bt2D)(i,ny_d-2)- Bt_val[i])
+                +                   Bt_val[i];
+            }//i  ---end Bt
+        }
+        
+    }//if Northern
+    
+}
+
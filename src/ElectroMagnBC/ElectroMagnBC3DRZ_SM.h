@@ -0,0 +1,70 @@
+
+#ifndef ELECTROMAGNBC3DRZ_SM_H
+#define ELECTROMAGNBC3DRZ_SM_H
+
+
+#include <vector>
+#include "Tools.h"
+#include "ElectroMagnBC.h" 
+
+
+class Params;
+class ElectroMagn;
+class ElectroMagn3DRZ;
+class Field;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class ElectroMagnBC3DRZ_SM : Silver-Muller conditions of ElectroMagnBC2D_SM applied to all the azimuthal modes
+//!   - on the x-borders (l) and at r = r_max, the components l, r, theta playing the role of x, y, z
+//!   - the lasers (polarizations By, Bz of the namelist) are injected in the mode m=1 :
+//!     By = b0, Bz = b1  <=>  Br = (b0, b1), Bt = (b1, -b0) for the (real, imaginary) parts
+//!   - the static fields saved by applyExternalField only concern the mode 0
+//  --------------------------------------------------------------------------------------------------------------------
+class ElectroMagnBC3DRZ_SM : public ElectroMagnBC {
+public:
+
+    ElectroMagnBC3DRZ_SM( Params &params, Patch* patch );
+    ~ElectroMagnBC3DRZ_SM();
+
+    virtual void apply_xmin(ElectroMagn* EMfields, double time_dual, Patch* patch);
+    virtual void apply_xmax(ElectroMagn* EMfields, double time_dual, Patch* patch);
+    virtual void apply_ymin(ElectroMagn* EMfields, double time_dual, Patch* patch) {}
+    virtual void apply_ymax(ElectroMagn* EMfields, double time_dual, Patch* patch);
+    
+private:
+    
+    virtual void save_fields_BC2D_Long(Field*);
+    virtual void save_fields_BC2D_Trans(Field*);
+    
+    //! Condition on the x-border : i0 dual border node, i1 its neighbour, ip primal border node, side 0 (min) or 1 (max)
+    void applyLong( ElectroMagn3DRZ* EM, double time_dual, unsigned int i0, unsigned int i1, unsigned int ip,
+                    unsigned int side, double alpha, double beta, double gamma, double delta, double epsilon );
+    
+    //! Static fields (mode 0) on the x-borders (min, max) and at r = r_max
+    std::vector<double> Bl_xval[2], Br_xval[2], Bt_xval[2];
+    std::vector<double> Bl_rmax, Br_rmax, Bt_rmax;
+    //! Zeros, for the static fields of the modes m>0
+    std::vector<double> zeros;
+    
+    //! Laser amplitudes on the x-border for By (primal in r) and Bz (dual in r),
+    //! and in the mode 1 for Br (primal in r) and Bt (dual in r), real and imaginary parts
+    std::vector<double> By_laser, Bz_laser, Br_laser_im, Bt_laser_im;
+    
+    //! Number of nodes on the primal and dual grids in the x-direction
+    unsigned int nx_p, nx_d;
+    
+    //! Number of nodes on the primal and dual grids in the r-direction
+    unsigned int ny_p, ny_d;
+    
+    //! Ratio of the time-step by the spatial-steps
+    double dt_ov_dx, dt_ov_dy;
+    
+    //! Constants used for the Silver-Mueller boundary conditions (West, East, North)
+    double Alpha_SM_W, Beta_SM_W, Gamma_SM_W, Delta_SM_W, Epsilon_SM_W;
+    double Alpha_SM_E, Beta_SM_E, Gamma_SM_E, Delta_SM_E, Epsilon_SM_E;
+    double Alpha_SM_N, Beta_SM_N, Delta_SM_N, Epsilon_SM_N;
+    
+};
+
+#endif
+
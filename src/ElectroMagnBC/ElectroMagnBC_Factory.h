@@ -5,8 +5,12 @@
 #include "ElectroMagnBC.h"
 #include "ElectroMagnBC1D_SM.h"
 #include "ElectroMagnBC1D_refl.h"
+#include "ElectroMagnBC1D_PML.h"
 #include "ElectroMagnBC2D_SM.h"
 #include "ElectroMagnBC2D_refl.h"
+#include "ElectroMagnBC2D_PML.h"
+#include "ElectroMagnBC3DRZ_SM.h"
+#include "ElectroMagnBC3DRZ_Axis.h"
 
 #include "Params.h"
 
@@ -41,6 +45,10 @@ public:
                 else if ( params.bc_em_type_x[ii] == "reflective" ) {
                     emBoundCond[ii] = new ElectroMagnBC1D_refl(params, patch);
                 }
+                // perfectly matched layer
+                else if ( params.bc_em_type_x[ii] == "pml" ) {
+                    emBoundCond[ii] = new ElectroMagnBC1D_PML(params, patch, ii);
+                }
                 // else: error
                 else if ( params.bc_em_type_x[ii] != "periodic" ) {
                     ERROR( "Unknown boundary bc_em_type_x[" << ii << "]");
@@ -68,6 +76,10 @@ public:
                 else if ( params.bc_em_type_x[ii] == "reflective" ) {
                     emBoundCond[ii] = new ElectroMagnBC2D_refl(params, patch);
                 }
+                // perfectly matched layer
+                else if ( params.bc_em_type_x[ii] == "pml" ) {
+                    emBoundCond[ii] = new ElectroMagnBC2D_PML(params, patch, ii);
+                }
                 // else: error
                 else if ( params.bc_em_type_x[ii] != "periodic" ) {
                     ERROR( "Unknown boundary bc_em_type_x[" << ii << "]");
@@ -82,6 +94,10 @@ public:
                 else if ( params.bc_em_type_y[ii] == "reflective" ) {
                     emBoundCond[ii+2] = new ElectroMagnBC2D_refl(params, patch);
                 }
+                // perfectly matched layer
+                else if ( params.bc_em_type_y[ii] == "pml" ) {
+                    emBoundCond[ii+2] = new ElectroMagnBC2D_PML(params, patch, ii+2);
+                }
                 // else: error
                 else if ( params.bc_em_type_y[ii] != "periodic" ) {
                     ERROR( "Unknown boundary bc_em_type_y[" << ii << "]");
@@ -91,6 +107,33 @@ public:
         }//2d3v
         
         
+        // -----------------
+        // For 3drz Geometry
+        // -----------------
+        else if ( params.geometry == "3drz" ) {
+            
+            // by default use periodic (=NULL) boundary conditions
+            emBoundCond.resize(4, NULL);
+            
+            for (unsigned int ii=0;ii<2;ii++) {
+                // X DIRECTION
+                // silver-muller (injecting/absorbing bcs)
+                if ( params.bc_em_type_x[ii] == "silver-muller" ) {
+                    emBoundCond[ii] = new ElectroMagnBC3DRZ_SM(params, patch);
+                }
+                // else: error
+                else if ( params.bc_em_type_x[ii] != "periodic" ) {
+                    ERROR( "Unknown boundary bc_em_type_x[" << ii << "]");
+                }
+            }
+            
+            // R DIRECTION : axis at r = 0, silver-muller at r = r_max (see Params)
+            emBoundCond[2] = new ElectroMagnBC3DRZ_Axis(params, patch);
+            emBoundCond[3] = new ElectroMagnBC3DRZ_SM(params, patch);
+            
+        }//3drz
+        
+        
         // OTHER GEOMETRIES ARE NOT DEFINED ---
         else {
             ERROR( "Unknown geometry : " << params.geometry );
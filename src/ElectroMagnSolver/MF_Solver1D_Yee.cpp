@@ -4,6 +4,8 @@
 #include "ElectroMagn.h"
 #include "Field1D.h"
 
+#include <algorithm>
+
 MF_Solver1D_Yee::MF_Solver1D_Yee(Params &params)
     : Solver1D(params)
 {
@@ -13,7 +15,7 @@ MF_Solver1D_Yee::~MF_Solver1D_Yee()
 {
 }
 
-void MF_Solver1D_Yee::operator() ( ElectroMagn* fields )
+void MF_Solver1D_Yee::operator() ( ElectroMagn* fields, unsigned int istart, unsigned int iend )
 {
     Field1D* Ey1D   = static_cast<Field1D*>(fields->Ey_);
     Field1D* Ez1D   = static_cast<Field1D*>(fields->Ez_);
@@ -26,7 +28,7 @@ void MF_Solver1D_Yee::operator() ( ElectroMagn* fields )
     // NB: bx is given in 1d and defined when initializing the fields (here put to 0)
     // Transverse fields  by & bz are defined on the dual grid
     //for (unsigned int ix=1 ; ix<nx_p ; ix++) {
-    for (unsigned int ix=1 ; ix<nx_d-1 ; ix++) {
+    for (unsigned int ix=std::max(istart,1u) ; ix<std::min(iend,nx_d-1) ; ix++) {
         (*By1D)(ix)= (*By1D)(ix) + dt_ov_dx * ( (*Ez1D)(ix) - (*Ez1D)(ix-1)) ;
         (*Bz1D)(ix)= (*Bz1D)(ix) - dt_ov_dx * ( (*Ey1D)(ix) - (*Ey1D)(ix-1)) ;
     } 
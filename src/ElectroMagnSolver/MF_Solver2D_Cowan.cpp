@@ -21,7 +21,7 @@ MF_Solver2D_Cowan::~MF_Solver2D_Cowan()
 {
 }
 
-void MF_Solver2D_Cowan::operator() ( ElectroMagn* fields )
+void MF_Solver2D_Cowan::operator() ( ElectroMagn* fields, unsigned int istart, unsigned int iend )
 {
     // Static-cast of the fields
     Field2D* Ex2D = static_cast<Field2D*>(fields->Ex_);
@@ -33,31 +33,42 @@ void MF_Solver2D_Cowan::operator() ( ElectroMagn* fields )
 
 
 
-//    for (unsigned int i=0 ; i<nx_p;  i++) {
-//    for (unsigned int i=1 ; i<nx_d-1;  i++) {
-    for (unsigned int i=1 ; i<nx_d-2;  i++) {
+    // Rows are contiguous : the j loops run on flat pointers to the rows and are vectorized
+    // Magnetic field Bx^(p,d)
+    for (unsigned int i=std::max(istart,1u) ; i<std::min(iend,nx_d-2) ; i++) {
+        double* __restrict__ Bx = &(*Bx2D)(i,0);
+        const double* __restrict__ Ez  = &(*Ez2D)(i,0);
+        const double* __restrict__ Ezp = &(*Ez2D)(i+1,0);
+        const double* __restrict__ Ezm = &(*Ez2D)(i-1,0);
+        #pragma omp simd
         for (unsigned int j=1 ; j<ny_d-1 ; j++) {
-            (*Bx2D)(i,j) -= dt_ov_dy * ( Beta_x*((*Ez2D)(i,j) - (*Ez2D)(i,j-1)) +beta_x*( (*Ez2D)(i+1,j)- (*Ez2D)(i+1,j-1) +(*Ez2D)(i-1,j)- (*Ez2D)(i-1,j-1)));
-	}
+            Bx[j] -= dt_ov_dy * ( Beta_x*(Ez[j] - Ez[j-1]) +beta_x*( Ezp[j] - Ezp[j-1] +Ezm[j] - Ezm[j-1] ) );
+        }
     }
     
-    // Magnetic field By^(d,p)
-    for (unsigned int i=1 ; i<nx_d-1 ; i++) {
+    for (unsigned int i=std::max(istart,1u) ; i<std::min(iend,nx_d-1) ; i++) {
+        double* __restrict__ By = &(*By2D)(i,0);
+        double* __restrict__ Bz = &(*Bz2D)(i,0);
+        const double* __restrict__ Ex  = &(*Ex2D)(i,0);
+        const double* __restrict__ Exp = &(*Ex2D)(i+1,0);
+        const double* __restrict__ Exm = &(*Ex2D)(i-1,0);
+        const double* __restrict__ Ey  = &(*Ey2D)(i,0);
+        const double* __restrict__ Eym = &(*Ey2D)(i-1,0);
+        const double* __restrict__ Ez  = &(*Ez2D)(i,0);
+        const double* __restrict__ Ezm = &(*Ez2D)(i-1,0);
+        // Magnetic field By^(d,p)
+        #pragma omp simd
         for (unsigned int j=1 ; j<ny_p-1 ; j++) {
-            (*By2D)(i,j) += dt_ov_dx * ( Beta_y*((*Ez2D)(i,j) - (*Ez2D)(i-1,j)) +beta_y*((*Ez2D)(i,j+1)- (*Ez2D)(i-1,j+1) +(*Ez2D)(i,j-1)- (*Ez2D)(i-1,j-1) ) );
+            By[j] += dt_ov_dx * ( Beta_y*(Ez[j] - Ezm[j]) +beta_y*(Ez[j+1] - Ezm[j+1] +Ez[j-1] - Ezm[j-1] ) );
         }
-	//(*By2D)(i,0) += dt_ov_dx *( (1-2*beta_y)*((*Ez2D)(i,0) - (*Ez2D)(i-1,0)) +beta_y*((*Ez2D)(i,1)- (*Ez2D)(i-1,1) +(*Ez2D)(i,ny_p-1)- (*Ez2D)(i-1,ny_p-1) ) );
-	//(*By2D)(i,ny_p-1) += dt_ov_dx * ( (1-2*beta_y)*((*Ez2D)(i,ny_p-1) - (*Ez2D)(i-1,ny_p-1)) +beta_y*((*Ez2D)(i,0)- (*Ez2D)(i-1,0) +(*Ez2D)(i,ny_p-2)- (*Ez2D)(i-1,ny_p-2) ) );
-    
-    
-    // Magnetic field Bz^(d,d)
-    //for (unsigned int i=1 ; i<nx_d-1 ; i++) {
+        
+        // Magnetic field Bz^(d,d)
+        #pragma omp simd
         for (unsigned int j=1 ; j<ny_d-1 ; j++) {
-            (*Bz2D)(i,j) += dt_ov_dy * (Beta_x*( (*Ex2D)(i,j) - (*Ex2D)(i,j-1) ) +beta_x*((*Ex2D)(i+1,j)- (*Ex2D)(i+1,j-1)+ (*Ex2D)(i-1,j)- (*Ex2D)(i-1,j-1)))
-            -               dt_ov_dx * (Beta_y*( (*Ey2D)(i,j) - (*Ey2D)(i-1,j) ) +beta_y*((*Ey2D)(i,j+1)- (*Ey2D)(i-1,j+1)+ (*Ey2D)(i,j-1)- (*Ey2D)(i-1,j-1)));   
-	}
+            Bz[j] += dt_ov_dy * (Beta_x*( Ex[j] - Ex[j-1] ) +beta_x*( Exp[j] - Exp[j-1] + Exm[j] - Exm[j-1] ))
+            -        dt_ov_dx * (Beta_y*( Ey[j] - Eym[j] ) +beta_y*( Ey[j+1] - Eym[j+1] + Ey[j-1] - Eym[j-1] ));
+        }
     }
-//}// end parallel
 }//END solveMaxwellFaraday
 
 
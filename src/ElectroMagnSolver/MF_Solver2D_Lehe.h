@@ -15,8 +15,9 @@ public:
     MF_Solver2D_Lehe(Params &params);
     virtual ~MF_Solver2D_Lehe();
 
-    //! Overloading of () operator
-    virtual void operator()( ElectroMagn* fields);
+    using Solver2D::operator();
+    //! Overloading of () operator : Maxwell-Faraday on the rows [istart,iend[
+    virtual void operator()( ElectroMagn* fields, unsigned int istart, unsigned int iend );
  
     // Parameters for the Maxwell-Faraday solver
     double dx;
@@ -0,0 +1,295 @@
+
+#include "MF_Solver2D_PSATD.h"
+
+#include "ElectroMagn.h"
+#include "Field2D.h"
+
+#include <cmath>
+
+using namespace std;
+
+MF_Solver2D_PSATD::MF_Solver2D_PSATD(Params &params)
+: Solver2D(params),
+  fft_(nx_d, ny_d)
+{
+    dt = params.timestep;
+    dx = params.cell_length[0];
+    dy = params.cell_length[1];
+    oversize_ = params.oversize;
+
+    // Wave numbers of the FFT grid k in [-pi/dx, pi/dx] x [-pi/dy, pi/dy], and K of the Yee curls
+    unsigned int n = nx_d*ny_d;
+    m_curl_  .resize( n );
+    m_curl2_ .resize( n );
+    m_curl2J_.resize( n );
+    m_curlJ_ .resize( n );
+    for (unsigned int i=0 ; i<nx_d ; i++) {
+        double kx = 2.*M_PI * ( 2*i<=nx_d ? (double)i : (double)i-(double)nx_d ) / ( nx_d*dx );
+        double Kx = 2./dx * sin( 0.5*kx*dx );
+        for (unsigned int j=0 ; j<ny_d ; j++) {
+            double ky = 2.*M_PI * ( 2*j<=ny_d ? (double)j : (double)j-(double)ny_d ) / ( ny_d*dy );
+            double Ky = 2./dy * sin( 0.5*ky*dy );
+            double K = sqrt( Kx*Kx + Ky*Ky );
+            double k = sqrt( kx*kx + ky*ky );
+            unsigned int ij = i*ny_d+j;
+            // the curls are 0 at k=0 : the multipliers are set to their limit
+            if ( k>0. ) {
+                double C = cos( k*dt ), S = sin( k*dt );
+                m_curl_  [ij] = S/K                 - dt;
+                m_curl2_ [ij] = (1.-C)/(K*K)        - 0.5*dt*dt;
+                m_curl2J_[ij] = (dt-S/k)/(K*K)      - dt*dt*dt/6.;
+                m_curlJ_ [ij] = (1.-C)/(k*K)        - 0.5*dt*dt;
+                m_curl_  [ij] /= (double)n;
+                m_curl2_ [ij] /= (double)n;
+                m_curl2J_[ij] /= (double)n;
+                m_curlJ_ [ij] /= (double)n;
+            } else {
+                m_curl_[ij] = m_curl2_[ij] = m_curl2J_[ij] = m_curlJ_[ij] = 0.;
+            }
+        }
+    }
+
+    for (unsigned int c=0 ; c<3 ; c++) {
+        E_[c].resize( n, 0. );
+        B_[c].resize( n, 0. );
+        J_[c].resize( n, 0. );
+        curlE_ [c].resize( n, 0. );
+        curlB_ [c].resize( n, 0. );
+        curlJ_ [c].resize( n, 0. );
+    }
+    acc_ .resize( n );
+    work_.resize( n );
+    
+    // The brackets of E are staggered as B, those of B as E
+    vector<unsigned int> dimPrim( 2 );
+    for (unsigned int i=0 ; i<2 ; i++)
+        dimPrim[i] = params.n_space[i]+1+2*params.oversize[i];
+    bracketE_[0] = new Field2D( dimPrim, 0, true,  "bracketEx" );
+    bracketE_[1] = new Field2D( dimPrim, 1, true,  "bracketEy" );
+    bracketE_[2] = new Field2D( dimPrim, 2, true,  "bracketEz" );
+    bracketB_[0] = new Field2D( dimPrim, 0, false, "bracketBx" );
+    bracketB_[1] = new Field2D( dimPrim, 1, false, "bracketBy" );
+    bracketB_[2] = new Field2D( dimPrim, 2, false, "bracketBz" );
+    for (unsigned int c=0 ; c<3 ; c++) {
+        spectralTerms.push_back( bracketE_[c] );
+        spectralTerms.push_back( bracketB_[c] );
+    }
+}
+
+MF_Solver2D_PSATD::~MF_Solver2D_PSATD()
+{
+    for (unsigned int c=0 ; c<3 ; c++) {
+        delete bracketE_[c];
+        delete bracketB_[c];
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// E^(n+1) = E - dt J + curl bracketE on all the points (Maxwell-Ampere), B^(n+1) = B - curl bracketB on the points of
+// Maxwell-Faraday : the guard cells of B must then be exchanged
+// ---------------------------------------------------------------------------------------------------------------------
+void MF_Solver2D_PSATD::operator() ( ElectroMagn* fields, unsigned int istart, unsigned int iend )
+{
+    if ( istart!=0 || iend!=nx_d )
+        ERROR( "The PSATD solver works on whole patches only (fused_maxwell must be False)" );
+    
+    Field2D* Ex2D = static_cast<Field2D*>(fields->Ex_);
+    Field2D* Ey2D = static_cast<Field2D*>(fields->Ey_);
+    Field2D* Ez2D = static_cast<Field2D*>(fields->Ez_);
+    Field2D* Bx2D = static_cast<Field2D*>(fields->Bx_);
+    Field2D* By2D = static_cast<Field2D*>(fields->By_);
+    Field2D* Bz2D = static_cast<Field2D*>(fields->Bz_);
+    Field2D* Jx2D = static_cast<Field2D*>(fields->Jx_);
+    Field2D* Jy2D = static_cast<Field2D*>(fields->Jy_);
+    Field2D* Jz2D = static_cast<Field2D*>(fields->Jz_);
+    
+    // Electric field Ex^(d,p), Ey^(p,d), Ez^(p,p)
+    for (unsigned int i=0 ; i<nx_d ; i++) {
+        for (unsigned int j=0 ; j<ny_p ; j++)
+            (*Ex2D)(i,j) += -dt*(*Jx2D)(i,j) + ( (*bracketE_[2])(i,j+1) - (*bracketE_[2])(i,j) ) / dy;
+    }
+    for (unsigned int i=0 ; i<nx_p ; i++) {
+        for (unsigned int j=0 ; j<ny_d ; j++)
+            (*Ey2D)(i,j) += -dt*(*Jy2D)(i,j) - ( (*bracketE_[2])(i+1,j) - (*bracketE_[2])(i,j) ) / dx;
+        for (unsigned int j=0 ; j<ny_p ; j++)
+            (*Ez2D)(i,j) += -dt*(*Jz2D)(i,j) + ( (*bracketE_[1])(i+1,j) - (*bracketE_[1])(i,j) ) / dx
+                                             - ( (*bracketE_[0])(i,j+1) - (*bracketE_[0])(i,j) ) / dy;
+    }
+    
+    // Magnetic field Bx^(p,d), By^(d,p), Bz^(d,d)
+    for (unsigned int i=0 ; i<nx_p ; i++) {
+        for (unsigned int j=1 ; j<ny_d-1 ; j++)
+            (*Bx2D)(i,j) -= ( (*bracketB_[2])(i,j) - (*bracketB_[2])(i,j-1) ) / dy;
+    }
+    for (unsigned int i=1 ; i<nx_d-1 ; i++) {
+        for (unsigned int j=0 ; j<ny_p ; j++)
+            (*By2D)(i,j) += ( (*bracketB_[2])(i,j) - (*bracketB_[2])(i-1,j) ) / dx;
+        for (unsigned int j=1 ; j<ny_d-1 ; j++)
+            (*Bz2D)(i,j) -= ( (*bracketB_[1])(i,j) - (*bracketB_[1])(i-1,j) ) / dx
+                          - ( (*bracketB_[0])(i,j) - (*bracketB_[0])(i,j-1) ) / dy;
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Brackets of the updates of E and B from E^n, B^n and J^(n+1/2) (see the class description)
+// ---------------------------------------------------------------------------------------------------------------------
+void MF_Solver2D_PSATD::computeSpectralTerms( ElectroMagn* fields )
+{
+    Field2D* E[3] = { static_cast<Field2D*>(fields->Ex_), static_cast<Field2D*>(fields->Ey_), static_cast<Field2D*>(fields->Ez_) };
+    Field2D* B[3] = { static_cast<Field2D*>(fields->Bx_), static_cast<Field2D*>(fields->By_), static_cast<Field2D*>(fields->Bz_) };
+    Field2D* J[3] = { static_cast<Field2D*>(fields->Jx_), static_cast<Field2D*>(fields->Jy_), static_cast<Field2D*>(fields->Jz_) };
+    
+    // Copy on the FFT grid
+    for (unsigned int c=0 ; c<3 ; c++) {
+        Field2D* F[3] = { E[c], B[c], J[c] };
+        vector<double>* G[3] = { &E_[c], &B_[c], &J_[c] };
+        for (unsigned int f=0 ; f<3 ; f++) {
+            unsigned int n0 = F[f]->dims_[0], n1 = F[f]->dims_[1];
+            for (unsigned int i=0 ; i<n0 ; i++) {
+                const double* src = &(*F[f])(i,0);
+                double* dst = &(*G[f])[i*ny_d];
+                for (unsigned int j=0 ; j<n1 ; j++)
+                    dst[j] = src[j];
+            }
+        }
+    }
+    
+    // Curls at time n
+    curlE( E_, curlE_ );
+    curlB( B_, curlB_ );
+    curlE( J_, curlJ_ );
+
+    double dt2 = 0.5*dt*dt, dt3 = dt*dt*dt/6.;
+    double aE[3] = { dt,  -dt2, dt3 };
+    double aB[3] = { dt,   dt2, -dt2 };
+    const double* w = reinterpret_cast<double*>( &acc_[0] );
+
+    // Brackets of Ex, Ey (on the points of Bx, By)
+    for (unsigned int k=0 ; k<nx_d*ny_d ; k++) acc_[k] = 0.;
+    accumulate( &B_    [0],  1., &B_    [1],  1., m_curl_   );
+    accumulate( &curlE_[0], -1., &curlE_[1], -1., m_curl2_  );
+    accumulate( &curlJ_[0],  1., &curlJ_[1],  1., m_curl2J_ );
+    fft_.transform( &acc_[0], false );
+    for (unsigned int c=0 ; c<2 ; c++) {
+        vector<double>* q[3] = { &B_[c], &curlE_[c], &curlJ_[c] };
+        sum( bracketE_[c], w+c, q, aE, 3 );
+    }
+
+    // Brackets of Bx, By (on the points of Ex, Ey)
+    for (unsigned int k=0 ; k<nx_d*ny_d ; k++) acc_[k] = 0.;
+    accumulate( &E_    [0],  1., &E_    [1],  1., m_curl_  );
+    accumulate( &curlB_[0],  1., &curlB_[1],  1., m_curl2_ );
+    accumulate( &J_    [0], -1., &J_    [1], -1., m_curlJ_ );
+    fft_.transform( &acc_[0], false );
+    for (unsigned int c=0 ; c<2 ; c++) {
+        vector<double>* q[3] = { &E_[c], &curlB_[c], &J_[c] };
+        sum( bracketB_[c], w+c, q, aB, 3 );
+    }
+
+    // Brackets of Ez (on the points of Bz) and Bz (on the points of Ez)
+    for (unsigned int k=0 ; k<nx_d*ny_d ; k++) acc_[k] = 0.;
+    accumulate( &B_    [2],  1., &E_    [2],  1., m_curl_   );
+    accumulate( &curlE_[2], -1., &curlB_[2],  1., m_curl2_  );
+    accumulate( &curlJ_[2],  1., NULL,        0., m_curl2J_ );
+    accumulate( NULL,        0., &J_    [2], -1., m_curlJ_  );
+    fft_.transform( &acc_[0], false );
+    vector<double>* qE[3] = { &B_[2], &curlE_[2], &curlJ_[2] };
+    sum( bracketE_[2], w, qE, aE, 3 );
+    vector<double>* qB[3] = { &E_[2], &curlB_[2], &J_[2] };
+    sum( bracketB_[2], w+1, qB, aB, 3 );
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Curl of the Maxwell-Faraday equation : E (dp, pd, pp) -> B (pd, dp, dd)
+// ---------------------------------------------------------------------------------------------------------------------
+void MF_Solver2D_PSATD::curlE( vector<double>* e, vector<double>* b )
+{
+    const double* ex = &e[0][0];
+    const double* ey = &e[1][0];
+    const double* ez = &e[2][0];
+    double* bx = &b[0][0];
+    double* by = &b[1][0];
+    double* bz = &b[2][0];
+    for (unsigned int i=0 ; i<nx_p ; i++) {
+        for (unsigned int j=1 ; j<ny_d-1 ; j++)
+            bx[i*ny_d+j] = ( ez[i*ny_d+j] - ez[i*ny_d+j-1] ) / dy;
+    }
+    for (unsigned int i=1 ; i<nx_d-1 ; i++) {
+        for (unsigned int j=0 ; j<ny_p ; j++)
+            by[i*ny_d+j] = -( ez[i*ny_d+j] - ez[(i-1)*ny_d+j] ) / dx;
+        for (unsigned int j=1 ; j<ny_d-1 ; j++)
+            bz[i*ny_d+j] = ( ey[i*ny_d+j] - ey[(i-1)*ny_d+j] ) / dx - ( ex[i*ny_d+j] - ex[i*ny_d+j-1] ) / dy;
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Curl of the Maxwell-Ampere equation : B (pd, dp, dd) -> E (dp, pd, pp)
+// ---------------------------------------------------------------------------------------------------------------------
+void MF_Solver2D_PSATD::curlB( vector<double>* b, vector<double>* e )
+{
+    const double* bx = &b[0][0];
+    const double* by = &b[1][0];
+    const double* bz = &b[2][0];
+    double* ex = &e[0][0];
+    double* ey = &e[1][0];
+    double* ez = &e[2][0];
+    for (unsigned int i=0 ; i<nx_d ; i++) {
+        for (unsigned int j=0 ; j<ny_p ; j++)
+            ex[i*ny_d+j] = ( bz[i*ny_d+j+1] - bz[i*ny_d+j] ) / dy;
+    }
+    for (unsigned int i=0 ; i<nx_p ; i++) {
+        for (unsigned int j=0 ; j<ny_d ; j++)
+            ey[i*ny_d+j] = -( bz[(i+1)*ny_d+j] - bz[i*ny_d+j] ) / dx;
+        for (unsigned int j=0 ; j<ny_p ; j++)
+            ez[i*ny_d+j] = ( by[(i+1)*ny_d+j] - by[i*ny_d+j] ) / dx - ( bx[i*ny_d+j+1] - bx[i*ny_d+j] ) / dy;
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// The multipliers are real and even in k : two real terms are transformed at once
+// ---------------------------------------------------------------------------------------------------------------------
+void MF_Solver2D_PSATD::accumulate( vector<double>* q0, double a0, vector<double>* q1, double a1, vector<double>& m )
+{
+    unsigned int n = nx_d*ny_d;
+    for (unsigned int k=0 ; k<n ; k++)
+        work_[k] = complex<double>( q0 ? a0*(*q0)[k] : 0., q1 ? a1*(*q1)[k] : 0. );
+    fft_.transform( &work_[0], true );
+    for (unsigned int k=0 ; k<n ; k++)
+        acc_[k] += m[k] * work_[k];
+}
+
+
+void MF_Solver2D_PSATD::sum( Field2D* F, const double* w, vector<double>** q, const double* a, unsigned int nq )
+{
+    unsigned int n0 = F->dims_[0], n1 = F->dims_[1];
+    vector<double> w1( n1 );
+    for (unsigned int j=0 ; j<n1 ; j++)
+        w1[j] = ownership( j, n1, F->isDual_[1], oversize_[1] );
+    for (unsigned int i=0 ; i<n0 ; i++) {
+        double w0 = ownership( i, n0, F->isDual_[0], oversize_[0] );
+        double* f = &(*F)(i,0);
+        for (unsigned int j=0 ; j<n1 ; j++) {
+            unsigned int k = i*ny_d+j;
+            f[j] = w[2*k];
+            for (unsigned int iq=0 ; iq<nq ; iq++)
+                f[j] += a[iq] * (*q[iq])[k];
+            f[j] *= w0 * w1[j];
+        }
+    }
+}
+
+// Part of the point i of the field owned by the patch : 1 inside the patch, 1/2 on its borders, 0 outside
+double MF_Solver2D_PSATD::ownership( unsigned int i, unsigned int n_elem, bool isDual, unsigned int oversize )
+{
+    unsigned int lo = oversize, hi = n_elem-1-oversize-isDual;
+    if ( isDual )
+        return ( i>lo && i<=hi ) ? 1. : 0.;
+    if ( i==lo || i==hi )
+        return 0.5;
+    return ( i>lo && i<hi ) ? 1. : 0.;
+}
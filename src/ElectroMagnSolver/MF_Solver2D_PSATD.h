@@ -0,0 +1,77 @@
+#ifndef MF_SOLVER2D_PSATD_H
+#define MF_SOLVER2D_PSATD_H
+
+#include <complex>
+#include <vector>
+
+#include "Solver2D.h"
+#include "FFT.h"
+
+class ElectroMagn;
+class Field2D;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class MF_Solver2D_PSATD : local pseudo-spectral analytical time-domain solver on the Yee grid
+//!   - E and B are both known at integer times (B_ = B_m, see VectorPatch::solveMaxwell), and are advanced together
+//!     from (E^n, B^n, J^(n+1/2)) to (E^(n+1), B^(n+1)) by the exact solution of Maxwell's equations with J constant
+//!     over the timestep. With C = cos(c|k|dt), S = sin(c|k|dt), and the curls of the Yee scheme :
+//!       E^(n+1) = E - dt J + curl[ S/|K| B - (1-C)/|K|^2 curl E + ( dt - S/(c|k|) )/|K|^2 curl J ]
+//!       B^(n+1) = B - curl[ S/|K| E + (1-C)/|K|^2 curl B - (1-C)/(c|k||K|) J ]
+//!     |K| being the wave number of the Yee curls, |K|^2 = (2/dx sin(kx dx/2))^2 + (2/dy sin(ky dy/2))^2
+//!   - the dispersion is exact ( omega = c|k| ) and the scheme is stable for any timestep, with or without plasma
+//!   - the brackets (spectralTerms) are computed by FFTs of each patch with its guard cells (at least
+//!     psatd_guard_cells), except their limit at k=0 which is computed on the grid. The errors due to the periodicity
+//!     of the FFTs decay over the guard cells. Each patch keeps only the points it owns (1/2 of the shared borders),
+//!     then the brackets are summed between the patches as the currents, so that all the patches see the same
+//!     brackets : the box must be periodic
+//!   - the outer curls are those of the Yee scheme, computed by operator() as Maxwell-Ampere and Maxwell-Faraday
+//!     from the summed brackets : the Yee divergences, hence Gauss's law, are preserved
+//  --------------------------------------------------------------------------------------------------------------------
+class MF_Solver2D_PSATD : public Solver2D
+{
+
+public:
+    //! Creator for MF_Solver2D_PSATD
+    MF_Solver2D_PSATD(Params &params);
+    virtual ~MF_Solver2D_PSATD();
+
+    //! Overloading of () operator : E and B from the summed brackets, only on the whole patch (istart=0, iend=nx_d)
+    virtual void operator()( ElectroMagn* fields, unsigned int istart, unsigned int iend );
+    //! Brackets of the updates of E (on the points of B) and of B (on the points of E)
+    virtual void computeSpectralTerms( ElectroMagn* fields );
+
+private:
+    //! Curls of the Yee scheme on the nx_d x ny_d grid (0 where the stencil leaves the patch)
+    //!   - curlE : from the points of E to those of B (Maxwell-Faraday)
+    //!   - curlB : from the points of B to those of E (Maxwell-Ampere)
+    void curlE( std::vector<double>* e, std::vector<double>* b );
+    void curlB( std::vector<double>* b, std::vector<double>* e );
+
+    //! Adds m(k) FFT( a0 q0 + i a1 q1 )(k) to acc_ (q0 or q1 may be NULL)
+    void accumulate( std::vector<double>* q0, double a0, std::vector<double>* q1, double a1, std::vector<double>& m );
+
+    //! Sets F to the filtered terms (w, one double out of two) plus the terms at k=0 ( sum of a[n] q[n] ),
+    //! times the part owned by the patch (see ownership)
+    void sum( Field2D* F, const double* w, std::vector<double>** q, const double* a, unsigned int nq );
+    static double ownership( unsigned int i, unsigned int n_elem, bool isDual, unsigned int oversize );
+
+    double dt, dx, dy;
+    std::vector<unsigned int> oversize_;
+
+    //! Multipliers minus their limit at k=0, divided by nx_d*ny_d (the FFTs are not normalized) :
+    //! S/|K|, (1-C)/|K|^2, ( dt - S/(c|k|) )/|K|^2 and (1-C)/(c|k||K|)
+    std::vector<double> m_curl_, m_curl2_, m_curl2J_, m_curlJ_;
+
+    //! Brackets of E (on the points of Bx, By, Bz) and of B (on the points of Ex, Ey, Ez), also in spectralTerms
+    Field2D* bracketE_[3];
+    Field2D* bracketB_[3];
+
+    //! E, B and J copied on the nx_d x ny_d grid (stored by rows, 0 outside the field), and their curls
+    std::vector<double> E_[3], B_[3], J_[3], curlE_[3], curlB_[3], curlJ_[3];
+    //! Sum of the filtered terms in Fourier space, and one pair of terms
+    std::vector<std::complex<double> > acc_, work_;
+    FFT2D fft_;
+
+};//END class
+
+#endif
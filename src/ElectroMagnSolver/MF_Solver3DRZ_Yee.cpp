@@ -0,0 +1,88 @@
+
+#include "MF_Solver3DRZ_Yee.h"
+
+#include "ElectroMagn3DRZ.h"
+#include "Field2D.h"
+
+#include <algorithm>
+
+MF_Solver3DRZ_Yee::MF_Solver3DRZ_Yee(Params &params)
+: Solver2D(params)
+{
+    dt = params.timestep;
+}
+
+MF_Solver3DRZ_Yee::~MF_Solver3DRZ_Yee()
+{
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+//   Bl -= dt/(r dr) d(r Et) + i m dt/r Er
+//   Br += dt dEt/dl + i m dt/r El
+//   Bt += dt dEl/dr - dt dEr/dl
+// the nodes on and below the axis are set by ElectroMagnBC3DRZ_Axis
+// ---------------------------------------------------------------------------------------------------------------------
+void MF_Solver3DRZ_Yee::operator() ( ElectroMagn* fields, unsigned int istart, unsigned int iend )
+{
+    ElectroMagn3DRZ* EM = static_cast<ElectroMagn3DRZ*>(fields);
+    const double* __restrict__ rp  = &(EM->r_p[0]);
+    const double* __restrict__ irp = &(EM->inv_r_p[0]);
+    const double* __restrict__ ird = &(EM->inv_r_d[0]);
+    const double dt_ov_dr = EM->dt_ov_dr;
+    const unsigned int jp = EM->j_first;
+    const unsigned int jd = std::max( EM->j_first, 1u );
+    
+    for (unsigned int k=0 ; k<EM->nparts() ; k++) {
+        const double c_dt = EM->imFactor(k)*dt;
+        const unsigned int ko = EM->partner(k);
+        Field2D* El2D = EM->El_[k];
+        Field2D* Er2D = EM->Er_[k];
+        Field2D* Et2D = EM->Et_[k];
+        Field2D* Bl2D = EM->Bl_[k];
+        Field2D* Br2D = EM->Br_[k];
+        Field2D* Bt2D = EM->Bt_[k];
+        
+        // Rows are contiguous : the j loops run on flat pointers to the rows and are vectorized
+        for (unsigned int i=istart ; i<std::min(iend,nx_d-1) ; i++) {
+            // Magnetic field Bl^(p,d)
+            {
+                double* __restrict__ Bl = &(*Bl2D)(i,0);
+                const double* __restrict__ Et  = &(*Et2D)(i,0);
+                const double* __restrict__ Ero = &(*EM->Er_[ko])(i,0);
+                #pragma omp simd
+                for (unsigned int j=jd ; j<ny_d-1 ; j++) {
+                    Bl[j] -= dt_ov_dr*ird[j] * ( rp[j]*Et[j] - rp[j-1]*Et[j-1] )
+                    +        c_dt*ird[j] * Ero[j];
+                }
+            }
+            if (i==0) continue;
+            
+            // Magnetic field Br^(d,p)
+            {
+                double* __restrict__ Br = &(*Br2D)(i,0);
+                const double* __restrict__ Et  = &(*Et2D)(i,0);
+                const double* __restrict__ Etm = &(*Et2D)(i-1,0);
+                const double* __restrict__ Elo = &(*EM->El_[ko])(i,0);
+                #pragma omp simd
+                for (unsigned int j=jp ; j<ny_p ; j++) {
+                    Br[j] += dt_ov_dx * ( Et[j] - Etm[j] )
+                    +        c_dt*irp[j] * Elo[j];
+                }
+            }
+            
+            // Magnetic field Bt^(d,d)
+            {
+                double* __restrict__ Bt = &(*Bt2D)(i,0);
+                const double* __restrict__ El  = &(*El2D)(i,0);
+                const double* __restrict__ Er  = &(*Er2D)(i,0);
+                const double* __restrict__ Erm = &(*Er2D)(i-1,0);
+                #pragma omp simd
+                for (unsigned int j=jd ; j<ny_d-1 ; j++) {
+                    Bt[j] += dt_ov_dr * ( El[j] - El[j-1] )
+                    -        dt_ov_dx * ( Er[j] - Erm[j] );
+                }
+            }
+        }
+    }
+}
+
@@ -0,0 +1,28 @@
+#ifndef MF_SOLVER3DRZ_YEE_H
+#define MF_SOLVER3DRZ_YEE_H
+
+#include "Solver2D.h" 
+class ElectroMagn;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class MF_Solver3DRZ_Yee : Maxwell-Faraday for all the azimuthal modes of ElectroMagn3DRZ, off the axis
+//  --------------------------------------------------------------------------------------------------------------------
+class MF_Solver3DRZ_Yee : public Solver2D
+{
+
+public:
+    //! Creator for MF_Solver3DRZ_Yee
+    MF_Solver3DRZ_Yee(Params &params);
+    virtual ~MF_Solver3DRZ_Yee();
+
+    using Solver2D::operator();
+    //! Overloading of () operator : Maxwell-Faraday on the rows [istart,iend[
+    virtual void operator()( ElectroMagn* fields, unsigned int istart, unsigned int iend );
+
+protected:
+    double dt;
+
+};//END class
+
+#endif
+
@@ -1,9 +1,12 @@
 #ifndef SOLVER_H
 #define SOLVER_H
 
+#include <vector>
+
 #include "Params.h"
 
 class ElectroMagn;
+class Field;
 
 //  --------------------------------------------------------------------------------------------------------------------
 //! Class Solver
@@ -18,6 +21,13 @@ public:
 
     //! Overloading of () operator
     virtual void operator()( ElectroMagn* fields) = 0;
+    //! Same on the rows [istart,iend[ of the dual grid only (used by the fused Maxwell sweep)
+    virtual void operator()( ElectroMagn* fields, unsigned int istart, unsigned int iend ) = 0;
+    //! Spectral solvers : terms computed by FFTs on each patch, summed between the patches before operator()
+    virtual void computeSpectralTerms( ElectroMagn* fields ) {};
+
+    //! Fields of the terms computed by computeSpectralTerms (empty for the finite-difference solvers)
+    std::vector<Field*> spectralTerms;
 
 protected:
 
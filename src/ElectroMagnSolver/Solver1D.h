@@ -19,8 +19,12 @@ public:
     };
     virtual ~Solver1D() {};
 
-    //! Overloading of () operator
-    virtual void operator()( ElectroMagn* fields) = 0;
+    //! Overloading of () operator : all the rows
+    void operator()( ElectroMagn* fields) {
+        (*this)( fields, 0, nx_d );
+    }
+    //! Overloading of () operator : rows [istart,iend[
+    virtual void operator()( ElectroMagn* fields, unsigned int istart, unsigned int iend ) = 0;
 
 protected:
     unsigned int nx_p;
@@ -5,6 +5,8 @@
 #include "MF_Solver2D_Yee.h"
 #include "MF_Solver2D_Cowan.h"
 #include "MF_Solver2D_Lehe.h"
+#include "MF_Solver2D_PSATD.h"
+#include "MF_Solver3DRZ_Yee.h"
 
 #include "Params.h"
 
@@ -27,8 +29,14 @@ public:
                 solver = new MF_Solver2D_Cowan(params);
             } else if(params.maxwell_sol == "Lehe" ){
                 solver = new MF_Solver2D_Lehe(params);
+            } else if(params.maxwell_sol == "PSATD" ){
+                solver = new MF_Solver2D_PSATD(params);
             }
             
+        } else if ( params.geometry == "3drz" ) {
+            if (params.maxwell_sol == "Yee") {
+                solver = new MF_Solver3DRZ_Yee(params);
+            }
         }
         
         if (!solver) {
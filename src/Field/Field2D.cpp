@@ -3,6 +3,10 @@
 #include <iostream>
 #include <vector>
 #include <cstring>
+#include <cstdlib>
+#include <algorithm>
+
+#include "AlignedAllocator.h"
 
 using namespace std;
 
@@ -54,10 +58,7 @@ Field2D::Field2D(vector<unsigned int> dims, unsigned int mainDim, bool isPrimal,
 Field2D::~Field2D()
 {
 
-    if (data_!=NULL) {
-        delete [] data_;
-        delete [] data_2D;
-    }
+    if (data_!=NULL) deallocateDims();
 }
 
 
@@ -69,32 +70,49 @@ void Field2D::allocateDims(std::vector<unsigned int> dims )
     //! \todo{Comment on what you are doing here (MG for JD)}
     dims_=dims;
     if (dims_.size()!=2) ERROR("Alloc error must be 2 : " << dims.size());
-    if (data_!=NULL) delete [] data_;
 	
     isDual_.resize( dims.size(), 0 );
 	
-    data_ = new double[dims_[0]*dims_[1]];
-    //! \todo{check row major order!!! (JD)}
-	
-    data_2D= new double*[dims_[0]];
-    for (unsigned int i=0; i<dims_[0]; i++) {
-        data_2D[i] = data_ + i*dims_[1];
-        for (unsigned int j=0; j<dims_[1]; j++) data_2D[i][j] = 0.0;
-    }
-	
-    globalDims_ = dims_[0]*dims_[1];
+    allocateData();
 	
 }
 
 void Field2D::deallocateDims()
 {
-    delete [] data_;
+    free( data_ );
     data_ = NULL;
     delete [] data_2D;
     data_2D = NULL;
         
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Allocate dims_[0]*dims_[1] doubles (row major) set to 0
+//   - data_ is aligned on SMILEI_ALIGNMENT bytes and padded to a multiple of SMILEI_ALIGNMENT bytes,
+//     so that the flat loops of the solvers run on whole vectors from an aligned address
+//   - rows are not padded : the linearized array (MPI types, dumps, projectors) is unchanged
+// ---------------------------------------------------------------------------------------------------------------------
+void Field2D::allocateData()
+{
+    if (data_!=NULL) deallocateDims();
+
+    globalDims_ = dims_[0]*dims_[1];
+
+    const unsigned int nalign = SMILEI_ALIGNMENT/sizeof(double);
+    unsigned int npadded = ( (globalDims_+nalign-1)/nalign ) * nalign;
+    void* p(NULL);
+    if ( posix_memalign( &p, SMILEI_ALIGNMENT, std::max(npadded,nalign)*sizeof(double) ) != 0 )
+        ERROR("Cannot allocate field " << name << " (" << dims_[0] << "x" << dims_[1] << ")");
+    data_ = static_cast<double*>(p);
+    memset( data_, 0, npadded*sizeof(double) );
+
+    //! \todo{check row major order!!! (JD)}
+    data_2D= new double*[dims_[0]];
+    for (unsigned int i=0; i<dims_[0]; i++)
+        data_2D[i] = data_ + i*dims_[1];
+
+}
+
 void Field2D::allocateDims(unsigned int dims1, unsigned int dims2)
 {
 	vector<unsigned int> dims(2);
@@ -111,7 +129,6 @@ void Field2D::allocateDims(std::vector<unsigned int> dims, unsigned int mainDim,
     //! \todo{Comment on what you are doing here (MG for JD)}
     dims_=dims;
     if (dims_.size()!=2) ERROR("Alloc error must be 2 : " << dims.size());
-    if (data_) delete [] data_;
 
     // isPrimal define if mainDim is Primal or Dual
     isDual_.resize( dims.size(), 0 );
@@ -125,16 +142,7 @@ void Field2D::allocateDims(std::vector<unsigned int> dims, unsigned int mainDim,
     for ( unsigned int j=0 ; j<dims.size() ; j++ )
         dims_[j] += isDual_[j];
 
-    data_ = new double[dims_[0]*dims_[1]];
-    //! \todo{check row major order!!! (JD)}
-
-    data_2D= new double*[dims_[0]];
-    for (unsigned int i=0; i<dims_[0]; i++)  {
-        data_2D[i] = data_ + i*dims_[1];
-        for (unsigned int j=0; j<dims_[1]; j++) data_2D[i][j] = 0.0;
-    }
-
-    globalDims_ = dims_[0]*dims_[1];
+    allocateData();
 
 }
 
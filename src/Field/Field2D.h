@@ -43,8 +43,8 @@ public:
     //! Overloading of the () operator allowing to set a new value for the (i,j) element of a Field2D
     inline double& operator () (unsigned int i,unsigned int j) {
         DEBUGEXEC(if (i>=dims_[0] || j>=dims_[1]) ERROR(name << "Out of limits ("<< i << "," << j << ")  > (" <<dims_[0] << "," <<dims_[1] << ")" ));
-        DEBUGEXEC(if (!std::isfinite(data_2D[i][j])) ERROR(name << " Not finite "<< i << "," << j << " = " << data_2D[i][j]));
-        return data_2D[i][j];
+        DEBUGEXEC(if (!std::isfinite(data_[i*dims_[1]+j])) ERROR(name << " Not finite "<< i << "," << j << " = " << data_[i*dims_[1]+j]));
+        return data_[i*dims_[1]+j];
     };
 
     /*inline double& operator () (unsigned int i) {
@@ -56,10 +56,15 @@ public:
     //! Overloading of the () operator allowing to get the value of the (i,j) element of a Field2D
     inline double operator () (unsigned int i,unsigned int j) const {
         DEBUGEXEC(if (i>=dims_[0] || j>=dims_[1]) ERROR(name << "Out of limits "<< i << " " << j));
-        DEBUGEXEC(if (!std::isfinite(data_2D[i][j])) ERROR(name << "Not finite "<< i << "," << j << " = " << data_2D[i][j]));
-        return data_2D[i][j];
+        DEBUGEXEC(if (!std::isfinite(data_[i*dims_[1]+j])) ERROR(name << "Not finite "<< i << "," << j << " = " << data_[i*dims_[1]+j]));
+        return data_[i*dims_[1]+j];
     };
 
+    //! Flat index of the (i,j) element in data_ (row major, rows of dims_[1] elements)
+    inline unsigned int index(unsigned int i,unsigned int j) const {
+        return i*dims_[1]+j;
+    }
+
     /*inline double operator () (unsigned int i) const {
         DEBUGEXEC(if (i>=dims_[0]*dims_[1]) ERROR("Out of limits & "<< i));
         DEBUGEXEC(if (!std::isfinite(data_2D[i])) ERROR("Not finite "<< i));
@@ -67,12 +72,14 @@ public:
     };*/
 
     //double** data_;
-    //! this will present the data as a 2d matrix
+    //! this will present the data as a 2d matrix (row pointers into data_, the solvers use the flat index instead)
     double **data_2D;
 
     virtual double norm2(unsigned int istart[3][2], unsigned int bufsize[3][2]);
 
 private:
+    //! Allocate data_ (aligned, padded, set to 0) and the row pointers data_2D from dims_
+    void allocateData();
     //!\todo{Comment what are these stuffs (MG for JD)}
     //double *data_2D;
 };
@@ -24,6 +24,11 @@ public:
 
     virtual void operator() (ElectroMagn* EMfields, Particles &particles, int ipart, LocalFields* ELoc, LocalFields* BLoc, LocalFields* JLoc, double* RhoLoc) = 0;
 
+    //! Ponderomotive potential of the laser envelope and its gradient, in smpi->dynamics_PHIpart and dynamics_GradPHIpart
+    virtual void envelope(ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread) {
+        ERROR( "The laser envelope model is only available in 2d3v with interpolation_order = 2" );
+    }
+
 private:
 
 };//END class
@@ -124,15 +124,25 @@ void Interpolator1D4Order::operator() (ElectroMagn* EMfields, Particles &particl
 }
 void Interpolator1D4Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
 {
-    std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
-    std::vector<LocalFields> *Bpart = &(smpi->dynamics_Bpart[ithread]);
+    std::vector<double> *Epart = &(smpi->dynamics_Epart[ithread]);
+    std::vector<double> *Bpart = &(smpi->dynamics_Bpart[ithread]);
     std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
     std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
 
+    // Fields are buffered as struct of arrays for the pusher
+    int nparts = Epart->size()/3;
+    LocalFields ELoc, BLoc;
+
     //Loop on bin particles
     for (unsigned int ipart=istart ; ipart<iend; ipart++ ) {
         //Interpolation on current particle
-        (*this)(EMfields, particles, ipart, &(*Epart)[ipart], &(*Bpart)[ipart]);
+        (*this)(EMfields, particles, ipart, &ELoc, &BLoc);
+        (*Epart)[ipart]          = ELoc.x;
+        (*Epart)[ipart+nparts]   = ELoc.y;
+        (*Epart)[ipart+2*nparts] = ELoc.z;
+        (*Bpart)[ipart]          = BLoc.x;
+        (*Bpart)[ipart+nparts]   = BLoc.y;
+        (*Bpart)[ipart+2*nparts] = BLoc.z;
         //Buffering of iol and delta
         (*iold)[ipart] = ip_;
         (*delta)[ipart] = xjmxi;
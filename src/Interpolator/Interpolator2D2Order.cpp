@@ -6,6 +6,7 @@
 #include "ElectroMagn.h"
 #include "Field2D.h"
 #include "Particles.h"
+#include "LaserEnvelope2D.h"
 
 using namespace std;
 
@@ -152,15 +153,25 @@ void Interpolator2D2Order::operator() (ElectroMagn* EMfields, Particles &particl
 
 void Interpolator2D2Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
 {
-    std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
-    std::vector<LocalFields> *Bpart = &(smpi->dynamics_Bpart[ithread]);
+    std::vector<double> *Epart = &(smpi->dynamics_Epart[ithread]);
+    std::vector<double> *Bpart = &(smpi->dynamics_Bpart[ithread]);
     std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
     std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
 
+    // Fields are buffered as struct of arrays for the pusher
+    int nparts = Epart->size()/3;
+    LocalFields ELoc, BLoc;
+
     //Loop on bin particles
     for (unsigned int ipart=istart ; ipart<iend; ipart++ ) {
         //Interpolation on current particle
-        (*this)(EMfields, particles, ipart, &(*Epart)[ipart], &(*Bpart)[ipart]);
+        (*this)(EMfields, particles, ipart, &ELoc, &BLoc);
+        (*Epart)[ipart]          = ELoc.x;
+        (*Epart)[ipart+nparts]   = ELoc.y;
+        (*Epart)[ipart+2*nparts] = ELoc.z;
+        (*Bpart)[ipart]          = BLoc.x;
+        (*Bpart)[ipart+nparts]   = BLoc.y;
+        (*Bpart)[ipart+2*nparts] = BLoc.z;
         //Buffering of iol and delta
         (*iold)[ipart*2] = ip_;
         (*iold)[ipart*2+1] = jp_;
@@ -169,3 +180,46 @@ void Interpolator2D2Order::operator() (ElectroMagn* EMfields, Particles &particl
     }
 
 }
+
+// ---------------------------------------------------------------------------------------------------------------------
+// 2nd Order Interpolation of the ponderomotive potential of the laser envelope and of its gradient (primal grid)
+// ---------------------------------------------------------------------------------------------------------------------
+void Interpolator2D2Order::envelope(ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
+{
+    Field2D* Phi2D       = EMfields->envelope->Phi;
+    Field2D* GradPhix2D  = EMfields->envelope->GradPhi_x;
+    Field2D* GradPhiy2D  = EMfields->envelope->GradPhi_y;
+
+    double *PHIpart     = smpi->dynamics_PHIpart[ithread].data();
+    double *GradPHIpart = smpi->dynamics_GradPHIpart[ithread].data();
+    int nparts = smpi->dynamics_PHIpart[ithread].size();
+
+    double delta2;
+    for (int ipart=istart ; ipart<iend; ipart++ ) {
+        double xpn = particles.position(0, ipart)*dx_inv_;
+        double ypn = particles.position(1, ipart)*dy_inv_;
+        int ip = round(xpn);
+        int jp = round(ypn);
+
+        deltax = xpn - (double)ip;
+        delta2 = deltax*deltax;
+        coeffxp_[0] = 0.5 * (delta2-deltax+0.25);
+        coeffxp_[1] = 0.75 - delta2;
+        coeffxp_[2] = 0.5 * (delta2+deltax+0.25);
+
+        deltay = ypn - (double)jp;
+        delta2 = deltay*deltay;
+        coeffyp_[0] = 0.5 * (delta2-deltay+0.25);
+        coeffyp_[1] = 0.75 - delta2;
+        coeffyp_[2] = 0.5 * (delta2+deltay+0.25);
+
+        ip -= i_domain_begin;
+        jp -= j_domain_begin;
+
+        PHIpart[ipart]                = compute( &coeffxp_[1], &coeffyp_[1], Phi2D     , ip, jp);
+        GradPHIpart[ipart]            = compute( &coeffxp_[1], &coeffyp_[1], GradPhix2D, ip, jp);
+        GradPHIpart[ipart+nparts]     = compute( &coeffxp_[1], &coeffyp_[1], GradPhiy2D, ip, jp);
+        GradPHIpart[ipart+2*nparts]   = 0.;
+    }
+
+}
@@ -0,0 +1,155 @@
+#include "Interpolator3DRZ2Order.h"
+
+#include <cmath>
+#include <iostream>
+
+#include "ElectroMagn3DRZ.h"
+#include "Field2D.h"
+#include "Particles.h"
+
+using namespace std;
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Creator for Interpolator3DRZ2Order
+// ---------------------------------------------------------------------------------------------------------------------
+Interpolator3DRZ2Order::Interpolator3DRZ2Order(Params &params, Patch *patch) : Interpolator2D(params, patch)
+{
+
+    dx_inv_ = 1.0/params.cell_length[0];
+    dy_inv_ = 1.0/params.cell_length[1];
+
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// 2nd Order Interpolation of the fields at a the particle position (3 nodes are used)
+// ---------------------------------------------------------------------------------------------------------------------
+void Interpolator3DRZ2Order::operator() (ElectroMagn* EMfields, Particles &particles, int ipart, LocalFields* ELoc, LocalFields* BLoc)
+{
+    ElectroMagn3DRZ* EM = static_cast<ElectroMagn3DRZ*>(EMfields);
+
+    // Normalized particle position, angle (0 on the axis)
+    double r = particles.distance_to_axis(ipart);
+    double xpn = particles.position(0, ipart)*dx_inv_;
+    double rpn = r*dy_inv_;
+    double cos_t = 1., sin_t = 0.;
+    if ( r > 0. ) {
+        cos_t = particles.position(1, ipart)/r;
+        sin_t = particles.position(2, ipart)/r;
+    }
+    theta_ = atan2( sin_t, cos_t );
+
+
+    // Indexes of the central nodes
+    ip_ = round(xpn);
+    id_ = round(xpn+0.5);
+    jp_ = round(rpn);
+    jd_ = round(rpn+0.5);
+
+
+    // Declaration and calculation of the coefficient for interpolation
+    double delta2;
+
+    deltax   = xpn - (double)id_ + 0.5;
+    delta2  = deltax*deltax;
+    coeffxd_[0] = 0.5 * (delta2-deltax+0.25);
+    coeffxd_[1] = 0.75 - delta2;
+    coeffxd_[2] = 0.5 * (delta2+deltax+0.25);
+
+    deltax   = xpn - (double)ip_;
+    delta2  = deltax*deltax;
+    coeffxp_[0] = 0.5 * (delta2-deltax+0.25);
+    coeffxp_[1] = 0.75 - delta2;
+    coeffxp_[2] = 0.5 * (delta2+deltax+0.25);
+
+    deltar   = rpn - (double)jd_ + 0.5;
+    delta2  = deltar*deltar;
+    coeffrd_[0] = 0.5 * (delta2-deltar+0.25);
+    coeffrd_[1] = 0.75 - delta2;
+    coeffrd_[2] = 0.5 * (delta2+deltar+0.25);
+
+    deltar   = rpn - (double)jp_;
+    delta2  = deltar*deltar;
+    coeffrp_[0] = 0.5 * (delta2-deltar+0.25);
+    coeffrp_[1] = 0.75 - delta2;
+    coeffrp_[2] = 0.5 * (delta2+deltar+0.25);
+
+    // First index for summation
+    ip_ = ip_ - i_domain_begin;
+    id_ = id_ - i_domain_begin;
+    jp_ = jp_ - j_domain_begin;
+    jd_ = jd_ - j_domain_begin;
+
+
+    // Sum of the parts : the mode 0, then Re cos(m theta) + Im sin(m theta) (the nodes below the axis are set by
+    // ElectroMagnBC3DRZ_Axis)
+    double El(0.), Er(0.), Et(0.), Bl(0.), Br(0.), Bt(0.);
+    double cos_m = 1., sin_m = 0.;
+    for (unsigned int k=0 ; k<EM->nparts() ; k++) {
+        double w;
+        if ( k==0 ) {
+            w = 1.;
+        } else if ( k%2 ) {
+            // exp(i m theta) = exp(i (m-1) theta) exp(i theta)
+            double c = cos_m*cos_t - sin_m*sin_t;
+            sin_m    = sin_m*cos_t + cos_m*sin_t;
+            cos_m    = c;
+            w = cos_m;
+        } else {
+            w = sin_m;
+        }
+        // El^(d,p), Er^(p,d), Et^(p,p)
+        El += w*compute( &coeffxd_[1], &coeffrp_[1], EM->El_[k], id_, jp_);
+        Er += w*compute( &coeffxp_[1], &coeffrd_[1], EM->Er_[k], ip_, jd_);
+        Et += w*compute( &coeffxp_[1], &coeffrp_[1], EM->Et_[k], ip_, jp_);
+        // Bl^(p,d), Br^(d,p), Bt^(d,d)
+        Bl += w*compute( &coeffxp_[1], &coeffrd_[1], EM->Bl_m[k], ip_, jd_);
+        Br += w*compute( &coeffxd_[1], &coeffrp_[1], EM->Br_m[k], id_, jp_);
+        Bt += w*compute( &coeffxd_[1], &coeffrd_[1], EM->Bt_m[k], id_, jd_);
+    }
+
+    // Cartesian components
+    (*ELoc).x = El;
+    (*ELoc).y = Er*cos_t - Et*sin_t;
+    (*ELoc).z = Er*sin_t + Et*cos_t;
+    (*BLoc).x = Bl;
+    (*BLoc).y = Br*cos_t - Bt*sin_t;
+    (*BLoc).z = Br*sin_t + Bt*cos_t;
+
+} // END Interpolator3DRZ2Order
+
+void Interpolator3DRZ2Order::operator() (ElectroMagn* EMfields, Particles &particles, int ipart, LocalFields* ELoc, LocalFields* BLoc, LocalFields* JLoc, double* RhoLoc)
+{
+    ERROR("Interpolation of the currents and density (probes) not yet defined for 3drz");
+}
+
+void Interpolator3DRZ2Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
+{
+    std::vector<double> *Epart = &(smpi->dynamics_Epart[ithread]);
+    std::vector<double> *Bpart = &(smpi->dynamics_Bpart[ithread]);
+    std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
+    std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
+
+    // Fields are buffered as struct of arrays for the pusher
+    int nparts = Epart->size()/3;
+    LocalFields ELoc, BLoc;
+
+    //Loop on bin particles
+    for (int ipart=istart ; ipart<iend; ipart++ ) {
+        //Interpolation on current particle
+        (*this)(EMfields, particles, ipart, &ELoc, &BLoc);
+        (*Epart)[ipart]          = ELoc.x;
+        (*Epart)[ipart+nparts]   = ELoc.y;
+        (*Epart)[ipart+2*nparts] = ELoc.z;
+        (*Bpart)[ipart]          = BLoc.x;
+        (*Bpart)[ipart+nparts]   = BLoc.y;
+        (*Bpart)[ipart+2*nparts] = BLoc.z;
+        //Buffering of iol, delta and theta
+        (*iold)[ipart*3] = ip_;
+        (*iold)[ipart*3+1] = jp_;
+        (*delta)[ipart*3] = deltax;
+        (*delta)[ipart*3+1] = deltar;
+        (*delta)[ipart*3+2] = theta_;
+    }
+
+}
@@ -0,0 +1,53 @@
+#ifndef INTERPOLATOR3DRZ2ORDER_H
+#define INTERPOLATOR3DRZ2ORDER_H
+
+
+#include "Interpolator2D.h"
+#include "Field2D.h"
+
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class for 2nd order interpolator for 3drz simulations
+//!   - the coefficients are the 2D ones in (x, r), with r the distance of the particle to the axis
+//!   - the modes are summed at the angle theta of the particle : F = F_0 + sum_m Re_m cos(m theta) + Im_m sin(m theta)
+//!   - the (l, r, theta) components are then rotated to (x, y, z)
+//  --------------------------------------------------------------------------------------------------------------------
+class Interpolator3DRZ2Order : public Interpolator2D
+{
+
+public:
+    Interpolator3DRZ2Order(Params&, Patch*);
+    ~Interpolator3DRZ2Order() override final {};
+
+    void operator() (ElectroMagn* EMfields, Particles &particles, int ipart, LocalFields* ELoc, LocalFields* BLoc) override final ;
+    //! Buffers ip, jp (iold) and delta x, delta r, theta (deltaold) with a stride of 3 for Projector3DRZ2Order
+    void operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread) override final ;
+    void operator() (ElectroMagn* EMfields, Particles &particles, int ipart, LocalFields* ELoc, LocalFields* BLoc, LocalFields* JLoc, double* RhoLoc) override final ;
+
+    inline double compute( double* coeffx, double* coeffy, Field2D* f, int idx, int idy) {
+        double interp_res(0.);
+        for (int iloc=-1 ; iloc<2 ; iloc++) {
+            for (int jloc=-1 ; jloc<2 ; jloc++) {
+                interp_res += *(coeffx+iloc) * *(coeffy+jloc) * (*f)(idx+iloc,idy+jloc);
+            }
+        }
+        return interp_res;
+    };
+
+private:
+    // Last prim index computed
+    int ip_, jp_;
+    // Last dual index computed
+    int id_, jd_;
+    // Last delta computed
+    double deltax, deltar;
+    // Last angle computed
+    double theta_;
+    // Interpolation coefficient on Prim grid
+    double coeffxp_[3], coeffrp_[3];
+    // Interpolation coefficient on Dual grid
+    double coeffxd_[3], coeffrd_[3];
+
+};//END class
+
+#endif
@@ -7,6 +7,7 @@
 #include "Interpolator1D4Order.h"
 #include "Interpolator2D2Order.h"
 #include "Interpolator2D4Order.h"
+#include "Interpolator3DRZ2Order.h"
 
 #include "Params.h"
 #include "Patch.h"
@@ -32,6 +33,12 @@ public:
         else if ( ( params.geometry == "2d3v" ) && ( params.interpolation_order == 2 ) ) {
             Interp = new Interpolator2D2Order(params, patch);
         }
+        // ---------------
+        // 3drz simulation
+        // ---------------
+        else if ( ( params.geometry == "3drz" ) && ( params.interpolation_order == 2 ) ) {
+            Interp = new Interpolator3DRZ2Order(params, patch);
+        }
         else {
             ERROR( "Unknwon parameters : " << params.geometry << ", Order : " << params.interpolation_order );
         }
@@ -11,6 +11,7 @@ Ionization::Ionization(Params& params, Species * species) {
     nDim_particle        = params.nDim_particle;
     atomic_number_       = species->atomic_number;
     ionized_species_mass = species->mass;
+    random               = &species->random;
 
     // Normalization constant from Smilei normalization to/from atomic units
     eV_to_au = 1.0 / 27.2116;
@@ -7,6 +7,7 @@
 #include "Params.h"
 #include "Field.h"
 #include "Particles.h"
+#include "Random.h"
 
 
 //! Class Ionization: generic class allowing to define Ionization physics
@@ -40,6 +41,9 @@ protected:
     unsigned int nDim_particle;
     unsigned int atomic_number_;
     unsigned int ionized_species_mass;
+    
+    //! Random numbers of the ionized species (keyed by patch and timestep)
+    Random* random;
 
 private:
 
@@ -45,7 +45,7 @@ void IonizationTunnel::operator() (Particles &particles, int ipart, LocalFields
     unsigned int k_times = 0;
 
     // Generate a random number between 0 and 1
-    double ran_p = (double)rand() / RAND_MAX;
+    double ran_p = random->uniform();
 
     // Absolute value of the electric field normalized in atomic units
     double E = EC_to_au * sqrt( Epart.x*Epart.x + Epart.y*Epart.y + Epart.z*Epart.z );
@@ -147,7 +147,7 @@ void IonizationTunnel::operator() (Particles &particles, int ipart, LocalFields
     unsigned int k_times = 0;
 
     // Generate a random number between 0 and 1
-    double ran_p = (double)rand() / RAND_MAX;
+    double ran_p = random->uniform();
 
     // Absolute value of the electric field normalized in atomic units
     double E = EC_to_au * sqrt( Epart.x*Epart.x + Epart.y*Epart.y + Epart.z*Epart.z );
@@ -85,6 +85,9 @@ void SimWindow::operate(VectorPatch& vecPatches, SmileiMPI* smpi, Params& params
             vecPatches.patches_.push_back( newPatch );
         }
     }
+    // The auxiliary fields along x are not sent : the layout of the layers changes with the position of the patches
+    for (unsigned int ipatch = 0 ; ipatch < vecPatches.size() ; ipatch++)
+        vecPatches(ipatch)->EMfields->auxiliaryFieldsXDisabled();
 
     for ( int ipatch = nPatches-1 ; ipatch >= 0 ; ipatch--) {
 
@@ -1,8 +1,11 @@
+// the numpy C API is imported by this file (see PyTools.h)
+#define SMILEI_IMPORT_ARRAY
 #include "PyTools.h"
 #include "Params.h"
 #include "Species.h"
 #include <cmath>
 #include <iomanip>
+#include <algorithm>
 #include "Tools.h"
 #include "SmileiMPI.h"
 
@@ -29,6 +32,13 @@ namelist("")
     
     //init Python
     PyTools::openPython();
+#ifdef SMILEI_USE_NUMPY
+    // numpy C API, used to evaluate the python profiles on arrays
+    if (_import_array() < 0) {
+        PyTools::checkPyError();
+        ERROR("Smilei was compiled with numpy but numpy cannot be imported");
+    }
+#endif
     
     // First, we tell python to filter the ctrl-C kill command (or it would prevent to kill the code execution).
     // This is done separately from other scripts because we don't want it in the concatenated python namelist.
@@ -106,13 +116,14 @@ namelist("")
     }
     
     
-    // random seed
-    unsigned int random_seed=0;
+    // random seed, the same on all processes (the random numbers only depend on the seed and on the patch)
+    random_seed=0;
     if (!PyTools::extract("random_seed", random_seed, "Main")) {
         random_seed = time(NULL);
     }
-    
-    srand(random_seed);
+    int seed = random_seed;
+    smpi->bcast(seed);
+    random_seed = seed;
     
     // --------------
     // Stop & Restart
@@ -141,7 +152,7 @@ namelist("")
     
     // geometry of the simulation
     PyTools::extract("geometry", geometry, "Main");
-    if (geometry!="1d3v" && geometry!="2d3v") {
+    if (geometry!="1d3v" && geometry!="2d3v" && geometry!="3drz") {
         ERROR("Geometry " << geometry << " does not exist");
     }
     setDimensions();
@@ -154,6 +165,16 @@ namelist("")
     if (geometry=="2d3v" && interpolation_order==4) {
         ERROR("Interpolation/projection order " << interpolation_order << " not yet defined in 2D");
     }
+    if (geometry=="3drz" && interpolation_order!=2) {
+        ERROR("Interpolation/projection order " << interpolation_order << " not yet defined in 3drz");
+    }
+    
+    // number of azimuthal modes (3drz geometry)
+    nmodes = 2;
+    PyTools::extract("nmodes", nmodes, "Main");
+    if ( geometry=="3drz" && nmodes<1 ) {
+        ERROR("nmodes must be at least 1 (found " << nmodes << ")");
+    }
     
     //!\todo (MG to JD) Please check if this parameter should still appear here
     // Disabled, not compatible for now with particles sort
@@ -185,10 +206,11 @@ namelist("")
     for (unsigned int i=0; i<nDim_field; i++) {
         res_space2 += res_space[i]*res_space[i];
     }
-    dtCFL=1.0/sqrt(res_space2);
-    if ( timestep>dtCFL ) {
-        WARNING("CFL problem: timestep=" << timestep << " should be smaller than " << dtCFL);
+    // the azimuthal modes m < nmodes add (m/r)^2 ~ (m/dr)^2 to the transverse wavenumber near the axis
+    if (geometry=="3drz") {
+        res_space2 += (double)((nmodes-1)*(nmodes-1))*res_space[1]*res_space[1];
     }
+    dtCFL=1.0/sqrt(res_space2);
     
     
     // simulation duration & length
@@ -214,6 +236,20 @@ namelist("")
             bc_em_type_y.resize(2); bc_em_type_y[1]=bc_em_type_y[0];
         }
     }
+    if ( geometry == "3drz" ) {
+        // the lower border of the box is the axis : bc_em_type_y only defines the condition at r = r_max
+        if ( !PyTools::extract("bc_em_type_y", bc_em_type_y, "Main") || bc_em_type_y.size()==0 )
+            ERROR("Electromagnetic boundary condition type (bc_em_type_y) not defined" );
+        string bc_rmax = bc_em_type_y.back();
+        if ( bc_rmax != "silver-muller" )
+            ERROR("In 3drz, the only boundary condition at r = r_max is \"silver-muller\" (found \"" << bc_rmax << "\")");
+        bc_em_type_y.resize(2);
+        bc_em_type_y[0] = "axis";
+        bc_em_type_y[1] = bc_rmax;
+        for (unsigned int i=0 ; i<bc_em_type_x.size() ; i++)
+            if ( bc_em_type_x[i] != "silver-muller" && bc_em_type_x[i] != "periodic" )
+                ERROR("In 3drz, bc_em_type_x must be \"silver-muller\" or \"periodic\" (found \"" << bc_em_type_x[i] << "\")");
+    }
     if ( geometry == "3d3v" ) {
         if ( !PyTools::extract("bc_em_type_z", bc_em_type_z, "Main") )
             ERROR("Electromagnetic boundary condition type (bc_em_type_z) not defined" );
@@ -225,10 +261,137 @@ namelist("")
     // Maxwell Solver 
     PyTools::extract("maxwell_sol", maxwell_sol, "Main");
     
+    // the PSATD solver has no CFL condition in vacuum, but the projectors and the particle exchange require that
+    // the particles cross less than one cell per timestep
+    if ( maxwell_sol=="PSATD" ) {
+        double dx_min = *min_element( cell_length.begin(), cell_length.end() );
+        if ( timestep>=dx_min )
+            ERROR("With maxwell_sol = \"PSATD\", timestep=" << timestep << " must be smaller than the smallest cell length " << dx_min);
+        // the boundary conditions of the box are written for the staggered B of the finite-difference solvers, and
+        // the spectral terms are summed between the patches across all the borders (see MF_Solver2D_PSATD)
+        bool periodic = true;
+        for (unsigned int i=0 ; i<bc_em_type_x.size() ; i++) periodic = periodic && (bc_em_type_x[i]=="periodic");
+        for (unsigned int i=0 ; i<bc_em_type_y.size() ; i++) periodic = periodic && (bc_em_type_y[i]=="periodic");
+        if ( !periodic )
+            ERROR("maxwell_sol = \"PSATD\" requires periodic electromagnetic boundary conditions");
+        if ( PyTools::nComponents("MovingWindow") > 0 )
+            ERROR("maxwell_sol = \"PSATD\" is not compatible with the moving window");
+    }
+    else if ( timestep>dtCFL ) {
+        WARNING("CFL problem: timestep=" << timestep << " should be smaller than " << dtCFL);
+    }
+    
+    fused_maxwell = true;
+    PyTools::extract("fused_maxwell", fused_maxwell, "Main");
+    
+    // Perfectly matched layers
+    pml_cells = 10;
+    PyTools::extract("pml_cells", pml_cells, "Main");
+    pml_order = 3;
+    PyTools::extract("pml_order", pml_order, "Main");
+    pml_reflection = 1.e-8;
+    PyTools::extract("pml_reflection", pml_reflection, "Main");
+    bool has_pml_x = false, has_pml = false;
+    for (unsigned int i=0 ; i<bc_em_type_x.size() ; i++) has_pml_x = has_pml_x || (bc_em_type_x[i]=="pml");
+    has_pml = has_pml_x;
+    for (unsigned int i=0 ; i<bc_em_type_y.size() ; i++) has_pml = has_pml || (bc_em_type_y[i]=="pml");
+    if (has_pml) {
+        // the layer corrects the curls of the Yee stencil only
+        if ( maxwell_sol != "Yee" )
+            ERROR("The pml boundary conditions require maxwell_sol = \"Yee\" (found \"" << maxwell_sol << "\")");
+        // the layers are set at the creation of the patches, they do not follow the window
+        if ( has_pml_x && PyTools::nComponents("MovingWindow") > 0 )
+            ERROR("bc_em_type_x = \"pml\" is not compatible with the moving window");
+        if ( pml_cells == 0 )
+            ERROR("pml_cells must be at least 1");
+        if ( pml_reflection <= 0. || pml_reflection >= 1. )
+            ERROR("pml_reflection must be in ]0,1[ (found " << pml_reflection << ")");
+        if ( fused_maxwell ) {
+            WARNING("fused_maxwell is not compatible with the pml boundary conditions : disabled");
+            fused_maxwell = false;
+        }
+    }
+    
+    // Pseudo-spectral solver : FFTs on whole patches, with at least psatd_guard_cells guard cells
+    psatd_guard_cells = 8;
+    PyTools::extract("psatd_guard_cells", psatd_guard_cells, "Main");
+    if ( maxwell_sol == "PSATD" ) {
+        if ( fused_maxwell ) {
+            WARNING("fused_maxwell is not compatible with the PSATD solver : disabled");
+            fused_maxwell = false;
+        }
+    }
+    
+    // Binomial filter of the currents
+    current_filter_passes = 0;
+    PyTools::extract("current_filter_passes", current_filter_passes, "Main");
+    current_filter_compensation = true;
+    PyTools::extract("current_filter_compensation", current_filter_compensation, "Main");
+    
+    // Quasi-3D cylindrical geometry : Yee solver on the (x,r) grid of each azimuthal mode
+    if ( geometry == "3drz" ) {
+        if ( maxwell_sol != "Yee" )
+            ERROR("In 3drz, maxwell_sol must be \"Yee\" (found \"" << maxwell_sol << "\")");
+        if ( fused_maxwell ) {
+            WARNING("fused_maxwell is not compatible with the 3drz geometry : disabled");
+            fused_maxwell = false;
+        }
+        if ( current_filter_passes > 0 )
+            ERROR("current_filter_passes is not available in 3drz");
+        if ( nmodes < 2 && PyTools::nComponents("Laser") > 0 )
+            ERROR("In 3drz, the lasers are injected in the mode m=1 : nmodes must be at least 2");
+        if ( PyTools::nComponents("Antenna") > 0 )
+            ERROR("Antennas are not available in 3drz");
+        if ( PyTools::nComponents("DiagProbe") > 0 )
+            ERROR("DiagProbe is not available in 3drz");
+    }
+    
+    // Laser envelope model
+    envelope_model = false;
+    for (unsigned int ilaser=0 ; ilaser<PyTools::nComponents("Laser") ; ilaser++) {
+        bool envelope = false;
+        PyTools::extract("envelope", envelope, "Laser", ilaser);
+        if ( !envelope ) continue;
+        if ( envelope_model )
+            ERROR("Only one Laser can have envelope = True");
+        if ( geometry != "2d3v" || interpolation_order != 2 )
+            ERROR("The laser envelope model (Laser #" << ilaser << ") is only available in 2d3v with interpolation_order = 2");
+        string boxSide;
+        PyTools::extract("boxSide", boxSide, "Laser", ilaser);
+        if ( boxSide != "west" )
+            ERROR("Laser #" << ilaser << ": a laser with envelope = True must have boxSide = \"west\"");
+        envelope_model = true;
+    }
+    
+    // Poisson Solver (initial electric field)
+    poisson_solver = "cg";
+    PyTools::extract("poisson_solver", poisson_solver, "Main");
+    if ( poisson_solver != "cg" && poisson_solver != "mgcg" )
+        ERROR("poisson_solver must be \"cg\" or \"mgcg\" (found \"" << poisson_solver << "\")");
+    poisson_max_iteration = 50000;
+    PyTools::extract("poisson_max_iteration", poisson_max_iteration, "Main");
+    poisson_error_max = 1.e-14;
+    PyTools::extract("poisson_error_max", poisson_error_max, "Main");
+    
     
     if (!PyTools::extract("clrw",clrw, "Main")) {
         clrw = 1;
     }
+    
+    vectorization = true;
+    PyTools::extract("vectorization", vectorization, "Main");
+    
+    fused_dynamics = true;
+    PyTools::extract("fused_dynamics", fused_dynamics, "Main");
+    
+    sort_every = 0;
+    PyTools::extract("sort_every", sort_every, "Main");
+    
+    overlap_communications = true;
+    PyTools::extract("overlap_communications", overlap_communications, "Main");
+    
+    aggregate_communications = true;
+    PyTools::extract("aggregate_communications", aggregate_communications, "Main");
         
     // --------------------
     // Number of patches
@@ -262,6 +425,25 @@ namelist("")
         PyTools::extract("coef_frozen", coef_frozen    , "LoadBalancing");
     }
     
+    // --------------------------------------------------------------
+    // Optional fields, allocated only if a DiagFields outputs them
+    // --------------------------------------------------------------
+    has_avg_fields  = false;
+    dump_all_fields = false;
+    dumped_fields.resize(0);
+    for (unsigned int idiag=0 ; idiag<PyTools::nComponents("DiagFields") ; idiag++) {
+        int time_average = 1;
+        PyTools::extract("time_average", time_average, "DiagFields", idiag);
+        if (time_average > 1) {
+            has_avg_fields = true;
+            continue;
+        }
+        vector<string> fields;
+        PyTools::extract("fields", fields, "DiagFields", idiag);
+        if (fields.size()==0) dump_all_fields = true;
+        dumped_fields.insert( dumped_fields.end(), fields.begin(), fields.end() );
+    }
+    
     //mi.resize(nDim_field, 0);
     mi.resize(3, 0);
     while ((number_of_patches[0] >> mi[0]) >1) mi[0]++ ;
@@ -339,11 +521,25 @@ void Params::compute()
     //n_space_global.resize(nDim_field, 0);
     for (unsigned int i=0; i<nDim_field; i++){
         oversize[i]  = interpolation_order + (exchange_particles_each-1);;
+        if ( maxwell_sol == "PSATD" ) oversize[i] = max( oversize[i], psatd_guard_cells );
+        // each pass of the current filter spoils one more layer of the guard cells : the layers added here are
+        // summed with the currents, so that the guard cells used by the solver and the interpolation stay exact
+        if ( current_filter_passes > 0 )
+            oversize[i] += current_filter_passes + (current_filter_compensation?1:0);
         n_space_global[i] = n_space[i];
         n_space[i] /= number_of_patches[i];
         if(n_space_global[i]%number_of_patches[i] !=0) ERROR("ERROR in dimension " << i <<". Number of patches = " << number_of_patches[i] << " must divide n_space_global = " << n_space_global[i]);
+        if ( ( (i==0 && find(bc_em_type_x.begin(), bc_em_type_x.end(), "pml")!=bc_em_type_x.end())
+            || (i==1 && find(bc_em_type_y.begin(), bc_em_type_y.end(), "pml")!=bc_em_type_y.end()) )
+            && 2*pml_cells >= n_space_global[i] ) ERROR( "ERROR in dimension " << i << ". pml_cells = " << pml_cells << " : the layers must be thinner than half the box" );
         if ( n_space[i] <= 2*oversize[i] ) ERROR ( "ERROR in dimension " << i <<". Patches length = "<<n_space[i] << " cells must be at least " << 2*oversize[i] +1 << " cells long. Increase number of cells or reduce number of patches in this direction. " );
     }
+    // The MPI sums of the first direction are done before the sums between the patches of the same process when the
+    // communications are overlapped : the rows exchanged on both sides of a patch must not intersect
+    if ( overlap_communications && n_space[0] < 2*oversize[0]+2 ) {
+        WARNING("overlap_communications needs patches of at least " << 2*oversize[0]+2 << " cells in the first direction : disabled");
+        overlap_communications = false;
+    }
 
 }
 
@@ -362,7 +558,7 @@ void Params::setDimensions()
     } else if (geometry=="3d3v") {
         nDim_particle=3;
         nDim_field=3;
-    } else if (geometry=="2drz") {
+    } else if (geometry=="3drz") {
         nDim_particle=3;
         nDim_field=2;
     } else {
@@ -382,6 +578,8 @@ void Params::print()
     TITLE("Geometry: " << geometry);
     MESSAGE(1,"(nDim_particle, nDim_field) : (" << nDim_particle << ", "<< nDim_field << ")");
     MESSAGE(1,"Interpolation_order : " <<  interpolation_order);
+    if (geometry=="3drz")
+        MESSAGE(1,"Number of azimuthal modes : " << nmodes);
     MESSAGE(1,"(res_time, sim_time) : (" << res_time << ", " << sim_time << ")");
     MESSAGE(1,"(n_time,   timestep) : (" << n_time << ", " << timestep << ")");
     MESSAGE(1,"           timestep  = " << timestep/dtCFL << " * CFL");
@@ -454,6 +652,21 @@ void Params::runScript(string command, string name) {
     }
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// True if a DiagFields outputs one of the current or charge densities of the species
+// ---------------------------------------------------------------------------------------------------------------------
+bool Params::speciesFieldsDumped( string species_type )
+{
+    if (dump_all_fields) return true;
+    
+    string names[4] = { "Jx_", "Jy_", "Jz_", "Rho_" };
+    for (unsigned int i=0 ; i<4 ; i++)
+        if ( find( dumped_fields.begin(), dumped_fields.end(), names[i]+species_type ) != dumped_fields.end() )
+            return true;
+    return false;
+}
+
+
 //! run the python functions cleanup (user defined) and _keep_python_running (in pycontrol.py)
 void Params::cleanup(SmileiMPI* smpi) {
     // call cleanup function from the user namelist (it can be used to free some memory 
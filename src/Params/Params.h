@@ -62,6 +62,9 @@ public:
     //! number of space dimensions for the fields
     unsigned int nDim_field;
     
+    //! number of azimuthal modes of the fields in the 3drz geometry
+    unsigned int nmodes;
+    
     /*! \brief Time resolution
      Number of timesteps in \f$ 2\pi/\omega_N \f$ where \f$ \omega_N \f$ is the normalization (plasma or laser) frequency
      */
@@ -89,10 +92,53 @@ public:
    
     // 2D Maxwell Solver  
     std::string maxwell_sol; 
+    //! Solve Maxwell's equations in a single cache-blocked sweep per patch (separate passes otherwise)
+    bool fused_maxwell;
+    
+    //! Minimum number of guard cells of the patches with the PSATD solver (the errors of its periodic FFTs decay over them)
+    unsigned int psatd_guard_cells;
+    
+    //! Number of passes of the binomial filter applied to the total currents (0 : no filter)
+    unsigned int current_filter_passes;
+    //! Add a compensation pass to the binomial filter (restores the low wavenumbers to second order)
+    bool current_filter_compensation;
+    
+    //! Laser envelope model : a Laser block has envelope = True (see LaserEnvelope2D)
+    bool envelope_model;
+    
+    //! Thickness (in cells) of the perfectly matched layers
+    unsigned int pml_cells;
+    //! Order of the polynomial grading of the conductivity in the layers
+    unsigned int pml_order;
+    //! Theoretical reflection coefficient of a layer at normal incidence
+    double pml_reflection;
+    
+    //! Poisson solver for the initial electric field : "cg" or "mgcg" (multigrid preconditioned conjugate gradient)
+    std::string poisson_solver;
+    //! Maximum number of iterations of the Poisson solver
+    unsigned int poisson_max_iteration;
+    //! Convergence criterion of the Poisson solver (squared residual per node)
+    double poisson_error_max;
     
     //! Clusters width
     //unsigned int clrw;
     int clrw;
+    
+    //! Use the vectorized particle kernels (scalar kernels otherwise)
+    bool vectorization;
+    //! Use the fused interpolation - push - projection kernels when available
+    bool fused_dynamics;
+    //! Number of timesteps between two sorts of the particles per cell (0 : particles only sorted per cluster)
+    unsigned int sort_every;
+    //! Overlap the MPI communications of the patches at the border of the MPI domain with the computation
+    //! of the other patches (see VectorPatch::dynamics, VectorPatch::solveMaxwell)
+    bool overlap_communications;
+    //! Send the guard cells of the fields in one message per neighbour MPI process and direction, instead of one
+    //! message per pair of patches and field (see HaloCommPlan)
+    bool aggregate_communications;
+    
+    //! Seed of the random numbers, they are keyed by (random_seed, patch, stream, timestep) (see Random.h)
+    unsigned int random_seed;
     //! Number of cells per cluster
     int n_cell_per_cluster;
     
@@ -157,6 +203,14 @@ public:
     //! string containing the whole clean namelist
     std::string namelist;
     
+    //! Time-averaged fields are allocated only if a DiagFields averages them
+    bool has_avg_fields;
+    //! Fields output by the DiagFields without time-averaging (all fields if dump_all_fields)
+    std::vector<std::string> dumped_fields;
+    bool dump_all_fields;
+    //! Per-species current and charge densities are allocated only if a DiagFields outputs one of them
+    bool speciesFieldsDumped( std::string species_type );
+    
     //! call the python cleanup function and
     //! check if python can be closed (e.g. there is no laser python profile)
     //! by calling the _keep_python_running python function (part of pycontrol.pyh)
@@ -0,0 +1,276 @@
+
+#include "HaloCommPlan.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+#include "VectorPatch.h"
+#include "Field.h"
+
+using namespace std;
+
+// Tags of the messages : the tags of the patch messages (see buildtag) end with a direction and a neighbour,
+// 00 to 46, the plan messages are tagged 50 and 60
+static inline int haloTag( int iDim )
+{
+    return 50+10*iDim;
+}
+
+
+HaloCommPlan::HaloCommPlan()
+{
+    nDim_ = 0;
+    oversize_[0] = 0;
+    oversize_[1] = 0;
+}
+
+
+HaloCommPlan::~HaloCommPlan()
+{
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// List the pairs of patches per neighbour process and direction
+//   - the pair (P on this process, side s) is sent in the position of (hindex of P, s) in the message, and received
+//     in the position of (hindex of the neighbour, 1-s) : both processes order the pairs in the same way
+// ---------------------------------------------------------------------------------------------------------------------
+void HaloCommPlan::build( VectorPatch& vecPatches )
+{
+    // The neighbour processes and the sizes of the messages change with the patches
+    clear();
+
+    nDim_ = vecPatches.listJx_[0]->dims_.size();
+    oversize_[0] = vecPatches(0)->EMfields->oversize[0];
+    oversize_[1] = vecPatches(0)->EMfields->oversize[1];
+
+    for (unsigned int iDim=0 ; iDim<2 ; iDim++) {
+        ranks_[iDim].clear();
+        sendLinks_[iDim].clear();
+        recvLinks_[iDim].clear();
+        patchRecv_[iDim].clear();
+        if (iDim>=nDim_) continue;
+
+        // Pairs of patches per neighbour process, with their keys
+        map< int, vector< pair< pair<int,unsigned int>, pair<unsigned int,unsigned int> > > > send, recv;
+        for (unsigned int ipatch=0 ; ipatch<(unsigned int)vecPatches.size() ; ipatch++) {
+            Patch* patch = vecPatches(ipatch);
+            for (unsigned int side=0 ; side<2 ; side++) {
+                if ( !patch->is_a_MPI_neighbor( iDim, side ) ) continue;
+                int rank = patch->MPI_neighbor_[iDim][side];
+                send[rank].push_back( make_pair( make_pair( (int)patch->hindex, side ), make_pair( ipatch, side ) ) );
+                recv[rank].push_back( make_pair( make_pair( patch->neighbor_[iDim][side], 1-side ), make_pair( ipatch, side ) ) );
+            }
+        }
+
+        patchRecv_[iDim].resize( vecPatches.size() );
+        for (map< int, vector< pair< pair<int,unsigned int>, pair<unsigned int,unsigned int> > > >::iterator it=send.begin() ; it!=send.end() ; it++) {
+            int rank = it->first;
+            unsigned int irank = ranks_[iDim].size();
+            ranks_[iDim].push_back( rank );
+
+            sort( it->second.begin(), it->second.end() );
+            sort( recv[rank].begin(), recv[rank].end() );
+            sendLinks_[iDim].resize( irank+1 );
+            recvLinks_[iDim].resize( irank+1 );
+            for (unsigned int l=0 ; l<it->second.size() ; l++)
+                sendLinks_[iDim][irank].push_back( it->second[l].second );
+            for (unsigned int l=0 ; l<recv[rank].size() ; l++) {
+                recvLinks_[iDim][irank].push_back( recv[rank][l].second );
+                patchRecv_[iDim][ recv[rank][l].second.first ].push_back( make_pair( irank, l ) );
+            }
+        }
+    }
+
+} // END build
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Free the persistent requests (inactive : all the messages of the channels have been waited for by finalize)
+// ---------------------------------------------------------------------------------------------------------------------
+void HaloCommPlan::clear()
+{
+    for (unsigned int iDim=0 ; iDim<2 ; iDim++) {
+        for (map<unsigned int, Channel>::iterator it=channels_[iDim].begin() ; it!=channels_[iDim].end() ; it++) {
+            for (unsigned int irank=0 ; irank<it->second.sendRequest.size() ; irank++) {
+                MPI_Request_free( &(it->second.sendRequest[irank]) );
+                MPI_Request_free( &(it->second.recvRequest[irank]) );
+            }
+        }
+        channels_[iDim].clear();
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Buffers of the messages of a given size, allocated once : the persistent requests are bound to their addresses
+// ---------------------------------------------------------------------------------------------------------------------
+HaloCommPlan::Channel& HaloCommPlan::channel( int iDim, unsigned int size )
+{
+    map<unsigned int, Channel>::iterator it = channels_[iDim].find( size );
+    if ( it != channels_[iDim].end() ) return it->second;
+
+    Channel& c = channels_[iDim][size];
+    unsigned int nranks = ranks_[iDim].size();
+    c.sendBuffer .resize( nranks );
+    c.recvBuffer .resize( nranks );
+    c.sendRequest.resize( nranks );
+    c.recvRequest.resize( nranks );
+    for (unsigned int irank=0 ; irank<nranks ; irank++) {
+        // One double more than needed, an empty message still has a valid address
+        c.sendBuffer[irank].resize( sendLinks_[iDim][irank].size()*size + 1 );
+        c.recvBuffer[irank].resize( recvLinks_[iDim][irank].size()*size + 1 );
+        MPI_Send_init( &(c.sendBuffer[irank][0]), sendLinks_[iDim][irank].size()*size, MPI_DOUBLE, ranks_[iDim][irank], haloTag(iDim), MPI_COMM_WORLD, &(c.sendRequest[irank]) );
+        MPI_Recv_init( &(c.recvBuffer[irank][0]), recvLinks_[iDim][irank].size()*size, MPI_DOUBLE, ranks_[iDim][irank], haloTag(iDim), MPI_COMM_WORLD, &(c.recvRequest[irank]) );
+    }
+    return c;
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Start the receives, pack, then start the sends of all the neighbour processes
+// ---------------------------------------------------------------------------------------------------------------------
+void HaloCommPlan::start( vector< vector<Field*>* >& lists, int iDim, bool sum )
+{
+    unsigned int size = linkSize( lists, iDim, sum );
+    unsigned int nranks = ranks_[iDim].size();
+    if (nranks==0) return;
+
+    // The channels are shared by the threads, created by one of them
+    Channel* c;
+    #pragma omp single copyprivate(c)
+    {
+        c = &channel( iDim, size );
+        MPI_Startall( nranks, &(c->recvRequest[0]) );
+    }
+
+    #pragma omp for schedule(dynamic)
+    for (unsigned int irank=0 ; irank<nranks ; irank++) {
+        vector< pair<unsigned int,unsigned int> >& links = sendLinks_[iDim][irank];
+        double* b = &(c->sendBuffer[irank][0]);
+        for (unsigned int l=0 ; l<links.size() ; l++) {
+            for (unsigned int ilist=0 ; ilist<lists.size() ; ilist++) {
+                Field* field = (*lists[ilist])[ links[l].first ];
+                unsigned int istart, width;
+                block( field, iDim, links[l].second, sum, true, istart, width );
+                copyBlock( field, iDim, istart, width, b, 0 );
+                b += blockSize( field, iDim, width );
+            }
+        }
+    }
+
+    #pragma omp single
+    MPI_Startall( nranks, &(c->sendRequest[0]) );
+
+} // END start
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Wait for all the messages, then unpack per local patch
+// ---------------------------------------------------------------------------------------------------------------------
+void HaloCommPlan::finalize( vector< vector<Field*>* >& lists, int iDim, bool sum )
+{
+    unsigned int size = linkSize( lists, iDim, sum );
+    unsigned int nranks = ranks_[iDim].size();
+    if (nranks==0) return;
+
+    Channel* c;
+    #pragma omp single copyprivate(c)
+    {
+        c = &channel( iDim, size );
+        MPI_Waitall( nranks, &(c->recvRequest[0]), MPI_STATUSES_IGNORE );
+        MPI_Waitall( nranks, &(c->sendRequest[0]), MPI_STATUSES_IGNORE );
+    }
+
+    #pragma omp for schedule(runtime)
+    for (unsigned int ipatch=0 ; ipatch<patchRecv_[iDim].size() ; ipatch++) {
+        for (unsigned int i=0 ; i<patchRecv_[iDim][ipatch].size() ; i++) {
+            unsigned int irank = patchRecv_[iDim][ipatch][i].first;
+            unsigned int l     = patchRecv_[iDim][ipatch][i].second;
+            double* b = &(c->recvBuffer[irank][l*size]);
+            for (unsigned int ilist=0 ; ilist<lists.size() ; ilist++) {
+                Field* field = (*lists[ilist])[ipatch];
+                unsigned int istart, width;
+                block( field, iDim, recvLinks_[iDim][irank][l].second, sum, false, istart, width );
+                copyBlock( field, iDim, istart, width, b, sum ? 2 : 1 );
+                b += blockSize( field, iDim, width );
+            }
+        }
+    }
+
+} // END finalize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Guard cells of a field, as in Patch2D::initSumField (sum) and Patch2D::initExchange (exchange)
+// ---------------------------------------------------------------------------------------------------------------------
+void HaloCommPlan::block( Field* field, int iDim, unsigned int side, bool sum, bool send, unsigned int& start, unsigned int& width )
+{
+    unsigned int n    = field->dims_[iDim];
+    unsigned int dual = field->isDual_[iDim];
+    unsigned int os   = oversize_[iDim];
+
+    if (sum) {
+        // 2 oversize (1 inside & 1 outside of the patch), the same rows are sent and received
+        width = 2*os + 1 + dual;
+        start = side * ( n - width );
+    }
+    else if (send) {
+        width = os;
+        start = side * ( n - (2*os+1+dual) ) + (1-side) * ( os+1+dual );
+    }
+    else {
+        width = os;
+        start = side * ( n - os );
+    }
+}
+
+
+unsigned int HaloCommPlan::blockSize( Field* field, int iDim, unsigned int width )
+{
+    if (field->dims_.size()==1) return width;
+    return width * field->dims_[1-iDim];
+}
+
+
+void HaloCommPlan::copyBlock( Field* field, int iDim, unsigned int start, unsigned int width, double* buffer, int mode )
+{
+    unsigned int ny = (field->dims_.size()>1) ? field->dims_[1] : 1;
+
+    // Rows : contiguous block
+    if (iDim==0) {
+        double* f = &(field->data_[start*ny]);
+        unsigned int n = width*ny;
+        if      (mode==0) memcpy( buffer, f, n*sizeof(double) );
+        else if (mode==1) memcpy( f, buffer, n*sizeof(double) );
+        else
+            for (unsigned int i=0 ; i<n ; i++) f[i] += buffer[i];
+    }
+    // Columns : one piece per row
+    else {
+        unsigned int nx = field->dims_[0];
+        for (unsigned int ix=0 ; ix<nx ; ix++) {
+            double* f = &(field->data_[ix*ny+start]);
+            double* b = &(buffer[ix*width]);
+            if      (mode==0) memcpy( b, f, width*sizeof(double) );
+            else if (mode==1) memcpy( f, b, width*sizeof(double) );
+            else
+                for (unsigned int j=0 ; j<width ; j++) f[j] += b[j];
+        }
+    }
+}
+
+
+unsigned int HaloCommPlan::linkSize( vector< vector<Field*>* >& lists, int iDim, bool sum )
+{
+    // All the patches have the same fields
+    unsigned int size = 0;
+    for (unsigned int ilist=0 ; ilist<lists.size() ; ilist++) {
+        Field* field = (*lists[ilist])[0];
+        unsigned int istart, width;
+        block( field, iDim, 0, sum, true, istart, width );
+        size += blockSize( field, iDim, width );
+    }
+    return size;
+}
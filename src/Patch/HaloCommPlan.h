@@ -0,0 +1,80 @@
+
+#ifndef HALOCOMMPLAN_H
+#define HALOCOMMPLAN_H
+
+#include <mpi.h>
+#include <map>
+#include <vector>
+#include <utility>
+
+class VectorPatch;
+class Field;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class HaloCommPlan : MPI communications of the guard cells of the fields aggregated per neighbour MPI process
+//!   - per direction, the pairs of patches shared with a neighbour process are listed once (see build)
+//!   - the guard cells of all the fields of a sum or exchange, for all these pairs, are packed in one buffer and
+//!     sent in a single message per neighbour process and direction
+//!   - the messages use persistent MPI requests, created once per size of message and rebuilt with the plan
+//!   - the pairs of patches of the same process are still synchronized by SyncVectorPatch (memcpy)
+//  --------------------------------------------------------------------------------------------------------------------
+class HaloCommPlan {
+public:
+    HaloCommPlan();
+    ~HaloCommPlan();
+
+    //! Lists the pairs of patches per neighbour process, after the creation of the patches, the load balancing
+    //! and the moving window (see VectorPatch::update_field_list)
+    void build( VectorPatch& vecPatches );
+
+    //! Pack the guard cells of the fields of the lists to sum (or exchange) in direction iDim and post the messages
+    void start   ( std::vector< std::vector<Field*>* >& lists, int iDim, bool sum );
+    //! Wait for the messages of direction iDim, then add (or copy) the received guard cells in the fields
+    void finalize( std::vector< std::vector<Field*>* >& lists, int iDim, bool sum );
+
+    //! Free the persistent requests, when the plan is rebuilt and before MPI_Finalize (see VectorPatch::close)
+    void clear();
+
+private:
+    //! Rows (iDim=0) or columns (iDim=1) of the guard cells sent to (send=true) or received from the neighbour of
+    //! the side (0 : min, 1 : max) of a patch : first index and width
+    void block( Field* field, int iDim, unsigned int side, bool sum, bool send, unsigned int& start, unsigned int& width );
+    //! Number of doubles of a block of field
+    unsigned int blockSize( Field* field, int iDim, unsigned int width );
+    //! Copy the block to the buffer (mode 0), the buffer to the block (mode 1), or add the buffer to the block (mode 2)
+    void copyBlock( Field* field, int iDim, unsigned int start, unsigned int width, double* buffer, int mode );
+    //! Number of doubles sent for one pair of patches
+    unsigned int linkSize( std::vector< std::vector<Field*>* >& lists, int iDim, bool sum );
+
+    //! Buffers and persistent requests per neighbour process, for the messages of a given size in direction iDim
+    struct Channel {
+        std::vector< std::vector<double> > sendBuffer;
+        std::vector< std::vector<double> > recvBuffer;
+        std::vector<MPI_Request> sendRequest;
+        std::vector<MPI_Request> recvRequest;
+    };
+    //! Channel of the messages of size doubles per pair of patches, created at its first use (MPI_Send_init,
+    //! MPI_Recv_init)
+    Channel& channel( int iDim, unsigned int size );
+
+    //! Number of directions of the fields
+    unsigned int nDim_;
+    //! Guard cells of the fields (EMfields->oversize)
+    unsigned int oversize_[2];
+
+    //! Neighbour processes per direction
+    std::vector<int> ranks_[2];
+    //! Pairs of patches (local patch, side of the neighbour patch) per neighbour process, in the order of the messages :
+    //! Hilbert index of the sender, then side of the receiver seen from the sender
+    std::vector< std::vector< std::pair<unsigned int,unsigned int> > > sendLinks_[2];
+    std::vector< std::vector< std::pair<unsigned int,unsigned int> > > recvLinks_[2];
+    //! Received pairs per local patch : (neighbour process, pair), a patch is unpacked by a single thread
+    std::vector< std::vector< std::pair<unsigned int,unsigned int> > > patchRecv_[2];
+
+    //! Channels per direction, indexed by the size per pair of patches : a sum or an exchange is done in a single
+    //! direction at a time, so the operations of the same size share their channel (buffers at fixed addresses)
+    std::map<unsigned int, Channel> channels_[2];
+
+};
+
+#endif
@@ -44,6 +44,7 @@ Patch::Patch(Params& params, SmileiMPI* smpi, unsigned int ipatch, unsigned int
     
     hindex = ipatch;
     nDim_fields_ = params.nDim_field;
+    rz_ = ( params.geometry == "3drz" );
     
     initStep1(params);
     
@@ -57,6 +58,7 @@ Patch::Patch(Patch* patch, Params& params, SmileiMPI* smpi, unsigned int ipatch,
     
     hindex = ipatch;
     nDim_fields_ = patch->nDim_fields_;
+    rz_ = patch->rz_;
     
     initStep1(params);
     
@@ -82,8 +84,10 @@ void Patch::initStep1(Params& params)
         corner_neighbor_[iDim].resize(2,MPI_PROC_NULL);
     }
     MPI_neighbor_.resize(nDim_fields_);
+    MPI_corner_neighbor_.resize(nDim_fields_);
     for ( int iDim = 0 ; iDim < nDim_fields_; iDim++ ) {
         MPI_neighbor_[iDim].resize(2,MPI_PROC_NULL);
+        MPI_corner_neighbor_[iDim].resize(2,MPI_PROC_NULL);
     }
     
     oversize.resize( 2 );
@@ -194,75 +198,95 @@ void Patch::updateMPIenv(SmileiMPI* smpi)
         for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++)
             MPI_neighbor_[iDim][iNeighbor] = smpi->hrank(neighbor_[iDim][iNeighbor]);
     
+    // Corners (2D)
+    if (nDim_fields_>1)
+        for (int ix=0 ; ix<2 ; ix++)
+            for (int iy=0 ; iy<2 ; iy++)
+                MPI_corner_neighbor_[ix][iy] = smpi->hrank(corner_neighbor_[ix][iy]);
+    
 #ifdef _PATCH_DEBUG
         cout << "\n\tPatch Corner decomp : " << corner_neighbor_[0][1] << "\t" << neighbor_[1][1]  << "\t" << corner_neighbor_[1][1] << endl;
         cout << "\tPatch Corner decomp : " << neighbor_[0][0] << "\t" << hindex << "\t" << neighbor_[0][1] << endl;
         cout << "\tPatch Corner decomp : " << corner_neighbor_[0][0] << "\t" << neighbor_[1][0]  << "\t" << corner_neighbor_[1][0] << endl;
         
-        cout << "\n\tMPI Corner decomp : " << "MPI_PROC_NULL" << "\t" << MPI_neighbor_[1][1]  << "\t" << "MPI_PROC_NULL" << endl;
+        cout << "\n\tMPI Corner decomp : " << MPI_corner_neighbor_[0][1] << "\t" << MPI_neighbor_[1][1]  << "\t" << MPI_corner_neighbor_[1][1] << endl;
         cout << "\tMPI Corner decomp : " << MPI_neighbor_[0][0] << "\t" << smpi->getRank() << "\t" << MPI_neighbor_[0][1] << endl;
-        cout << "\tMPI Corner decomp : " << "MPI_PROC_NULL" << "\t" << MPI_neighbor_[1][0]  << "\t" << "MPI_PROC_NULL" << endl;
+        cout << "\tMPI Corner decomp : " << MPI_corner_neighbor_[0][0] << "\t" << MPI_neighbor_[1][0]  << "\t" << MPI_corner_neighbor_[1][0] << endl;
 #endif
 
 } // END updateMPIenv
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-// Split particles Id to send in per direction and per patch neighbor dedicated buffers
-// Apply periodicity if necessary
+// Split particles Id to send in per patch neighbor dedicated buffers : the 2 neighbors of each direction and, in 2D,
+// the 4 corner neighbors (particles leaving through a corner are sent directly to the corner neighbor)
+// Apply periodicity if necessary, in all the directions crossed
 // ---------------------------------------------------------------------------------------------------------------------
 void Patch::initExchParticles(SmileiMPI* smpi, int ispec, Params& params)
 {
     Particles &cuParticles = (*vecSpecies[ispec]->particles);
+    SpeciesMPI &specMPI = vecSpecies[ispec]->specMPI;
     int ndim = params.nDim_field;
-    int idim,check;
+    int idim;
     std::vector<int>* indexes_of_particles_to_exchange = &vecSpecies[ispec]->indexes_of_particles_to_exchange;
     double xmax[3]; 
     
     for (int iDim=0 ; iDim < ndim ; iDim++){
         xmax[iDim] = params.cell_length[iDim]*( params.n_space_global[iDim] );
         for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
-            vecSpecies[ispec]->specMPI.patchVectorRecv[iDim][iNeighbor].initialize(0,cuParticles);
-            vecSpecies[ispec]->specMPI.patchVectorSend[iDim][iNeighbor].initialize(0,cuParticles);
-            vecSpecies[ispec]->specMPI.patch_buff_index_send[iDim][iNeighbor].resize(0);
-            vecSpecies[ispec]->specMPI.patch_buff_index_recv_sz[iDim][iNeighbor] = 0;
+            specMPI.patchVectorRecv[iDim][iNeighbor].initialize(0,cuParticles);
+            specMPI.patch_buff_index_send[iDim][iNeighbor].resize(0);
+            specMPI.patch_buff_index_recv_sz[iDim][iNeighbor] = 0;
+        }
+    }
+    if (ndim>1) {
+        for (int ix=0 ; ix<2 ; ix++) {
+            for (int iy=0 ; iy<2 ; iy++) {
+                specMPI.cornerVectorRecv[ix][iy].initialize(0,cuParticles);
+                specMPI.corner_buff_index_send[ix][iy].resize(0);
+                specMPI.corner_buff_index_recv_sz[ix][iy] = 0;
+            }
         }
     }
  
     int n_part_send = (*indexes_of_particles_to_exchange).size();
-    //int n_part_recv;
         
     int iPart;
+    // Side crossed per direction : -1 if none, 0 (min) or 1 (max)
+    int side[2];
+    bool lost;
 
     // Define where particles are going 
-    //Put particles in the send buffer it belongs to. Priority to lower dimensions.
     for (int i=0 ; i<n_part_send ; i++) {
         iPart = (*indexes_of_particles_to_exchange)[i];
-        check = 0;
-        idim = 0;
-        //Put indexes of particles in the first direction they will be exchanged and correct their position according to periodicity for the first exchange only.
-        while (check == 0 && idim<ndim){
-            if ( cuParticles.position(idim,iPart) < min_local[idim]){
-                if ( neighbor_[idim][0]!=MPI_PROC_NULL) { 
-                    vecSpecies[ispec]->specMPI.patch_buff_index_send[idim][0].push_back( iPart );
-                    if (smpi->periods_[idim]==1 && Pcoordinates[idim] == 0) {
-                        cuParticles.position(idim,iPart)     += xmax[idim];
-                    }
-                }
-                //If particle is outside of the global domain (has no neighbor), it will not be put in a send buffer and will simply be deleted.
-                check = 1;
-            }
-            else if ( cuParticles.position(idim,iPart) >= max_local[idim]){
-                if( neighbor_[idim][1]!=MPI_PROC_NULL) { 
-                    vecSpecies[ispec]->specMPI.patch_buff_index_send[idim][1].push_back( iPart );
-                    if (smpi->periods_[idim]==1 && Pcoordinates[idim] == params.number_of_patches[idim]-1) {
-                        cuParticles.position(idim,iPart)     -= xmax[idim];
-                    }
-                }
-                check = 1;
-            }
-            idim++;
+        lost = false;
+        for (idim=0 ; idim<ndim ; idim++) {
+            side[idim] = -1;
+            if      ( particleCoordinate(cuParticles, idim, iPart) <  min_local[idim] ) side[idim] = 0;
+            else if ( particleCoordinate(cuParticles, idim, iPart) >= max_local[idim] ) side[idim] = 1;
+            //If particle is outside of the global domain (has no neighbor), it will not be put in a send buffer and will simply be deleted.
+            if ( side[idim]>=0 && neighbor_[idim][side[idim]]==MPI_PROC_NULL )
+                lost = true;
         }
+        if (lost) continue;
+
+        //Correct their position according to periodicity.
+        for (idim=0 ; idim<ndim ; idim++) {
+            if ( side[idim]==0 && smpi->periods_[idim]==1 && Pcoordinates[idim] == 0 )
+                cuParticles.position(idim,iPart)     += xmax[idim];
+            else if ( side[idim]==1 && smpi->periods_[idim]==1 && Pcoordinates[idim] == params.number_of_patches[idim]-1 )
+                cuParticles.position(idim,iPart)     -= xmax[idim];
+        }
+
+        //Put indexes of particles in the buffer of the face or of the corner they cross.
+        if ( ndim==1 || side[1]<0 ) {
+            if (side[0]>=0)
+                specMPI.patch_buff_index_send[0][side[0]].push_back( iPart );
+        }
+        else if ( side[0]<0 )
+            specMPI.patch_buff_index_send[1][side[1]].push_back( iPart );
+        else
+            specMPI.corner_buff_index_send[side[0]][side[1]].push_back( iPart );
     }
      
 
@@ -270,366 +294,377 @@ void Patch::initExchParticles(SmileiMPI* smpi, int ispec, Params& params)
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-// For direction iDim, start exchange of number of particles 
+// Split particles Id to send and post the MPI messages of the particles, as soon as the dynamics of the patch is done
+// (see VectorPatch::dynamics)
+//   - the intra-MPI process copies are done later by initCommParticles and CommParticles, once all patches have split
+//     their particles
+// ---------------------------------------------------------------------------------------------------------------------
+void Patch::postCommParticles(SmileiMPI* smpi, int ispec, Params& params)
+{
+    initExchParticles(smpi, ispec, params);
+    sendMPIParticles(ispec);
+    vecSpecies[ispec]->specMPI.particles_posted = true;
+
+} // postCommParticles
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Send the particles to the MPI neighbours and the number of particles to the local ones
 //   - vecPatch : used for intra-MPI process comm (direct copy using Particels::cp_particles)
 //   - smpi     : inhereted from previous SmileiMPI::exchangeParticles()
 // ---------------------------------------------------------------------------------------------------------------------
-void Patch::initCommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim, VectorPatch * vecPatch)
+void Patch::initCommParticles(SmileiMPI* smpi, int ispec, Params& params, VectorPatch * vecPatch)
 {
     int h0 = (*vecPatch)(0)->hindex;
+    SpeciesMPI &specMPI = vecSpecies[ispec]->specMPI;
+
+    // The MPI messages (the number of particles is their header) may have been posted by postCommParticles
+    if (!specMPI.particles_posted)
+        sendMPIParticles(ispec);
+    specMPI.particles_posted = false;
+
     /********************************************************************************/
-    // Exchange number of particles to exchange to establish or not a communication
+    // Local neighbours : I directly set the receive size to the correct value.
     /********************************************************************************/
-    for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
-        if (neighbor_[iDim][iNeighbor]!=MPI_PROC_NULL) {
-            vecSpecies[ispec]->specMPI.patch_buff_index_send_sz[iDim][iNeighbor] = (vecSpecies[ispec]->specMPI.patch_buff_index_send[iDim][iNeighbor]).size();
-            if (is_a_MPI_neighbor(iDim, iNeighbor)) {
-                //If neighbour is MPI ==> I send him the number of particles I'll send later.
-                int tag = buildtag( hindex, iDim+1, iNeighbor+3 );
-                      MPI_Isend( &(vecSpecies[ispec]->specMPI.patch_buff_index_send_sz[iDim][iNeighbor]), 1, MPI_INT, MPI_neighbor_[iDim][iNeighbor], tag, MPI_COMM_WORLD, &(vecSpecies[ispec]->specMPI.patch_srequest[iDim][iNeighbor]) );
-            }
-            else {
-                //Else, I directly set the receive size to the correct value.
-                (*vecPatch)( neighbor_[iDim][iNeighbor]- h0 )->vecSpecies[ispec]->specMPI.patch_buff_index_recv_sz[iDim][(iNeighbor+1)%2] = vecSpecies[ispec]->specMPI.patch_buff_index_send_sz[iDim][iNeighbor];
+    for (int iDim=0 ; iDim<nDim_fields_ ; iDim++) {
+        for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
+            if ( (neighbor_[iDim][iNeighbor]!=MPI_PROC_NULL) && !is_a_MPI_neighbor(iDim, iNeighbor) ) {
+                specMPI.patch_buff_index_send_sz[iDim][iNeighbor] = (specMPI.patch_buff_index_send[iDim][iNeighbor]).size();
+                (*vecPatch)( neighbor_[iDim][iNeighbor]- h0 )->vecSpecies[ispec]->specMPI.patch_buff_index_recv_sz[iDim][(iNeighbor+1)%2] = specMPI.patch_buff_index_send_sz[iDim][iNeighbor];
             }
-        } // END of Send
-
-        if (neighbor_[iDim][(iNeighbor+1)%2]!=MPI_PROC_NULL) {
-            if (is_a_MPI_neighbor(iDim, (iNeighbor+1)%2)) {
-                //If other neighbour is MPI ==> I receive the number of particles I'll receive later.
-                int tag = buildtag( neighbor_[iDim][(iNeighbor+1)%2], iDim+1, iNeighbor+3 );
-                MPI_Irecv( &(vecSpecies[ispec]->specMPI.patch_buff_index_recv_sz[iDim][(iNeighbor+1)%2]), 1, MPI_INT, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &(vecSpecies[ispec]->specMPI.patch_rrequest[iDim][(iNeighbor+1)%2]) );
+        }
+    }
+    if (nDim_fields_>1) {
+        for (int ix=0 ; ix<2 ; ix++) {
+            for (int iy=0 ; iy<2 ; iy++) {
+                if ( (corner_neighbor_[ix][iy]!=MPI_PROC_NULL) && !is_a_MPI_corner_neighbor(ix, iy) )
+                    (*vecPatch)( corner_neighbor_[ix][iy]- h0 )->vecSpecies[ispec]->specMPI.corner_buff_index_recv_sz[1-ix][1-iy] = specMPI.corner_buff_index_send[ix][iy].size();
             }
         }
-    }//end loop on nb_neighbors.
+    }
 
-} // initCommParticles(... iDim)
+} // initCommParticles
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-// For direction iDim, finalize receive of number of particles and really send particles
+// Receive the particles of the MPI neighbours and copy the particles of the local neighbours
 //   - vecPatch : used for intra-MPI process comm (direct copy using Particels::cp_particles)
-//   - smpi     : used smpi->periods_
 // ---------------------------------------------------------------------------------------------------------------------
-void Patch::CommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim, VectorPatch * vecPatch)
+void Patch::CommParticles(SmileiMPI* smpi, int ispec, Params& params, VectorPatch * vecPatch)
 {
-    MPI_Datatype typePartSend, typePartRecv;
     Particles &cuParticles = (*vecSpecies[ispec]->particles);
-
-    int n_part_send, n_part_recv;
+    SpeciesMPI &specMPI = vecSpecies[ispec]->specMPI;
     int h0 = (*vecPatch)(0)->hindex;
-    double x_max = params.cell_length[iDim]*( params.n_space_global[iDim] );
 
     /********************************************************************************/
-    // Wait for end of communications over number of particles
+    // Receive particles of MPI neighbours, all the messages have been posted by initCommParticles
     /********************************************************************************/
-    for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
-        MPI_Status sstat    [2];
-        MPI_Status rstat    [2];
-        if (neighbor_[iDim][iNeighbor]!=MPI_PROC_NULL) {
-            if (is_a_MPI_neighbor(iDim, iNeighbor))
-                MPI_Wait( &(vecSpecies[ispec]->specMPI.patch_srequest[iDim][iNeighbor]), &(sstat[iNeighbor]) );
+    for (int iDim=0 ; iDim<nDim_fields_ ; iDim++) {
+        for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
+            if (is_a_MPI_neighbor(iDim, iNeighbor)) {
+                int tag = buildtag( neighbor_[iDim][iNeighbor], iDim+1, (iNeighbor+1)%2+3 );
+                specMPI.patch_buff_index_recv_sz[iDim][iNeighbor] = recvParticles( specMPI.patch_buffer_recv[iDim][iNeighbor], specMPI.patchVectorRecv[iDim][iNeighbor], MPI_neighbor_[iDim][iNeighbor], tag );
+            }
         }
-        if (neighbor_[iDim][(iNeighbor+1)%2]!=MPI_PROC_NULL) {
-            if (is_a_MPI_neighbor(iDim, (iNeighbor+1)%2))  {
-                MPI_Wait( &(vecSpecies[ispec]->specMPI.patch_rrequest[iDim][(iNeighbor+1)%2]), &(rstat[(iNeighbor+1)%2]) );
-                if (vecSpecies[ispec]->specMPI.patch_buff_index_recv_sz[iDim][(iNeighbor+1)%2]!=0) {
-                    //If I receive particles over MPI, I initialize my receive buffer with the appropriate size.
-                    vecSpecies[ispec]->specMPI.patchVectorRecv[iDim][(iNeighbor+1)%2].initialize( vecSpecies[ispec]->specMPI.patch_buff_index_recv_sz[iDim][(iNeighbor+1)%2], cuParticles);
+    }
+    if (nDim_fields_>1) {
+        for (int ix=0 ; ix<2 ; ix++) {
+            for (int iy=0 ; iy<2 ; iy++) {
+                if (is_a_MPI_corner_neighbor(ix, iy)) {
+                    int tag = buildtag( corner_neighbor_[ix][iy], (1-ix)+3, (1-iy)+5 );
+                    specMPI.corner_buff_index_recv_sz[ix][iy] = recvParticles( specMPI.corner_buffer_recv[ix][iy], specMPI.cornerVectorRecv[ix][iy], MPI_corner_neighbor_[ix][iy], tag );
                 }
             }
         }
     }
+
     /********************************************************************************/
-    // Proceed to effective Particles' communications
+    // Copy particles of local neighbours directly in their receive buffer
     /********************************************************************************/
-
-    // Number of properties per particles = nDim_Particles + 3 + 1 + 1
-
-    for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
-                
-        // n_part_send : number of particles to send to current neighbor
-        n_part_send = (vecSpecies[ispec]->specMPI.patch_buff_index_send[iDim][iNeighbor]).size();
-        if ( (neighbor_[iDim][iNeighbor]!=MPI_PROC_NULL) && (n_part_send!=0) ) {
-            // Enabled periodicity
-            if (smpi->periods_[iDim]==1) {
-                for (int iPart=0 ; iPart<n_part_send ; iPart++) {
-                    if ( ( iNeighbor==0 ) &&  (Pcoordinates[iDim] == 0 ) &&( cuParticles.position(iDim,vecSpecies[ispec]->specMPI.patch_buff_index_send[iDim][iNeighbor][iPart]) < 0. ) ) {
-                        cuParticles.position(iDim,vecSpecies[ispec]->specMPI.patch_buff_index_send[iDim][iNeighbor][iPart])     += x_max;
-                    }
-                    else if ( ( iNeighbor==1 ) &&  (Pcoordinates[iDim] == params.number_of_patches[iDim]-1 ) && ( cuParticles.position(iDim,vecSpecies[ispec]->specMPI.patch_buff_index_send[iDim][iNeighbor][iPart]) >= x_max ) ) {
-                        cuParticles.position(iDim,vecSpecies[ispec]->specMPI.patch_buff_index_send[iDim][iNeighbor][iPart])     -= x_max;
-                    }
-                }
-            }
-            // Send particles
-            if (is_a_MPI_neighbor(iDim, iNeighbor)) {
-                // If MPI comm, first copy particles in the sendbuffer
-                for (int iPart=0 ; iPart<n_part_send ; iPart++) 
-                    cuParticles.cp_particle(vecSpecies[ispec]->specMPI.patch_buff_index_send[iDim][iNeighbor][iPart], vecSpecies[ispec]->specMPI.patchVectorSend[iDim][iNeighbor]);
-                // Then send particles
-                int tag = buildtag( hindex, iDim+1, iNeighbor+3 );
-                typePartSend = smpi->createMPIparticles( &(vecSpecies[ispec]->specMPI.patchVectorSend[iDim][iNeighbor]) );
-                MPI_Isend( &((vecSpecies[ispec]->specMPI.patchVectorSend[iDim][iNeighbor]).position(0,0)), 1, typePartSend, MPI_neighbor_[iDim][iNeighbor], tag, MPI_COMM_WORLD, &(vecSpecies[ispec]->specMPI.patch_srequest[iDim][iNeighbor]) );
-                MPI_Type_free( &typePartSend );
+    for (int iDim=0 ; iDim<nDim_fields_ ; iDim++) {
+        for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
+            std::vector<int> &indexes = specMPI.patch_buff_index_send[iDim][iNeighbor];
+            if ( (neighbor_[iDim][iNeighbor]!=MPI_PROC_NULL) && !is_a_MPI_neighbor(iDim, iNeighbor) ) {
+                Particles &recv = (*vecPatch)( neighbor_[iDim][iNeighbor]- h0 )->vecSpecies[ispec]->specMPI.patchVectorRecv[iDim][(iNeighbor+1)%2];
+                for (unsigned int iPart=0 ; iPart<indexes.size() ; iPart++) 
+                    cuParticles.cp_particle( indexes[iPart], recv );
             }
-            else {
-                //If not MPI comm, copy particles directly in the receive buffer
-                for (int iPart=0 ; iPart<n_part_send ; iPart++) 
-                    cuParticles.cp_particle( vecSpecies[ispec]->specMPI.patch_buff_index_send[iDim][iNeighbor][iPart],((*vecPatch)( neighbor_[iDim][iNeighbor]- h0 )->vecSpecies[ispec]->specMPI.patchVectorRecv[iDim][(iNeighbor+1)%2]) );
+        }
+    }
+    if (nDim_fields_>1) {
+        for (int ix=0 ; ix<2 ; ix++) {
+            for (int iy=0 ; iy<2 ; iy++) {
+                std::vector<int> &indexes = specMPI.corner_buff_index_send[ix][iy];
+                if ( (corner_neighbor_[ix][iy]!=MPI_PROC_NULL) && !is_a_MPI_corner_neighbor(ix, iy) ) {
+                    Particles &recv = (*vecPatch)( corner_neighbor_[ix][iy]- h0 )->vecSpecies[ispec]->specMPI.cornerVectorRecv[1-ix][1-iy];
+                    for (unsigned int iPart=0 ; iPart<indexes.size() ; iPart++) 
+                        cuParticles.cp_particle( indexes[iPart], recv );
+                }
             }
-        } // END of Send
-                
-        n_part_recv = vecSpecies[ispec]->specMPI.patch_buff_index_recv_sz[iDim][(iNeighbor+1)%2];
-        if ( (neighbor_[iDim][(iNeighbor+1)%2]!=MPI_PROC_NULL) && (n_part_recv!=0) ) {
-            if (is_a_MPI_neighbor(iDim, (iNeighbor+1)%2)) {
-                // If MPI comm, receive particles in the recv buffer previously initialized.
-                typePartRecv = smpi->createMPIparticles( &(vecSpecies[ispec]->specMPI.patchVectorRecv[iDim][(iNeighbor+1)%2]) );
-                int tag = buildtag( neighbor_[iDim][(iNeighbor+1)%2], iDim+1 ,iNeighbor+3 );
-                MPI_Irecv( &((vecSpecies[ispec]->specMPI.patchVectorRecv[iDim][(iNeighbor+1)%2]).position(0,0)), 1, typePartRecv, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &(vecSpecies[ispec]->specMPI.patch_rrequest[iDim][(iNeighbor+1)%2]) );
-                MPI_Type_free( &typePartRecv );
+        }
+    }
+
+} // END CommParticles
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Post the messages of the particles sent to the MPI neighbours : faces (tags end with iDim+1, iNeighbor+3) and corners
+// (tags end with ix+3, iy+5)
+// ---------------------------------------------------------------------------------------------------------------------
+void Patch::sendMPIParticles(int ispec)
+{
+    SpeciesMPI &specMPI = vecSpecies[ispec]->specMPI;
+
+    for (int iDim=0 ; iDim<nDim_fields_ ; iDim++) {
+        for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
+            if (is_a_MPI_neighbor(iDim, iNeighbor))
+                sendParticles( ispec, specMPI.patch_buff_index_send[iDim][iNeighbor], specMPI.patch_buffer_send[iDim][iNeighbor],
+                               MPI_neighbor_[iDim][iNeighbor], buildtag( hindex, iDim+1, iNeighbor+3 ), &(specMPI.patch_srequest[iDim][iNeighbor]) );
+        }
+    }
+    if (nDim_fields_>1) {
+        for (int ix=0 ; ix<2 ; ix++) {
+            for (int iy=0 ; iy<2 ; iy++) {
+                if (is_a_MPI_corner_neighbor(ix, iy))
+                    sendParticles( ispec, specMPI.corner_buff_index_send[ix][iy], specMPI.corner_buffer_send[ix][iy],
+                                   MPI_corner_neighbor_[ix][iy], buildtag( hindex, ix+3, iy+5 ), &(specMPI.corner_srequest[ix][iy]) );
             }
+        }
+    }
+}
+
 
-        } // END of Recv
-                
-    } // END for iNeighbor
+// ---------------------------------------------------------------------------------------------------------------------
+// The particles sent to a MPI neighbour are packed in a single message (see Particles::pack) : no MPI datatype to
+// create, no message for the number of particles. The buffer is reused from one exchange to the next
+// ---------------------------------------------------------------------------------------------------------------------
+void Patch::sendParticles(int ispec, std::vector<int>& indexes, std::vector<char>& buffer, int rank, int tag, MPI_Request* request)
+{
+    buffer.clear();
+    vecSpecies[ispec]->particles->pack( indexes, buffer );
 
-} // END CommParticles(... iDim)
+    MPI_Isend( &buffer[0], buffer.size(), MPI_BYTE, rank, tag, MPI_COMM_WORLD, request );
+}
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-// For direction iDim, finalize receive of particles, temporary store particles if diagonalParticles
-// And store recv particles at their definitive place. 
+// The size of the message is probed before receiving it, only one patch receives from a given neighbour and tag
+// ---------------------------------------------------------------------------------------------------------------------
+int Patch::recvParticles(std::vector<char>& buffer, Particles& recv, int rank, int tag)
+{
+    MPI_Status status;
+    int size;
+    MPI_Probe( rank, tag, MPI_COMM_WORLD, &status );
+    MPI_Get_count( &status, MPI_BYTE, &size );
+    if ( (int)buffer.size() < size )
+        buffer.resize( size );
+    MPI_Recv( &buffer[0], size, MPI_BYTE, rank, tag, MPI_COMM_WORLD, &status );
+
+    recv.unpack( buffer, 0 );
+    return recv.size();
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Finalize send of particles and store received particles at their definitive place. 
 // Call Patch::cleanup_sent_particles
 //   - vecPatch : used for intra-MPI process comm (direct copy using Particels::cp_particles)
-//   - smpi     : used smpi->periods_
 // ---------------------------------------------------------------------------------------------------------------------
-void Patch::finalizeCommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim, VectorPatch * vecPatch)
+void Patch::finalizeCommParticles(SmileiMPI* smpi, int ispec, Params& params, VectorPatch * vecPatch)
 {
 
     int ndim = params.nDim_field;
-    int idim, check;
-
-    Particles &cuParticles = (*vecSpecies[ispec]->particles);
-    double xmax[3]; 
-    for (int idim=0 ; idim < ndim ; idim++)
-        xmax[idim] = params.cell_length[idim]*( params.n_space_global[idim] );
-
+    int idim;
 
+    SpeciesMPI &specMPI = vecSpecies[ispec]->specMPI;
     std::vector<int>* indexes_of_particles_to_exchange = &vecSpecies[ispec]->indexes_of_particles_to_exchange;
 
-    std::vector<int>* cubmin = &vecSpecies[ispec]->bmin;
     std::vector<int>* cubmax = &vecSpecies[ispec]->bmax;
 
-    int nmove,lmove,ii; // local, OK
-    int shift[(*cubmax).size()+1];//how much we need to shift each bin in order to leave room for the new particles
+    int ii;
     double dbin;
         
     dbin = params.cell_length[0]*params.clrw; //width of a bin.
-    for (unsigned int j=0; j<(*cubmax).size()+1 ;j++){
-      shift[j]=0;
-    }
 
-    int n_part_send, n_part_recv, n_particles;
+    int n_part_recv;
 
     /********************************************************************************/
-    // Wait for end of communications over Particles
+    // Wait for end of send of Particles (received by CommParticles)
     /********************************************************************************/
-    for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
-        MPI_Status sstat    [2];
-        MPI_Status rstat    [2];
-                
-        n_part_send = vecSpecies[ispec]->specMPI.patch_buff_index_send[iDim][iNeighbor].size();
-        n_part_recv = vecSpecies[ispec]->specMPI.patch_buff_index_recv_sz[iDim][(iNeighbor+1)%2];
-               
-
- 
-        if ( (neighbor_[iDim][iNeighbor]!=MPI_PROC_NULL) && (n_part_send!=0) ) {
-            if (is_a_MPI_neighbor(iDim, iNeighbor))
-                MPI_Wait( &(vecSpecies[ispec]->specMPI.patch_srequest[iDim][iNeighbor]), &(sstat[iNeighbor]) );
-        }
-        if ( (neighbor_[iDim][(iNeighbor+1)%2]!=MPI_PROC_NULL) && (n_part_recv!=0) ) {
-            if (is_a_MPI_neighbor(iDim, (iNeighbor+1)%2))
-                MPI_Wait( &(vecSpecies[ispec]->specMPI.patch_rrequest[iDim][(iNeighbor+1)%2]), &(rstat[(iNeighbor+1)%2]) );     
-
-            // Treat diagonalParticles
-            if (iDim < ndim-1){ // No need to treat diag particles at last dimension.
-                for (int iPart=n_part_recv-1 ; iPart>=0; iPart-- ) {
-                    check = 0;
-                    idim = iDim+1;//We check next dimension
-                    while (check == 0 && idim<ndim){
-                        //If particle not in the domain...
-                        if ( (vecSpecies[ispec]->specMPI.patchVectorRecv[iDim][(iNeighbor+1)%2]).position(idim,iPart) < min_local[idim] ){  
-                            if (neighbor_[idim][0]!=MPI_PROC_NULL){ //if neighbour exists
-                                //...Deal with periodicity...
-                                    if (smpi->periods_[idim]==1 && Pcoordinates[idim] == 0) {
-                                    (vecSpecies[ispec]->specMPI.patchVectorRecv[iDim][(iNeighbor+1)%2]).position(idim,iPart)     += xmax[idim];
-                                }
-                                //... copy it at the back of the local particle vector ...
-                                (vecSpecies[ispec]->specMPI.patchVectorRecv[iDim][(iNeighbor+1)%2]).cp_particle(iPart, cuParticles);
-                                //...adjust bmax ...
-                                (*cubmax)[(*cubmax).size()-1]++;
-                                //... and add its index to the particles to be sent later...
-                                vecSpecies[ispec]->specMPI.patch_buff_index_send[idim][0].push_back( cuParticles.size()-1 );
-                                //..without forgeting to add it to the list of particles to clean.
-                                vecSpecies[ispec]->addPartInExchList(cuParticles.size()-1);
-                            }
-                            //Remove it from receive buffer.
-                            (vecSpecies[ispec]->specMPI.patchVectorRecv[iDim][(iNeighbor+1)%2]).erase_particle(iPart);
-                            vecSpecies[ispec]->specMPI.patch_buff_index_recv_sz[iDim][(iNeighbor+1)%2]--;
-                            check = 1;
-                        }
-                        //Other side of idim
-                        else if ( (vecSpecies[ispec]->specMPI.patchVectorRecv[iDim][(iNeighbor+1)%2]).position(idim,iPart) >= max_local[idim]) { 
-                            if (neighbor_[idim][1]!=MPI_PROC_NULL){ //if neighbour exists
-                                    if (smpi->periods_[idim]==1 && Pcoordinates[idim] == params.number_of_patches[idim]-1) {
-                                    (vecSpecies[ispec]->specMPI.patchVectorRecv[iDim][(iNeighbor+1)%2]).position(idim,iPart)     -= xmax[idim];
-                                }
-                                (vecSpecies[ispec]->specMPI.patchVectorRecv[iDim][(iNeighbor+1)%2]).cp_particle(iPart, cuParticles);
-                                (*cubmax)[(*cubmax).size()-1]++;
-                                vecSpecies[ispec]->specMPI.patch_buff_index_send[idim][1].push_back( cuParticles.size()-1 );
-                                vecSpecies[ispec]->addPartInExchList(cuParticles.size()-1);
-                            }
-                            (vecSpecies[ispec]->specMPI.patchVectorRecv[iDim][(iNeighbor+1)%2]).erase_particle(iPart);
-                            vecSpecies[ispec]->specMPI.patch_buff_index_recv_sz[iDim][(iNeighbor+1)%2]--;
-                            check = 1;
-                        }
-                        idim++;
-                    }
-                }
-            }//If not last dim for diagonal particles.
-
-        } //If received something
-    } //loop i Neighbor
-
-    //La recopie finale doit se faire au traitement de la dernière dimension seulement !!
-    if (iDim == ndim-1){
-   
-        //We have stored in indexes_of_particles_to_exchange the list of all particles that needs to be removed.
-        cleanup_sent_particles(ispec, indexes_of_particles_to_exchange);
-        (*indexes_of_particles_to_exchange).clear();
-        cuParticles.erase_particle_trail((*cubmax).back());
-
-        //Evaluation of the necessary shift of all bins.
-        for (unsigned int j=0; j<(*cubmax).size()+1 ;j++){
-            shift[j]=0;
-        }
-
-        //idim=0
-        shift[1] += vecSpecies[ispec]->specMPI.patch_buff_index_recv_sz[0][0];//Particles coming from south all go to bin 0 and shift all the other bins.
-        shift[(*cubmax).size()] += vecSpecies[ispec]->specMPI.patch_buff_index_recv_sz[0][1];//Used only to count the total number of particles arrived.
-        //idim>0
-        for (idim = 1; idim < ndim; idim++){
-            for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
-                n_part_recv = vecSpecies[ispec]->specMPI.patch_buff_index_recv_sz[idim][iNeighbor];
-                for (unsigned int j=0; j<n_part_recv ;j++){
-                    //We first evaluate how many particles arrive in each bin.
-                        ii = int((vecSpecies[ispec]->specMPI.patchVectorRecv[idim][iNeighbor].position(0,j)-min_local[0])/dbin);//bin in which the particle goes.
-                    shift[ii+1]++; // It makes the next bins shift.
-                }
-            }
+    MPI_Status sstat;
+    for (idim=0 ; idim<nDim_fields_ ; idim++) {
+        for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
+            if (is_a_MPI_neighbor(idim, iNeighbor))
+                MPI_Wait( &(specMPI.patch_srequest[idim][iNeighbor]), &sstat );
         }
+    }
+    if (nDim_fields_>1) {
+        for (int ix=0 ; ix<2 ; ix++)
+            for (int iy=0 ; iy<2 ; iy++)
+                if (is_a_MPI_corner_neighbor(ix, iy))
+                    MPI_Wait( &(specMPI.corner_srequest[ix][iy]), &sstat );
+    }
 
+    int nbin = (*cubmax).size();
+    specMPI.bin_arrivals.resize(nbin);
+    for (int ibin=0 ; ibin<nbin ; ibin++)
+        specMPI.bin_arrivals[ibin].clear();
 
-        //Must be done sequentially
-        for (unsigned int j=1; j<(*cubmax).size()+1;j++){ //bin 0 is not shifted.Last element of shift stores total number of arriving particles.
-            shift[j]+=shift[j-1];
-        }
-        //Make room for new particles
-        if (shift[(*cubmax).size()]) {
-          //! vecor::resize of Charge crashed ! Temporay solution : push_back / Particle
-          //cuParticles.initialize( cuParticles.size()+shift[(*cubmax).size()], cuParticles.Position.size() );
-          for (int inewpart=0 ; inewpart<shift[(*cubmax).size()] ; inewpart++) cuParticles.create_particle();
-        }
-            
-        //Shift bins, must be done sequentially
-        for (unsigned int j=(*cubmax).size()-1; j>=1; j--){
-            n_particles = (*cubmax)[j]-(*cubmin)[j]; //Nbr of particle in this bin
-            nmove = min(n_particles,shift[j]); //Nbr of particles to move
-            lmove = max(n_particles,shift[j]); //How far particles must be shifted
-            if (nmove>0) cuParticles.overwrite_part((*cubmin)[j], (*cubmin)[j]+lmove, nmove);
-            (*cubmin)[j] += shift[j];
-            (*cubmax)[j] += shift[j];
+    //Evaluation of the destination bin of the arriving particles, stored as (receive buffer, index).
+    //idim == 0  is the easy case, when particles arrive either in first or last bin.
+    for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
+        n_part_recv = specMPI.patch_buff_index_recv_sz[0][iNeighbor];
+        if ( (neighbor_[0][iNeighbor]!=MPI_PROC_NULL) && (n_part_recv!=0) ) {
+            ii = iNeighbor*(nbin-1);//0 if iNeighbor=0(particles coming from West) and nbin-1 otherwise.
+            for (int j=0; j<n_part_recv; j++)
+                specMPI.bin_arrivals[ii].push_back( make_pair(iNeighbor, j) );
         }
-            
-        //Space has been made now to write the arriving particles into the correct bins
-        //idim == 0  is the easy case, when particles arrive either in first or last bin.
-        for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
-            n_part_recv = vecSpecies[ispec]->specMPI.patch_buff_index_recv_sz[0][iNeighbor];
-            if ( (neighbor_[0][iNeighbor]!=MPI_PROC_NULL) && (n_part_recv!=0) ) {
-                ii = iNeighbor*((*cubmax).size()-1);//0 if iNeighbor=0(particles coming from West) and (*cubmax).size()-1 otherwise.
-                vecSpecies[ispec]->specMPI.patchVectorRecv[0][iNeighbor].overwrite_part(0, cuParticles,(*cubmax)[ii],n_part_recv);
-                (*cubmax)[ii] += n_part_recv ;
+    }
+    //Corners are as easy, the side in the first direction gives the bin.
+    if (ndim>1) {
+        for (int ix=0 ; ix<2 ; ix++) {
+            for (int iy=0 ; iy<2 ; iy++) {
+                n_part_recv = specMPI.corner_buff_index_recv_sz[ix][iy];
+                if ( (corner_neighbor_[ix][iy]!=MPI_PROC_NULL) && (n_part_recv!=0) ) {
+                    ii = ix*(nbin-1);
+                    for (int j=0; j<n_part_recv; j++)
+                        specMPI.bin_arrivals[ii].push_back( make_pair(4+2*ix+iy, j) );
+                }
             }
         }
-        //idim > 0; this is the difficult case, when particles can arrive in any bin.
-        for (idim = 1; idim < ndim; idim++){
-            for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
-                n_part_recv = vecSpecies[ispec]->specMPI.patch_buff_index_recv_sz[idim][iNeighbor];
-                if ( (neighbor_[idim][iNeighbor]!=MPI_PROC_NULL) && (n_part_recv!=0) ) {
-                        for(unsigned int j=0; j<n_part_recv; j++){
-                            ii = int((vecSpecies[ispec]->specMPI.patchVectorRecv[iDim][iNeighbor].position(0,j)-min_local[0])/dbin);//bin in which the particle goes.
-                            vecSpecies[ispec]->specMPI.patchVectorRecv[idim][iNeighbor].overwrite_part(j, cuParticles,(*cubmax)[ii]);
-                            (*cubmax)[ii] ++ ;
-                        }
+    }
+    //idim > 0; this is the difficult case, when particles can arrive in any bin.
+    for (idim = 1; idim < ndim; idim++){
+        for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
+            n_part_recv = specMPI.patch_buff_index_recv_sz[idim][iNeighbor];
+            if ( (neighbor_[idim][iNeighbor]!=MPI_PROC_NULL) && (n_part_recv!=0) ) {
+                for (int j=0; j<n_part_recv; j++) {
+                    ii = int((specMPI.patchVectorRecv[idim][iNeighbor].position(0,j)-min_local[0])/dbin);//bin in which the particle goes.
+                    ii = min( max(ii, 0), nbin-1 );
+                    specMPI.bin_arrivals[ii].push_back( make_pair(2*idim+iNeighbor, j) );
                 }
             }
         }
-    }//End Recv_buffers ==> particles
+    }
 
-} // finalizeCommParticles(... iDim)
+    //We have stored in indexes_of_particles_to_exchange the list of all particles that needs to be removed.
+    //Their slots are filled by the arriving particles.
+    cleanup_sent_particles(ispec, indexes_of_particles_to_exchange);
+    (*indexes_of_particles_to_exchange).clear();
+
+} // finalizeCommParticles
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-// Clear vecSpecies[]->indexes_of_particles_to_exchange, suppress particles send and manage memory
+// Suppress particles sent, store particles received (vecSpecies[]->specMPI.bin_arrivals) in their bin
+//   - departed particles leave holes in their bin, filled first by the particles arriving in the same bin
+//   - bins are compacted and moved in memory only when holes and arrivals do not match
 // ---------------------------------------------------------------------------------------------------------------------
 void Patch::cleanup_sent_particles(int ispec, std::vector<int>* indexes_of_particles_to_exchange)
 {
     /********************************************************************************/
     // Delete Particles included in the index of particles to exchange. Assumes indexes are sorted.
     /********************************************************************************/
-    int ii, iPart;
     std::vector<int>* cubmin = &vecSpecies[ispec]->bmin;
     std::vector<int>* cubmax = &vecSpecies[ispec]->bmax;
     Particles &cuParticles = (*vecSpecies[ispec]->particles);
-
-    
-    // Push lost particles at the end of bins
-    for (unsigned int ibin = 0 ; ibin < (*cubmax).size() ; ibin++ ) {
-        ii = (*indexes_of_particles_to_exchange).size()-1;
-        if (ii >= 0) { // Push lost particles to the end of the bin
-            iPart = (*indexes_of_particles_to_exchange)[ii];
-            while (iPart >= (*cubmax)[ibin] && ii > 0) {
-                ii--;
-                iPart = (*indexes_of_particles_to_exchange)[ii];
-            }
-            while (iPart == (*cubmax)[ibin]-1 && iPart >= (*cubmin)[ibin] && ii > 0) {
-                (*cubmax)[ibin]--;
-                ii--;
-                iPart = (*indexes_of_particles_to_exchange)[ii];
-            }
-            while (iPart >= (*cubmin)[ibin] && ii > 0) {
-                cuParticles.overwrite_part((*cubmax)[ibin]-1, iPart );
-                (*cubmax)[ibin]--;
-                ii--;
-                iPart = (*indexes_of_particles_to_exchange)[ii];
-            }
-            if (iPart >= (*cubmin)[ibin] && iPart < (*cubmax)[ibin]) { //On traite la dernière particule (qui peut aussi etre la premiere)
-                cuParticles.overwrite_part((*cubmax)[ibin]-1, iPart );
-                (*cubmax)[ibin]--;
-            }
+    SpeciesMPI &specMPI = vecSpecies[ispec]->specMPI;
+
+    int nbin   = (*cubmax).size();
+    int n_exch = (*indexes_of_particles_to_exchange).size();
+    int ii, nmove, lmove, shift, n_particles;
+
+    // Holes of each bin
+    specMPI.bin_holes.resize(nbin);
+    ii = 0;
+    for (int ibin = 0 ; ibin < nbin ; ibin++ ) {
+        std::vector<int> &holes = specMPI.bin_holes[ibin];
+        holes.clear();
+        while ( ii < n_exch && (*indexes_of_particles_to_exchange)[ii] < (*cubmax)[ibin] ) {
+            if ( (*indexes_of_particles_to_exchange)[ii] >= (*cubmin)[ibin] )
+                holes.push_back( (*indexes_of_particles_to_exchange)[ii] );
+            ii++;
+        }
+    }
+    cuParticles.erase_particle_trail((*cubmax).back());
+
+    // The largest holes of a bin are filled with the particles arriving in this bin,
+    // the remaining holes with the last particles of the bin
+    bool contiguous = true;
+    for (int ibin = 0 ; ibin < nbin ; ibin++ ) {
+        std::vector<int> &holes = specMPI.bin_holes[ibin];
+        std::vector< std::pair<int,int> > &arrivals = specMPI.bin_arrivals[ibin];
+        int nholes = holes.size();
+        int nfill  = min( nholes, (int)arrivals.size() );
+        for (int i=0 ; i<nfill ; i++ ) {
+            Particles &recv = specMPI.recvVector( arrivals[i].first );
+            recv.overwrite_part( arrivals[i].second, cuParticles, holes[nholes-nfill+i] );
         }
+        if ( ( ibin>0 && (*cubmin)[ibin] != (*cubmax)[ibin-1] ) || ( (int)arrivals.size() > nfill ) )
+            contiguous = false;
+        if ( nholes > nfill ) {
+            holes.resize( nholes-nfill );
+            (*cubmax)[ibin] = cuParticles.fill_holes( holes, (*cubmax)[ibin] );
+            // All arrivals of this bin are stored
+            arrivals.clear();
+        }
+    }
+
+    // Holes and arrivals matched in all bins (except may be the last one), no bin to move
+    if ( contiguous ) {
+        cuParticles.erase_particle_trail( (*cubmax).back() );
+        return;
     }
 
+    // New first index of each bin
+    std::vector<int> &new_bmin = specMPI.bin_new_min;
+    new_bmin.resize(nbin);
+    new_bmin[0] = 0;
+    for (int ibin = 1 ; ibin < nbin ; ibin++ ) {
+        int nextra = max( (int)specMPI.bin_arrivals[ibin-1].size() - (int)specMPI.bin_holes[ibin-1].size(), 0 );
+        new_bmin[ibin] = new_bmin[ibin-1] + (*cubmax)[ibin-1]-(*cubmin)[ibin-1] + nextra;
+    }
+    int nextra = max( (int)specMPI.bin_arrivals[nbin-1].size() - (int)specMPI.bin_holes[nbin-1].size(), 0 );
+    int new_size = new_bmin[nbin-1] + (*cubmax)[nbin-1]-(*cubmin)[nbin-1] + nextra;
+
+    //Make room for new particles
+    if ( new_size > (int)cuParticles.size() )
+        cuParticles.create_particles( new_size - cuParticles.size() );
+
+    //Shift the bins in memory, bins going down first (ascending), then bins going up (descending).
+    //Warning: these loops must be executed sequentially. Do not use openMP here.
+    for (int ibin = 0 ; ibin < nbin ; ibin++ ) {
+        shift = (*cubmin)[ibin] - new_bmin[ibin];
+        if ( shift > 0 ) {
+            n_particles = (*cubmax)[ibin]-(*cubmin)[ibin];
+            nmove = min( n_particles, shift ); // Number of particles we have to shift = min (Nshift, Nparticle in the bin)
+            if (nmove > 0) cuParticles.overwrite_part( (*cubmax)[ibin]-nmove, new_bmin[ibin], nmove );
+            (*cubmin)[ibin] -= shift;
+            (*cubmax)[ibin] -= shift;
+        }
+    }
+    for (int ibin = nbin-1 ; ibin >= 0 ; ibin-- ) {
+        shift = new_bmin[ibin] - (*cubmin)[ibin];
+        if ( shift > 0 ) {
+            n_particles = (*cubmax)[ibin]-(*cubmin)[ibin];
+            nmove = min( n_particles, shift ); //Nbr of particles to move
+            lmove = max( n_particles, shift ); //How far particles must be shifted
+            if (nmove > 0) cuParticles.overwrite_part( (*cubmin)[ibin], (*cubmin)[ibin]+lmove, nmove );
+            (*cubmin)[ibin] += shift;
+            (*cubmax)[ibin] += shift;
+        }
+    }
 
-    //Shift the bins in memory
-    //Warning: this loop must be executed sequentially. Do not use openMP here.
-    for (int unsigned ibin = 1 ; ibin < (*cubmax).size() ; ibin++ ) { //First bin don't need to be shifted
-        ii = (*cubmin)[ibin]-(*cubmax)[ibin-1]; // Shift the bin in memory by ii slots.
-        iPart = min(ii,(*cubmax)[ibin]-(*cubmin)[ibin]); // Number of particles we have to shift = min (Nshift, Nparticle in the bin)
-        if(iPart > 0) cuParticles.overwrite_part((*cubmax)[ibin]-iPart,(*cubmax)[ibin-1],iPart);
-        (*cubmax)[ibin] -= ii;
-        (*cubmin)[ibin] = (*cubmax)[ibin-1];
+    //Space has been made now to write the remaining arriving particles at the end of their bin
+    for (int ibin = 0 ; ibin < nbin ; ibin++ ) {
+        std::vector< std::pair<int,int> > &arrivals = specMPI.bin_arrivals[ibin];
+        for (unsigned int i=specMPI.bin_holes[ibin].size() ; i<arrivals.size() ; i++ ) {
+            Particles &recv = specMPI.recvVector( arrivals[i].first );
+            recv.overwrite_part( arrivals[i].second, cuParticles, (*cubmax)[ibin] );
+            (*cubmax)[ibin]++;
+        }
     }
 
+    cuParticles.erase_particle_trail( new_size );
+
 } // END cleanup_sent_particles
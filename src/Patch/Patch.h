@@ -26,6 +26,7 @@ class Patch
     friend class VectorPatch;
     friend class SimWindow;
     friend class SyncVectorPatch;
+    friend class HaloCommPlan;
 public:
     //! Constructor for Patch
     Patch(Params& params, SmileiMPI* smpi, unsigned int ipatch, unsigned int n_moved);
@@ -84,13 +85,16 @@ public:
 
     //! manage Idx of particles per direction,
     void initExchParticles(SmileiMPI* smpi, int ispec, Params& params);
-    //!init comm  nbr of particles/
-    void initCommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim, VectorPatch* vecPatch);
-    //! finalize comm / nbr of particles, init exch / particles
-    void CommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim, VectorPatch* vecPatch);
+    //! manage Idx of particles and post the MPI comm / particles in advance
+    //! (overlap of the communications with the dynamics of the interior patches)
+    void postCommParticles(SmileiMPI* smpi, int ispec, Params& params);
+    //! send packed particles to MPI neighbours, nbr of particles to local neighbours
+    void initCommParticles(SmileiMPI* smpi, int ispec, Params& params, VectorPatch* vecPatch);
+    //! recv packed particles from MPI neighbours, copy particles to local neighbours
+    void CommParticles(SmileiMPI* smpi, int ispec, Params& params, VectorPatch* vecPatch);
     //! finalize exch / particles, manage particles suppr/introduce
-    void finalizeCommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim, VectorPatch* vecPatch);
-    //! delete Particles included in the index of particles to exchange. Assumes indexes are sorted.
+    void finalizeCommParticles(SmileiMPI* smpi, int ispec, Params& params, VectorPatch* vecPatch);
+    //! delete Particles included in the index of particles to exchange (sorted), their slots are filled by the received particles
     void cleanup_sent_particles(int ispec, std::vector<int>* indexes_of_particles_to_exchange);
 
     //! init comm / sum densities
@@ -119,6 +123,12 @@ public:
     //! Method to identify the rank 0 MPI process
     inline bool isMaster() { return (hindex==0); }
 
+    //! Coordinate of a particle along the direction idim of the patch decomposition
+    //! (in 3drz, the direction 1 is the distance to the axis)
+    inline double particleCoordinate( Particles& particles, int idim, int iPart ) {
+        return ( rz_ && idim==1 ) ? particles.distance_to_axis(iPart) : particles.position(idim, iPart);
+    }
+
     //! Should be pure virtual, see child classes
     inline bool isWestern()  { return locateOnBorders(0, 0); }
     //! Should be pure virtual, see child classes
@@ -142,6 +152,9 @@ public:
     inline bool is_a_MPI_neighbor(int iDim, int iNeighbor) {
     return( (neighbor_[iDim][iNeighbor]!=MPI_PROC_NULL) && (MPI_neighbor_[iDim][iNeighbor]!=MPI_me_) );
     }
+    inline bool is_a_MPI_corner_neighbor(int ix, int iy) {
+    return( (corner_neighbor_[ix][iy]!=MPI_PROC_NULL) && (MPI_corner_neighbor_[ix][iy]!=MPI_me_) );
+    }
 
     //! Return real (excluding oversize) min coordinates (ex : rank 0 returns 0.) for direction i
     //! @see min_local
@@ -199,17 +212,23 @@ protected:
 
     //! Store number of space dimensions for the fields
     int nDim_fields_;
+    
+    //! 3drz geometry : the patches are decomposed in (x,r)
+    bool rz_;
 
     //! Number of MPI process per direction in the cartesian topology (2)
     int nbNeighbors_;
 
     //! Hilbert index of neighbors patch
     std::vector< std::vector<int> > neighbor_;
-    //! Hilbert index of corners neighbors patch
-    std::vector< std::vector<int> > corner_neighbor_; // Kept for Moving Windows
+    //! Hilbert index of corners neighbors patch : corner_neighbor_[ix][iy], 0 on the min side, 1 on the max side
+    //! (moving window, exchange of the particles leaving through a corner)
+    std::vector< std::vector<int> > corner_neighbor_;
 
     //! MPI rank of neighbors patch
     std::vector< std::vector<int> > MPI_neighbor_;
+    //! MPI rank of corners neighbors patch
+    std::vector< std::vector<int> > MPI_corner_neighbor_;
 
     //! "Real" min limit of local sub-subdomain (ghost data not concerned)
     //!     - "0." on rank 0
@@ -223,6 +242,12 @@ protected:
 
     std::vector<unsigned int> oversize;
     
+    //! Pack the particles sent to all the MPI neighbours (faces and corners) and post the messages
+    void sendMPIParticles(int ispec);
+    //! Pack the particles of indexes in buffer and post the message to rank
+    void sendParticles(int ispec, std::vector<int>& indexes, std::vector<char>& buffer, int rank, int tag, MPI_Request* request);
+    //! Receive the message of rank in buffer and unpack its particles in recv, returns their number
+    int recvParticles(std::vector<char>& buffer, Particles& recv, int rank, int tag);
 
 };
 
@@ -68,7 +68,8 @@ void Patch1D::initSumField( Field* field, int iDim )
     std::vector<unsigned int> isDual = field->isDual_;
     Field1D* f1D =  static_cast<Field1D*>(field);
     
-    // Use a buffer per direction to exchange data before summing
+    // Use a buffer per direction to exchange data before summing, held by the field so that the sums of several
+    // fields can be in flight (see SyncVectorPatch::sumStart)
     // Size buffer is 2 oversize (1 inside & 1 outside of the current subdomain)
     std::vector<unsigned int> oversize2 = oversize;
     oversize2[0] *= 2;
@@ -77,7 +78,7 @@ void Patch1D::initSumField( Field* field, int iDim )
     for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
         std::vector<unsigned int> tmp(nDim_fields_,0);
         tmp[0] =    iDim  * n_elem[0] + (1-iDim) * oversize2[0];
-        buf[iDim][iNeighbor].allocateDims( tmp );
+        f1D->specMPI.sum_buffer[iDim][iNeighbor].resize( tmp[0] );
     }
      
     int istart, ix;
@@ -99,11 +100,9 @@ void Patch1D::initSumField( Field* field, int iDim )
         } // END of Send
             
         if ( is_a_MPI_neighbor( iDim, (iNeighbor+1)%2 ) ) {
-            int tmp_elem = (buf[iDim][(iNeighbor+1)%2]).dims_[0];
+            int tmp_elem = f1D->specMPI.sum_buffer[iDim][(iNeighbor+1)%2].size();
             int tag = buildtag( neighbor_[iDim][(iNeighbor+1)%2], iDim, iNeighbor );
-            MPI_Irecv( &( (buf[iDim][(iNeighbor+1)%2]).data_[0] ), tmp_elem, MPI_DOUBLE, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &(f1D->specMPI.patch_rrequest[iDim][(iNeighbor+1)%2]) );
-            //MPI_Status stat;
-            //MPI_Recv( &( (buf[iDim][(iNeighbor+1)%2]).data_[0] ), tmp_elem, MPI_DOUBLE, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &stat );
+            MPI_Irecv( &( f1D->specMPI.sum_buffer[iDim][(iNeighbor+1)%2][0] ), tmp_elem, MPI_DOUBLE, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &(f1D->specMPI.patch_rrequest[iDim][(iNeighbor+1)%2]) );
         } // END of Recv
             
     } // END for iNeighbor
@@ -155,17 +154,13 @@ void Patch1D::finalizeSumField( Field* field, int iDim )
         istart = ( (iNeighbor+1)%2 ) * ( n_elem[iDim]- oversize2[iDim] ) + (1-(iNeighbor+1)%2) * ( 0 );
         int ix0 = (1-iDim)*istart;
         if ( is_a_MPI_neighbor( iDim, (iNeighbor+1)%2 ) ) {
-            for (unsigned int ix=0 ; ix< (buf[iDim][(iNeighbor+1)%2]).dims_[0] ; ix++) {
-                f1D->data_[ix0+ix] += (buf[iDim][(iNeighbor+1)%2])(ix);
+            std::vector<double>& b = f1D->specMPI.sum_buffer[iDim][(iNeighbor+1)%2];
+            for (unsigned int ix=0 ; ix< b.size() ; ix++) {
+                f1D->data_[ix0+ix] += b[ix];
             }
         } // END if
             
     } // END for iNeighbor
-        
-
-    for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
-        buf[iDim][iNeighbor].deallocateDims();
-    }
 
 } // END finalizeSumField
 
@@ -97,8 +97,8 @@ void Patch2D::initSumField( Field* field, int iDim )
     std::vector<unsigned int> isDual = field->isDual_;
     Field2D* f2D =  static_cast<Field2D*>(field);
    
-    // Use a buffer per direction to exchange data before summing
-    //Field2D buf[patch_ndims_][patch_nbNeighbors_];
+    // Use a buffer per direction to exchange data before summing, held by the field so that the sums of several
+    // fields can be in flight (see SyncVectorPatch::sumStart)
     // Size buffer is 2 oversize (1 inside & 1 outside of the current subdomain)
     std::vector<unsigned int> oversize2 = oversize;
     oversize2[0] *= 2;
@@ -115,7 +115,7 @@ void Patch2D::initSumField( Field* field, int iDim )
             tmp[1] = (1-iDim) * n_elem[1] +    iDim  * oversize2[1];
         else 
             tmp[1] = 1;
-        buf[iDim][iNeighbor].allocateDims( tmp );
+        f2D->specMPI.sum_buffer[iDim][iNeighbor].resize( tmp[0]*tmp[1] );
     }
      
     int istart, ix, iy;
@@ -139,12 +139,11 @@ void Patch2D::initSumField( Field* field, int iDim )
         } // END of Send
             
         if ( is_a_MPI_neighbor( iDim, (iNeighbor+1)%2 ) ) {
-            int tmp_elem = (buf[iDim][(iNeighbor+1)%2]).dims_[0]*(buf[iDim][(iNeighbor+1)%2]).dims_[1];
+            int tmp_elem = f2D->specMPI.sum_buffer[iDim][(iNeighbor+1)%2].size();
             //int tag = buildtag( 3, neighbor_[iDim][(iNeighbor+1)%2], hindex);
             int tag = buildtag( neighbor_[iDim][(iNeighbor+1)%2], iDim, iNeighbor );
             //cout << hindex << " recv from " << neighbor_[iDim][(iNeighbor+1)%2] << " ; n_elements = " << tmp_elem << endl;
-            //MPI_Irecv( &( (buf[iDim][(iNeighbor+1)%2]).data_2D[0][0] ), tmp_elem, MPI_DOUBLE, 0, tag, MPI_COMM_SELF, &(f2D->specMPI.patch_rrequest[iDim][(iNeighbor+1)%2]) );
-            MPI_Irecv( &( (buf[iDim][(iNeighbor+1)%2]).data_2D[0][0] ), tmp_elem, MPI_DOUBLE, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &(f2D->specMPI.patch_rrequest[iDim][(iNeighbor+1)%2]) );
+            MPI_Irecv( &( f2D->specMPI.sum_buffer[iDim][(iNeighbor+1)%2][0] ), tmp_elem, MPI_DOUBLE, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &(f2D->specMPI.patch_rrequest[iDim][(iNeighbor+1)%2]) );
         } // END of Recv
             
     } // END for iNeighbor
@@ -160,19 +159,20 @@ void Patch2D::initSumField( Field* field, int iDim )
 void Patch2D::finalizeSumField( Field* field, int iDim )
 {
     int patch_ndims_(2);
-    int patch_nbNeighbors_(2);
     std::vector<unsigned int> n_elem = field->dims_;
     std::vector<unsigned int> isDual = field->isDual_;
     Field2D* f2D =  static_cast<Field2D*>(field);
    
-    // Use a buffer per direction to exchange data before summing
-    //Field2D buf[patch_ndims_][patch_nbNeighbors_];
+    // The data received per direction are summed from the buffers of the field (see initSumField)
     // Size buffer is 2 oversize (1 inside & 1 outside of the current subdomain)
     std::vector<unsigned int> oversize2 = oversize;
     oversize2[0] *= 2;
     oversize2[0] += 1 + f2D->isDual_[0];
     oversize2[1] *= 2;
     oversize2[1] += 1 + f2D->isDual_[1];
+    // Dimensions of the buffers
+    unsigned int nx_buf =    iDim  * n_elem[0] + (1-iDim) * oversize2[0];
+    unsigned int ny_buf = (1-iDim) * n_elem[1] +    iDim  * oversize2[1];
     
     int istart;
     /********************************************************************************/
@@ -203,18 +203,14 @@ void Patch2D::finalizeSumField( Field* field, int iDim )
         int ix0 = (1-iDim)*istart;
         int iy0 =    iDim *istart;
         if ( is_a_MPI_neighbor( iDim, (iNeighbor+1)%2 ) ) {
-            for (unsigned int ix=0 ; ix< (buf[iDim][(iNeighbor+1)%2]).dims_[0] ; ix++) {
-                for (unsigned int iy=0 ; iy< (buf[iDim][(iNeighbor+1)%2]).dims_[1] ; iy++)
-                    f2D->data_2D[ix0+ix][iy0+iy] += (buf[iDim][(iNeighbor+1)%2])(ix,iy);
+            std::vector<double>& b = f2D->specMPI.sum_buffer[iDim][(iNeighbor+1)%2];
+            for (unsigned int ix=0 ; ix< nx_buf ; ix++) {
+                for (unsigned int iy=0 ; iy< ny_buf ; iy++)
+                    f2D->data_2D[ix0+ix][iy0+iy] += b[ix*ny_buf+iy];
             }
         } // END if
             
     } // END for iNeighbor
-        
-
-    for (int iNeighbor=0 ; iNeighbor<patch_nbNeighbors_ ; iNeighbor++) {
-        buf[iDim][iNeighbor].deallocateDims();
-    }
 
 } // END finalizeSumField
 
@@ -56,6 +56,7 @@ public:
         MESSAGE(1,"All patches created");
         vecPatches.set_refHindex();
         
+        vecPatches.aggregateComms = params.aggregate_communications;
         vecPatches.update_field_list();
         
         vecPatches.createDiags( params, smpi );
@@ -9,84 +9,275 @@
 
 using namespace std;
 
-void SyncVectorPatch::exchangeParticles(VectorPatch& vecPatches, int ispec, Params &params, SmileiMPI* smpi)
+void SyncVectorPatch::exchangeParticles(VectorPatch& vecPatches, int ispec, Params &params, SmileiMPI* smpi, int itime)
 {
     #pragma omp for schedule(runtime)
     for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
-        vecPatches(ipatch)->initExchParticles(smpi, ispec, params);
+        // Already done by Patch::postCommParticles for the border patches if the communications are overlapped
+        if ( !vecPatches(ipatch)->vecSpecies[ispec]->specMPI.particles_posted )
+            vecPatches(ipatch)->initExchParticles(smpi, ispec, params);
     }
 
-    //cout << "init exch done" << endl;
-
-    // Per direction
-    for (unsigned int iDim=0 ; iDim<params.nDim_particle ; iDim++) {
-        //cout << "initExchParticles done for " << iDim << endl;
-        #pragma omp for schedule(runtime)
-        for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
-            vecPatches(ipatch)->initCommParticles(smpi, ispec, params, iDim, &vecPatches);
-        }
-        #pragma omp for schedule(runtime)
-        for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
-            vecPatches(ipatch)->CommParticles(smpi, ispec, params, iDim, &vecPatches);
-        }
-        //cout << "init comm done for dim " << iDim << endl;
-        //cout << "initCommParticles done for " << iDim << endl;
-        #pragma omp for schedule(runtime)
-        for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
-            vecPatches(ipatch)->finalizeCommParticles(smpi, ispec, params, iDim, &vecPatches);
-        }
-        //cout << "final comm done for dim " << iDim << endl;
+    // Single phase : particles are sent directly to the neighbours of the faces and of the corners
+    #pragma omp for schedule(runtime)
+    for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
+        vecPatches(ipatch)->initCommParticles(smpi, ispec, params, &vecPatches);
+    }
+    #pragma omp for schedule(runtime)
+    for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
+        vecPatches(ipatch)->CommParticles(smpi, ispec, params, &vecPatches);
     }
+    #pragma omp for schedule(runtime)
+    for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
+        vecPatches(ipatch)->finalizeCommParticles(smpi, ispec, params, &vecPatches);
+    }
+
+    // Full sort per cell every sort_every timesteps, bins only re-bracketed in between
+    bool cell_sort = ( params.sort_every != 0 ) && ( itime%params.sort_every == 0 );
 
     #pragma omp for schedule(runtime)
-    for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++)
-        vecPatches(ipatch)->vecSpecies[ispec]->sort_part();
+    for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
+        if (cell_sort)
+            vecPatches(ipatch)->vecSpecies[ispec]->count_sort_part(params);
+        else
+            vecPatches(ipatch)->vecSpecies[ispec]->sort_part();
+        // Release memory left by departed particles (hysteresis, see Particles::shrink_capacity)
+        vecPatches(ipatch)->vecSpecies[ispec]->particles->shrink_capacity();
+    }
 
 }
 
 void SyncVectorPatch::sumRhoJ(VectorPatch& vecPatches, unsigned int diag_flag )
 {
 
-    SyncVectorPatch::sum( vecPatches.listJx_ , vecPatches );
-    SyncVectorPatch::sum( vecPatches.listJy_ , vecPatches );
-    SyncVectorPatch::sum( vecPatches.listJz_ , vecPatches );
-    if(diag_flag) SyncVectorPatch::sum( vecPatches.listrho_, vecPatches );
+    std::vector< std::vector<Field*>* > lists;
+    lists.push_back( &vecPatches.listJx_ );
+    lists.push_back( &vecPatches.listJy_ );
+    lists.push_back( &vecPatches.listJz_ );
+    if(diag_flag) lists.push_back( &vecPatches.listrho_ );
+    if(vecPatches.listEnvChi_.size()) lists.push_back( &vecPatches.listEnvChi_ );
+    // Azimuthal modes (3drz)
+    for (unsigned int k=0 ; k<vecPatches.listModesJ_.size() ; k++)
+        lists.push_back( &vecPatches.listModesJ_[k] );
+    if(diag_flag)
+        for (unsigned int k=0 ; k<vecPatches.listModesRho_.size() ; k++)
+            lists.push_back( &vecPatches.listModesRho_[k] );
+
+    SyncVectorPatch::sum( lists, vecPatches );
+}
+
+// Overlapped sum of the currents (timesteps without field diagnostics), see VectorPatch::dynamics
+void SyncVectorPatch::sumRhoJStart( VectorPatch& vecPatches )
+{
+
+    std::vector< std::vector<Field*>* > lists;
+    lists.push_back( &vecPatches.listJx_ );
+    lists.push_back( &vecPatches.listJy_ );
+    lists.push_back( &vecPatches.listJz_ );
+    SyncVectorPatch::sumStart( lists, vecPatches );
+}
+
+void SyncVectorPatch::sumRhoJFinalize( VectorPatch& vecPatches )
+{
+
+    std::vector< std::vector<Field*>* > lists;
+    lists.push_back( &vecPatches.listJx_ );
+    lists.push_back( &vecPatches.listJy_ );
+    lists.push_back( &vecPatches.listJz_ );
+    SyncVectorPatch::sumFinalize( lists, vecPatches );
+
+    std::vector< std::vector<Field*>* > others;
+    if(vecPatches.listEnvChi_.size()) others.push_back( &vecPatches.listEnvChi_ );
+    // Azimuthal modes (3drz)
+    for (unsigned int k=0 ; k<vecPatches.listModesJ_.size() ; k++)
+        others.push_back( &vecPatches.listModesJ_[k] );
+    if (others.size())
+        SyncVectorPatch::sum( others, vecPatches );
 }
 
 void SyncVectorPatch::sumRhoJs(VectorPatch& vecPatches, int ispec )
 {
 
-    SyncVectorPatch::sum( vecPatches.listJxs_,  vecPatches );
-    SyncVectorPatch::sum( vecPatches.listJys_,  vecPatches );
-    SyncVectorPatch::sum( vecPatches.listJzs_,  vecPatches );
-    SyncVectorPatch::sum( vecPatches.listrhos_, vecPatches );
+    std::vector< std::vector<Field*>* > lists;
+    lists.push_back( &vecPatches.listJxs_  );
+    lists.push_back( &vecPatches.listJys_  );
+    lists.push_back( &vecPatches.listJzs_  );
+    lists.push_back( &vecPatches.listrhos_ );
+    SyncVectorPatch::sum( lists, vecPatches );
 }
 
 void SyncVectorPatch::exchangeE( VectorPatch& vecPatches )
 {
 
-    SyncVectorPatch::exchange( vecPatches.listEx_, vecPatches );
-    SyncVectorPatch::exchange( vecPatches.listEy_, vecPatches );
-    SyncVectorPatch::exchange( vecPatches.listEz_, vecPatches );
+    std::vector< std::vector<Field*>* > lists;
+    lists.push_back( &vecPatches.listEx_ );
+    lists.push_back( &vecPatches.listEy_ );
+    lists.push_back( &vecPatches.listEz_ );
+    SyncVectorPatch::exchange( lists, std::vector<int>( lists.size(), -1 ), vecPatches );
 }
 
 void SyncVectorPatch::exchangeB( VectorPatch& vecPatches )
 {
 
+    std::vector< std::vector<Field*>* > lists;
+    std::vector<int> directions;
+
     if ( vecPatches.listBx_[0]->dims_.size()>1 ) {
-        SyncVectorPatch::exchange1( vecPatches.listBx_, vecPatches );
-        SyncVectorPatch::exchange0( vecPatches.listBy_, vecPatches );
-        SyncVectorPatch::exchange ( vecPatches.listBz_, vecPatches );
+        lists.push_back( &vecPatches.listBx_ ); directions.push_back(  1 );
+        lists.push_back( &vecPatches.listBy_ ); directions.push_back(  0 );
+        lists.push_back( &vecPatches.listBz_ ); directions.push_back( -1 );
     }
     else if (vecPatches.listBx_[0]->dims_.size()==1) {
-        SyncVectorPatch::exchange0( vecPatches.listBy_, vecPatches );
-        SyncVectorPatch::exchange0( vecPatches.listBz_, vecPatches );
+        lists.push_back( &vecPatches.listBy_ ); directions.push_back(  0 );
+        lists.push_back( &vecPatches.listBz_ ); directions.push_back(  0 );
+    }
+
+    // Azimuthal modes (3drz) : Bl, Br, Bt are staggered as Bx, By, Bz in 2D
+    for (unsigned int k=0 ; k<vecPatches.listModesB_.size() ; k++) {
+        lists.push_back( &vecPatches.listModesB_[k] );
+        if      ( k%3 == 0 ) directions.push_back(  1 );
+        else if ( k%3 == 1 ) directions.push_back(  0 );
+        else                 directions.push_back( -1 );
+    }
+
+    SyncVectorPatch::exchange( lists, directions, vecPatches );
+
+}
+
+// Overlapped exchange of B (finite-difference solvers), see VectorPatch::solveMaxwell
+//   - only the components exchanged in a single direction are started early, Bz (2D) needs the corners and is
+//     exchanged by exchangeBFinalize
+void SyncVectorPatch::exchangeBStart( VectorPatch& vecPatches )
+{
+
+    std::vector< std::vector<Field*>* > lists0, lists1;
+    if ( vecPatches.listBx_[0]->dims_.size()>1 ) {
+        lists1.push_back( &vecPatches.listBx_ );
+        lists0.push_back( &vecPatches.listBy_ );
+        SyncVectorPatch::exchangeStart( lists1, vecPatches, 1 );
+    }
+    else if (vecPatches.listBx_[0]->dims_.size()==1) {
+        lists0.push_back( &vecPatches.listBy_ );
+        lists0.push_back( &vecPatches.listBz_ );
+    }
+    SyncVectorPatch::exchangeStart( lists0, vecPatches, 0 );
+}
+
+void SyncVectorPatch::exchangeBFinalize( VectorPatch& vecPatches )
+{
+
+    std::vector< std::vector<Field*>* > lists0, lists1;
+    if ( vecPatches.listBx_[0]->dims_.size()>1 ) {
+        lists1.push_back( &vecPatches.listBx_ );
+        lists0.push_back( &vecPatches.listBy_ );
+        SyncVectorPatch::exchangeFinalize( lists1, vecPatches, 1 );
+    }
+    else if (vecPatches.listBx_[0]->dims_.size()==1) {
+        lists0.push_back( &vecPatches.listBy_ );
+        lists0.push_back( &vecPatches.listBz_ );
+    }
+    SyncVectorPatch::exchangeFinalize( lists0, vecPatches, 0 );
+
+    // Bz (2D) and the azimuthal modes (3drz)
+    std::vector< std::vector<Field*>* > lists;
+    std::vector<int> directions;
+    if ( vecPatches.listBx_[0]->dims_.size()>1 ) {
+        lists.push_back( &vecPatches.listBz_ );
+        directions.push_back( -1 );
     }
+    for (unsigned int k=0 ; k<vecPatches.listModesB_.size() ; k++) {
+        lists.push_back( &vecPatches.listModesB_[k] );
+        if      ( k%3 == 0 ) directions.push_back(  1 );
+        else if ( k%3 == 1 ) directions.push_back(  0 );
+        else                 directions.push_back( -1 );
+    }
+    if (lists.size())
+        SyncVectorPatch::exchange( lists, directions, vecPatches );
 
 }
 
+void SyncVectorPatch::exchangeEnvelope( VectorPatch& vecPatches )
+{
+
+    std::vector< std::vector<Field*>* > lists;
+    lists.push_back( &vecPatches.listEnvAre_ );
+    lists.push_back( &vecPatches.listEnvAim_ );
+    SyncVectorPatch::exchange( lists, std::vector<int>( lists.size(), -1 ), vecPatches );
+}
+
+// Terms of the spectral solvers (see Solver::computeSpectralTerms), each patch holding only the points it owns
+void SyncVectorPatch::sumSpectralTerms( VectorPatch& vecPatches )
+{
+
+    std::vector< std::vector<Field*>* > lists;
+    for (unsigned int k=0 ; k<vecPatches.listSpectralTerms_.size() ; k++)
+        lists.push_back( &vecPatches.listSpectralTerms_[k] );
+    if (lists.size())
+        SyncVectorPatch::sum( lists, vecPatches );
+}
+
 
 void SyncVectorPatch::sum( std::vector<Field*> fields, VectorPatch& vecPatches )
+{
+    std::vector< std::vector<Field*>* > lists( 1, &fields );
+    SyncVectorPatch::sum( lists, vecPatches );
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Sum of several lists of fields : the guard cells of all the lists are sent together, direction after direction
+// (one message per neighbour MPI process if vecPatches.aggregateComms, see HaloCommPlan)
+// ---------------------------------------------------------------------------------------------------------------------
+void SyncVectorPatch::sum( std::vector< std::vector<Field*>* >& lists, VectorPatch& vecPatches )
+{
+    for (unsigned int ilist=0 ; ilist<lists.size() ; ilist++)
+        SyncVectorPatch::sumLocal( *lists[ilist], vecPatches, 0 );
+
+    SyncVectorPatch::startMPI   ( lists, vecPatches, 0, true, false );
+    SyncVectorPatch::finalizeMPI( lists, vecPatches, 0, true, false );
+
+    if ((*lists[0])[0]->dims_.size()>1) {
+        for (unsigned int ilist=0 ; ilist<lists.size() ; ilist++)
+            SyncVectorPatch::sumLocal( *lists[ilist], vecPatches, 1 );
+
+        SyncVectorPatch::startMPI   ( lists, vecPatches, 1, true, false );
+        SyncVectorPatch::finalizeMPI( lists, vecPatches, 1, true, false );
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Overlapped sum : the MPI sums of the first direction are started for the border patches as soon as their
+// projection is done (see VectorPatch::dynamics). The intra-MPI process sums, done later by sumFinalize, do not touch
+// the rows sent (patches of at least 2*oversize+2 cells, see Params)
+// ---------------------------------------------------------------------------------------------------------------------
+void SyncVectorPatch::sumStart( std::vector< std::vector<Field*>* >& lists, VectorPatch& vecPatches )
+{
+    SyncVectorPatch::startMPI( lists, vecPatches, 0, true, true );
+}
+
+void SyncVectorPatch::sumFinalize( std::vector< std::vector<Field*>* >& lists, VectorPatch& vecPatches )
+{
+    for (unsigned int ilist=0 ; ilist<lists.size() ; ilist++)
+        SyncVectorPatch::sumLocal( *lists[ilist], vecPatches, 0 );
+
+    SyncVectorPatch::finalizeMPI( lists, vecPatches, 0, true, true );
+
+    // The second direction needs the corners summed in the first one
+    if ((*lists[0])[0]->dims_.size()>1) {
+        for (unsigned int ilist=0 ; ilist<lists.size() ; ilist++)
+            SyncVectorPatch::sumLocal( *lists[ilist], vecPatches, 1 );
+
+        SyncVectorPatch::startMPI   ( lists, vecPatches, 1, true, false );
+        SyncVectorPatch::finalizeMPI( lists, vecPatches, 1, true, false );
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Sum of the fields between the patches of the same MPI process in direction iDim (memcpy)
+// ---------------------------------------------------------------------------------------------------------------------
+void SyncVectorPatch::sumLocal( std::vector<Field*> fields, VectorPatch& vecPatches, int iDim )
 {
     unsigned int nx_,ny_, h0, oversize[2], n_space[2],gsp[2];
     double *pt1,*pt2;
@@ -103,36 +294,24 @@ void SyncVectorPatch::sum( std::vector<Field*> fields, VectorPatch& vecPatches )
     if (fields[0]->dims_.size()>1)
         ny_ = fields[0]->dims_[1];
     
-    gsp[0] = 1+2*oversize[0]+fields[0]->isDual_[0]; //Ghost size primal
+    if (iDim==0) {
+        gsp[0] = 1+2*oversize[0]+fields[0]->isDual_[0]; //Ghost size primal
 
+        #pragma omp for schedule(runtime) private(pt1,pt2)
+        for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++) {
 
-    #pragma omp for schedule(runtime) private(pt1,pt2)
-    for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++) {
+            if (vecPatches(ipatch)->MPI_me_ == vecPatches(ipatch)->MPI_neighbor_[0][0]){
+                //The patch on my left belongs to the same MPI process than I.
+                pt1 = &(*fields[vecPatches(ipatch)->neighbor_[0][0]-h0])(n_space[0]*ny_);
+                pt2 = &(*fields[ipatch])(0);
+                for (unsigned int i = 0; i < gsp[0]* ny_ ; i++) pt1[i] += pt2[i];
+                memcpy( pt2, pt1, gsp[0]*ny_*sizeof(double)); 
+                        
+            }
 
-        if (vecPatches(ipatch)->MPI_me_ == vecPatches(ipatch)->MPI_neighbor_[0][0]){
-            //The patch on my left belongs to the same MPI process than I.
-            pt1 = &(*fields[vecPatches(ipatch)->neighbor_[0][0]-h0])(n_space[0]*ny_);
-            pt2 = &(*fields[ipatch])(0);
-            for (unsigned int i = 0; i < gsp[0]* ny_ ; i++) pt1[i] += pt2[i];
-            memcpy( pt2, pt1, gsp[0]*ny_*sizeof(double)); 
-                    
         }
-
     }
-    
-    for (int iDim=0;iDim<1;iDim++) {
-        #pragma omp for schedule(runtime)
-        for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++) {
-            vecPatches(ipatch)->initSumField( fields[ipatch], iDim ); // initialize
-        }
-    
-        #pragma omp for schedule(runtime)
-        for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++) {
-            vecPatches(ipatch)->finalizeSumField( fields[ipatch], iDim ); // finalize (waitall + sum)
-        }
-    }
-
-    if (fields[0]->dims_.size()>1) {
+    else {
         gsp[1] = 1+2*oversize[1]+fields[0]->isDual_[1]; //Ghost size primal
         #pragma omp for schedule(runtime) private(pt1,pt2)
         for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++) {
@@ -149,148 +328,125 @@ void SyncVectorPatch::sum( std::vector<Field*> fields, VectorPatch& vecPatches )
                 }
             }
         }
-
-        for (int iDim=1;iDim<2;iDim++) {
-            #pragma omp for schedule(runtime)
-            for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++) {
-                vecPatches(ipatch)->initSumField( fields[ipatch], iDim ); // initialize
-            }
-
-            #pragma omp for schedule(runtime)
-            for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++) {
-                vecPatches(ipatch)->finalizeSumField( fields[ipatch], iDim ); // finalize (waitall + sum)
-            }
-        }
     }
 }
 
 
 void SyncVectorPatch::exchange( std::vector<Field*> fields, VectorPatch& vecPatches )
 {
-    unsigned int nx_, ny_, h0, oversize[2], n_space[2],gsp[2];
-    double *pt1,*pt2;
-    h0 = vecPatches(0)->hindex;
-
-    oversize[0] = vecPatches(0)->EMfields->oversize[0];
-    oversize[1] = vecPatches(0)->EMfields->oversize[1];
+    std::vector< std::vector<Field*>* > lists( 1, &fields );
+    SyncVectorPatch::exchange( lists, std::vector<int>( 1, -1 ), vecPatches );
+}
 
-    n_space[0] = vecPatches(0)->EMfields->n_space[0];
-    n_space[1] = vecPatches(0)->EMfields->n_space[1];
+void SyncVectorPatch::exchange0( std::vector<Field*> fields, VectorPatch& vecPatches )
+{
+    std::vector< std::vector<Field*>* > lists( 1, &fields );
+    SyncVectorPatch::exchange( lists, std::vector<int>( 1, 0 ), vecPatches );
+}
 
-    nx_ = fields[0]->dims_[0];
-    ny_ = 1;
-    if (fields[0]->dims_.size()>1)
-      ny_ = fields[0]->dims_[1];
-
-    //For minimum comm
-    //gsp[0] = 2*oversize[0]+fields[0]->isDual_[0]; //Ghost size primal
-    //gsp[1] = 2*oversize[1]+fields[0]->isDual_[1]; //Ghost size primal
-    //for filter
-    gsp[0] = ( oversize[0] + 1 + fields[0]->isDual_[0] ); //Ghost size primal
-    gsp[1] = ( oversize[1] + 1 + fields[0]->isDual_[1] ); //Ghost size primal
-
-    #pragma omp for schedule(runtime) 
-    for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++) {
-
-        if (vecPatches(ipatch)->MPI_me_ == vecPatches(ipatch)->MPI_neighbor_[0][0]){
-            pt1 = &(*fields[vecPatches(ipatch)->neighbor_[0][0]-h0])((n_space[0])*ny_);
-            pt2 = &(*fields[ipatch])(0);
-            //For minimum comm
-            //memcpy( pt2, pt1, ny_*sizeof(double)); 
-            //memcpy( pt1+gsp[0]*ny_, pt2+gsp[0]*ny_, ny_*sizeof(double)); 
-            //for filter
-            memcpy( pt2, pt1, oversize[0]*ny_*sizeof(double)); 
-            memcpy( pt1+gsp[0]*ny_, pt2+gsp[0]*ny_, oversize[0]*ny_*sizeof(double)); 
-        } // End if ( MPI_me_ == MPI_neighbor_[0][0] ) 
-
-        if (fields[0]->dims_.size()>1) {
-            if (vecPatches(ipatch)->MPI_me_ == vecPatches(ipatch)->MPI_neighbor_[1][0]){
-                pt1 = &(*fields[vecPatches(ipatch)->neighbor_[1][0]-h0])(n_space[1]);
-                pt2 = &(*fields[ipatch])(0);
-                for (unsigned int i = 0 ; i < nx_*ny_ ; i += ny_){
-                    //For minimum comm
-                    //pt2[i] = pt1[i] ;
-                    //pt1[i+gsp[1]] = pt2[i+gsp[1]] ;
-                    // for filter
-                    for (unsigned int j = 0 ; j < oversize[1] ; j++ ){
-                        pt2[i+j] = pt1[i+j] ;
-                        pt1[i+j+gsp[1]] = pt2[i+j+gsp[1]] ;
-                    }
-                } 
-            } // End if ( MPI_me_ == MPI_neighbor_[1][0] ) 
-        }
+void SyncVectorPatch::exchange1( std::vector<Field*> fields, VectorPatch& vecPatches )
+{
+    std::vector< std::vector<Field*>* > lists( 1, &fields );
+    SyncVectorPatch::exchange( lists, std::vector<int>( 1, 1 ), vecPatches );
+}
 
-    } // End for( ipatch )
 
-    #pragma omp for schedule(runtime)
-    for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++)
-        vecPatches(ipatch)->initExchange( fields[ipatch], 0 );
+// ---------------------------------------------------------------------------------------------------------------------
+// Exchange of several lists of fields, each one in a single direction (0, 1) or in all of them (-1)
+//   - the intra-MPI process exchanges are done first, then the MPI exchanges direction after direction, the guard
+//     cells of all the lists exchanged in a direction being sent together
+// ---------------------------------------------------------------------------------------------------------------------
+void SyncVectorPatch::exchange( std::vector< std::vector<Field*>* >& lists, std::vector<int> directions, VectorPatch& vecPatches )
+{
+    unsigned int nDim = (*lists[0])[0]->dims_.size();
 
-    #pragma omp for schedule(runtime)
-    for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++)
-        vecPatches(ipatch)->finalizeExchange( fields[ipatch], 0 );
+    for (unsigned int ilist=0 ; ilist<lists.size() ; ilist++) {
+        for (unsigned int iDim=0 ; iDim<nDim ; iDim++)
+            if ( directions[ilist]<0 || directions[ilist]==(int)iDim )
+                SyncVectorPatch::exchangeLocal( *lists[ilist], vecPatches, iDim );
+    }
 
-    if (fields[0]->dims_.size()>1) {
-        #pragma omp for schedule(runtime)
-        for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++)
-            vecPatches(ipatch)->initExchange( fields[ipatch], 1 );
+    for (unsigned int iDim=0 ; iDim<nDim ; iDim++) {
+        std::vector< std::vector<Field*>* > listsDim;
+        for (unsigned int ilist=0 ; ilist<lists.size() ; ilist++)
+            if ( directions[ilist]<0 || directions[ilist]==(int)iDim )
+                listsDim.push_back( lists[ilist] );
+        if ( listsDim.empty() ) continue;
 
-        #pragma omp for schedule(runtime)
-        for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++)
-            vecPatches(ipatch)->finalizeExchange( fields[ipatch], 1 );
+        SyncVectorPatch::startMPI   ( listsDim, vecPatches, iDim, false, false );
+        SyncVectorPatch::finalizeMPI( listsDim, vecPatches, iDim, false, false );
     }
 
 }
 
-void SyncVectorPatch::exchange0( std::vector<Field*> fields, VectorPatch& vecPatches )
-{
-    unsigned int nx_, ny_, h0, oversize[2], n_space[2],gsp;
-    double *pt1,*pt2;
-    h0 = vecPatches(0)->hindex;
-
-    oversize[0] = vecPatches(0)->EMfields->oversize[0];
-    oversize[1] = vecPatches(0)->EMfields->oversize[1];
-
-    n_space[0] = vecPatches(0)->EMfields->n_space[0];
-    n_space[1] = vecPatches(0)->EMfields->n_space[1];
-
-    nx_ = fields[0]->dims_[0];
-    ny_ = 1;
-    if (fields[0]->dims_.size()>1)
-        ny_ = fields[0]->dims_[1];
-
-    //gsp[0] = 2*oversize[0]+fields[0]->isDual_[0]; //Ghost size primal
-    //for filter
-    gsp = ( oversize[0] + 1 + fields[0]->isDual_[0] ); //Ghost size primal
 
-    #pragma omp for schedule(runtime) private(pt1,pt2)
-    for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++) {
+// ---------------------------------------------------------------------------------------------------------------------
+// Overlapped exchange in direction iDim only (as exchange0 or exchange1) : the MPI exchanges are started for the
+// border patches as soon as their fields are computed (see VectorPatch::solveMaxwell), the rows sent are not touched
+// by the intra-MPI process exchanges done later by exchangeFinalize
+// ---------------------------------------------------------------------------------------------------------------------
+void SyncVectorPatch::exchangeStart( std::vector< std::vector<Field*>* >& lists, VectorPatch& vecPatches, int iDim )
+{
+    SyncVectorPatch::startMPI( lists, vecPatches, iDim, false, true );
+}
 
-        if (vecPatches(ipatch)->MPI_me_ == vecPatches(ipatch)->MPI_neighbor_[0][0]){
-            pt1 = &(*fields[vecPatches(ipatch)->neighbor_[0][0]-h0])((n_space[0])*ny_);
-            pt2 = &(*fields[ipatch])(0);
-            //memcpy( pt2, pt1, ny_*sizeof(double)); 
-            //memcpy( pt1+gsp[0]*ny_, pt2+gsp[0]*ny_, ny_*sizeof(double)); 
-            //for filter
-            memcpy( pt2, pt1, oversize[0]*ny_*sizeof(double)); 
-            memcpy( pt1+gsp*ny_, pt2+gsp*ny_, oversize[0]*ny_*sizeof(double)); 
-        } // End if ( MPI_me_ == MPI_neighbor_[0][0] ) 
+void SyncVectorPatch::exchangeFinalize( std::vector< std::vector<Field*>* >& lists, VectorPatch& vecPatches, int iDim )
+{
+    for (unsigned int ilist=0 ; ilist<lists.size() ; ilist++)
+        SyncVectorPatch::exchangeLocal( *lists[ilist], vecPatches, iDim );
 
+    SyncVectorPatch::finalizeMPI( lists, vecPatches, iDim, false, true );
+}
 
-    } // End for( ipatch )
 
-    #pragma omp for schedule(runtime)
-    for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++)
-        vecPatches(ipatch)->initExchange( fields[ipatch], 0 );
+// ---------------------------------------------------------------------------------------------------------------------
+// MPI part of a sum (sum=true) or of an exchange in direction iDim
+//   - aggregated per neighbour MPI process by the HaloCommPlan of vecPatches
+//   - or patch per patch (Patch::initSumField, Patch::initExchange), for all the patches or only the border ones
+// ---------------------------------------------------------------------------------------------------------------------
+void SyncVectorPatch::startMPI( std::vector< std::vector<Field*>* >& lists, VectorPatch& vecPatches, int iDim, bool sum, bool border )
+{
+    if ( vecPatches.aggregateComms ) {
+        vecPatches.haloPlan.start( lists, iDim, sum );
+        return;
+    }
 
-    #pragma omp for schedule(runtime)
-    for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++)
-        vecPatches(ipatch)->finalizeExchange( fields[ipatch], 0 );
+    for (unsigned int ilist=0 ; ilist<lists.size() ; ilist++) {
+        std::vector<Field*>& fields = *lists[ilist];
+        unsigned int npatches = border ? vecPatches.borderPatches_.size() : fields.size();
+        #pragma omp for schedule(runtime)
+        for (unsigned int i=0 ; i<npatches ; i++) {
+            unsigned int ipatch = border ? vecPatches.borderPatches_[i] : i;
+            if (sum) vecPatches(ipatch)->initSumField( fields[ipatch], iDim ); // initialize
+            else     vecPatches(ipatch)->initExchange( fields[ipatch], iDim );
+        }
+    }
+}
 
+void SyncVectorPatch::finalizeMPI( std::vector< std::vector<Field*>* >& lists, VectorPatch& vecPatches, int iDim, bool sum, bool border )
+{
+    if ( vecPatches.aggregateComms ) {
+        vecPatches.haloPlan.finalize( lists, iDim, sum );
+        return;
+    }
 
+    for (unsigned int ilist=0 ; ilist<lists.size() ; ilist++) {
+        std::vector<Field*>& fields = *lists[ilist];
+        unsigned int npatches = border ? vecPatches.borderPatches_.size() : fields.size();
+        #pragma omp for schedule(runtime)
+        for (unsigned int i=0 ; i<npatches ; i++) {
+            unsigned int ipatch = border ? vecPatches.borderPatches_[i] : i;
+            if (sum) vecPatches(ipatch)->finalizeSumField( fields[ipatch], iDim ); // finalize (waitall + sum)
+            else     vecPatches(ipatch)->finalizeExchange( fields[ipatch], iDim );
+        }
+    }
 }
 
-void SyncVectorPatch::exchange1( std::vector<Field*> fields, VectorPatch& vecPatches )
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Exchange of the fields between the patches of the same MPI process in direction iDim (memcpy)
+// ---------------------------------------------------------------------------------------------------------------------
+void SyncVectorPatch::exchangeLocal( std::vector<Field*> fields, VectorPatch& vecPatches, int iDim )
 {
     unsigned int nx_, ny_, h0, oversize[2], n_space[2],gsp;
     double *pt1,*pt2;
@@ -303,39 +459,54 @@ void SyncVectorPatch::exchange1( std::vector<Field*> fields, VectorPatch& vecPat
     n_space[1] = vecPatches(0)->EMfields->n_space[1];
 
     nx_ = fields[0]->dims_[0];
-    ny_ = fields[0]->dims_[1];
-
-    //gsp = 2*oversize[1]+fields[0]->isDual_[1]; //Ghost size primal
-    //for filter
-    gsp = ( oversize[1] + 1 + fields[0]->isDual_[1] ); //Ghost size primal
-
-    #pragma omp for schedule(runtime) private(pt1,pt2)
-    for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++) {
-
-        if (vecPatches(ipatch)->MPI_me_ == vecPatches(ipatch)->MPI_neighbor_[1][0]){
-            pt1 = &(*fields[vecPatches(ipatch)->neighbor_[1][0]-h0])(n_space[1]);
-            pt2 = &(*fields[ipatch])(0);
-            for (unsigned int i = 0 ; i < nx_*ny_ ; i += ny_){
-                pt2[i] = pt1[i] ;
-                pt1[i+gsp] = pt2[i+gsp] ;
-                // for filter
-                for (unsigned int j = 0 ; j < oversize[1] ; j++ ){
-                    pt2[i+j] = pt1[i+j] ;
-                    pt1[i+j+gsp] = pt2[i+j+gsp] ;
-                }
-            } 
-        } // End if ( MPI_me_ == MPI_neighbor_[1][0] ) 
+    ny_ = 1;
+    if (fields[0]->dims_.size()>1)
+        ny_ = fields[0]->dims_[1];
 
-    } // End for( ipatch )
+    if (iDim==0) {
+        //gsp[0] = 2*oversize[0]+fields[0]->isDual_[0]; //Ghost size primal
+        //for filter
+        gsp = ( oversize[0] + 1 + fields[0]->isDual_[0] ); //Ghost size primal
 
-    #pragma omp for schedule(runtime)
-    for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++)
-        vecPatches(ipatch)->initExchange( fields[ipatch], 1 );
+        #pragma omp for schedule(runtime) private(pt1,pt2)
+        for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++) {
 
-    #pragma omp for schedule(runtime)
-    for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++)
-        vecPatches(ipatch)->finalizeExchange( fields[ipatch], 1 );
+            if (vecPatches(ipatch)->MPI_me_ == vecPatches(ipatch)->MPI_neighbor_[0][0]){
+                pt1 = &(*fields[vecPatches(ipatch)->neighbor_[0][0]-h0])((n_space[0])*ny_);
+                pt2 = &(*fields[ipatch])(0);
+                //memcpy( pt2, pt1, ny_*sizeof(double)); 
+                //memcpy( pt1+gsp[0]*ny_, pt2+gsp[0]*ny_, ny_*sizeof(double)); 
+                //for filter
+                memcpy( pt2, pt1, oversize[0]*ny_*sizeof(double)); 
+                memcpy( pt1+gsp*ny_, pt2+gsp*ny_, oversize[0]*ny_*sizeof(double)); 
+            } // End if ( MPI_me_ == MPI_neighbor_[0][0] ) 
 
 
-}
+        } // End for( ipatch )
+    }
+    else {
+        //gsp = 2*oversize[1]+fields[0]->isDual_[1]; //Ghost size primal
+        //for filter
+        gsp = ( oversize[1] + 1 + fields[0]->isDual_[1] ); //Ghost size primal
+
+        #pragma omp for schedule(runtime) private(pt1,pt2)
+        for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++) {
 
+            if (vecPatches(ipatch)->MPI_me_ == vecPatches(ipatch)->MPI_neighbor_[1][0]){
+                pt1 = &(*fields[vecPatches(ipatch)->neighbor_[1][0]-h0])(n_space[1]);
+                pt2 = &(*fields[ipatch])(0);
+                for (unsigned int i = 0 ; i < nx_*ny_ ; i += ny_){
+                    pt2[i] = pt1[i] ;
+                    pt1[i+gsp] = pt2[i+gsp] ;
+                    // for filter
+                    for (unsigned int j = 0 ; j < oversize[1] ; j++ ){
+                        pt2[i+j] = pt1[i+j] ;
+                        pt1[i+j+gsp] = pt2[i+j+gsp] ;
+                    }
+                } 
+            } // End if ( MPI_me_ == MPI_neighbor_[1][0] ) 
+
+        } // End for( ipatch )
+    }
+
+}
@@ -12,18 +12,49 @@ class Field;
 class SyncVectorPatch {
 public :
 
-    static void exchangeParticles(VectorPatch& vecPatches, int ispec, Params &params, SmileiMPI* smpi);
+    static void exchangeParticles(VectorPatch& vecPatches, int ispec, Params &params, SmileiMPI* smpi, int itime);
 #ifdef _NOTFORNOW
     static void exchangeParticles(VectorPatch& vecPatches, int ispec, Params &params);
 #endif
     static void sumRhoJ  ( VectorPatch& vecPatches, unsigned int diag_flag );
+    //! Overlapped sum of the currents : started for the border patches, finalized with the other fields to sum
+    static void sumRhoJStart   ( VectorPatch& vecPatches );
+    static void sumRhoJFinalize( VectorPatch& vecPatches );
     static void sumRhoJs ( VectorPatch& vecPatches, int ispec );
     static void exchangeE( VectorPatch& vecPatches );
     static void exchangeB( VectorPatch& vecPatches );
+    //! Overlapped exchange of B (finite-difference solvers) : started for the border patches, then finalized
+    static void exchangeBStart   ( VectorPatch& vecPatches );
+    static void exchangeBFinalize( VectorPatch& vecPatches );
+    static void exchangeEnvelope( VectorPatch& vecPatches );
+    //! Sum of the terms computed by the spectral solvers before E and B are advanced
+    static void sumSpectralTerms( VectorPatch& vecPatches );
     static void sum      ( std::vector<Field*> fields, VectorPatch& vecPatches );
+    //! Sum of several lists of fields, sent together (see HaloCommPlan)
+    static void sum      ( std::vector< std::vector<Field*>* >& lists, VectorPatch& vecPatches );
+    //! Overlapped sum : MPI sums of the first direction started for the border patches (VectorPatch::borderPatches_)
+    static void sumStart   ( std::vector< std::vector<Field*>* >& lists, VectorPatch& vecPatches );
+    //! Intra-MPI process sums, end of the MPI sums of the first direction, and sum in the second direction
+    static void sumFinalize( std::vector< std::vector<Field*>* >& lists, VectorPatch& vecPatches );
+    //! Sum between the patches of the same MPI process in direction iDim
+    static void sumLocal   ( std::vector<Field*> fields, VectorPatch& vecPatches, int iDim );
     static void exchange ( std::vector<Field*> fields, VectorPatch& vecPatches );
     static void exchange0( std::vector<Field*> fields, VectorPatch& vecPatches );
     static void exchange1( std::vector<Field*> fields, VectorPatch& vecPatches );
+    //! Exchange of several lists of fields, in the direction given per list (-1 : all directions)
+    static void exchange ( std::vector< std::vector<Field*>* >& lists, std::vector<int> directions, VectorPatch& vecPatches );
+    //! Overlapped exchange in direction iDim only : MPI exchanges started for the border patches
+    static void exchangeStart   ( std::vector< std::vector<Field*>* >& lists, VectorPatch& vecPatches, int iDim );
+    //! Intra-MPI process exchanges and end of the MPI exchanges in direction iDim
+    static void exchangeFinalize( std::vector< std::vector<Field*>* >& lists, VectorPatch& vecPatches, int iDim );
+    //! Exchange between the patches of the same MPI process in direction iDim
+    static void exchangeLocal   ( std::vector<Field*> fields, VectorPatch& vecPatches, int iDim );
+
+private :
+    //! MPI part of a sum or of an exchange in direction iDim, aggregated per MPI process (VectorPatch::haloPlan) or
+    //! patch per patch (all the patches, or only the border ones)
+    static void startMPI   ( std::vector< std::vector<Field*>* >& lists, VectorPatch& vecPatches, int iDim, bool sum, bool border );
+    static void finalizeMPI( std::vector< std::vector<Field*>* >& lists, VectorPatch& vecPatches, int iDim, bool sum, bool border );
 
 };
 
@@ -14,6 +14,7 @@
 #include "DiagnosticFactory.h"
 
 #include "SyncVectorPatch.h"
+#include "PoissonCoarseGrid.h"
 
 #include "Timer.h"
 
@@ -26,6 +27,7 @@ using namespace std;
 VectorPatch::VectorPatch()
 {
     fieldsTimeSelection = NULL;
+    aggregateComms = false;
 }
 
 
@@ -45,6 +47,9 @@ void VectorPatch::close(SmileiMPI * smpiData)
         delete patches_[ipatch];
     
     patches_.clear();
+    
+    // Persistent MPI requests of the guard cells
+    haloPlan.clear();
 }
 
 void VectorPatch::createDiags(Params& params, SmileiMPI* smpi)
@@ -65,29 +70,48 @@ void VectorPatch::createDiags(Params& params, SmileiMPI* smpi)
 // For all patch, move particles (restartRhoJ(s), dynamics and exchangeParticles)
 // ---------------------------------------------------------------------------------------------------------------------
 void VectorPatch::dynamics(Params& params, SmileiMPI* smpi, SimWindow* simWindow,
-                           int* diag_flag, double time_dual, vector<Timer>& timer)
+                           int* diag_flag, int itime, double time_dual, vector<Timer>& timer)
 {
     timer[1].restart();
     ostringstream t;
-    #pragma omp for schedule(runtime)
-    for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++) {
-        (*this)(ipatch)->EMfields->restartRhoJ();
-        for (unsigned int ispec=0 ; ispec<(*this)(ipatch)->vecSpecies.size() ; ispec++) {
-            if ( (*this)(ipatch)->vecSpecies[ispec]->isProj(time_dual, simWindow) || *diag_flag  ) {
-                species(ipatch, ispec)->dynamics(time_dual, ispec,
-                                                 emfields(ipatch), interp(ipatch), proj(ipatch),
-                                                 params, *diag_flag, partwalls(ipatch),
-                                                 (*this)(ipatch), smpi);
+    if ( overlapCommunications( params, *diag_flag ) ) {
+        // The border patches are computed first, their MPI communications (sums of the currents, number of
+        // particles to exchange) run during the dynamics of the interior patches
+        #pragma omp for schedule(runtime)
+        for (unsigned int i=0 ; i<borderPatches_.size() ; i++)
+            dynamicsPatch( borderPatches_[i], params, smpi, simWindow, *diag_flag, itime, time_dual );
+        timer[1].update();
+        
+        timer[9].restart();
+        SyncVectorPatch::sumRhoJStart( (*this) );
+        timer[9].update();
+        
+        timer[8].restart();
+        for (unsigned int ispec=0 ; ispec<(*this)(0)->vecSpecies.size(); ispec++) {
+            if ( (*this)(0)->vecSpecies[ispec]->isProj(time_dual, simWindow) ){
+                #pragma omp for schedule(runtime)
+                for (unsigned int i=0 ; i<borderPatches_.size() ; i++)
+                    (*this)(borderPatches_[i])->postCommParticles( smpi, ispec, params );
             }
         }
-    
+        timer[8].update();
+        
+        timer[1].restart();
+        #pragma omp for schedule(runtime)
+        for (unsigned int i=0 ; i<interiorPatches_.size() ; i++)
+            dynamicsPatch( interiorPatches_[i], params, smpi, simWindow, *diag_flag, itime, time_dual );
+    }
+    else {
+        #pragma omp for schedule(runtime)
+        for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++)
+            dynamicsPatch( ipatch, params, smpi, simWindow, *diag_flag, itime, time_dual );
     }
     timer[1].update();
     
     timer[8].restart();
     for (unsigned int ispec=0 ; ispec<(*this)(0)->vecSpecies.size(); ispec++) {
         if ( (*this)(0)->vecSpecies[ispec]->isProj(time_dual, simWindow) ){
-            SyncVectorPatch::exchangeParticles((*this), ispec, params, smpi ); // Included sort_part
+            SyncVectorPatch::exchangeParticles((*this), ispec, params, smpi, itime ); // Included sort_part
         }
     }
     timer[8].update();
@@ -95,10 +119,28 @@ void VectorPatch::dynamics(Params& params, SmileiMPI* smpi, SimWindow* simWindow
 } // END dynamics
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Move the particles of one patch (restartRhoJ, dynamics of the species)
+// ---------------------------------------------------------------------------------------------------------------------
+void VectorPatch::dynamicsPatch(unsigned int ipatch, Params& params, SmileiMPI* smpi, SimWindow* simWindow,
+                                int diag_flag, int itime, double time_dual)
+{
+    (*this)(ipatch)->EMfields->restartRhoJ();
+    for (unsigned int ispec=0 ; ispec<(*this)(ipatch)->vecSpecies.size() ; ispec++) {
+        if ( (*this)(ipatch)->vecSpecies[ispec]->isProj(time_dual, simWindow) || diag_flag  ) {
+            species(ipatch, ispec)->dynamics(time_dual, itime, ispec,
+                                             emfields(ipatch), interp(ipatch), proj(ipatch),
+                                             params, diag_flag, partwalls(ipatch),
+                                             (*this)(ipatch), smpi);
+        }
+    }
+}
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // For all patch, sum densities on ghost cells (sum per species if needed, sync per patch and MPI sync)
 // ---------------------------------------------------------------------------------------------------------------------
-void VectorPatch::sumDensities( int* diag_flag, vector<Timer>& timer )
+void VectorPatch::sumDensities( Params& params, int* diag_flag, vector<Timer>& timer )
 {
     timer[4].restart();
     if  (*diag_flag){
@@ -111,11 +153,15 @@ void VectorPatch::sumDensities( int* diag_flag, vector<Timer>& timer )
     timer[4].update();
     
     timer[9].restart();
-    SyncVectorPatch::sumRhoJ( (*this), *diag_flag ); // MPI
+    if ( overlapCommunications( params, *diag_flag ) )
+        SyncVectorPatch::sumRhoJFinalize( (*this) ); // MPI, started in dynamics
+    else
+        SyncVectorPatch::sumRhoJ( (*this), *diag_flag ); // MPI
     
     if(*diag_flag){
+        // Only the species densities which are allocated (output by a DiagFields)
         for (unsigned int ispec=0 ; ispec<(*this)(0)->vecSpecies.size(); ispec++) {
-            if( ! (*this)(0)->vecSpecies[ispec]->particles->isTest ) {
+            if( ! (*this)(0)->vecSpecies[ispec]->particles->isTest && (*this)(0)->EMfields->Jx_s[ispec] ) {
                 update_field_list(ispec);
                 SyncVectorPatch::sumRhoJs( (*this), ispec ); // MPI
             }
@@ -123,52 +169,146 @@ void VectorPatch::sumDensities( int* diag_flag, vector<Timer>& timer )
     }
     timer[9].update();
     
+    // Binomial filter of the total currents : the sum made them exact on the extra guard cells of the filter
+    // (see Params), the outer layers spoiled by the passes are not used
+    if ( params.current_filter_passes > 0 ) {
+        timer[4].restart();
+        #pragma omp for schedule(static)
+        for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++)
+            (*this)(ipatch)->EMfields->binomialCurrentFilter( params.current_filter_passes, params.current_filter_compensation );
+        timer[4].update();
+    }
+    
 } // End sumDensities
 
 
 // ---------------------------------------------------------------------------------------------------------------------
 // For all patch, update E and B (Ampere, Faraday, boundary conditions, exchange B and center B)
+//   - fused_maxwell : Ampere, Faraday and centering in one sweep per patch, the borders changed by
+//     the boundary conditions and the exchange of B are centered afterwards
+//   - PSATD : E and B are advanced together, at integer times (B_m is a copy of B), from the spectral terms
+//     summed beforehand (see MF_Solver2D_PSATD)
+//   - overlap_communications : Faraday is solved on the border patches first, see SyncVectorPatch::exchangeBStart
 // ---------------------------------------------------------------------------------------------------------------------
 void VectorPatch::solveMaxwell(Params& params, SimWindow* simWindow, int itime, double time_dual, vector<Timer>& timer)
 {
     timer[2].restart();
     
-    #pragma omp for schedule(static)
-    for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++){
-        // Saving magnetic fields (to compute centered fields used in the particle pusher)
-        // Stores B at time n in B_m.
-        (*this)(ipatch)->EMfields->saveMagneticFields();
-        // Computes Ex_, Ey_, Ez_ on all points.
-        // E is already synchronized because J has been synchronized before.
-        (*this)(ipatch)->EMfields->solveMaxwellAmpere();
+    if (params.envelope_model) {
+        #pragma omp for schedule(static)
+        for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++){
+            // Advances the laser envelope with the susceptibility of the particles, injection at time n+1
+            (*this)(ipatch)->EMfields->envelope->compute();
+            (*this)(ipatch)->EMfields->envelope->boundaryConditions( (*this)(ipatch), time_dual+0.5*params.timestep );
+        }
     }
-    //(*this).exchangeE();
     
-    #pragma omp for schedule(static)
-    for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++){
-        // Computes Bx_, By_, Bz_ at time n+1 on interior points.
-        // (*this)(ipatch)->EMfields->solveMaxwellFaraday();
-        (*(*this)(ipatch)->EMfields->MaxwellFaradaySolver_)((*this)(ipatch)->EMfields);
-        // Applies boundary conditions on B
-        (*this)(ipatch)->EMfields->boundaryConditions(itime, time_dual, (*this)(ipatch), params, simWindow);
+    if (params.fused_maxwell) {
+        // Operations of the diags hooked into the sweep (e.g. time-averaged fields)
+        #pragma omp single
+        {
+            maxwellSweepHooks.clear();
+            for (unsigned int idiag = 0 ; idiag < localDiags.size() ; idiag++) {
+                MaxwellSweepHook* hook = localDiags[idiag]->sweepHook( itime );
+                if (hook) maxwellSweepHooks.push_back( hook );
+            }
+        }
+    }
+    else if (params.maxwell_sol == "PSATD") {
+        #pragma omp for schedule(static)
+        for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++)
+            (*this)(ipatch)->EMfields->MaxwellFaradaySolver_->computeSpectralTerms( (*this)(ipatch)->EMfields );
+        timer[2].update();
+        timer[9].restart();
+        SyncVectorPatch::sumSpectralTerms( (*this) );
+        timer[9].update();
+        timer[2].restart();
+    }
+    else {
+        #pragma omp for schedule(static)
+        for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++){
+            // Saving magnetic fields (to compute centered fields used in the particle pusher)
+            // Stores B at time n in B_m.
+            (*this)(ipatch)->EMfields->saveMagneticFields();
+            // Computes Ex_, Ey_, Ez_ on all points.
+            // E is already synchronized because J has been synchronized before.
+            (*this)(ipatch)->EMfields->solveMaxwellAmpere();
+            // Applies boundary conditions on E (PML)
+            (*this)(ipatch)->EMfields->boundaryConditionsE(time_dual, (*this)(ipatch), simWindow);
+        }
+    }
+    
+    // The B of the border patches is exchanged during the computation of the interior patches
+    if ( params.overlap_communications ) {
+        #pragma omp for schedule(static)
+        for (unsigned int i=0 ; i<borderPatches_.size() ; i++)
+            solveMaxwellFaradayPatch( borderPatches_[i], params, simWindow, itime, time_dual );
+        timer[2].update();
+        
+        timer[9].restart();
+        SyncVectorPatch::exchangeBStart( (*this) );
+        timer[9].update();
+        
+        timer[2].restart();
+        #pragma omp for schedule(static)
+        for (unsigned int i=0 ; i<interiorPatches_.size() ; i++)
+            solveMaxwellFaradayPatch( interiorPatches_[i], params, simWindow, itime, time_dual );
+    }
+    else {
+        #pragma omp for schedule(static)
+        for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++)
+            solveMaxwellFaradayPatch( ipatch, params, simWindow, itime, time_dual );
     }
     //Synchronize B fields between patches.
     timer[2].update();
     
     timer[9].restart();
-    SyncVectorPatch::exchangeB( (*this) );
+    if ( params.overlap_communications )
+        SyncVectorPatch::exchangeBFinalize( (*this) );
+    else
+        SyncVectorPatch::exchangeB( (*this) );
+    if (params.envelope_model)
+        SyncVectorPatch::exchangeEnvelope( (*this) );
     timer[9].update();
     
     timer[2].restart();
     // Computes B at time n+1/2 using B and B_m.
     #pragma omp for schedule(static)
-    for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++)
-        (*this)(ipatch)->EMfields->centerMagneticFields();
+    for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++) {
+        if (params.fused_maxwell)
+            (*this)(ipatch)->EMfields->centerMagneticFieldsBorders( maxwellSweepHooks );
+        else if (params.maxwell_sol == "PSATD")
+            (*this)(ipatch)->EMfields->saveMagneticFields();
+        else
+            (*this)(ipatch)->EMfields->centerMagneticFields();
+        // Ponderomotive potential of the new envelope
+        if (params.envelope_model)
+            (*this)(ipatch)->EMfields->envelope->computePhi();
+    }
     timer[2].update();
 
 } // END solveMaxwell
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Maxwell-Faraday (or the fused sweep, see solveMaxwell) and boundary conditions on B of one patch
+// ---------------------------------------------------------------------------------------------------------------------
+void VectorPatch::solveMaxwellFaradayPatch(unsigned int ipatch, Params& params, SimWindow* simWindow, int itime, double time_dual)
+{
+    if (params.fused_maxwell) {
+        // Saves B in B_m, computes E, B and the centered B (except on the borders) in one sweep
+        (*this)(ipatch)->EMfields->solveMaxwellFused( maxwellSweepHooks );
+    }
+    else {
+        // Computes Bx_, By_, Bz_ at time n+1 on interior points (PSATD : E and B).
+        // (*this)(ipatch)->EMfields->solveMaxwellFaraday();
+        (*(*this)(ipatch)->EMfields->MaxwellFaradaySolver_)((*this)(ipatch)->EMfields);
+    }
+    // Applies boundary conditions on B
+    (*this)(ipatch)->EMfields->boundaryConditions(itime, time_dual, (*this)(ipatch), params, simWindow);
+}
+
+
 void VectorPatch::initExternals(Params& params)
 {
     // Init all lasers
@@ -310,9 +450,10 @@ void VectorPatch::solvePoisson( Params &params, SmileiMPI* smpi )
 {
     unsigned int nx_p2_global = (params.n_space_global[0]+1) * (params.n_space_global[1]+1);
     
-    unsigned int iteration_max = 50000;
-    double       error_max     = 1.e-14;
+    unsigned int iteration_max = params.poisson_max_iteration;
+    double       error_max     = params.poisson_error_max;
     unsigned int iteration=0;
+    bool         multigrid     = (params.poisson_solver == "mgcg");
     
     // Init & Store internal data (phi, r, p, Ap) per patch
     double rnew_dot_rnew_local(0.);
@@ -325,12 +466,27 @@ void VectorPatch::solvePoisson( Params &params, SmileiMPI* smpi )
     
     std::vector<Field*> Ex_;
     std::vector<Field*> Ap_;
+    std::vector<Field*> z_;
     
     for (int ipatch=0 ; ipatch<this->size() ; ipatch++) {
         Ex_.push_back( (*this)(ipatch)->EMfields->Ex_ );
         Ap_.push_back( (*this)(ipatch)->EMfields->Ap_ );
     }
     
+    // Multigrid preconditioner : first direction p = z = M^-1 r
+    PoissonCoarseGrid* coarseGrid = NULL;
+    double rnew_dot_znew(0.);
+    if (multigrid) {
+        coarseGrid = new PoissonCoarseGrid( params );
+        for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++) {
+            (*this)(ipatch)->EMfields->initPoissonMultigrid();
+            z_.push_back( (*this)(ipatch)->EMfields->z_ );
+        }
+        rnew_dot_znew = preconditionPoisson( z_, coarseGrid, rnew_dot_rnew );
+        for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++)
+            (*this)(ipatch)->EMfields->update_pz( 0., 1. );
+    }
+    
     // compute control parameter
     double ctrl = rnew_dot_rnew / (double)(nx_p2_global);
     
@@ -343,8 +499,9 @@ void VectorPatch::solvePoisson( Params &params, SmileiMPI* smpi )
         iteration++;
         if (smpi->isMaster()) DEBUG("iteration " << iteration << " started with control parameter ctrl = " << ctrl*1.e14 << " x 1e-14");
         
-        // scalar product of the residual
+        // scalar product of the residual (by the preconditioned residual)
         double r_dot_r = rnew_dot_rnew;
+        double r_dot_z = rnew_dot_znew;
         
         for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++) 
             (*this)(ipatch)->EMfields->compute_Ap( (*this)(ipatch) );
@@ -363,21 +520,33 @@ void VectorPatch::solvePoisson( Params &params, SmileiMPI* smpi )
         
         // compute new potential and residual
         for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++) {
-            (*this)(ipatch)->EMfields->update_pand_r( r_dot_r, p_dot_Ap );
+            (*this)(ipatch)->EMfields->update_pand_r( multigrid ? r_dot_z : r_dot_r, p_dot_Ap );
         }
         
-        // compute new residual norm
-        rnew_dot_rnew       = 0.0;
-        rnew_dot_rnew_local = 0.0;
-        for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++) {
-            rnew_dot_rnew_local += (*this)(ipatch)->EMfields->compute_r();
+        if (multigrid) {
+            // preconditioned residual, new residual norm
+            rnew_dot_znew = preconditionPoisson( z_, coarseGrid, rnew_dot_rnew );
+            if (smpi->isMaster()) DEBUG("new residual norm: rnew_dot_rnew = " << rnew_dot_rnew);
+            
+            // compute new direction
+            for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++) {
+                (*this)(ipatch)->EMfields->update_pz( rnew_dot_znew, r_dot_z );
+            }
         }
-        MPI_Allreduce(&rnew_dot_rnew_local, &rnew_dot_rnew, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-        if (smpi->isMaster()) DEBUG("new residual norm: rnew_dot_rnew = " << rnew_dot_rnew);
-        
-        // compute new directio
-        for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++) {
-            (*this)(ipatch)->EMfields->update_p( rnew_dot_rnew, r_dot_r );
+        else {
+            // compute new residual norm
+            rnew_dot_rnew       = 0.0;
+            rnew_dot_rnew_local = 0.0;
+            for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++) {
+                rnew_dot_rnew_local += (*this)(ipatch)->EMfields->compute_r();
+            }
+            MPI_Allreduce(&rnew_dot_rnew_local, &rnew_dot_rnew, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+            if (smpi->isMaster()) DEBUG("new residual norm: rnew_dot_rnew = " << rnew_dot_rnew);
+            
+            // compute new directio
+            for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++) {
+                (*this)(ipatch)->EMfields->update_p( rnew_dot_rnew, r_dot_r );
+            }
         }
         
         // compute control parameter
@@ -386,6 +555,8 @@ void VectorPatch::solvePoisson( Params &params, SmileiMPI* smpi )
     
     }//End of the iterative loop
     
+    if (coarseGrid) delete coarseGrid;
+    
     
     // --------------------------------
     // Status of the solver convergence
@@ -503,6 +674,38 @@ void VectorPatch::solvePoisson( Params &params, SmileiMPI* smpi )
 } // END solvePoisson
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Multigrid preconditioner of the Poisson solver : z = M^-1 r
+//   - coarse correction : one node per patch (sum of the residual over the patch), solved on every MPI process
+//   - local correction : one V-cycle on the nodes owned by each patch (0 outside)
+//   - z is then summed over the borders of the patches, which fills the ghost nodes with the values of their owner
+// Returns r.z, and r.r in r_dot_r (one single reduction)
+// ---------------------------------------------------------------------------------------------------------------------
+double VectorPatch::preconditionPoisson( std::vector<Field*>& z, PoissonCoarseGrid* coarseGrid, double& r_dot_r )
+{
+    std::vector<double> r_coarse( coarseGrid->size(), 0. );
+    for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++)
+        r_coarse[ coarseGrid->index( (*this)(ipatch)->Pcoordinates ) ] = (*this)(ipatch)->EMfields->compute_rsum();
+    MPI_Allreduce(MPI_IN_PLACE, &r_coarse[0], r_coarse.size(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    coarseGrid->solve( r_coarse );
+    
+    for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++)
+        (*this)(ipatch)->EMfields->precondition_r( r_coarse[ coarseGrid->index( (*this)(ipatch)->Pcoordinates ) ] );
+    SyncVectorPatch::sum( z, *this );
+    
+    double dots_local[2] = {0., 0.};
+    double dots[2];
+    for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++) {
+        dots_local[0] += (*this)(ipatch)->EMfields->compute_r();
+        dots_local[1] += (*this)(ipatch)->EMfields->compute_rz();
+    }
+    MPI_Allreduce(dots_local, dots, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    
+    r_dot_r = dots[0];
+    return dots[1];
+} // END preconditionPoisson
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // ---------------------------------------------------------------------------------------------------------------------
 // ----------------------------------------------    BALANCING METHODS    ----------------------------------------------
@@ -723,6 +926,70 @@ void VectorPatch::update_field_list()
         listBy_[ipatch] = patches_[ipatch]->EMfields->By_ ;
         listBz_[ipatch] = patches_[ipatch]->EMfields->Bz_ ;
     }
+    
+    if ( size() && patches_[0]->EMfields->envelope ) {
+        listEnvAre_.resize( size() ) ;
+        listEnvAim_.resize( size() ) ;
+        listEnvChi_.resize( size() ) ;
+        for (int ipatch=0 ; ipatch < size() ; ipatch++) {
+            listEnvAre_[ipatch] = patches_[ipatch]->EMfields->envelope->A_re ;
+            listEnvAim_[ipatch] = patches_[ipatch]->EMfields->envelope->A_im ;
+            listEnvChi_[ipatch] = patches_[ipatch]->EMfields->envelope->Chi ;
+        }
+    }
+    else {
+        listEnvAre_.clear();
+        listEnvAim_.clear();
+        listEnvChi_.clear();
+    }
+    
+    // Azimuthal modes (3drz)
+    unsigned int nmodesB   = size() ? patches_[0]->EMfields->modesB  .size() : 0;
+    unsigned int nmodesJ   = size() ? patches_[0]->EMfields->modesJ  .size() : 0;
+    unsigned int nmodesRho = size() ? patches_[0]->EMfields->modesRho.size() : 0;
+    listModesB_  .resize( nmodesB   );
+    listModesJ_  .resize( nmodesJ   );
+    listModesRho_.resize( nmodesRho );
+    for (unsigned int k=0 ; k<nmodesB ; k++) {
+        listModesB_[k].resize( size() );
+        for (int ipatch=0 ; ipatch < size() ; ipatch++)
+            listModesB_[k][ipatch] = patches_[ipatch]->EMfields->modesB[k];
+    }
+    for (unsigned int k=0 ; k<nmodesJ ; k++) {
+        listModesJ_[k].resize( size() );
+        for (int ipatch=0 ; ipatch < size() ; ipatch++)
+            listModesJ_[k][ipatch] = patches_[ipatch]->EMfields->modesJ[k];
+    }
+    for (unsigned int k=0 ; k<nmodesRho ; k++) {
+        listModesRho_[k].resize( size() );
+        for (int ipatch=0 ; ipatch < size() ; ipatch++)
+            listModesRho_[k][ipatch] = patches_[ipatch]->EMfields->modesRho[k];
+    }
+    
+    // Terms of the spectral solvers
+    unsigned int nterms = size() ? patches_[0]->EMfields->MaxwellFaradaySolver_->spectralTerms.size() : 0;
+    listSpectralTerms_.resize( nterms );
+    for (unsigned int k=0 ; k<nterms ; k++) {
+        listSpectralTerms_[k].resize( size() );
+        for (int ipatch=0 ; ipatch < size() ; ipatch++)
+            listSpectralTerms_[k][ipatch] = patches_[ipatch]->EMfields->MaxwellFaradaySolver_->spectralTerms[k];
+    }
+    
+    // Patches with a neighbour on another MPI process, and the others (overlap of the communications)
+    borderPatches_  .clear();
+    interiorPatches_.clear();
+    for (int ipatch=0 ; ipatch < size() ; ipatch++) {
+        bool border = false;
+        for (unsigned int iDim=0 ; iDim<listJx_[ipatch]->dims_.size() ; iDim++)
+            for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++)
+                border = border || patches_[ipatch]->is_a_MPI_neighbor( iDim, iNeighbor );
+        if (border) borderPatches_  .push_back( ipatch );
+        else        interiorPatches_.push_back( ipatch );
+    }
+    
+    // Pairs of patches shared with the neighbour MPI processes
+    if (aggregateComms)
+        haloPlan.build( *this );
 }
 void VectorPatch::update_field_list(int ispec)
 {
@@ -15,10 +15,12 @@
 #include "Params.h"
 #include "SmileiMPI.h"
 #include "SimWindow.h"
+#include "HaloCommPlan.h"
 
 class Field;
 class Timer;
 class SimWindow; 
+class PoissonCoarseGrid;
 
 //! Class Patch : sub MPI domain 
 //!     Collection of patch = MPI domain
@@ -86,11 +88,11 @@ public :
     // -----------------------------------------------------
 
     //! For all patch, move particles (restartRhoJ(s), dynamics and exchangeParticles)
-    void dynamics(Params& params, SmileiMPI* smpi, SimWindow* simWindow, int* diag_flag, double time_dual,
+    void dynamics(Params& params, SmileiMPI* smpi, SimWindow* simWindow, int* diag_flag, int itime, double time_dual,
                   std::vector<Timer>& timer);
 
     //! For all patch, sum densities on ghost cells (sum per species if needed, sync per patch and MPI sync)
-    void sumDensities( int* diag_flag, std::vector<Timer>& timer );
+    void sumDensities( Params& params, int* diag_flag, std::vector<Timer>& timer );
 
     //! For all patch, update E and B (Ampere, Faraday, boundary conditions, exchange B and center B)
     void solveMaxwell(Params& params, SimWindow* simWindow, int itime, double time_dual,
@@ -107,6 +109,8 @@ public :
 
     //! Solve Poisson to initialize E
     void solvePoisson( Params &params, SmileiMPI* smpi );
+    //! Multigrid preconditioner of the Poisson solver, returns r.z and r.r
+    double preconditionPoisson( std::vector<Field*>& z, PoissonCoarseGrid* coarseGrid, double& r_dot_r );
     
     //! For all patch initialize the externals (lasers, fields, antennas)
     void initExternals(Params& params);
@@ -140,6 +144,24 @@ public :
     std::vector<Field*> listBx_;
     std::vector<Field*> listBy_;
     std::vector<Field*> listBz_;
+    //! Laser envelope and susceptibility (empty if no envelope model)
+    std::vector<Field*> listEnvAre_;
+    std::vector<Field*> listEnvAim_;
+    std::vector<Field*> listEnvChi_;
+    //! Azimuthal modes m>0 of the 3drz geometry, one list per field of ElectroMagn::modesB... (empty otherwise)
+    std::vector<std::vector<Field*> > listModesB_;
+    std::vector<std::vector<Field*> > listModesJ_;
+    std::vector<std::vector<Field*> > listModesRho_;
+    //! Terms of the spectral solvers, one list per field of Solver::spectralTerms (empty otherwise)
+    std::vector<std::vector<Field*> > listSpectralTerms_;
+    
+    //! Indexes of the patches with a neighbour on another MPI process, and of the others (see update_field_list)
+    std::vector<unsigned int> borderPatches_;
+    std::vector<unsigned int> interiorPatches_;
+    
+    //! Guard cells of the fields sent in one message per neighbour MPI process (Params::aggregate_communications)
+    bool aggregateComms;
+    HaloCommPlan haloPlan;
     
     //! True if any antennas
     bool hasAntennas;
@@ -149,6 +171,9 @@ public :
     
     //! Copy of the fields time selection
     TimeSelection * fieldsTimeSelection;
+    
+    //! Operations of the diags done in the fused Maxwell sweep of the current timestep
+    std::vector<MaxwellSweepHook*> maxwellSweepHooks;
 
  private :
 
@@ -175,6 +200,18 @@ public :
         return (*this)(ipatch)->partWalls;
     }
 
+    //! The sums of the currents and the exchange of particles are overlapped, except at the timesteps of the
+    //! field diags (the species densities and rho are summed then)
+    inline bool overlapCommunications(Params& params, int diag_flag) {
+        return params.overlap_communications && !diag_flag;
+    }
+
+    //! Dynamics of the species of one patch (see dynamics)
+    void dynamicsPatch(unsigned int ipatch, Params& params, SmileiMPI* smpi, SimWindow* simWindow,
+                       int diag_flag, int itime, double time_dual);
+    //! Maxwell-Faraday (or fused sweep) and boundary conditions on B of one patch (see solveMaxwell)
+    void solveMaxwellFaradayPatch(unsigned int ipatch, Params& params, SimWindow* simWindow, int itime, double time_dual);
+
     //  Internal balancing members
     // ---------------------------
     std::vector<Patch*> recv_patches_;
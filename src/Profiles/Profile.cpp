@@ -6,6 +6,50 @@
 using namespace std;
 
 
+// Call a python function once with read-only numpy arrays wrapping arrays[0] ... arrays[narrays-1],
+// followed by the scalar time when given (the arrays are shared by all the profiles of a batch : a function
+// modifying its arguments in place fails, and is then evaluated point by point).
+// The result (array of values.size() elements, or a scalar) is copied in values.
+// Returns false, without python error pending, if the function does not accept arrays.
+static bool valuesAtPython(PyObject *py_profile, unsigned int narrays, vector<double> *arrays, vector<double> &values, double *time=NULL)
+{
+#ifdef SMILEI_USE_NUMPY
+    npy_intp npoints = values.size();
+    PyObject *args = PyTuple_New(narrays + (time?1:0));
+    for (unsigned int idim=0; idim<narrays; idim++)
+        PyTuple_SET_ITEM(args, idim, PyArray_New(&PyArray_Type, 1, &npoints, NPY_DOUBLE, NULL, &(arrays[idim][0]), 0, NPY_ARRAY_CARRAY_RO, NULL));
+    if( time )
+        PyTuple_SET_ITEM(args, narrays, PyFloat_FromDouble(*time));
+    PyObject *ret = PyObject_CallObject(py_profile, args);
+    Py_DECREF(args);
+    if( !ret ) {
+        PyErr_Clear();
+        return false;
+    }
+    PyArrayObject *result = (PyArrayObject*) PyArray_FROMANY(ret, NPY_DOUBLE, 0, 1, NPY_ARRAY_CARRAY_RO | NPY_ARRAY_FORCECAST);
+    Py_DECREF(ret);
+    if( !result ) {
+        PyErr_Clear();
+        return false;
+    }
+    npy_intp size = PyArray_SIZE(result);
+    double *data = (double*) PyArray_DATA(result);
+    bool ok = true;
+    if( size == npoints ) {
+        for (npy_intp i=0; i<npoints; i++) values[i] = data[i];
+    } else if( size == 1 ) {
+        for (npy_intp i=0; i<npoints; i++) values[i] = data[0];
+    } else {
+        ok = false;
+    }
+    Py_DECREF(result);
+    return ok;
+#else
+    return false;
+#endif
+}
+
+
 
 // Default constructor.
 Profile::Profile(PyObject* py_profile, unsigned int nvariables, string name) :
@@ -156,15 +200,29 @@ Profile::Profile(PyObject* py_profile, unsigned int nvariables, string name) :
         Py_XDECREF(tuple);
         Py_XDECREF(inspect);
         
+        // Check whether the function can be evaluated on arrays (numpy operations only),
+        // by calling it on 2 points (scalar calls otherwise)
+        bool vectorized = false;
+        if ( nvariables <= 3 ) {
+            vector<vector<double> > test_coordinates(nvariables, vector<double>(2));
+            vector<double> test_values(2);
+            for (unsigned int idim=0; idim<nvariables; idim++) {
+                test_coordinates[idim][0] = 0.5;
+                test_coordinates[idim][1] = 1.5;
+            }
+            vectorized = valuesAtPython(py_profile, nvariables, &test_coordinates[0], test_values);
+        }
+        
         // Assign the evaluating function, which depends on the number of arguments
-        if      ( nvariables == 1 ) function = new Function_Python1D(py_profile);
-        else if ( nvariables == 2 ) function = new Function_Python2D(py_profile);
-        else if ( nvariables == 3 ) function = new Function_Python3D(py_profile);
+        if      ( nvariables == 1 ) function = new Function_Python1D(py_profile, vectorized);
+        else if ( nvariables == 2 ) function = new Function_Python2D(py_profile, vectorized);
+        else if ( nvariables == 3 ) function = new Function_Python3D(py_profile, vectorized);
         else {
             ERROR("Profile `"<<name<<"`: defined with unsupported number of variables");
         }
         
         info_ << " user-defined function";
+        if ( vectorized ) info_ << " (vectorized)";
     }
     
     info = info_.str();
@@ -240,34 +298,60 @@ Profile::~Profile()
 double Function_Python1D::valueAt(double time) {
     return PyTools::runPyFunction(py_profile, time);
 }
-double Function_Python1D::valueAt(vector<double> x_cell) {
+double Function_Python1D::valueAt(const vector<double>& x_cell) {
     return PyTools::runPyFunction(py_profile, x_cell[0]);
 }
 // 2D
-double Function_Python2D::valueAt(vector<double> x_cell, double time) {
+double Function_Python2D::valueAt(const vector<double>& x_cell, double time) {
     return PyTools::runPyFunction(py_profile, x_cell[0], time);
 }
-double Function_Python2D::valueAt(vector<double> x_cell) {
+double Function_Python2D::valueAt(const vector<double>& x_cell) {
     return PyTools::runPyFunction(py_profile, x_cell[0], x_cell[1]);
 }
 // 3D
-double Function_Python3D::valueAt(vector<double> x_cell, double time) {
+double Function_Python3D::valueAt(const vector<double>& x_cell, double time) {
     return PyTools::runPyFunction(py_profile, x_cell[0], x_cell[1], time);
 }
-double Function_Python3D::valueAt(vector<double> x_cell) {
+double Function_Python3D::valueAt(const vector<double>& x_cell) {
     return PyTools::runPyFunction(py_profile, x_cell[0], x_cell[1], x_cell[2]);
 }
+// Arrays (numpy), one python call for all the points if the function accepts arrays
+void Function_Python1D::valuesAt(vector<vector<double> > &coordinates, vector<double> &values) {
+    if( !vectorized || !valuesAtPython(py_profile, 1, &coordinates[0], values) )
+        Function::valuesAt(coordinates, values);
+}
+void Function_Python2D::valuesAt(vector<vector<double> > &coordinates, vector<double> &values) {
+    if( !vectorized || !valuesAtPython(py_profile, 2, &coordinates[0], values) )
+        Function::valuesAt(coordinates, values);
+}
+void Function_Python3D::valuesAt(vector<vector<double> > &coordinates, vector<double> &values) {
+    if( !vectorized || !valuesAtPython(py_profile, 3, &coordinates[0], values) )
+        Function::valuesAt(coordinates, values);
+}
+// Arrays of times (1D), or of coordinates at a given time passed as a scalar (2D, 3D)
+void Function_Python1D::valuesAt(vector<double> &times, vector<double> &values) {
+    if( !vectorized || !valuesAtPython(py_profile, 1, &times, values) )
+        Function::valuesAt(times, values);
+}
+void Function_Python2D::valuesAt(vector<vector<double> > &coordinates, double time, vector<double> &values) {
+    if( !vectorized || !valuesAtPython(py_profile, 1, &coordinates[0], values, &time) )
+        Function::valuesAt(coordinates, time, values);
+}
+void Function_Python3D::valuesAt(vector<vector<double> > &coordinates, double time, vector<double> &values) {
+    if( !vectorized || !valuesAtPython(py_profile, 2, &coordinates[0], values, &time) )
+        Function::valuesAt(coordinates, time, values);
+}
 // 4D
-double Function_Python4D::valueAt(vector<double> x_cell, double time) {
+double Function_Python4D::valueAt(const vector<double>& x_cell, double time) {
     return PyTools::runPyFunction(py_profile, x_cell[0], x_cell[1], x_cell[2], time);
 }
 
 // Constant profiles
-double Function_Constant1D::valueAt(vector<double> x_cell) {
-    return (x_cell[0]>xvacuum) ? value : 0.;
+double Function_Constant1D::compute(double x) {
+    return (x>xvacuum) ? value : 0.;
 }
-double Function_Constant2D::valueAt(vector<double> x_cell) {
-    return ((x_cell[0]>xvacuum) && (x_cell[1]>yvacuum)) ? value : 0.;
+double Function_Constant2D::compute(double x, double y) {
+    return ((x>xvacuum) && (y>yvacuum)) ? value : 0.;
 }
 
 // Trapezoidal profiles
@@ -288,25 +372,25 @@ inline double trapeze(double x, double plateau, double slope1, double slope2, do
     }
     return result;
 }
-double Function_Trapezoidal1D::valueAt(vector<double> x_cell) {
-    return value * trapeze(x_cell[0]-xvacuum, xplateau, xslope1, xslope2, invxslope1, invxslope2);
+double Function_Trapezoidal1D::compute(double x) {
+    return value * trapeze(x-xvacuum, xplateau, xslope1, xslope2, invxslope1, invxslope2);
 }
-double Function_Trapezoidal2D::valueAt(vector<double> x_cell) {
+double Function_Trapezoidal2D::compute(double x, double y) {
     return value
-        * trapeze(x_cell[0]-xvacuum, xplateau, xslope1, xslope2, invxslope1, invxslope2)
-        * trapeze(x_cell[1]-yvacuum, yplateau, yslope1, yslope2, invyslope1, invyslope2);
+        * trapeze(x-xvacuum, xplateau, xslope1, xslope2, invxslope1, invxslope2)
+        * trapeze(y-yvacuum, yplateau, yslope1, yslope2, invyslope1, invyslope2);
 }
 
 // Gaussian profiles
-double Function_Gaussian1D::valueAt(vector<double> x_cell) {
-    double x = x_cell[0], xfactor=0.;
+double Function_Gaussian1D::compute(double x) {
+    double xfactor=0.;
     if ( x > xvacuum  && x < xvacuum+xlength )
         xfactor = exp( -pow(x-xcenter, xorder) * invxsigma );
     return value * xfactor;
 }
-double Function_Gaussian2D::valueAt(vector<double> x_cell) {
-    double x = x_cell[0], xfactor=0.;
-    double y = x_cell[1], yfactor=0.;
+double Function_Gaussian2D::compute(double x, double y) {
+    double xfactor=0.;
+    double yfactor=0.;
     if ( x > xvacuum  && x < xvacuum+xlength )
         xfactor = exp( -pow(x-xcenter, xorder) * invxsigma );
     if ( y > yvacuum  && y < yvacuum+ylength )
@@ -315,16 +399,14 @@ double Function_Gaussian2D::valueAt(vector<double> x_cell) {
 }
 
 // Polygonal profiles
-double Function_Polygonal1D::valueAt(vector<double> x_cell) {
-    double x = x_cell[0];
+double Function_Polygonal1D::compute(double x) {
     if( x < xpoints[0] ) return 0.;
     for( int i=1; i<npoints; i++ )
         if( x < xpoints[i] )
             return xvalues[i-1] + xslopes[i-1] * ( x - xpoints[i-1] );
     return 0.;
 }
-double Function_Polygonal2D::valueAt(vector<double> x_cell) {
-    double x = x_cell[0];
+double Function_Polygonal2D::compute(double x, double y) {
     if( x < xpoints[0] ) return 0.;
     for( int i=1; i<npoints; i++ )
         if( x < xpoints[i] )
@@ -333,15 +415,17 @@ double Function_Polygonal2D::valueAt(vector<double> x_cell) {
 }
 
 // Cosine profiles
-double Function_Cosine1D::valueAt(vector<double> x_cell) {
-    double x = (x_cell[0] - xvacuum) * invxlength, xfactor = 0.;
+double Function_Cosine1D::compute(double x) {
+    double xfactor = 0.;
+    x = (x - xvacuum) * invxlength;
     if( x > 0. && x < 1. )
         xfactor = base + xamplitude * cos(xphi + xfreq * x);
     return xfactor;
 }
-double Function_Cosine2D::valueAt(vector<double> x_cell) {
-    double x = (x_cell[0] - xvacuum) * invxlength, xfactor = 0.;
-    double y = (x_cell[1] - yvacuum) * invylength, yfactor = 0.;
+double Function_Cosine2D::compute(double x, double y) {
+    double xfactor = 0., yfactor = 0.;
+    x = (x - xvacuum) * invxlength;
+    y = (y - yvacuum) * invylength;
     if( x > 0. && x < 1. )
         xfactor = base + xamplitude * cos(xphi + xfreq * x);
     if( y > 0. && y < 1. )
@@ -350,8 +434,8 @@ double Function_Cosine2D::valueAt(vector<double> x_cell) {
 }
 
 // Polynomial profiles
-double Function_Polynomial1D::valueAt(vector<double> x_cell) {
-    double r = 0., xx0 = x_cell[0]-x0, xx = 1.;
+double Function_Polynomial1D::compute(double x) {
+    double r = 0., xx0 = x-x0, xx = 1.;
     int currentOrder = 0;
     for( int i=0; i<orders.size(); i++ ) {
         while( currentOrder<orders[i] ) {
@@ -362,8 +446,8 @@ double Function_Polynomial1D::valueAt(vector<double> x_cell) {
     }
     return r;
 }
-double Function_Polynomial2D::valueAt(vector<double> x_cell) {
-    double r = 0., xx0 = x_cell[0]-x0, yy0 = x_cell[1]-y0;
+double Function_Polynomial2D::compute(double x, double y) {
+    double r = 0., xx0 = x-x0, yy0 = y-y0;
     vector<double> xx;
     int currentOrder = 0;
     xx.resize(orders.back()+1);
@@ -13,9 +13,9 @@ public:
     //! Default constructor
     Function(){};
     //! Default destructor
-    ~Function(){};
+    virtual ~Function(){};
     // spatial
-    virtual double valueAt(std::vector<double>         ) {
+    virtual double valueAt(const std::vector<double>&         ) {
         return 0.;
     };
     // temporal
@@ -26,9 +26,67 @@ public:
         return valueAt(v);
     };
     // spatio-temporal
-    virtual double valueAt(std::vector<double>, double ) {
+    virtual double valueAt(const std::vector<double>&, double ) {
         return 0.;
     };
+    // spatial, at several locations : coordinates[idim][ipoint], one valueAt per point by default
+    virtual void valuesAt(std::vector<std::vector<double> > &coordinates, std::vector<double> &values) {
+        std::vector<double> x_cell(coordinates.size());
+        for (unsigned int ipoint=0; ipoint<values.size(); ipoint++) {
+            for (unsigned int idim=0; idim<coordinates.size(); idim++)
+                x_cell[idim] = coordinates[idim][ipoint];
+            values[ipoint] = valueAt(x_cell);
+        }
+    };
+    // temporal, at several times, one valueAt per time by default
+    virtual void valuesAt(std::vector<double> &times, std::vector<double> &values) {
+        for (unsigned int ipoint=0; ipoint<values.size(); ipoint++)
+            values[ipoint] = valueAt(times[ipoint]);
+    };
+    // spatio-temporal, at several locations and the same time, one valueAt per point by default
+    virtual void valuesAt(std::vector<std::vector<double> > &coordinates, double time, std::vector<double> &values) {
+        std::vector<double> x_cell(coordinates.size());
+        for (unsigned int ipoint=0; ipoint<values.size(); ipoint++) {
+            for (unsigned int idim=0; idim<coordinates.size(); idim++)
+                x_cell[idim] = coordinates[idim][ipoint];
+            values[ipoint] = valueAt(x_cell, time);
+        }
+    };
+};
+
+
+//! Hard-coded spatial functions of x : the array evaluation loops over Derived::compute, without virtual call per point
+template <class Derived>
+class Function_Space1D : public Function
+{
+public:
+    double valueAt(const std::vector<double>& x_cell) {
+        return static_cast<Derived*>(this)->compute( x_cell[0] );
+    };
+    void valuesAt(std::vector<std::vector<double> > &coordinates, std::vector<double> &values) {
+        Derived* f = static_cast<Derived*>(this);
+        const double* x = &(coordinates[0][0]);
+        for (unsigned int ipoint=0; ipoint<values.size(); ipoint++)
+            values[ipoint] = f->compute( x[ipoint] );
+    };
+};
+
+
+//! Hard-coded spatial functions of (x,y) : the array evaluation loops over Derived::compute, without virtual call per point
+template <class Derived>
+class Function_Space2D : public Function
+{
+public:
+    double valueAt(const std::vector<double>& x_cell) {
+        return static_cast<Derived*>(this)->compute( x_cell[0], x_cell[1] );
+    };
+    void valuesAt(std::vector<std::vector<double> > &coordinates, std::vector<double> &values) {
+        Derived* f = static_cast<Derived*>(this);
+        const double* x = &(coordinates[0][0]);
+        const double* y = &(coordinates[1][0]);
+        for (unsigned int ipoint=0; ipoint<values.size(); ipoint++)
+            values[ipoint] = f->compute( x[ipoint], y[ipoint] );
+    };
 };
 
 
@@ -46,17 +104,30 @@ public:
     ~Profile();
     
     //! Get the value of the profile at some location (spatial)
-    inline double valueAt(std::vector<double> coordinates) {
+    inline double valueAt(const std::vector<double>& coordinates) {
         return function->valueAt(coordinates);
     };
+    //! Get the values of the profile at several locations (spatial), coordinates[idim][ipoint]
+    //! (python functions are called once with numpy arrays when they accept them)
+    inline void valuesAt(std::vector<std::vector<double> > &coordinates, std::vector<double> &values) {
+        if (values.size()>0) function->valuesAt(coordinates, values);
+    };
     //! Get the value of the profile at some location (temporal)
     inline double valueAt(double time) {
         return function->valueAt(time);
     };
+    //! Get the values of the profile at several times (temporal)
+    inline void valuesAt(std::vector<double> &times, std::vector<double> &values) {
+        if (values.size()>0) function->valuesAt(times, values);
+    };
     //! Get the value of the profile at some location (spatio-temporal)
-    inline double valueAt(std::vector<double> coordinates, double time) {
+    inline double valueAt(const std::vector<double>& coordinates, double time) {
         return function->valueAt(coordinates, time);
     };
+    //! Get the values of the profile at several locations, at the same time (spatio-temporal)
+    inline void valuesAt(std::vector<std::vector<double> > &coordinates, double time, std::vector<double> &values) {
+        if (values.size()>0) function->valuesAt(coordinates, time, values);
+    };
     
     //! Get info on the loaded profile, to be printed later
     inline std::string getInfo() { return info; };
@@ -83,36 +154,48 @@ private:
 class Function_Python1D : public Function
 {
 public:
-    Function_Python1D(PyObject *pp) : py_profile(pp) {};
-    Function_Python1D(Function_Python1D *f) : py_profile(f->py_profile) {};
+    Function_Python1D(PyObject *pp, bool vectorized) : py_profile(pp), vectorized(vectorized) {};
+    Function_Python1D(Function_Python1D *f) : py_profile(f->py_profile), vectorized(f->vectorized) {};
     double valueAt(double); // time
-    double valueAt(std::vector<double>); // space
+    double valueAt(const std::vector<double>&); // space
+    void valuesAt(std::vector<std::vector<double> >&, std::vector<double>&); // space, arrays
+    void valuesAt(std::vector<double>&, std::vector<double>&); // time, arrays
 private:
     PyObject *py_profile;
+    //! The function accepts numpy arrays
+    bool vectorized;
 };
 
 
 class Function_Python2D : public Function
 {
 public:
-    Function_Python2D(PyObject *pp) : py_profile(pp) {};
-    Function_Python2D(Function_Python2D *f) : py_profile(f->py_profile) {};
-    double valueAt(std::vector<double>, double); // space + time
-    double valueAt(std::vector<double>); // space
+    Function_Python2D(PyObject *pp, bool vectorized) : py_profile(pp), vectorized(vectorized) {};
+    Function_Python2D(Function_Python2D *f) : py_profile(f->py_profile), vectorized(f->vectorized) {};
+    double valueAt(const std::vector<double>&, double); // space + time
+    double valueAt(const std::vector<double>&); // space
+    void valuesAt(std::vector<std::vector<double> >&, std::vector<double>&); // space, arrays
+    void valuesAt(std::vector<std::vector<double> >&, double, std::vector<double>&); // space + time, arrays
 private:
     PyObject *py_profile;
+    //! The function accepts numpy arrays
+    bool vectorized;
 };
 
 
 class Function_Python3D : public Function
 {
 public:
-    Function_Python3D(PyObject *pp) : py_profile(pp) {};
-    Function_Python3D(Function_Python3D *f) : py_profile(f->py_profile) {};
-    double valueAt(std::vector<double>, double); // space + time
-    double valueAt(std::vector<double>); // space
+    Function_Python3D(PyObject *pp, bool vectorized) : py_profile(pp), vectorized(vectorized) {};
+    Function_Python3D(Function_Python3D *f) : py_profile(f->py_profile), vectorized(f->vectorized) {};
+    double valueAt(const std::vector<double>&, double); // space + time
+    double valueAt(const std::vector<double>&); // space
+    void valuesAt(std::vector<std::vector<double> >&, std::vector<double>&); // space, arrays
+    void valuesAt(std::vector<std::vector<double> >&, double, std::vector<double>&); // space + time, arrays
 private:
     PyObject *py_profile;
+    //! The function accepts numpy arrays
+    bool vectorized;
 };
 
 
@@ -121,7 +204,7 @@ class Function_Python4D : public Function
 public:
     Function_Python4D(PyObject *pp) : py_profile(pp) {};
     Function_Python4D(Function_Python4D *f) : py_profile(f->py_profile) {};
-    double valueAt(std::vector<double>, double); // space + time
+    double valueAt(const std::vector<double>&, double); // space + time
 private:
     PyObject *py_profile;
 };
@@ -130,7 +213,7 @@ private:
 
 // Children classes for hard-coded functions
 
-class Function_Constant1D : public Function
+class Function_Constant1D : public Function_Space1D<Function_Constant1D>
 {
 public:
     Function_Constant1D ( PyObject *py_profile ) {
@@ -141,13 +224,13 @@ public:
         value   = f->value  ;
         xvacuum = f->xvacuum;
     };
-    double valueAt(std::vector<double>);
+    double compute(double x);
 private:
     double value, xvacuum;
 };
 
 
-class Function_Constant2D : public Function
+class Function_Constant2D : public Function_Space2D<Function_Constant2D>
 {
 public:
     Function_Constant2D ( PyObject *py_profile ) {
@@ -160,13 +243,13 @@ public:
         xvacuum = f->xvacuum;
         yvacuum = f->yvacuum;
     };
-    double valueAt(std::vector<double>);
+    double compute(double x, double y);
 private:
     double value, xvacuum, yvacuum;
 };
 
 
-class Function_Trapezoidal1D : public Function
+class Function_Trapezoidal1D : public Function_Space1D<Function_Trapezoidal1D>
 {
 public:
     Function_Trapezoidal1D ( PyObject *py_profile ) {
@@ -187,13 +270,13 @@ public:
         invxslope1 = 1./xslope1;
         invxslope2 = 1./xslope2;
     };
-    double valueAt(std::vector<double>);
+    double compute(double x);
 private:
     double value, xvacuum, xplateau, xslope1, xslope2, invxslope1, invxslope2;
 };
 
 
-class Function_Trapezoidal2D : public Function
+class Function_Trapezoidal2D : public Function_Space2D<Function_Trapezoidal2D>
 {
 public:
     Function_Trapezoidal2D ( PyObject *py_profile ) {
@@ -226,7 +309,7 @@ public:
         invyslope1 = 1./yslope1;
         invyslope2 = 1./yslope2;
     };
-    double valueAt(std::vector<double>);
+    double compute(double x, double y);
 private:
     double value, 
         xvacuum, xplateau, xslope1, xslope2, invxslope1, invxslope2,
@@ -234,7 +317,7 @@ private:
 };
 
 
-class Function_Gaussian1D : public Function
+class Function_Gaussian1D : public Function_Space1D<Function_Gaussian1D>
 {
 public:
     Function_Gaussian1D ( PyObject *py_profile ) {
@@ -255,14 +338,14 @@ public:
         xcenter   = f->xcenter;
         xorder    = f->xorder ;
     };
-    double valueAt(std::vector<double>);
+    double compute(double x);
 private:
     double value, xvacuum, xlength, invxsigma, xcenter;
     int xorder;
 };
 
 
-class Function_Gaussian2D : public Function
+class Function_Gaussian2D : public Function_Space2D<Function_Gaussian2D>
 {
 public:
     Function_Gaussian2D ( PyObject *py_profile ) {
@@ -294,7 +377,7 @@ public:
         ycenter   = f->ycenter;
         yorder    = f->yorder ;
     };
-    double valueAt(std::vector<double>);
+    double compute(double x, double y);
 private:
     double value, 
         xvacuum, xlength, invxsigma, xcenter,
@@ -303,7 +386,7 @@ private:
 };
 
 
-class Function_Polygonal1D : public Function
+class Function_Polygonal1D : public Function_Space1D<Function_Polygonal1D>
 {
 public:
     Function_Polygonal1D ( PyObject *py_profile ) {
@@ -318,14 +401,14 @@ public:
         xslopes = f->xslopes;
         npoints = xpoints.size();
     };
-    double valueAt(std::vector<double>);
+    double compute(double x);
 private:
     std::vector<double> xpoints, xvalues, xslopes;
     int npoints;
 };
 
 
-class Function_Polygonal2D : public Function
+class Function_Polygonal2D : public Function_Space2D<Function_Polygonal2D>
 {
 public:
     Function_Polygonal2D ( PyObject *py_profile ) {
@@ -340,14 +423,14 @@ public:
         xslopes = f->xslopes;
         npoints = xpoints.size();
     };
-    double valueAt(std::vector<double>);
+    double compute(double x, double y);
 private:
     std::vector<double> xpoints, xvalues, xslopes;
     int npoints;
 };
 
 
-class Function_Cosine1D : public Function
+class Function_Cosine1D : public Function_Space1D<Function_Cosine1D>
 {
 public:
     Function_Cosine1D ( PyObject *py_profile ) {
@@ -369,13 +452,13 @@ public:
         xphi       = f->xphi      ;
         xfreq      = f->xfreq     ;
     };
-    double valueAt(std::vector<double>);
+    double compute(double x);
 private:
     double base, xamplitude, xvacuum, invxlength, xphi, xfreq;
 };
 
 
-class Function_Cosine2D : public Function
+class Function_Cosine2D : public Function_Space2D<Function_Cosine2D>
 {
 public:
     Function_Cosine2D ( PyObject *py_profile ) {
@@ -409,7 +492,7 @@ public:
         yphi       = f->yphi      ;
         yfreq      = f->yfreq     ;
     };
-    double valueAt(std::vector<double>);
+    double compute(double x, double y);
 private:
     double base, 
         xamplitude, xvacuum, invxlength, xphi, xfreq,
@@ -417,7 +500,7 @@ private:
 };
 
 
-class Function_Polynomial1D : public Function
+class Function_Polynomial1D : public Function_Space1D<Function_Polynomial1D>
 {
 public:
     Function_Polynomial1D ( PyObject *py_profile ) {
@@ -430,7 +513,7 @@ public:
         coeffs = f->coeffs;
         x0     = f->x0    ;
     };
-    double valueAt(std::vector<double>);
+    double compute(double x);
 private:
     double x0;
     std::vector<int> orders;
@@ -438,7 +521,7 @@ private:
 };
 
 
-class Function_Polynomial2D : public Function
+class Function_Polynomial2D : public Function_Space2D<Function_Polynomial2D>
 {
 public:
     Function_Polynomial2D ( PyObject *py_profile ) {
@@ -456,7 +539,7 @@ public:
         x0     = f->x0    ;
         y0     = f->y0    ;
     };
-    double valueAt(std::vector<double>);
+    double compute(double x, double y);
 private:
     double x0, y0;
     std::vector<int> orders;
@@ -32,6 +32,11 @@ public:
 
    //!Wrapper
     virtual void operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, int diag_flag, std::vector<unsigned int> &b_dim, int ispec) = 0;
+
+    //! Project the susceptibility of the particles (EMfields->envelope->Chi), before the push
+    virtual void susceptibility(ElectroMagn* EMfields, Particles &particles, double species_mass, SmileiMPI* smpi, int istart, int iend, int ithread) {
+        ERROR( "The laser envelope model is only available in 2d3v with interpolation_order = 2" );
+    }
 private:
 
 };
@@ -334,10 +334,10 @@ void Projector1D2Order::operator() (ElectroMagn* EMfields, Particles &particles,
         for (unsigned int ipart=istart ; ipart<iend; ipart++ )
     	    (*this)(b_Jx , b_Jy , b_Jz , particles,  ipart, (*gf)[ipart], ibin*clrw, b_dim, &(*iold)[ipart], &(*delta)[ipart]);
     } else {
-	double* b_Jx =  &(*EMfields->Jx_s[ispec] )(ibin*clrw);
-	double* b_Jy =  &(*EMfields->Jy_s[ispec] )(ibin*clrw);
-	double* b_Jz =  &(*EMfields->Jz_s[ispec] )(ibin*clrw);
-	double* b_rho = &(*EMfields->rho_s[ispec])(ibin*clrw);
+	double* b_Jx =  &(*EMfields->Jx_diag(ispec) )(ibin*clrw);
+	double* b_Jy =  &(*EMfields->Jy_diag(ispec) )(ibin*clrw);
+	double* b_Jz =  &(*EMfields->Jz_diag(ispec) )(ibin*clrw);
+	double* b_rho = &(*EMfields->rho_diag(ispec))(ibin*clrw);
         for (unsigned int ipart=istart ; ipart<iend; ipart++ )
 	    (*this)(b_Jx , b_Jy , b_Jz ,b_rho, particles,  ipart, (*gf)[ipart], ibin*clrw, b_dim, &(*iold)[ipart], &(*delta)[ipart]);
     }
@@ -6,6 +6,7 @@
 #include "ElectroMagn.h"
 #include "Field2D.h"
 #include "Particles.h"
+#include "LaserEnvelope2D.h"
 #include "Tools.h"
 #include "Patch.h"
 
@@ -396,12 +397,62 @@ void Projector2D2Order::operator() (ElectroMagn* EMfields, Particles &particles,
         for (unsigned int ipart=istart ; ipart<iend; ipart++ )
     	    (*this)(b_Jx , b_Jy , b_Jz , particles,  ipart, (*gf)[ipart], ibin*clrw, b_dim, &(*iold)[2*ipart], &(*delta)[2*ipart]);
     } else {
-	double* b_Jx =  &(*EMfields->Jx_s[ispec] )(ibin*clrw*dim1);
-	double* b_Jy =  &(*EMfields->Jy_s[ispec] )(ibin*clrw*(dim1+1));
-	double* b_Jz =  &(*EMfields->Jz_s[ispec] )(ibin*clrw*dim1);
-	double* b_rho = &(*EMfields->rho_s[ispec])(ibin*clrw*dim1);
+	double* b_Jx =  &(*EMfields->Jx_diag(ispec) )(ibin*clrw*dim1);
+	double* b_Jy =  &(*EMfields->Jy_diag(ispec) )(ibin*clrw*(dim1+1));
+	double* b_Jz =  &(*EMfields->Jz_diag(ispec) )(ibin*clrw*dim1);
+	double* b_rho = &(*EMfields->rho_diag(ispec))(ibin*clrw*dim1);
         for (unsigned int ipart=istart ; ipart<iend; ipart++ )
 	    (*this)(b_Jx , b_Jy , b_Jz ,b_rho, particles,  ipart, (*gf)[ipart], ibin*clrw, b_dim, &(*iold)[2*ipart], &(*delta)[2*ipart]);
     }
 
 }
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project the susceptibility chi = q^2 w / (m gamma) of the particles, with the cycle-averaged Lorentz factor
+//! gamma = sqrt( 1 + u^2 + (q/m)^2 Phi ) (Phi interpolated by Interpolator::envelope, before the push)
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector2D2Order::susceptibility(ElectroMagn* EMfields, Particles &particles, double species_mass, SmileiMPI* smpi, int istart, int iend, int ithread)
+{
+    Field2D* Chi2D = EMfields->envelope->Chi;
+    double *PHIpart = smpi->dynamics_PHIpart[ithread].data();
+    double one_over_mass = 1./species_mass;
+
+    double delta, delta2;
+    double Sx1[3], Sy1[3];
+
+    for (int ipart=istart ; ipart<iend; ipart++ ) {
+        double charge_over_mass = (double)(particles.charge(ipart))*one_over_mass;
+        double gamma = sqrt( 1.0 + particles.momentum(0, ipart)*particles.momentum(0, ipart)
+                                 + particles.momentum(1, ipart)*particles.momentum(1, ipart)
+                                 + particles.momentum(2, ipart)*particles.momentum(2, ipart)
+                                 + charge_over_mass*charge_over_mass*PHIpart[ipart] );
+        double chi_weight = (double)(particles.charge(ipart))*charge_over_mass*particles.weight(ipart)/gamma;
+
+        double xpn = particles.position(0, ipart) * dx_inv_;
+        int ip = round(xpn);
+        delta  = xpn - (double)ip;
+        delta2 = delta*delta;
+        Sx1[0] = 0.5 * (delta2-delta+0.25);
+        Sx1[1] = 0.75-delta2;
+        Sx1[2] = 0.5 * (delta2+delta+0.25);
+
+        double ypn = particles.position(1, ipart) * dy_inv_;
+        int jp = round(ypn);
+        delta  = ypn - (double)jp;
+        delta2 = delta*delta;
+        Sy1[0] = 0.5 * (delta2-delta+0.25);
+        Sy1[1] = 0.75-delta2;
+        Sy1[2] = 0.5 * (delta2+delta+0.25);
+
+        ip -= i_domain_begin + 1;
+        jp -= j_domain_begin + 1;
+
+        for (unsigned int i=0 ; i<3 ; i++) {
+            for (unsigned int j=0 ; j<3 ; j++) {
+                (*Chi2D)(i+ip, j+jp) += chi_weight * Sx1[i]*Sy1[j];
+            }
+        }
+    }
+
+} // END Project susceptibility
@@ -23,6 +23,9 @@ public:
     //!Wrapper
     void operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, int diag_flag, std::vector<unsigned int> &b_dim, int ispec) override final;
 
+    //! Project the susceptibility of the particles (EMfields->envelope->Chi)
+    void susceptibility(ElectroMagn* EMfields, Particles &particles, double species_mass, SmileiMPI* smpi, int istart, int iend, int ithread) override final;
+
 private:
     double one_third;
 };
@@ -0,0 +1,296 @@
+#include "Projector3DRZ2Order.h"
+
+#include <cmath>
+#include <iostream>
+
+#include "ElectroMagn3DRZ.h"
+#include "Field2D.h"
+#include "Particles.h"
+#include "Tools.h"
+#include "Patch.h"
+
+using namespace std;
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor for Projector3DRZ2Order
+// ---------------------------------------------------------------------------------------------------------------------
+Projector3DRZ2Order::Projector3DRZ2Order (Params& params, Patch* patch) : Projector2D(params, patch)
+{
+    dx_inv_   = 1.0/params.cell_length[0];
+    dx_ov_dt  = params.cell_length[0] / params.timestep;
+    dy_inv_   = 1.0/params.cell_length[1];
+    dy_ov_dt  = params.cell_length[1] / params.timestep;
+    dr_inv_   = dy_inv_;
+
+    one_third = 1.0/3.0;
+
+    // A uniform density n deposits n * 13/64 dr on the axis with the 2nd order shape function (weight ~ r)
+    inv_r_axis = 64./13. * dr_inv_;
+
+    i_domain_begin = patch->getCellStartingGlobalIndex(0);
+    j_domain_begin = patch->getCellStartingGlobalIndex(1);
+
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor for Projector3DRZ2Order
+// ---------------------------------------------------------------------------------------------------------------------
+Projector3DRZ2Order::~Projector3DRZ2Order()
+{
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Deposit of a local 5x5 array, divided by the radius of the nodes
+//!   primal nodes : r = j_glob dr, the node -j_glob is the image of j_glob
+//!   dual nodes   : r = (j_glob-1/2) dr, the node 1-j_glob is the image of j_glob
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector3DRZ2Order::deposit(double* f, unsigned int row, int i0, int j0, double loc[5][5], double coeff, double fold_sign, bool dual)
+{
+    for (int j=0 ; j<5 ; j++) {
+        int jl = j0+j;
+        int jg = jl+j_domain_begin;
+        double c;
+        if ( dual ) {
+            if ( jg >= 1 ) {
+                c = coeff / ( (double)jg-0.5 ) * dr_inv_;
+            } else {
+                jl += 1-2*jg;
+                c = fold_sign*coeff / ( 0.5-(double)jg ) * dr_inv_;
+            }
+        } else {
+            if ( jg > 0 ) {
+                c = coeff / (double)jg * dr_inv_;
+            } else if ( jg == 0 ) {
+                c = coeff * inv_r_axis;
+            } else {
+                jl -= 2*jg;
+                c = fold_sign*coeff / (double)(-jg) * dr_inv_;
+            }
+        }
+        for (int i=0 ; i<5 ; i++)
+            f[(i0+i)*row+jl] += c*loc[i][j];
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project charge : frozen & diagFields timstep (mode 0)
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector3DRZ2Order::operator() (double* rho, Particles &particles, unsigned int ipart, unsigned int bin, std::vector<unsigned int> &b_dim)
+{
+    //Warning : this function is used for frozen species only. It is assumed that position = position_old !!!
+
+    double charge_weight = (double)(particles.charge(ipart))*particles.weight(ipart);
+
+    double xpn, rpn;
+    double delta, delta2;
+    double Sx1[5], Sr1[5];
+    double rho_loc[5][5];
+
+    for (unsigned int i=0; i<5; i++) {
+        Sx1[i] = 0.;
+        Sr1[i] = 0.;
+    }
+
+    xpn = particles.position(0, ipart) * dx_inv_;
+    int ip = round(xpn);
+    delta  = xpn - (double)ip;
+    delta2 = delta*delta;
+    Sx1[1] = 0.5 * (delta2-delta+0.25);
+    Sx1[2] = 0.75-delta2;
+    Sx1[3] = 0.5 * (delta2+delta+0.25);
+
+    rpn = particles.distance_to_axis(ipart) * dr_inv_;
+    int jp = round(rpn);
+    delta  = rpn - (double)jp;
+    delta2 = delta*delta;
+    Sr1[1] = 0.5 * (delta2-delta+0.25);
+    Sr1[2] = 0.75-delta2;
+    Sr1[3] = 0.5 * (delta2+delta+0.25);
+
+    for (unsigned int i=0 ; i<5 ; i++)
+        for (unsigned int j=0 ; j<5 ; j++)
+            rho_loc[i][j] = charge_weight * Sx1[i]*Sr1[j];
+
+    ip -= i_domain_begin + bin +2;
+    jp -= j_domain_begin + 2;
+
+    deposit( rho, b_dim[1], ip, jp, rho_loc, 1., 1., false );
+
+} // END Project local current densities (frozen)
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project global current densities : ionization
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector3DRZ2Order::operator() (Field* Jx, Field* Jy, Field* Jz, Particles &particles, int ipart, LocalFields Jion)
+{
+    ERROR("Projection of ionization current not yet defined for 3drz 2nd order");
+
+} // END Project global current densities (ionize)
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Wrapper for projection
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector3DRZ2Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, int diag_flag, std::vector<unsigned int> &b_dim, int ispec)
+{
+    ElectroMagn3DRZ* EM = static_cast<ElectroMagn3DRZ*>(EMfields);
+    std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
+    std::vector<double> *deltaold = &(smpi->dynamics_deltaold[ithread]);
+    std::vector<double> *gf = &(smpi->dynamics_gf[ithread]);
+
+    int dim1 = EMfields->dimPrim[1];
+    unsigned int bin = ibin*clrw;
+    unsigned int nparts = EM->nparts();
+
+    // Bin pointers of each part : the mode 0 in the species fields at diagFields timesteps
+    std::vector<double*> b_Jl(nparts), b_Jr(nparts), b_Jt(nparts), b_rho(nparts, (double*)NULL);
+    for (unsigned int k=0 ; k<nparts ; k++) {
+        Field* Jl  = EM->Jl_[k];
+        Field* Jr  = EM->Jr_[k];
+        Field* Jt  = EM->Jt_[k];
+        Field* rho = EM->Rho_[k];
+        if ( k==0 && diag_flag ) {
+            Jl  = EMfields->Jx_diag(ispec);
+            Jr  = EMfields->Jy_diag(ispec);
+            Jt  = EMfields->Jz_diag(ispec);
+            rho = EMfields->rho_diag(ispec);
+        }
+        b_Jl[k] = &(*Jl)(bin*dim1);
+        b_Jr[k] = &(*Jr)(bin*(dim1+1));
+        b_Jt[k] = &(*Jt)(bin*dim1);
+        if ( diag_flag )
+            b_rho[k] = &(*rho)(bin*dim1);
+    }
+
+    double Sx0[5], Sx1[5], Sr0[5], Sr1[5], DSx[5], DSr[5], tmpJl[5];
+    double Jl_loc[5][5], Jr_loc[5][5], Jt_loc[5][5], rho_loc[5][5];
+    double delta, delta2;
+
+    for (int ipart=istart ; ipart<iend; ipart++ ) {
+        int*    io = &(*iold)[3*ipart];
+        double* dold = &(*deltaold)[3*ipart];
+
+        double charge_weight = (double)(particles.charge(ipart))*particles.weight(ipart);
+        double crx_p = charge_weight*dx_ov_dt;
+        double crr_p = charge_weight*dy_ov_dt;
+
+        // Angle at the middle of the step, azimuthal velocity
+        double r = particles.distance_to_axis(ipart);
+        double cos_n = 1., sin_n = 0.;
+        if ( r > 0. ) {
+            cos_n = particles.position(1, ipart)/r;
+            sin_n = particles.position(2, ipart)/r;
+        }
+        double cos_m = cos( dold[2] ) + cos_n;
+        double sin_m = sin( dold[2] ) + sin_n;
+        double theta = ( cos_m!=0. || sin_m!=0. ) ? atan2( sin_m, cos_m ) : atan2( sin_n, cos_n );
+        cos_m = cos( theta );
+        sin_m = sin( theta );
+        double crt_p = charge_weight*( -particles.momentum(1, ipart)*sin_m + particles.momentum(2, ipart)*cos_m )/(*gf)[ipart];
+
+        // --------------------------------------------------------
+        // Locate particles & Calculate Esirkepov coef. S, DS and W
+        // --------------------------------------------------------
+        for (unsigned int i=0; i<5; i++) {
+            Sx1[i] = 0.;
+            Sr1[i] = 0.;
+            tmpJl[i] = 0.;
+        }
+        Sx0[0] = 0.;
+        Sx0[4] = 0.;
+        Sr0[0] = 0.;
+        Sr0[4] = 0.;
+
+        delta = dold[0];
+        delta2 = delta*delta;
+        Sx0[1] = 0.5 * (delta2-delta+0.25);
+        Sx0[2] = 0.75-delta2;
+        Sx0[3] = 0.5 * (delta2+delta+0.25);
+
+        delta = dold[1];
+        delta2 = delta*delta;
+        Sr0[1] = 0.5 * (delta2-delta+0.25);
+        Sr0[2] = 0.75-delta2;
+        Sr0[3] = 0.5 * (delta2+delta+0.25);
+
+        double xpn = particles.position(0, ipart) * dx_inv_;
+        int ip = round(xpn);
+        int ipo = io[0];
+        int ip_m_ipo = ip-ipo-i_domain_begin;
+        delta  = xpn - (double)ip;
+        delta2 = delta*delta;
+        Sx1[ip_m_ipo+1] = 0.5 * (delta2-delta+0.25);
+        Sx1[ip_m_ipo+2] = 0.75-delta2;
+        Sx1[ip_m_ipo+3] = 0.5 * (delta2+delta+0.25);
+
+        double rpn = r * dr_inv_;
+        int jp = round(rpn);
+        int jpo = io[1];
+        int jp_m_jpo = jp-jpo-j_domain_begin;
+        delta  = rpn - (double)jp;
+        delta2 = delta*delta;
+        Sr1[jp_m_jpo+1] = 0.5 * (delta2-delta+0.25);
+        Sr1[jp_m_jpo+2] = 0.75-delta2;
+        Sr1[jp_m_jpo+3] = 0.5 * (delta2+delta+0.25);
+
+        for (unsigned int i=0; i < 5; i++) {
+            DSx[i] = Sx1[i] - Sx0[i];
+            DSr[i] = Sr1[i] - Sr0[i];
+        }
+
+        // ------------------------------------------------
+        // Local current created by the particle in (x, r)
+        // ------------------------------------------------
+        for (unsigned int i=0 ; i<5 ; i++) {
+            double tmp = 0.;
+            double tmpR = Sx0[i] + 0.5*DSx[i];
+            double tmp2 = 0.5*Sx1[i] + Sx0[i];
+            double tmp3 = 0.5*Sx0[i] + Sx1[i];
+            Jr_loc[i][0] = 0.;
+            for (unsigned int j=0 ; j<5 ; j++) {
+                if (i>0)
+                    tmpJl[j] -= crx_p * DSx[i-1] * (Sr0[j] + 0.5*DSr[j]);
+                Jl_loc[i][j] = tmpJl[j];
+                if (j>0) {
+                    tmp -= crr_p * DSr[j-1] * tmpR;
+                    Jr_loc[i][j] = tmp;
+                }
+                Jt_loc[i][j]  = crt_p * one_third * ( Sr0[j]*tmp2 + Sr1[j]*tmp3 );
+                rho_loc[i][j] = charge_weight * Sx1[i]*Sr1[j];
+            }
+        }
+
+        // ------------------------------------------------
+        // Deposit in the modes
+        // ------------------------------------------------
+        ipo -= bin+2; //This minus 2 come from the order 2 scheme, based on a 5 points stencil from -2 to +2.
+        jpo -= 2;
+        double cos_mt = 1., sin_mt = 0.;
+        for (unsigned int k=0 ; k<nparts ; k++) {
+            double coeff;
+            double parity = 1.;
+            if ( k==0 ) {
+                coeff = 1.;
+            } else if ( k%2 ) {
+                double c = cos_mt*cos_m - sin_mt*sin_m;
+                sin_mt   = sin_mt*cos_m + cos_mt*sin_m;
+                cos_mt   = c;
+                coeff = 2.*cos_mt;
+            } else {
+                coeff = 2.*sin_mt;
+            }
+            if ( EM->mode(k)%2 ) parity = -1.;
+            deposit( b_Jl[k], dim1  , ipo, jpo, Jl_loc, coeff,  parity, false );
+            deposit( b_Jr[k], dim1+1, ipo, jpo, Jr_loc, coeff, -parity, true  );
+            deposit( b_Jt[k], dim1  , ipo, jpo, Jt_loc, coeff, -parity, false );
+            if ( b_rho[k] )
+                deposit( b_rho[k], dim1, ipo, jpo, rho_loc, coeff, parity, false );
+        }
+    }
+
+}
@@ -0,0 +1,43 @@
+#ifndef PROJECTOR3DRZ2ORDER_H
+#define PROJECTOR3DRZ2ORDER_H
+
+#include "Projector2D.h"
+
+
+//----------------------------------------------------------------------------------------------------------------------
+//! class Projector3DRZ2Order : 2nd order projection for 3drz simulations
+//!   - the charge conserving (Esirkepov) currents are computed in (x, r), as in 2d3v, and the current along theta
+//!     from the azimuthal velocity of the particle
+//!   - they are deposited in the mode m with the phase 2 exp(i m theta) (1 for the mode 0) at the mean angle of the
+//!     particle during the step, and divided by the radius of the nodes (the weight of a particle is proportional
+//!     to its radius, see Species::initWeight)
+//!   - the contributions to the nodes r<0 are folded back on the nodes -r with the parity of the mode
+//----------------------------------------------------------------------------------------------------------------------
+class Projector3DRZ2Order : public Projector2D {
+public:
+    Projector3DRZ2Order(Params&, Patch* patch);
+    ~Projector3DRZ2Order();
+
+    //! Project charge of mode 0 (EMfields->rho_), frozen & diagFields timestep
+    void operator() (double* rho, Particles &particles, unsigned int ipart, unsigned int bin, std::vector<unsigned int> &b_dim) override final;
+
+    //! Project global current densities if Ionization in Species::dynamics,
+    void operator() (Field* Jx, Field* Jy, Field* Jz, Particles &particles, int ipart, LocalFields Jion) override final;
+
+    //!Wrapper : the mode 0 is projected in the species fields at diagFields timesteps, the modes m>0 in the total
+    //! fields of ElectroMagn3DRZ
+    void operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, int diag_flag, std::vector<unsigned int> &b_dim, int ispec) override final;
+
+private:
+    //! Add coeff * loc / r to the 5x5 nodes from (i0, j0) of the field f (rows of length row), folding the nodes
+    //! r<0 with the sign fold_sign
+    void deposit(double* f, unsigned int row, int i0, int j0, double loc[5][5], double coeff, double fold_sign, bool dual);
+
+    double one_third;
+    //! Inverse of the radial step and inverse of the effective radius of the nodes on the axis
+    double dr_inv_;
+    double inv_r_axis;
+};
+
+#endif
+
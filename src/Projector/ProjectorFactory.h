@@ -6,6 +6,7 @@
 #include "Projector1D4Order.h"
 #include "Projector2D2Order.h"
 #include "Projector2D4Order.h"
+#include "Projector3DRZ2Order.h"
 
 #include "Params.h"
 #include "Patch.h" 
@@ -31,6 +32,12 @@ public:
         else if ( ( params.geometry == "2d3v" ) && ( params.interpolation_order == (unsigned int)2 ) ) {
             Proj = new Projector2D2Order(params, patch);
         }
+        // ---------------
+        // 3drz simulation
+        // ---------------
+        else if ( ( params.geometry == "3drz" ) && ( params.interpolation_order == (unsigned int)2 ) ) {
+            Proj = new Projector3DRZ2Order(params, patch);
+        }
         else {
             ERROR( "Unknwon parameters : " << params.geometry << ", Order : " << params.interpolation_order );
         }
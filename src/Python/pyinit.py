@@ -104,15 +104,31 @@ class Main(SmileiSingleton):
     sim_time = None
     number_of_timesteps = None
     interpolation_order = 2
+    nmodes = 2
     number_of_patches = None
     clrw = 1
+    vectorization = True
+    fused_dynamics = True
+    sort_every = 0
+    overlap_communications = True
+    aggregate_communications = True
     timestep = None
     timestep_over_CFL = None
     
     # Default fields
     maxwell_sol = 'Yee'
+    fused_maxwell = True
+    psatd_guard_cells = 8
+    current_filter_passes = 0
+    current_filter_compensation = True
+    poisson_solver = 'cg'
+    poisson_max_iteration = 50000
+    poisson_error_max = 1.e-14
     bc_em_type_x = []
     bc_em_type_y = []
+    pml_cells = 10
+    pml_order = 3
+    pml_reflection = 1.e-8
     time_fields_frozen = 0.
     
     # Default Misc
@@ -130,11 +146,14 @@ class Main(SmileiSingleton):
             else:
                 if Main.cell_length is None:
                     raise Exception("Need cell_length to calculate timestep")
-                if Main.maxwell_sol == 'Yee':
+                if Main.maxwell_sol in ['Yee', 'PSATD']:
                     if Main.geometry == '1d3v':
                         Main.timestep = Main.timestep_over_CFL*Main.cell_length[0]
                     elif Main.geometry == '2d3v':         
                         Main.timestep = Main.timestep_over_CFL/math.sqrt(1.0/(Main.cell_length[0]**2)+1.0/(Main.cell_length[1]**2))
+                    elif Main.geometry == '3drz':
+                        # the azimuthal modes tighten the 2D condition
+                        Main.timestep = Main.timestep_over_CFL/math.sqrt(1.0/(Main.cell_length[0]**2)+(1.0+(Main.nmodes-1)**2)/(Main.cell_length[1]**2))
                     else: 
                         raise Exception("timestep: geometry not implemented "+Main.geometry)
                 else:
@@ -188,7 +207,7 @@ class Species(SmileiComponent):
     initPosition_type = None
     initMomentum_type = ""
     n_part_per_cell = None
-    c_part_max = 1.0
+    c_part_max = 1.2
     mass = None
     charge = None
     charge_density = None
@@ -200,6 +219,7 @@ class Species(SmileiComponent):
     dynamics_type = "norm"
     time_frozen = 0.0
     radiating = False
+    ponderomotive_dynamics = False
     bc_part_type_west = None
     bc_part_type_east = None
     bc_part_type_north = None
@@ -207,6 +227,10 @@ class Species(SmileiComponent):
     ionization_model = "none"
     ionization_electrons = None
     atomic_number = None
+    merge_every = 0
+    merge_max_ppc = 0
+    merge_momentum_cells = 8
+    merge_min_particles = 4
     isTest = False
     track_every = 0
 
@@ -219,6 +243,7 @@ class Laser(SmileiComponent):
     space_envelope = [1., 0.]
     phase = [0., 0.]
     space_time_profile = None
+    envelope = False
 
 class Collisions(SmileiComponent):
     """Collisions parameters"""
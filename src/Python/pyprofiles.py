@@ -6,7 +6,7 @@ def constant(value, xvacuum=-float("inf"), yvacuum=-float("inf")):
         raise Exception("constant profile has been defined before `Main()`")
     if Main.geometry == "1d3v":
         f = lambda x  : value if x>=xvacuum else 0.
-    if Main.geometry == "2d3v":
+    if Main.geometry in ["2d3v", "3drz"]:
         f = lambda x,y: value if (x>=xvacuum and y>=yvacuum) else 0.
         f.yvacuum = yvacuum
     f.profileName = "constant"
@@ -37,7 +37,7 @@ def trapezoidal(max,
         else: return 0.0
     if Main.geometry == "1d3v":
         f = fx
-    if Main.geometry == "2d3v":
+    if Main.geometry in ["2d3v", "3drz"]:
         def fy(y):
             # vacuum region
             if y < yvacuum: return 0.
@@ -88,7 +88,7 @@ def gaussian(max,
         else: return 0.0
     if Main.geometry == "1d3v":
         f = fx
-    if Main.geometry == "2d3v":
+    if Main.geometry in ["2d3v", "3drz"]:
         ysigma = (0.5*yfwhm)**yorder/math.log(2.0)
         def fy(y):
             if yorder == 0: return 1.
@@ -162,7 +162,7 @@ def cosine(base,
         else: return 0.
     if Main.geometry == "1d3v":
         f = fx
-    if Main.geometry == "2d3v":
+    if Main.geometry in ["2d3v", "3drz"]:
         def fy(y):
             #vacuum region
             if y < yvacuum: return 0.
@@ -216,7 +216,7 @@ def polynomial(**kwargs):
                     xx *= xx0
                 r += c[0] * xx
             return r
-    if Main.geometry=="2d3v":
+    if Main.geometry in ["2d3v", "3drz"]:
         def f(x,y):
             r = 0.
             xx0 = x-x0
@@ -405,7 +405,7 @@ def LaserPlanar1D( boxSide="west", a0=1., omega=1.,
 
 
 def LaserGaussian2D( boxSide="west", a0=1., omega=1., focus=None, waist=3., incidence_angle=0.,
-        polarizationPhi=0., ellipticity=0., time_envelope=tconstant()):
+        polarizationPhi=0., ellipticity=0., time_envelope=tconstant(), envelope=False):
     import math
     # Polarization and amplitude
     [dephasing, amplitudeY, amplitudeZ] = transformPolarization(polarizationPhi, ellipticity)
@@ -446,6 +446,7 @@ def LaserGaussian2D( boxSide="west", a0=1., omega=1., focus=None, waist=3., inci
         time_envelope  = time_envelope,
         space_envelope = [ lambda y:amplitudeZ*spatial(y), lambda y:amplitudeY*spatial(y) ],
         phase          = [ lambda y:phase(y)-phaseZero+dephasing, lambda y:phase(y)-phaseZero ],
+        envelope       = envelope,
     )
 
 
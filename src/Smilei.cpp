@@ -132,11 +132,11 @@ int main (int argc, char* argv[])
         
         // Initialize the electromagnetic fields
         // -----------------------------------
-        vecPatches.dynamics(params, smpiData, simWindow, &diag_flag, time_dual, timer);
+        vecPatches.dynamics(params, smpiData, simWindow, &diag_flag, 0, time_dual, timer);
         timer[1].reboot();
         timer[8].reboot();
         
-        vecPatches.sumDensities( &diag_flag, timer );
+        vecPatches.sumDensities( params, &diag_flag, timer );
         timer[4].reboot();
         timer[9].reboot();
         
@@ -149,7 +149,12 @@ int main (int argc, char* argv[])
         }
         
         // Init electric field (Ex/1D, + Ey/2D)
-        if (!vecPatches.isRhoNull(smpiData)) {
+        if ( params.geometry == "3drz" ) {
+            // The cartesian Poisson solver does not apply to the azimuthal modes
+            if (!vecPatches.isRhoNull(smpiData))
+                WARNING("The Poisson solver is not available in 3drz : the initial electric field is not computed");
+        }
+        else if (!vecPatches.isRhoNull(smpiData)) {
             TITLE("Solving Poisson at time t = 0");
             Timer ptimer;
             ptimer.init(smpiData, "global");
@@ -256,12 +261,12 @@ int main (int argc, char* argv[])
             // (1) interpolate the fields at the particle position
             // (2) move the particle
             // (3) calculate the currents (charge conserving method)
-            vecPatches.dynamics(params, smpiData, simWindow, &diag_flag, time_dual, timer);
+            vecPatches.dynamics(params, smpiData, simWindow, &diag_flag, itime, time_dual, timer);
             
             /*******************************************/
             /*********** Sum densities *****************/
             /*******************************************/
-            vecPatches.sumDensities( &diag_flag, timer );
+            vecPatches.sumDensities( params, &diag_flag, timer );
             
             // apply currents from antennas
             #pragma omp single
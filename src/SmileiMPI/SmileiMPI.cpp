@@ -109,12 +109,16 @@ void SmileiMPI::init( Params& params )
     dynamics_gf.resize(omp_get_max_threads());
     dynamics_iold.resize(omp_get_max_threads());
     dynamics_deltaold.resize(omp_get_max_threads());
+    dynamics_PHIpart.resize(omp_get_max_threads());
+    dynamics_GradPHIpart.resize(omp_get_max_threads());
 #else
     dynamics_Epart.resize(1);
     dynamics_Bpart.resize(1);
     dynamics_gf.resize(1);
     dynamics_iold.resize(1);
     dynamics_deltaold.resize(1);
+    dynamics_PHIpart.resize(1);
+    dynamics_GradPHIpart.resize(1);
 #endif
 
     // Set periodicity of the simulated problem
@@ -198,7 +202,7 @@ void SmileiMPI::init_patch_count( Params& params)
         PyTools::extract_pyProfile("nb_density"    , profile1, "Species", ispecies);
         PyTools::extract_pyProfile("charge_density", profile1, "Species", ispecies);
         PyTools::extract_pyProfile("n_part_per_cell", profile1, "Species", ispecies);
-        Profile *ppcProfile = new Profile(profile1, params.nDim_particle, "n_part_per_cell "+species_type);
+        Profile *ppcProfile = new Profile(profile1, params.nDim_field, "n_part_per_cell "+species_type);
 
         local_load = 0;
         // Count global number of particles, 
@@ -254,7 +258,7 @@ void SmileiMPI::init_patch_count( Params& params)
             PyTools::extract_pyProfile("nb_density"    , profile1, "Species", ispecies);
             PyTools::extract_pyProfile("charge_density", profile1, "Species", ispecies);
             PyTools::extract_pyProfile("n_part_per_cell", profile1, "Species", ispecies);
-            Profile *ppcProfile = new Profile(profile1, params.nDim_particle, "n_part_per_cell "+species_type);
+            Profile *ppcProfile = new Profile(profile1, params.nDim_field, "n_part_per_cell "+species_type);
 
             vector<double> cell_index(3,0);
             for (unsigned int i=0 ; i<params.nDim_field ; i++) {
@@ -605,6 +609,23 @@ void SmileiMPI::recv(std::vector<int> *vec, int from, int tag)
 } // End recv ( bmax )
 
 
+// Assuming vec.size() is known (same layout on both patches). Asynchronous.
+void SmileiMPI::isend(std::vector<double>* vec, int to, int tag)
+{
+    MPI_Request request; 
+    MPI_Isend( &((*vec)[0]), (*vec).size(), MPI_DOUBLE, to, tag, MPI_COMM_WORLD, &request );
+
+} // End isend ( vector<double> )
+
+
+void SmileiMPI::recv(std::vector<double> *vec, int from, int tag)
+{
+    MPI_Status status;
+    MPI_Recv( &((*vec)[0]), vec->size(), MPI_DOUBLE, from, tag, MPI_COMM_WORLD, &status );
+
+} // End recv ( vector<double> )
+
+
 void SmileiMPI::isend(ElectroMagn* EM, int to, int tag)
 {
     isend( EM->Ex_, to, tag+0);
@@ -641,6 +662,34 @@ void SmileiMPI::isend(ElectroMagn* EM, int to, int tag)
             }
         }
     }
+    
+    // Laser envelope at times n and n-1, ponderomotive potential
+    if ( EM->envelope ) {
+        isend( EM->envelope->A_re     , to, tag   );
+        isend( EM->envelope->A_im     , to, tag+1 );
+        isend( EM->envelope->A0_re    , to, tag+2 );
+        isend( EM->envelope->A0_im    , to, tag+3 );
+        isend( EM->envelope->Phi      , to, tag+4 );
+        isend( EM->envelope->GradPhi_x, to, tag+5 );
+        isend( EM->envelope->GradPhi_y, to, tag+6 );
+    }
+    
+    // Azimuthal modes m>0 (3drz)
+    for (unsigned int k=0 ; k<EM->modesE.size() ; k++) {
+        isend( EM->modesE  [k], to, tag+7+3*k   );
+        isend( EM->modesB  [k], to, tag+7+3*k+1 );
+        isend( EM->modesB_m[k], to, tag+7+3*k+2 );
+    }
+    tag += 7 + 3*EM->modesE.size();
+    
+    // Auxiliary fields of the boundary conditions (PML), empty if the patch is outside the layer
+    for (unsigned int bcId=0 ; bcId<EM->emBoundCond.size() ; bcId++ ) {
+        if(! EM->emBoundCond[bcId]) continue;
+        vector< vector<double>* > aux;
+        EM->emBoundCond[bcId]->auxiliaryFields( aux );
+        for (unsigned int i=0 ; i<aux.size() ; i++, tag++)
+            if ( aux[i]->size() > 0 ) isend( aux[i], to, tag );
+    }
 } // End isend ( ElectroMagn )
 
 
@@ -679,6 +728,34 @@ void SmileiMPI::recv(ElectroMagn* EM, int from, int tag)
             }
         }
     }
+    
+    // Laser envelope at times n and n-1, ponderomotive potential
+    if ( EM->envelope ) {
+        recv( EM->envelope->A_re     , from, tag   );
+        recv( EM->envelope->A_im     , from, tag+1 );
+        recv( EM->envelope->A0_re    , from, tag+2 );
+        recv( EM->envelope->A0_im    , from, tag+3 );
+        recv( EM->envelope->Phi      , from, tag+4 );
+        recv( EM->envelope->GradPhi_x, from, tag+5 );
+        recv( EM->envelope->GradPhi_y, from, tag+6 );
+    }
+    
+    // Azimuthal modes m>0 (3drz)
+    for (unsigned int k=0 ; k<EM->modesE.size() ; k++) {
+        recv( EM->modesE  [k], from, tag+7+3*k   );
+        recv( EM->modesB  [k], from, tag+7+3*k+1 );
+        recv( EM->modesB_m[k], from, tag+7+3*k+2 );
+    }
+    tag += 7 + 3*EM->modesE.size();
+    
+    // Auxiliary fields of the boundary conditions (PML), empty if the patch is outside the layer
+    for (unsigned int bcId=0 ; bcId<EM->emBoundCond.size() ; bcId++ ) {
+        if(! EM->emBoundCond[bcId]) continue;
+        vector< vector<double>* > aux;
+        EM->emBoundCond[bcId]->auxiliaryFields( aux );
+        for (unsigned int i=0 ; i<aux.size() ; i++, tag++)
+            if ( aux[i]->size() > 0 ) recv( aux[i], from, tag );
+    }
 } // End recv ( ElectroMagn )
 
 
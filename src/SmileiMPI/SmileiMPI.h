@@ -72,6 +72,8 @@ public:
     void recv (Particles* partictles, int from, int hindex, MPI_Datatype datatype);
     void isend(std::vector<int>* vec, int to  , int hindex);
     void recv (std::vector<int> *vec, int from, int hindex);
+    void isend(std::vector<double>* vec, int to  , int hindex);
+    void recv (std::vector<double> *vec, int from, int hindex);
 
     void isend(ElectroMagn* fields, int to  , int hindex);
     void recv (ElectroMagn* fields, int from, int hindex);
@@ -116,24 +118,32 @@ public:
     // Global buffers for vectorization of Species::dynamics
     // -----------------------------------------------------
     
-    //! value of the Efield 
-    std::vector<std::vector<LocalFields>> dynamics_Epart;
-    //! value of the Bfield
-    std::vector<std::vector<LocalFields>> dynamics_Bpart;
+    //! value of the Efield, struct of arrays : [Ex(0..npart-1), Ey(0..npart-1), Ez(0..npart-1)]
+    std::vector<std::vector<double>> dynamics_Epart;
+    //! value of the Bfield, struct of arrays : [Bx(0..npart-1), By(0..npart-1), Bz(0..npart-1)]
+    std::vector<std::vector<double>> dynamics_Bpart;
     //! gamma factor
     std::vector<std::vector<double>> dynamics_gf;
     //! iold_pos
     std::vector<std::vector<int>> dynamics_iold;
     //! delta_old_pos
     std::vector<std::vector<double>> dynamics_deltaold;
+    //! value of the ponderomotive potential of the laser envelope
+    std::vector<std::vector<double>> dynamics_PHIpart;
+    //! value of its gradient, struct of arrays : [GradPhix(0..npart-1), GradPhiy(0..npart-1), GradPhiz(0..npart-1)]
+    std::vector<std::vector<double>> dynamics_GradPHIpart;
 
     // Resize buffers for a given number of particles
-    inline void dynamics_resize(int ithread, int ndim_part, int npart ){
-        dynamics_Epart[ithread].resize(npart);
-        dynamics_Bpart[ithread].resize(npart);
+    inline void dynamics_resize(int ithread, int ndim_part, int npart, bool ponderomotive=false ){
+        dynamics_Epart[ithread].resize(3*npart);
+        dynamics_Bpart[ithread].resize(3*npart);
         dynamics_gf[ithread].resize(npart);
         dynamics_iold[ithread].resize(ndim_part*npart);
         dynamics_deltaold[ithread].resize(ndim_part*npart);
+        if ( ponderomotive ) {
+            dynamics_PHIpart[ithread].resize(npart);
+            dynamics_GradPHIpart[ithread].resize(3*npart);
+        }
     }
 
 
@@ -3,12 +3,12 @@
 
 SpeciesMPI::SpeciesMPI()
 {
+    particles_posted = false;
 }
 
 void SpeciesMPI::init()
 {
     // resize correctly arrays 
-    // suppress corner object
 
     int ndims = 2;
     int nbNeighbors_ = 2;
@@ -18,9 +18,8 @@ void SpeciesMPI::init()
 	    patch_buff_index_send[iDir][i].resize(0);
 	    patch_buff_index_recv_sz[iDir][i] = 0;
 	    patch_buff_index_send_sz[iDir][i] = 0;
-	    //corner_buff_index_send[iDir][i].resize(0);
-	    //corner_buff_index_recv_sz[iDir][i] = 0;
-	    //corner_buff_index_send_sz[iDir][i] = 0;
+	    corner_buff_index_send[iDir][i].resize(0);
+	    corner_buff_index_recv_sz[iDir][i] = 0;
 	}
     }
 
@@ -2,6 +2,8 @@
 #define SPECIESMPI_H
 
 #include <mpi.h>
+#include <vector>
+#include <utility>
 
 #include "Particles.h"
 
@@ -15,21 +17,45 @@ class SpeciesMPI {
 
 
     Particles patchVectorRecv[2][2];
-    Particles patchVectorSend[2][2];
-    //Particles cornerVectorRecv[2][2];
-    //Particles cornerVectorSend[2][2];
+    //! Particles received from the corner neighbours (2D), indexed as Patch::corner_neighbor_
+    Particles cornerVectorRecv[2][2];
 
     std::vector<int> patch_buff_index_send[2][2];
-    //std::vector<int> corner_buff_index_send[2][2];
+    std::vector<int> corner_buff_index_send[2][2];
     int patch_buff_index_send_sz[2][2];
-    //int corner_buff_index_send_sz[2][2];
     int patch_buff_index_recv_sz[2][2];
-    //int corner_buff_index_recv_sz[2][2];
+    int corner_buff_index_recv_sz[2][2];
+
+    //! Per bin, indexes of the particles sent (holes to fill)
+    std::vector< std::vector<int> > bin_holes;
+    //! Per bin, particles received as (neighbour, index in its receive buffer), see recvVector
+    std::vector< std::vector< std::pair<int,int> > > bin_arrivals;
+    //! New first particle of each bin when bins have to be moved
+    std::vector<int> bin_new_min;
+
+    //! Packed particles sent to and received from the MPI neighbours (see Particles::pack), the number of particles
+    //! is the header of the message. Kept from one exchange to the next, only reallocated when they grow
+    std::vector<char> patch_buffer_send[2][2];
+    std::vector<char> patch_buffer_recv[2][2];
+    std::vector<char> corner_buffer_send[2][2];
+    std::vector<char> corner_buffer_recv[2][2];
+
+    //! The MPI messages of the particles to exchange with the neighbours of the faces and of the corners, in all
+    //! directions, have been posted by Patch::postCommParticles (overlap of the communications)
+    bool particles_posted;
+
+    //! Receive buffers of the MPI sums of a field (see Patch::initSumField), one per direction and neighbour
+    //! so that the sums of several fields can be in flight
+    std::vector<double> sum_buffer[2][2];
 
     MPI_Request patch_srequest[2][2];
     MPI_Request patch_rrequest[2][2];
-    //MPI_Request corner_srequest[2][2];
-    //MPI_Request corner_rrequest[2][2];
+    MPI_Request corner_srequest[2][2];
+
+    //! Receive buffer of the neighbour i : 2*iDim+iNeighbor for the faces, 4+2*ix+iy for the corners
+    inline Particles& recvVector(int i) {
+        return ( i<4 ) ? patchVectorRecv[i/2][i%2] : cornerVectorRecv[(i-4)/2][i%2];
+    }
 
 };
 
@@ -51,6 +51,48 @@ inline int stop_particle( Particles &particles, int ipart, int direction, double
 
 }
 
+//! 3drz geometry : conditions on the cylinder r = limit_pos/2 (direction is unused), the particle is moved back
+//! radially at the same angle
+inline void mirror_radius( Particles &particles, int ipart, double limit_pos, double &cos_t, double &sin_t ) {
+    double r = particles.distance_to_axis(ipart);
+    cos_t = particles.position(1, ipart)/r;
+    sin_t = particles.position(2, ipart)/r;
+    particles.position(1, ipart) = (limit_pos - r)*cos_t;
+    particles.position(2, ipart) = (limit_pos - r)*sin_t;
+}
+
+inline int refl_particle_rz( Particles &particles, int ipart, int direction, double limit_pos, Species *species,
+                            double &nrj_iPart) {
+    nrj_iPart = 0.;     // no energy loss during reflection
+    double cos_t, sin_t;
+    mirror_radius( particles, ipart, limit_pos, cos_t, sin_t );
+    // the radial momentum is reversed
+    double pr = particles.momentum(1, ipart)*cos_t + particles.momentum(2, ipart)*sin_t;
+    particles.momentum(1, ipart) -= 2.*pr*cos_t;
+    particles.momentum(2, ipart) -= 2.*pr*sin_t;
+    return 1;
+}
+
+inline int supp_particle_rz( Particles &particles, int ipart, int direction, double limit_pos, Species *species,
+                            double &nrj_iPart) {
+    nrj_iPart = particles.weight(ipart)*(particles.lor_fac(ipart)-1.0); // energy lost
+    double cos_t, sin_t;
+    mirror_radius( particles, ipart, limit_pos, cos_t, sin_t );
+    particles.charge(ipart) = 0;
+    return 0;
+}
+
+inline int stop_particle_rz( Particles &particles, int ipart, int direction, double limit_pos, Species *species,
+                            double &nrj_iPart) {
+    nrj_iPart = particles.weight(ipart)*(particles.lor_fac(ipart)-1.0); // energy lost
+    double cos_t, sin_t;
+    mirror_radius( particles, ipart, limit_pos, cos_t, sin_t );
+    particles.momentum(0, ipart) = 0.;
+    particles.momentum(1, ipart) = 0.;
+    particles.momentum(2, ipart) = 0.;
+    return 1;
+}
+
 //!\todo (MG) at the moment the particle is thermalize whether or not there is a plasma initially at the boundary.
 // ATTENTION: here the thermalization assumes a Maxwellian distribution, maybe we should add some checks on thermT (MG)!
 inline int thermalize_particle( Particles &particles, int ipart, int direction, double limit_pos,
@@ -78,13 +120,13 @@ inline int thermalize_particle( Particles &particles, int ipart, int direction,
                 // change of velocity in the direction normal to the reflection plane
                 double sign_vel = -particles.momentum(i,ipart)/std::abs(particles.momentum(i,ipart));
                 particles.momentum(i,ipart) = sign_vel * species->thermalMomentum[i]
-                *                             std::sqrt( -std::log(1.0-((double)rand() / ((double)RAND_MAX+0.1)) ) );
+                *                             std::sqrt( -std::log(1.0-species->random.uniform()) );
                 
             } else {
                 // change of momentum in the direction(s) along the reflection plane
-                double sign_rnd = (double)rand() / RAND_MAX - 0.5; sign_rnd = (sign_rnd)/std::abs(sign_rnd);
+                double sign_rnd = species->random.uniform() < 0.5 ? -1. : 1.;
                 particles.momentum(i,ipart) = sign_rnd * species->thermalMomentum[i]
-                *                             userFunctions::erfinv( (double)rand() / ((double)RAND_MAX+0.1) );
+                *                             userFunctions::erfinv( species->random.uniform() );
             }//if
             
         }//i
@@ -0,0 +1,68 @@
+/*! @file FusedDynamics.h
+
+ @brief FusedDynamics.h  generic class for the fused interpolation - push - projection of a bin of particles
+
+ */
+
+#ifndef FUSEDDYNAMICS_H
+#define FUSEDDYNAMICS_H
+
+#include <vector>
+
+#include "Params.h"
+
+class ElectroMagn;
+class Particles;
+class Species;
+class PartWalls;
+class Patch;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class FusedDynamics
+//!   - interpolates the fields, pushes, applies the boundary conditions and projects the currents particle per particle
+//!   - the shape factors computed for the interpolation at the former position are reused by the projection
+//!   - one virtual call per bin, the pusher is a template parameter of the implementations
+//  --------------------------------------------------------------------------------------------------------------------
+class FusedDynamics
+{
+public:
+    //! Creator for FusedDynamics
+    FusedDynamics(Params& params, double mass) {
+        mass_          = mass;
+        one_over_mass_ = 1.0/mass_;
+        dt             = params.timestep;
+        dts2           = params.timestep/2.;
+        nDim_          = params.nDim_particle;
+        dx_inv_        = 1.0/params.cell_length[0];
+        dx_ov_dt       = params.cell_length[0] / params.timestep;
+    }
+    virtual ~FusedDynamics() {}
+
+    //! Move the particles of the bin ibin, project their currents (and charge if diag_flag), accumulate lost energy in nrj_lost
+    virtual void operator() (ElectroMagn* EMfields, Particles &particles, Species* species, PartWalls* partWalls, Patch* patch,
+                             int ibin, int diag_flag, int ispec, double &nrj_lost) = 0;
+
+protected:
+    //! 2nd order shape factors on the 3 nodes around the particle, delta being the distance to the central node
+    static inline void shape2( double delta, double* coeff ) {
+        double delta2 = delta*delta;
+        coeff[0] = 0.5 * (delta2-delta+0.25);
+        coeff[1] = 0.75 - delta2;
+        coeff[2] = 0.5 * (delta2+delta+0.25);
+    }
+
+    double dt, dts2;
+    double mass_;
+    double one_over_mass_;
+    int nDim_;
+    double dx_inv_;
+    double dx_ov_dt;
+
+};
+
+//! Fused kernel for a given geometry and interpolation order (see specializations FusedDynamics1D2Order.h, ...)
+template <unsigned int nDim, unsigned int order, class PushScheme>
+class FusedDynamicsKernel;
+
+#endif
+
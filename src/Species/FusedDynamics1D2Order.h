@@ -0,0 +1,163 @@
+/*! @file FusedDynamics1D2Order.h
+
+ @brief FusedDynamics1D2Order.h  fused interpolation - push - projection for 1d3v simulations, 2nd order shape
+
+ Same operations as Interpolator1D2Order, the Pusher of the species and Projector1D2Order (Esirkepov)
+ */
+
+#ifndef FUSEDDYNAMICS1D2ORDER_H
+#define FUSEDDYNAMICS1D2ORDER_H
+
+#include <cmath>
+
+#include "FusedDynamics.h"
+#include "PushSchemes.h"
+
+#include "ElectroMagn.h"
+#include "Field1D.h"
+#include "Particles.h"
+#include "Species.h"
+#include "PartWall.h"
+#include "PartBoundCond.h"
+#include "Patch.h"
+
+template <class PushScheme>
+class FusedDynamicsKernel<1,2,PushScheme> : public FusedDynamics
+{
+public:
+    FusedDynamicsKernel(Params& params, double mass) : FusedDynamics(params, mass) {}
+    ~FusedDynamicsKernel() override final {}
+
+    void operator() (ElectroMagn* EMfields, Particles &particles, Species* species, PartWalls* partWalls, Patch* patch,
+                     int ibin, int diag_flag, int ispec, double &nrj_lost) override final
+    {
+        // Static cast of the electromagnetic fields
+        Field1D* Ex1D     = static_cast<Field1D*>(EMfields->Ex_);
+        Field1D* Ey1D     = static_cast<Field1D*>(EMfields->Ey_);
+        Field1D* Ez1D     = static_cast<Field1D*>(EMfields->Ez_);
+        Field1D* Bx1D_m   = static_cast<Field1D*>(EMfields->Bx_m);
+        Field1D* By1D_m   = static_cast<Field1D*>(EMfields->By_m);
+        Field1D* Bz1D_m   = static_cast<Field1D*>(EMfields->Bz_m);
+
+        int index_domain_begin = patch->getCellStartingGlobalIndex(0);
+        unsigned int bin = ibin*species->clrw;
+
+        // Currents (and charge) of the bin
+        double *b_Jx, *b_Jy, *b_Jz, *b_rho(NULL);
+        if (diag_flag == 0) {
+            b_Jx = &(*EMfields->Jx_ )(bin);
+            b_Jy = &(*EMfields->Jy_ )(bin);
+            b_Jz = &(*EMfields->Jz_ )(bin);
+        } else {
+            b_Jx  = &(*EMfields->Jx_diag(ispec) )(bin);
+            b_Jy  = &(*EMfields->Jy_diag(ispec) )(bin);
+            b_Jz  = &(*EMfields->Jz_diag(ispec) )(bin);
+            b_rho = &(*EMfields->rho_diag(ispec))(bin);
+        }
+
+        double E[3], B[3], p[3];
+        double coeffd[3];
+        // S0[1..3] are the primal interpolation coefficients, reused by the projection
+        double S0[5], S1[5], Wl[5], Wt[5], Jx_p[5];
+        S0[0] = 0.;
+        S0[4] = 0.;
+        double ener_iPart(0.);
+
+        for (int ipart=species->bmin[ibin] ; ipart<species->bmax[ibin] ; ipart++ ) {
+
+            // ------------------------------------------
+            // Interpolate the fields at the old position
+            // ------------------------------------------
+            double xjn = particles.position(0, ipart)*dx_inv_;
+
+            // Dual grid : Ex, By, Bz
+            int id = round(xjn+0.5);
+            shape2( xjn - (double)id + 0.5, coeffd );
+            id -= index_domain_begin;
+            E[0] = compute( coeffd, Ex1D,   id );
+            B[1] = compute( coeffd, By1D_m, id );
+            B[2] = compute( coeffd, Bz1D_m, id );
+
+            // Primal grid : Ey, Ez, Bx
+            int ipo = round(xjn);
+            shape2( xjn - (double)ipo, &S0[1] );
+            ipo -= index_domain_begin;
+            E[1] = compute( &S0[1], Ey1D,   ipo );
+            E[2] = compute( &S0[1], Ez1D,   ipo );
+            B[0] = compute( &S0[1], Bx1D_m, ipo );
+
+            // ------------------
+            // Push the particle
+            // ------------------
+            double charge_over_mass_ = static_cast<double>(particles.charge(ipart))*one_over_mass_;
+            for ( int i = 0 ; i<3 ; i++ )
+                p[i] = particles.momentum(i, ipart);
+            double gf = PushScheme::push( p, E, B, charge_over_mass_, dts2, mass_, one_over_mass_ );
+            for ( int i = 0 ; i<3 ; i++ )
+                particles.momentum(i, ipart) = p[i];
+            particles.position(0, ipart) += dt*p[0]/gf;
+            PushScheme::finalize( particles, ipart );
+
+            // --------------------------------
+            // Apply wall and boundary conditions
+            // --------------------------------
+            for (int iwall=0; iwall<partWalls->size(); iwall++) {
+                if ( !(*partWalls)[iwall]->apply(particles, ipart, species, ener_iPart)) {
+                    nrj_lost += mass_ * ener_iPart;
+                }
+            }
+            if ( !species->partBoundCond->apply( particles, ipart, species, ener_iPart ) ) {
+                species->addPartInExchList( ipart );
+                nrj_lost += mass_ * ener_iPart;
+            }
+
+            if (particles.isTest) continue;
+
+            // ---------------------------------------------------
+            // Project the currents (Esirkepov), charge if diag_flag
+            // ---------------------------------------------------
+            double charge_weight = (double)(particles.charge(ipart))*particles.weight(ipart);
+            double crx_p = charge_weight*dx_ov_dt;
+            double cry_p = charge_weight*particles.momentum(1, ipart)/gf;
+            double crz_p = charge_weight*particles.momentum(2, ipart)/gf;
+
+            for (unsigned int i=0; i<5; i++) {
+                S1[i]   = 0.;
+                Jx_p[i] = 0.;
+            }
+            xjn = particles.position(0, ipart) * dx_inv_;
+            int ip = round(xjn);
+            shape2( xjn - (double)ip, &S1[ip-ipo-index_domain_begin+1] );
+
+            for (unsigned int i=0; i<5; i++) {
+                Wl[i] = S0[i] - S1[i];           // for longitudinal current (x)
+                Wt[i] = 0.5 * (S0[i] + S1[i]);   // for transverse currents (y,z)
+            }
+            for (unsigned int i=1; i<5; i++) {
+                Jx_p[i] = Jx_p[i-1] + crx_p * Wl[i-1];
+            }
+
+            ipo -= bin + 2;
+            for (unsigned int i=0; i<5; i++) {
+                b_Jx[i + ipo]  += Jx_p[i];
+                b_Jy[i + ipo]  += cry_p * Wt[i];
+                b_Jz[i + ipo]  += crz_p * Wt[i];
+            }
+            if (b_rho) {
+                for (unsigned int i=0; i<5; i++)
+                    b_rho[i + ipo] += charge_weight * S1[i];
+            }
+
+        }// ipart
+    }
+
+private:
+    //! 3 nodes interpolation centered on idx
+    static inline double compute( const double* coeff, Field1D* f, int idx ) {
+        return coeff[0] * (*f)(idx-1) + coeff[1] * (*f)(idx) + coeff[2] * (*f)(idx+1);
+    }
+
+};
+
+#endif
+
@@ -0,0 +1,226 @@
+/*! @file FusedDynamics2D2Order.h
+
+ @brief FusedDynamics2D2Order.h  fused interpolation - push - projection for 2d3v simulations, 2nd order shape
+
+ Same operations as Interpolator2D2Order, the Pusher of the species and Projector2D2Order (Esirkepov)
+ */
+
+#ifndef FUSEDDYNAMICS2D2ORDER_H
+#define FUSEDDYNAMICS2D2ORDER_H
+
+#include <cmath>
+
+#include "FusedDynamics.h"
+#include "PushSchemes.h"
+
+#include "ElectroMagn.h"
+#include "Field2D.h"
+#include "Particles.h"
+#include "Species.h"
+#include "PartWall.h"
+#include "PartBoundCond.h"
+#include "Patch.h"
+
+template <class PushScheme>
+class FusedDynamicsKernel<2,2,PushScheme> : public FusedDynamics
+{
+public:
+    FusedDynamicsKernel(Params& params, double mass) : FusedDynamics(params, mass) {
+        dy_inv_   = 1.0/params.cell_length[1];
+        dy_ov_dt  = params.cell_length[1] / params.timestep;
+        one_third = 1.0/3.0;
+    }
+    ~FusedDynamicsKernel() override final {}
+
+    void operator() (ElectroMagn* EMfields, Particles &particles, Species* species, PartWalls* partWalls, Patch* patch,
+                     int ibin, int diag_flag, int ispec, double &nrj_lost) override final
+    {
+        // Static cast of the electromagnetic fields
+        Field2D* Ex2D = static_cast<Field2D*>(EMfields->Ex_);
+        Field2D* Ey2D = static_cast<Field2D*>(EMfields->Ey_);
+        Field2D* Ez2D = static_cast<Field2D*>(EMfields->Ez_);
+        Field2D* Bx2D = static_cast<Field2D*>(EMfields->Bx_m);
+        Field2D* By2D = static_cast<Field2D*>(EMfields->By_m);
+        Field2D* Bz2D = static_cast<Field2D*>(EMfields->Bz_m);
+
+        int i_domain_begin = patch->getCellStartingGlobalIndex(0);
+        int j_domain_begin = patch->getCellStartingGlobalIndex(1);
+        unsigned int bin = ibin*species->clrw;
+        std::vector<unsigned int> &b_dim = species->b_dim;
+
+        // Currents (and charge) of the bin
+        int dim1 = EMfields->dimPrim[1];
+        double *b_Jx, *b_Jy, *b_Jz, *b_rho(NULL);
+        if (diag_flag == 0) {
+            b_Jx = &(*EMfields->Jx_ )(bin*dim1);
+            b_Jy = &(*EMfields->Jy_ )(bin*(dim1+1));
+            b_Jz = &(*EMfields->Jz_ )(bin*dim1);
+        } else {
+            b_Jx  = &(*EMfields->Jx_diag(ispec) )(bin*dim1);
+            b_Jy  = &(*EMfields->Jy_diag(ispec) )(bin*(dim1+1));
+            b_Jz  = &(*EMfields->Jz_diag(ispec) )(bin*dim1);
+            b_rho = &(*EMfields->rho_diag(ispec))(bin*dim1);
+        }
+
+        double E[3], B[3], p[3];
+        double coeffxd[3], coeffyd[3];
+        // Sx0[1..3], Sy0[1..3] are the primal interpolation coefficients, reused by the projection
+        double Sx0[5], Sx1[5], Sy0[5], Sy1[5], DSx[5], DSy[5], tmpJx[5];
+        Sx0[0] = 0.;
+        Sx0[4] = 0.;
+        Sy0[0] = 0.;
+        Sy0[4] = 0.;
+        double ener_iPart(0.);
+
+        for (int ipart=species->bmin[ibin] ; ipart<species->bmax[ibin] ; ipart++ ) {
+
+            // ------------------------------------------
+            // Interpolate the fields at the old position
+            // ------------------------------------------
+            double xpn = particles.position(0, ipart)*dx_inv_;
+            double ypn = particles.position(1, ipart)*dy_inv_;
+
+            int ipo = round(xpn);
+            int id  = round(xpn+0.5);
+            int jpo = round(ypn);
+            int jd  = round(ypn+0.5);
+
+            shape2( xpn - (double)id + 0.5, coeffxd  );
+            shape2( xpn - (double)ipo,      &Sx0[1] );
+            shape2( ypn - (double)jd + 0.5, coeffyd  );
+            shape2( ypn - (double)jpo,      &Sy0[1] );
+
+            ipo -= i_domain_begin;
+            id  -= i_domain_begin;
+            jpo -= j_domain_begin;
+            jd  -= j_domain_begin;
+
+            E[0] = compute( &coeffxd[1], &Sy0[2],     Ex2D, id,  jpo );
+            E[1] = compute( &Sx0[2],     &coeffyd[1], Ey2D, ipo, jd  );
+            E[2] = compute( &Sx0[2],     &Sy0[2],     Ez2D, ipo, jpo );
+            B[0] = compute( &Sx0[2],     &coeffyd[1], Bx2D, ipo, jd  );
+            B[1] = compute( &coeffxd[1], &Sy0[2],     By2D, id,  jpo );
+            B[2] = compute( &coeffxd[1], &coeffyd[1], Bz2D, id,  jd  );
+
+            // ------------------
+            // Push the particle
+            // ------------------
+            double charge_over_mass_ = static_cast<double>(particles.charge(ipart))*one_over_mass_;
+            for ( int i = 0 ; i<3 ; i++ )
+                p[i] = particles.momentum(i, ipart);
+            double gf = PushScheme::push( p, E, B, charge_over_mass_, dts2, mass_, one_over_mass_ );
+            for ( int i = 0 ; i<3 ; i++ )
+                particles.momentum(i, ipart) = p[i];
+            particles.position(0, ipart) += dt*p[0]/gf;
+            particles.position(1, ipart) += dt*p[1]/gf;
+            PushScheme::finalize( particles, ipart );
+
+            // --------------------------------
+            // Apply wall and boundary conditions
+            // --------------------------------
+            for (int iwall=0; iwall<partWalls->size(); iwall++) {
+                if ( !(*partWalls)[iwall]->apply(particles, ipart, species, ener_iPart)) {
+                    nrj_lost += mass_ * ener_iPart;
+                }
+            }
+            if ( !species->partBoundCond->apply( particles, ipart, species, ener_iPart ) ) {
+                species->addPartInExchList( ipart );
+                nrj_lost += mass_ * ener_iPart;
+            }
+
+            if (particles.isTest) continue;
+
+            // ---------------------------------------------------
+            // Project the currents (Esirkepov), charge if diag_flag
+            // ---------------------------------------------------
+            double charge_weight = (double)(particles.charge(ipart))*particles.weight(ipart);
+            double crx_p = charge_weight*dx_ov_dt;
+            double cry_p = charge_weight*dy_ov_dt;
+            double crz_p = charge_weight*particles.momentum(2, ipart)/gf;
+
+            for (unsigned int i=0; i<5; i++) {
+                Sx1[i]   = 0.;
+                Sy1[i]   = 0.;
+                tmpJx[i] = 0.;
+            }
+
+            // Shape at the new position
+            xpn = particles.position(0, ipart) * dx_inv_;
+            int ip = round(xpn);
+            shape2( xpn - (double)ip, &Sx1[ip-ipo-i_domain_begin+1] );
+
+            ypn = particles.position(1, ipart) * dy_inv_;
+            int jp = round(ypn);
+            shape2( ypn - (double)jp, &Sy1[jp-jpo-j_domain_begin+1] );
+
+            for (unsigned int i=0; i < 5; i++) {
+                DSx[i] = Sx1[i] - Sx0[i];
+                DSy[i] = Sy1[i] - Sy0[i];
+            }
+
+            double tmp, tmp2, tmp3, tmpY;
+            int iloc;
+            ipo -= bin+2; // 5 points stencil from -2 to +2
+            jpo -= 2;
+            // i = 0
+            {
+                iloc = ipo*b_dim[1]+jpo;
+                tmp2 = 0.5*Sx1[0];
+                tmp3 =     Sx1[0];
+                b_Jz[iloc]  += crz_p * one_third * ( Sy1[0]*tmp3 );
+                tmp = 0;
+                tmpY = Sx0[0] + 0.5*DSx[0];
+                for (unsigned int j=1 ; j<5 ; j++) {
+                    tmp -= cry_p * DSy[j-1] * tmpY;
+                    b_Jy[iloc+j+ipo]  += tmp; // Size of Jy in Y is b_dim[1]+1
+                    b_Jz[iloc+j]  += crz_p * one_third * ( Sy0[j]*tmp2 + Sy1[j]*tmp3 );
+                }
+            }
+            for (unsigned int i=1 ; i<5 ; i++) {
+                iloc = (i+ipo)*b_dim[1]+jpo;
+                tmpJx[0] -= crx_p *  DSx[i-1] * (0.5*DSy[0]);
+                b_Jx[iloc]  += tmpJx[0];
+                tmp2 = 0.5*Sx1[i] + Sx0[i];
+                tmp3 = 0.5*Sx0[i] + Sx1[i];
+                b_Jz[iloc]  += crz_p * one_third * ( Sy1[0]*tmp3 );
+                tmp = 0;
+                tmpY = Sx0[i] + 0.5*DSx[i];
+                for (unsigned int j=1 ; j<5 ; j++) {
+                    tmpJx[j] -= crx_p * DSx[i-1] * (Sy0[j] + 0.5*DSy[j]);
+                    b_Jx[iloc+j]  += tmpJx[j];
+                    tmp -= cry_p * DSy[j-1] * tmpY;
+                    b_Jy[iloc+j+i+ipo]  += tmp;
+                    b_Jz[iloc+j]  += crz_p * one_third * ( Sy0[j]*tmp2 + Sy1[j]*tmp3 );
+                }
+            }
+            if (b_rho) {
+                for (unsigned int i=0 ; i<5 ; i++) {
+                    iloc = (i+ipo)*b_dim[1]+jpo;
+                    for (unsigned int j=0 ; j<5 ; j++)
+                        b_rho[iloc+j] += charge_weight * Sx1[i]*Sy1[j];
+                }
+            }
+
+        }// ipart
+    }
+
+private:
+    //! 3x3 nodes interpolation centered on (idx,idy), coeffx and coeffy point to the central coefficients
+    static inline double compute( const double* coeffx, const double* coeffy, Field2D* f, int idx, int idy ) {
+        double interp_res(0.);
+        for (int iloc=-1 ; iloc<2 ; iloc++) {
+            for (int jloc=-1 ; jloc<2 ; jloc++) {
+                interp_res += *(coeffx+iloc) * *(coeffy+jloc) * (*f)(idx+iloc,idy+jloc);
+            }
+        }
+        return interp_res;
+    }
+
+    double dy_inv_;
+    double dy_ov_dt;
+    double one_third;
+
+};
+
+#endif
+
@@ -0,0 +1,60 @@
+#ifndef FUSEDDYNAMICSFACTORY_H
+#define FUSEDDYNAMICSFACTORY_H
+
+#include "FusedDynamics.h"
+#include "FusedDynamics1D2Order.h"
+#include "FusedDynamics2D2Order.h"
+#include "PushSchemes.h"
+
+#include "Params.h"
+#include "Species.h"
+
+#include "Tools.h"
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class FusedDynamicsFactory
+//  --------------------------------------------------------------------------------------------------------------------
+class FusedDynamicsFactory {
+public:
+    //  --------------------------------------------------------------------------------------------------------------------
+    //! Create the fused kernel for the species, NULL if the separate interpolator/pusher/projector must be used
+    //! \param params Parameters
+    //! \param species Species (its pusher and ionization model must be defined)
+    //  --------------------------------------------------------------------------------------------------------------------
+    static FusedDynamics* create(Params& params, Species * species) {
+        FusedDynamics* Fused = NULL;
+
+        // Ionization needs the fields of all the bin particles before the push,
+        // the ponderomotive dynamics needs the envelope interpolation and the susceptibility deposition
+        if ( !params.fused_dynamics || species->Ionize || species->ponderomotive_dynamics )
+            return NULL;
+
+        if ( ( params.geometry == "1d3v" ) && ( params.interpolation_order == (unsigned int)2 ) ) {
+            Fused = createKernel<1,2>( params, species );
+        }
+        else if ( ( params.geometry == "2d3v" ) && ( params.interpolation_order == (unsigned int)2 ) ) {
+            Fused = createKernel<2,2>( params, species );
+        }
+
+        return Fused;
+    }
+
+private:
+    //! Instantiate the kernel with the push scheme of the species
+    template <unsigned int nDim, unsigned int order>
+    static FusedDynamics* createKernel(Params& params, Species * species) {
+        FusedDynamics* Fused = NULL;
+
+        if ( species->dynamics_type == "norm" )
+            Fused = new FusedDynamicsKernel<nDim,order,BorisScheme>( params, species->mass );
+        else if ( species->dynamics_type == "borisnr" )
+            Fused = new FusedDynamicsKernel<nDim,order,BorisNRScheme>( params, species->mass );
+        else if ( species->dynamics_type == "rrll" )
+            Fused = new FusedDynamicsKernel<nDim,order,RRLLScheme>( params, species->mass );
+
+        return Fused;
+    }
+
+};
+
+#endif
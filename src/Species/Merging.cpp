@@ -0,0 +1,257 @@
+#include "Merging.h"
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "Species.h"
+#include "Tools.h"
+
+using namespace std;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor for Merging
+// ---------------------------------------------------------------------------------------------------------------------
+Merging::Merging(Params& params, Species * species)
+{
+    nDim_particle  = params.nDim_particle;
+    clrw           = params.clrw;
+    ny             = (nDim_particle > 1) ? params.n_space[1] : 1;
+    dx_inv_        = 1.0/params.cell_length[0];
+    dy_inv_        = (nDim_particle > 1) ? 1.0/params.cell_length[1] : 0.;
+
+    max_ppc        = species->merge_max_ppc;
+    momentum_cells = species->merge_momentum_cells;
+    min_particles  = species->merge_min_particles;
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Merge the particles of all the bins, then compact the bins
+//   - bins must be contiguous and hold the particles of their clrw columns of cells (as after sorting)
+//   - x_min, y_min : lower corner of the patch
+// ---------------------------------------------------------------------------------------------------------------------
+void Merging::operator() (Particles &particles, vector<int> &bmin, vector<int> &bmax,
+                          double x_min, double y_min, double &weight_merged)
+{
+    int npart = particles.size();
+    int nbin  = bmin.size();
+    unsigned int ncells = clrw*ny;
+    int ix, iy, ip, n_particles;
+    unsigned int key, begin, end;
+
+    keep.assign(npart, 1);
+    n_removed = 0;
+
+    for (int ibin=0 ; ibin<nbin ; ibin++) {
+        n_particles = bmax[ibin]-bmin[ibin];
+        if ( n_particles <= (int)max_ppc || n_particles < (int)min_particles ) continue;
+
+        // Cell of each particle of the bin (y fastest, as in Species::count_sort_part)
+        cell_keys.resize(n_particles);
+        cell_offsets.assign(ncells+1, 0);
+        for (ip=bmin[ibin] ; ip<bmax[ibin] ; ip++) {
+            ix = floor( (particles.position(0,ip)-x_min) * dx_inv_ ) - ibin*clrw;
+            ix = min( max(ix, 0), (int)clrw-1 );
+            iy = 0;
+            if (ny > 1) {
+                iy = floor( (particles.position(1,ip)-y_min) * dy_inv_ );
+                iy = min( max(iy, 0), (int)ny-1 );
+            }
+            key = iy + ix*ny;
+            cell_keys[ip-bmin[ibin]] = key;
+            cell_offsets[key+1]++;
+        }
+        for (key=0 ; key<ncells ; key++)
+            cell_offsets[key+1] += cell_offsets[key];
+
+        // Particles sorted by cell : afterwards, cell_offsets[key] is the end of the cell key
+        cell_part.resize(n_particles);
+        for (ip=bmin[ibin] ; ip<bmax[ibin] ; ip++)
+            cell_part[ cell_offsets[cell_keys[ip-bmin[ibin]]]++ ] = ip;
+
+        begin = 0;
+        for (key=0 ; key<ncells ; key++) {
+            end = cell_offsets[key];
+            if ( end-begin > max_ppc && end-begin >= min_particles )
+                mergeCell( particles, begin, end, weight_merged );
+            begin = end;
+        }
+    }
+
+    if (n_removed == 0) return;
+
+    // Compact the bins (and the particles after the last bin if any)
+    int iw = 0, first, last = bmax.back();
+    for (int ibin=0 ; ibin<nbin ; ibin++) {
+        first = iw;
+        for (ip=bmin[ibin] ; ip<bmax[ibin] ; ip++) {
+            if (!keep[ip]) continue;
+            if (ip != iw) particles.overwrite_part(ip, iw);
+            iw++;
+        }
+        bmin[ibin] = first;
+        bmax[ibin] = iw;
+    }
+    for (ip=last ; ip<npart ; ip++)
+        particles.overwrite_part(ip, iw++);
+    particles.erase_particle_trail(iw);
+
+} // END operator()
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Merge the particles of a cell, group by group
+//   - a group gathers the particles of same charge in the same cell of the momentum grid,
+//     this grid spans the momenta of the particles of the cell
+//   - the grid is coarsened by 2 until the cell holds at most max_ppc particles,
+//     groups of 3 particles are merged on the coarsest grid (a single momentum cell)
+// ---------------------------------------------------------------------------------------------------------------------
+void Merging::mergeCell( Particles &particles, unsigned int begin, unsigned int end, double &weight_merged )
+{
+    unsigned int n_mom = momentum_cells;
+    unsigned int n_alive = end-begin;
+    unsigned int min_group, g, gend, idim, id;
+    double pmin[3], pmax[3], inv_dp[3];
+    short qmin;
+    int ip;
+    uint64_t key;
+
+    while (true) {
+        min_group = (n_mom == 1) ? min(min_particles, 3u) : min_particles;
+
+        // Momentum range and lowest charge of the remaining particles
+        for (idim=0 ; idim<3 ; idim++) {
+            pmin[idim] =  numeric_limits<double>::max();
+            pmax[idim] = -numeric_limits<double>::max();
+        }
+        qmin = numeric_limits<short>::max();
+        for (unsigned int i=begin ; i<end ; i++) {
+            ip = cell_part[i];
+            if (!keep[ip]) continue;
+            for (idim=0 ; idim<3 ; idim++) {
+                pmin[idim] = min( pmin[idim], particles.momentum(idim, ip) );
+                pmax[idim] = max( pmax[idim], particles.momentum(idim, ip) );
+            }
+            qmin = min( qmin, particles.charge(ip) );
+        }
+        for (idim=0 ; idim<3 ; idim++)
+            inv_dp[idim] = (pmax[idim] > pmin[idim]) ? (double)n_mom / (pmax[idim]-pmin[idim]) : 0.;
+
+        // Group of each particle : (charge, momentum cell)
+        group.clear();
+        for (unsigned int i=begin ; i<end ; i++) {
+            ip = cell_part[i];
+            if (!keep[ip]) continue;
+            key = particles.charge(ip) - qmin;
+            for (idim=0 ; idim<3 ; idim++) {
+                id = (unsigned int)( (particles.momentum(idim, ip)-pmin[idim]) * inv_dp[idim] );
+                key = key*n_mom + min(id, n_mom-1);
+            }
+            group.push_back( make_pair(key, ip) );
+        }
+        sort( group.begin(), group.end() );
+
+        for (g=0 ; g<group.size() ; g=gend) {
+            for (gend=g+1 ; gend<group.size() && group[gend].first==group[g].first ; gend++);
+            if ( gend-g >= min_group ) {
+                mergeGroup( particles, g, gend, weight_merged );
+                n_alive -= gend-g-2;
+            }
+        }
+
+        if ( max_ppc == 0 || n_alive <= max_ppc || n_mom == 1 ) break;
+        n_mom /= 2;
+    }
+
+} // END mergeCell
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Replace a group of particles by 2 particles a and b of weight W/2 (W total weight of the group)
+//   - kinetic energy per unit weight k : |pa| = |pb| = pt = sqrt(k(k+2))
+//   - total momentum P : pa,b = pt ( cos(w) e1 +/- sin(w) e2 ), e1 = P/|P|, cos(w) = |P|/(W pt) <= 1 (convexity)
+//   - e2 orthogonal to e1 in the plane of P and of the momentum of the first particle of the group
+//   - both particles are put at the barycenter of the group (same cell)
+// ---------------------------------------------------------------------------------------------------------------------
+void Merging::mergeGroup( Particles &particles, unsigned int begin, unsigned int end, double &weight_merged )
+{
+    int ia = group[begin].second;
+    int ib = group[begin+1].second;
+    unsigned int idim;
+    double W(0.), K(0.), P[3]={0.,0.,0.}, X[3]={0.,0.,0.}, X_old[3]={0.,0.,0.};
+    double w, p2, e1[3], e2[3];
+
+    for (unsigned int i=begin ; i<end ; i++) {
+        int ip = group[i].second;
+        w  = particles.weight(ip);
+        p2 = 0.;
+        for (idim=0 ; idim<3 ; idim++) {
+            P[idim] += w * particles.momentum(idim, ip);
+            p2      += particles.momentum(idim, ip) * particles.momentum(idim, ip);
+        }
+        // gamma-1 without cancellation
+        K += w * p2 / ( sqrt(1.+p2) + 1. );
+        for (idim=0 ; idim<nDim_particle ; idim++) {
+            X    [idim] += w * particles.position    (idim, ip);
+            X_old[idim] += w * particles.position_old(idim, ip);
+        }
+        W += w;
+    }
+    if (W <= 0.) return;
+
+    double k  = K/W;
+    double pt = sqrt( k*(k+2.) );
+    double norm_P = sqrt( P[0]*P[0] + P[1]*P[1] + P[2]*P[2] );
+    double cos_w = (pt > 0.) ? min( norm_P/(W*pt), 1. ) : 1.;
+    double sin_w = sqrt( 1. - cos_w*cos_w );
+
+    if (norm_P > 0.) {
+        for (idim=0 ; idim<3 ; idim++) e1[idim] = P[idim]/norm_P;
+    } else {
+        e1[0] = 1.; e1[1] = 0.; e1[2] = 0.;
+    }
+
+    // e2 : momentum of the first particle minus its component along e1
+    double pa_e1(0.), pa2(0.), norm_e2(0.);
+    for (idim=0 ; idim<3 ; idim++) {
+        pa_e1 += particles.momentum(idim, ia) * e1[idim];
+        pa2   += particles.momentum(idim, ia) * particles.momentum(idim, ia);
+    }
+    for (idim=0 ; idim<3 ; idim++) {
+        e2[idim] = particles.momentum(idim, ia) - pa_e1*e1[idim];
+        norm_e2 += e2[idim]*e2[idim];
+    }
+    norm_e2 = sqrt(norm_e2);
+    if ( norm_e2 <= 1.e-10*sqrt(pa2) || norm_e2 == 0. ) {
+        // momentum along e1 : any direction orthogonal to e1, from the axis the least aligned with e1
+        unsigned int iaxis = 0;
+        for (idim=1 ; idim<3 ; idim++)
+            if ( abs(e1[idim]) < abs(e1[iaxis]) ) iaxis = idim;
+        norm_e2 = 0.;
+        for (idim=0 ; idim<3 ; idim++) {
+            e2[idim] = ( (idim==iaxis) ? 1. : 0. ) - e1[iaxis]*e1[idim];
+            norm_e2 += e2[idim]*e2[idim];
+        }
+        norm_e2 = sqrt(norm_e2);
+    }
+    for (idim=0 ; idim<3 ; idim++) e2[idim] /= norm_e2;
+
+    // The 2 first particles of the group become the merged particles
+    for (idim=0 ; idim<3 ; idim++) {
+        particles.momentum(idim, ia) = pt * ( cos_w*e1[idim] + sin_w*e2[idim] );
+        particles.momentum(idim, ib) = pt * ( cos_w*e1[idim] - sin_w*e2[idim] );
+    }
+    for (idim=0 ; idim<nDim_particle ; idim++) {
+        particles.position    (idim, ia) = particles.position    (idim, ib) = X    [idim]/W;
+        particles.position_old(idim, ia) = particles.position_old(idim, ib) = X_old[idim]/W;
+    }
+    particles.weight(ia) = particles.weight(ib) = 0.5*W;
+
+    for (unsigned int i=begin+2 ; i<end ; i++)
+        keep[ group[i].second ] = 0;
+    n_removed += end-begin-2;
+    weight_merged += W;
+
+} // END mergeGroup
+
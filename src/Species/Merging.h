@@ -0,0 +1,76 @@
+/*! @file Merging.h
+
+ @brief Merging.h  merging of the macro-particles of a species, cell by cell
+
+ Vranic et al., "Particle merging algorithm for PIC codes", Comput. Phys. Commun. 191 (2015) 65
+ (http://dx.doi.org/10.1016/j.cpc.2015.01.020)
+ */
+
+#ifndef MERGING_H
+#define MERGING_H
+
+#include <stdint.h>
+#include <vector>
+#include <utility>
+
+#include "Params.h"
+#include "Particles.h"
+
+class Species;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class Merging
+//!   - the particles of a bin are grouped by cell, then by charge and cell of a cartesian grid in momentum space
+//!   - each group of at least min_particles particles is replaced by 2 particles of half the total weight,
+//!     which conserve the weight, the momentum and the kinetic energy of the group
+//!   - only the cells holding more than max_ppc particles are merged, the momentum grid is coarsened
+//!     until the cell holds at most max_ppc particles (max_ppc=0 : all the cells are merged once)
+//  --------------------------------------------------------------------------------------------------------------------
+class Merging
+{
+public:
+    //! Creator for Merging
+    Merging(Params& params, Species * species);
+    ~Merging() {}
+
+    //! Merge the particles of the bins [bmin,bmax[, compact the bins, accumulate the weight of the merged particles
+    void operator() (Particles &particles, std::vector<int> &bmin, std::vector<int> &bmax,
+                     double x_min, double y_min, double &weight_merged);
+
+private:
+    //! Merge the particles cell_part[begin..end[ of a cell
+    void mergeCell( Particles &particles, unsigned int begin, unsigned int end, double &weight_merged );
+
+    //! Replace the particles group[begin..end[ by 2 particles (stored in the 2 first ones), flag the others
+    void mergeGroup( Particles &particles, unsigned int begin, unsigned int end, double &weight_merged );
+
+    unsigned int nDim_particle;
+    unsigned int clrw;
+    //! Number of cells in y (1 in 1D)
+    unsigned int ny;
+    double dx_inv_, dy_inv_;
+
+    //! Maximum number of particles per cell (0 : no limit)
+    unsigned int max_ppc;
+    //! Number of momentum cells per direction
+    unsigned int momentum_cells;
+    //! Minimum number of particles in a momentum cell to merge them
+    unsigned int min_particles;
+
+    //! Number of particles merged into others during the current call
+    int n_removed;
+    //! 1 if the particle is kept, 0 if it was merged into another one
+    std::vector<char> keep;
+    //! Number of particles, then first particle, per cell of the bin
+    std::vector<unsigned int> cell_offsets;
+    //! Cell of each particle of the bin
+    std::vector<unsigned int> cell_keys;
+    //! Particles of the bin sorted by cell
+    std::vector<int> cell_part;
+    //! (momentum cell, particle) of the particles of a cell
+    std::vector< std::pair<uint64_t,int> > group;
+
+};
+
+#endif
+
@@ -0,0 +1,35 @@
+#ifndef MERGINGFACTORY_H
+#define MERGINGFACTORY_H
+
+#include "Merging.h"
+
+#include "Params.h"
+#include "Species.h"
+
+#include "Tools.h"
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class MergingFactory
+//  --------------------------------------------------------------------------------------------------------------------
+class MergingFactory {
+public:
+    //  --------------------------------------------------------------------------------------------------------------------
+    //! Create the merging operator of the species, NULL if the macro-particles are not merged
+    //! \param params Parameters
+    //! \param species Species (its merging parameters must be defined)
+    //  --------------------------------------------------------------------------------------------------------------------
+    static Merging* create(Params& params, Species * species) {
+        Merging* Merge = NULL;
+
+        // Test particles keep their identity
+        if ( species->merge_every == 0 || species->particles->isTest )
+            return NULL;
+
+        Merge = new Merging( params, species );
+
+        return Merge;
+    }
+
+};
+
+#endif
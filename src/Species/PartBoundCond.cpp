@@ -19,6 +19,7 @@ PartBoundCond::PartBoundCond( Params& params, Species *species, Patch* patch )
     // number of dimensions for the particle
     //!\todo (MG to JD) isn't it always 3?
     nDim_particle = params.nDim_particle;
+    rz = ( params.geometry == "3drz" );
     
     // Absolute global values
     double x_min_global = 0;
@@ -57,7 +58,7 @@ PartBoundCond::PartBoundCond( Params& params, Species *species, Patch* patch )
             y_max = min( y_max_global, patch->getDomainLocalMax(1) );
         }
         
-        if ( nDim_particle > 2 ) {
+        if ( nDim_particle > 2 && !rz ) {
             if (params.bc_em_type_z[0]=="periodic") {
                 z_min = patch->getDomainLocalMin(2);
                 z_max = patch->getDomainLocalMax(2);
@@ -83,7 +84,7 @@ PartBoundCond::PartBoundCond( Params& params, Species *species, Patch* patch )
              ||  ((params.bc_em_type_y[1]=="periodic")&&(species->bc_part_type_north!="none")) ) {
                 ERROR("For species #" << species->species_type << ", periodic EM boundary conditions require y particle BCs to be periodic.");
             }
-            if ( nDim_particle > 2 ) {
+            if ( nDim_particle > 2 && !rz ) {
                 if ( ((params.bc_em_type_z[0]=="periodic")&&(species->bc_part_type_bottom!="none"))
                  ||  ((params.bc_em_type_z[1]=="periodic")&&(species->bc_part_type_up!="none"    )) ) {
                     ERROR("For species #" << species->species_type << ", periodic EM boundary conditions require z particle BCs to be periodic.");
@@ -152,7 +153,7 @@ PartBoundCond::PartBoundCond( Params& params, Species *species, Patch* patch )
             if (patch->isSouthern()) bc_south = &thermalize_particle;
         }
         else if ( species->bc_part_type_south == "none" ) {
-            if (patch->isMaster()) MESSAGE(2,"South boundary condition for species " << species->species_type << " is 'none', which means the same as fields");
+            if (patch->isMaster() && !rz) MESSAGE(2,"South boundary condition for species " << species->species_type << " is 'none', which means the same as fields");
         }
         else {
             ERROR( "South boundary condition undefined : " << species->bc_part_type_south  );
@@ -160,13 +161,13 @@ PartBoundCond::PartBoundCond( Params& params, Species *species, Patch* patch )
         
         // North
         if ( species->bc_part_type_north == "refl" ) {
-            if (patch->isNorthern()) bc_north = &refl_particle;
+            if (patch->isNorthern()) bc_north = rz ? &refl_particle_rz : &refl_particle;
         }
         else if ( species->bc_part_type_north == "supp" ) {
-            if (patch->isNorthern()) bc_north = &supp_particle;
+            if (patch->isNorthern()) bc_north = rz ? &supp_particle_rz : &supp_particle;
         }
         else if ( species->bc_part_type_north == "stop" ) {
-            if (patch->isNorthern()) bc_north = &stop_particle;
+            if (patch->isNorthern()) bc_north = rz ? &stop_particle_rz : &stop_particle;
         }
         else if ( species->bc_part_type_north == "thermalize" ) {
             if (patch->isNorthern()) bc_north = &thermalize_particle;
@@ -179,7 +180,7 @@ PartBoundCond::PartBoundCond( Params& params, Species *species, Patch* patch )
         }
         
         
-        if ( nDim_particle > 2 ) {
+        if ( nDim_particle > 2 && !rz ) {
             if ( species->bc_part_type_bottom == "refl" ) {
                 if (z_min==z_min_global) bc_bottom = &refl_particle;
             }
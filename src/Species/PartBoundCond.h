@@ -53,7 +53,21 @@ public:
                 keep_part = (*bc_east)( particles, ipart, 0, 2.*x_max, species,nrj_iPart );
             }
         }
-        if (nDim_particle >= 2) {
+        if (rz) {
+            
+            // 3drz : the second coordinate is the distance to the axis, which is never below 0
+            double r = particles.distance_to_axis(ipart);
+            if ( r <  y_min ) {
+                keep_part = 0;
+            }
+            else if ( r >= y_max ) {
+                if (bc_north==NULL) keep_part = 0;
+                else {
+                    keep_part *= (*bc_north)( particles, ipart, 1, 2.*y_max, species,nrj_iPart );
+                }
+            }
+            
+        } else if (nDim_particle >= 2) {
             
             if ( particles.position(1, ipart) <  y_min ) {
                 if (bc_south==NULL) keep_part = 0;
@@ -111,6 +125,9 @@ private:
     //! Space dimension of a particle
     int nDim_particle;
     
+    //! 3drz geometry : conditions on the distance to the axis instead of y and z
+    bool rz;
+    
 };
 
 #endif
@@ -17,6 +17,7 @@ using namespace std;
 // Constructor for Particle
 // ---------------------------------------------------------------------------------------------------------------------
 Particles::Particles():
+c_part_max(1.2),
 tracked(false)
 {
     Position.resize(0);
@@ -35,14 +36,9 @@ tracked(false)
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::initialize(unsigned int nParticles, unsigned int nDim)
 {
-    //if (nParticles > Weight.capacity()) {
-    //    WARNING("You should increase c_part_max in specie namelist");
-    //}
-    if (Weight.size()==0) {
-        float c_part_max =1.2;
-	//float c_part_max = part.c_part_max;
-	//float c_part_max = params.species_param[0].c_part_max;
-	reserve( round( c_part_max * nParticles ), nDim );
+    // Storage grows by c_part_max, not by the std::vector doubling, to keep all columns the same capacity
+    if ( (Weight.size()==0) || (nParticles > Weight.capacity()) ) {
+        reserve( round( c_part_max * nParticles ), nDim );
     }
     
     Position.resize(nDim);
@@ -96,6 +92,8 @@ void Particles::initialize(unsigned int nParticles, Particles &part)
     
     isRadReaction=part.isRadReaction;
     
+    c_part_max=part.c_part_max;
+    
     initialize(nParticles, part.Position.size());
 }
 
@@ -127,6 +125,48 @@ void Particles::reserve( unsigned int n_part_max, int nDim )
 
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Reallocate a column to exactly n_part_max elements of storage (std::vector::reserve never shrinks)
+// ---------------------------------------------------------------------------------------------------------------------
+template <typename T>
+static void reallocate( aligned_vector<T>& column, unsigned int n_part_max )
+{
+    aligned_vector<T> tmp;
+    tmp.reserve( n_part_max );
+    tmp.assign( column.begin(), column.end() );
+    column.swap( tmp );
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Release memory if capacity exceeds c_part_max^2 times the number of particles
+//   - new capacity is c_part_max times the number of particles, as after a growth
+//   - the gap between the two thresholds avoids reallocating at each exchange when the population oscillates
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::shrink_capacity()
+{
+    unsigned int nParticles = size();
+    if ( capacity() <= c_part_max * c_part_max * nParticles + min_capacity_step )
+        return;
+    
+    unsigned int n_part_max = std::max( (unsigned int)( c_part_max * nParticles ), min_capacity_step );
+    
+    for (unsigned int i=0 ; i< Position.size() ; i++) {
+        reallocate( Position[i], n_part_max );
+        reallocate( Position_old[i], n_part_max );
+    }
+    for (unsigned int i=0 ; i< Momentum.size() ; i++) {
+        reallocate( Momentum[i], n_part_max );
+    }
+    reallocate( Weight, n_part_max );
+    reallocate( Charge, n_part_max );
+    
+    if (tracked)
+        reallocate( Id, n_part_max );
+    
+    if (isRadReaction)
+        reallocate( Chi, n_part_max );
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Reset of Particles vectors
 // ---------------------------------------------------------------------------------------------------------------------
@@ -154,6 +194,8 @@ void Particles::clear()
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::cp_particle(int ipart, Particles &dest_parts )
 {
+    dest_parts.ensure_capacity( dest_parts.size()+1 );
+    
     for (unsigned int i=0; i<Position.size(); i++) {
         dest_parts.Position[i].push_back(Position[i][ipart]);
         dest_parts.Position_old[i].push_back(Position_old[i][ipart]);
@@ -177,6 +219,8 @@ void Particles::cp_particle(int ipart, Particles &dest_parts )
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::cp_particle(int ipart, Particles &dest_parts, int dest_id )
 {
+    dest_parts.ensure_capacity( dest_parts.size()+1 );
+    
     for (unsigned int i=0; i<Position.size(); i++) {
         dest_parts.Position[i].insert( dest_parts.Position[i].begin() + dest_id, Position[i][ipart] );
         dest_parts.Position_old[i].insert( dest_parts.Position_old[i].begin() + dest_id, Position_old[i][ipart] );
@@ -196,11 +240,23 @@ void Particles::cp_particle(int ipart, Particles &dest_parts, int dest_id )
 
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Copy nPart particles starting at iPart at the end of dest_parts
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::cp_particles(int iPart, int nPart, Particles &dest_parts )
+{
+    int dest_id = dest_parts.size();
+    dest_parts.create_particles( nPart );
+    overwrite_part( iPart, dest_parts, dest_id, nPart );
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Insert nPart particles starting at ipart to dest_id in dest_parts
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::cp_particles(int iPart, int nPart, Particles &dest_parts, int dest_id )
 {
+    dest_parts.ensure_capacity( dest_parts.size()+nPart );
+    
     for (unsigned int i=0; i<Position.size(); i++) {
         dest_parts.Position[i].insert( dest_parts.Position[i].begin() + dest_id, Position[i].begin()+iPart, Position[i].begin()+iPart+nPart );
         dest_parts.Position_old[i].insert( dest_parts.Position_old[i].begin() + dest_id, Position_old[i].begin()+iPart, Position_old[i].begin()+iPart+nPart );
@@ -285,6 +341,37 @@ void Particles::erase_particle(int ipart, int npart)
     
     if (tracked)
         Id.erase( Id.begin()+ipart,Id.begin()+ipart+npart );
+    
+    if (isRadReaction)
+        Chi.erase( Chi.begin()+ipart,Chi.begin()+ipart+npart );
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Fill the holes (sorted indexes) with the last particles of [0, iEnd[
+//   - a particle is moved only once, no shift of the whole array as with erase_particle
+//   - particles order is not preserved
+//   - particles in [new end, iEnd[ are garbage, returns the new end
+// ---------------------------------------------------------------------------------------------------------------------
+int Particles::fill_holes( const std::vector<int>& holes, int iEnd )
+{
+    int nHoles = holes.size();
+    int ih_first = 0;
+    int ih_last  = nHoles-1;
+    int ipart    = iEnd-1;
+    
+    while ( ih_first <= ih_last ) {
+        if ( ipart == holes[ih_last] ) {
+            // The last particle is itself a hole
+            ih_last--;
+        }
+        else {
+            overwrite_part( ipart, holes[ih_first] );
+            ih_first++;
+        }
+        ipart--;
+    }
+    
+    return iEnd - nHoles;
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -516,6 +603,8 @@ void Particles::push_to_end(int iPart )
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::create_particle()
 {
+    ensure_capacity( size()+1 );
+    
     for (unsigned int i=0; i<Position.size(); i++) {
         Position[i].push_back(0.);
         Position_old[i].push_back(0.);
@@ -538,27 +627,94 @@ void Particles::create_particle()
 // ---------------------------------------------------------------------------------------------------------------------
 // Create nParticles new particles at the end of vectors
 // ---------------------------------------------------------------------------------------------------------------------
-//void Particles::create_particles(int nAdditionalParticles )
-//{
-//    int nParticles = size();
-//    for (unsigned int i=0; i<Position.size(); i++) {
-//        Position[i].resize(nParticles+nAdditionalParticles,0.);
-//        Position_old[i].resize(nParticles+nAdditionalParticles,0.);
-//    }
-//    
-//    for (unsigned int i=0; i<3; i++) {
-//        Momentum[i].resize(nParticles+nAdditionalParticles,0.);
-//    }
-//    Weight.resize(nParticles+nAdditionalParticles,0.);
-//    Charge.resize(nParticles+nAdditionalParticles,0);
-//    
-//    if (tracked)
-//        Id.resize(nParticles+nAdditionalParticles,0);
-//    
-//    if (isRadReaction)
-//        Chi.resize(nParticles+nAdditionalParticles,0.);
-//
-//}
+void Particles::create_particles(int nAdditionalParticles )
+{
+    int nParticles = size();
+    ensure_capacity( nParticles+nAdditionalParticles );
+    
+    for (unsigned int i=0; i<Position.size(); i++) {
+        Position[i].resize(nParticles+nAdditionalParticles,0.);
+        Position_old[i].resize(nParticles+nAdditionalParticles,0.);
+    }
+    
+    for (unsigned int i=0; i<3; i++) {
+        Momentum[i].resize(nParticles+nAdditionalParticles,0.);
+    }
+    Weight.resize(nParticles+nAdditionalParticles,0.);
+    Charge.resize(nParticles+nAdditionalParticles,0);
+    
+    if (tracked)
+        Id.resize(nParticles+nAdditionalParticles,0);
+    
+    if (isRadReaction)
+        Chi.resize(nParticles+nAdditionalParticles,0.);
+
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Pack the particles of indexes at the end of buffer, property after property
+//   - the buffer is only reallocated when it grows (its capacity is kept when it is cleared)
+//   - several blocks may be packed in the same buffer (several patches sent in one message)
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::pack( const std::vector<int>& indexes, std::vector<char>& buffer )
+{
+    int nPart = indexes.size();
+    size_t offset = buffer.size();
+    buffer.resize( offset + sizeof(int) + nPart*packedSize() );
+
+    char* b = &buffer[0] + offset;
+    memcpy( b, &nPart, sizeof(int) );
+    b += sizeof(int);
+    if (nPart==0) return;
+
+    for (unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++) {
+        double* prop = &( (*double_prop[iprop])[0] );
+        for (int i=0 ; i<nPart ; i++, b+=sizeof(double))
+            memcpy( b, &prop[indexes[i]], sizeof(double) );
+    }
+    for (unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++) {
+        short* prop = &( (*short_prop[iprop])[0] );
+        for (int i=0 ; i<nPart ; i++, b+=sizeof(short))
+            memcpy( b, &prop[indexes[i]], sizeof(short) );
+    }
+    for (unsigned int iprop=0 ; iprop<uint_prop.size() ; iprop++) {
+        unsigned int* prop = &( (*uint_prop[iprop])[0] );
+        for (int i=0 ; i<nPart ; i++, b+=sizeof(unsigned int))
+            memcpy( b, &prop[indexes[i]], sizeof(unsigned int) );
+    }
+}
+
+size_t Particles::unpack( const std::vector<char>& buffer, size_t offset )
+{
+    int nPart;
+    const char* b = &buffer[0] + offset;
+    memcpy( &nPart, b, sizeof(int) );
+    b += sizeof(int);
+    if (nPart==0) return offset + sizeof(int);
+
+    int n0 = size();
+    create_particles( nPart );
+
+    for (unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++) {
+        memcpy( &( (*double_prop[iprop])[n0] ), b, nPart*sizeof(double) );
+        b += nPart*sizeof(double);
+    }
+    for (unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++) {
+        memcpy( &( (*short_prop[iprop])[n0] ), b, nPart*sizeof(short) );
+        b += nPart*sizeof(short);
+    }
+    for (unsigned int iprop=0 ; iprop<uint_prop.size() ; iprop++) {
+        memcpy( &( (*uint_prop[iprop])[n0] ), b, nPart*sizeof(unsigned int) );
+        b += nPart*sizeof(unsigned int);
+    }
+
+    return offset + sizeof(int) + nPart*packedSize();
+}
+
+size_t Particles::packedSize() const
+{
+    return double_prop.size()*sizeof(double) + short_prop.size()*sizeof(short) + uint_prop.size()*sizeof(unsigned int);
+}
 
 // ---------------------------------------------------------------------------------------------------------------------
 // Test if ipart is in the local patch
@@ -6,9 +6,11 @@
 #include <iostream>
 #include <fstream>
 #include <vector>
+#include <algorithm>
 
 #include "Tools.h"
 #include "TimeSelection.h"
+#include "AlignedAllocator.h"
 
 class Particle;
 
@@ -38,6 +40,15 @@ public:
     //! Set capacity of Particles vectors
     void reserve( unsigned int n_part_max, int nDim );
 
+    //! Grow capacity (with c_part_max margin) if nParticles do not fit in the current storage
+    inline void ensure_capacity( unsigned int nParticles ) {
+        if ( nParticles > capacity() )
+            reserve( std::max( (unsigned int)( c_part_max * nParticles ), nParticles + min_capacity_step ), dimension() );
+    }
+
+    //! Release memory if capacity exceeds c_part_max^2 times the number of particles
+    void shrink_capacity();
+
     //! Reset Particles vectors
     void clear();
 
@@ -59,6 +70,8 @@ public:
     //! Copy particle iPart at the end of dest_parts
     void cp_particle(int iPart, Particles &dest_parts );
 
+    //! Copy nPart particles starting at iPart at the end of dest_parts
+    void cp_particles(int iPart, int nPart, Particles &dest_parts );
     //! Insert nPart particles starting at ipart to dest_id in dest_parts
     void cp_particles(int iPart, int nPart, Particles &dest_parts, int dest_id );
     //! Insert particle iPart at dest_id in dest_parts
@@ -72,6 +85,9 @@ public:
     //! Suppress all particles from iPart to the end of particle array
     void erase_particle_trail(int iPart );
 
+    //! Fill the holes (sorted indexes) with the last particles of [0, iEnd[. Returns the new end of the range
+    int fill_holes( const std::vector<int>& holes, int iEnd );
+
     //! Print parameters of particle iPart
     void print(int iPart);
 
@@ -105,6 +121,14 @@ public:
     //! Create nParticles new particles
     void create_particles(int nParticles);
 
+    //! Append to buffer a block made of the number of particles, then of the properties (double_prop, short_prop,
+    //! uint_prop) of the particles of indexes : packed MPI messages of the exchange of particles
+    void pack( const std::vector<int>& indexes, std::vector<char>& buffer );
+    //! Append the particles of the block packed at offset in buffer. Returns the offset of the next block
+    size_t unpack( const std::vector<char>& buffer, size_t offset );
+    //! Number of bytes of a packed particle
+    size_t packedSize() const;
+
     //! Test if ipart is in the local patch
     bool is_part_in_domain(int ipart, Patch* patch);
 
@@ -128,7 +152,12 @@ public:
 
     //! Method used to get the list of Particle position
     inline std::vector<double>  position(int idim) const {
-        return Position[idim];
+        return std::vector<double>( Position[idim].begin(), Position[idim].end() );
+    }
+
+    //! Distance of the Particle to the x axis (radial coordinate of the 3drz geometry)
+    inline double distance_to_axis( int ipart ) const {
+        return sqrt( Position[1][ipart]*Position[1][ipart] + Position[2][ipart]*Position[2][ipart] );
     }
 
     //! Method used to get the Particle momentum
@@ -141,7 +170,7 @@ public:
     }
       //! Method used to get the Particle momentum
     inline std::vector<double>  momentum( int idim ) const {
-        return Momentum[idim];
+        return std::vector<double>( Momentum[idim].begin(), Momentum[idim].end() );
     }
 
     //! Method used to get the Particle weight
@@ -154,7 +183,7 @@ public:
     }
     //! Method used to get the Particle weight
     inline std::vector<double>  weight() const {
-        return Weight;
+        return std::vector<double>( Weight.begin(), Weight.end() );
     }
 
     //! Method used to get the Particle charge
@@ -167,7 +196,7 @@ public:
     }
     //! Method used to get the list of Particle charges
     inline std::vector<short>  charge() const {
-        return Charge;
+        return std::vector<short>( Charge.begin(), Charge.end() );
     }
 
 
@@ -177,28 +206,36 @@ public:
     }
 
     //! Partiles properties, respect type order : all double, all short, all unsigned int
+    //! Each property is stored in its own column, aligned on SMILEI_ALIGNMENT bytes
 
     //! array containing the particle position
-    std::vector< std::vector<double> > Position;
+    std::vector< aligned_vector<double> > Position;
 
     //! array containing the particle former (old) positions
-    std::vector< std::vector<double> >Position_old;
+    std::vector< aligned_vector<double> >Position_old;
 
     //! array containing the particle moments
-    std::vector< std::vector<double> >  Momentum;
+    std::vector< aligned_vector<double> >  Momentum;
 
     //! containing the particle weight: equivalent to a charge density
-    std::vector<double> Weight;
+    aligned_vector<double> Weight;
 
     //! containing the particle weight: equivalent to a charge density
-    std::vector<double> Chi;
+    aligned_vector<double> Chi;
 
 
     //! charge state of the particle (multiples of e>0)
-    std::vector<short> Charge;
+    aligned_vector<short> Charge;
 
     //! Id of the particle
-    std::vector<unsigned int> Id;
+    aligned_vector<unsigned int> Id;
+
+    //! Capacity margin : storage grows to c_part_max times the requested number of particles
+    //!   and is released when less than 1/c_part_max^2 of it is used (hysteresis)
+    double c_part_max;
+
+    //! Minimum number of particles added to the capacity when the storage grows
+    static const unsigned int min_capacity_step = 64;
 
     // TEST PARTICLE PARAMETERS
     bool isTest;
@@ -230,7 +267,7 @@ public:
     }
     //! Method used to get the Particle Ids
     inline std::vector<unsigned int> id() const {
-        return Id;
+        return std::vector<unsigned int>( Id.begin(), Id.end() );
     }
     void sortById();
 
@@ -250,12 +287,12 @@ public:
     }
     //! Method used to get the Particle chi factor
     inline std::vector<double>  chi() const {
-        return Chi;
+        return std::vector<double>( Chi.begin(), Chi.end() );
     }
 
-    std::vector< std::vector<double>* >       double_prop;
-    std::vector< std::vector<short>* >        short_prop;
-    std::vector< std::vector<unsigned int>* > uint_prop;
+    std::vector< aligned_vector<double>* >       double_prop;
+    std::vector< aligned_vector<short>* >        short_prop;
+    std::vector< aligned_vector<unsigned int>* > uint_prop;
 
 
     //bool test_move( int iPartStart, int iPartEnd, Params& params );
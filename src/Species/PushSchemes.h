@@ -0,0 +1,105 @@
+/*! @file PushSchemes.h
+
+ @brief PushSchemes.h  single particle push schemes, inlined in the fused dynamics kernels
+
+ Each scheme is the per-particle body of the corresponding Pusher (same operations, same order)
+ */
+
+#ifndef PUSHSCHEMES_H
+#define PUSHSCHEMES_H
+
+#include <cmath>
+
+#include "Particles.h"
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Relativistic Boris scheme (see PusherBoris)
+//  --------------------------------------------------------------------------------------------------------------------
+struct BorisScheme {
+    //! Push momentum p in the fields E & B, return the new Lorentz factor
+    static inline double push( double* p, const double* E, const double* B, double charge_over_mass_, double dts2, double mass_, double one_over_mass_ )
+    {
+        double umx = p[0] + charge_over_mass_*E[0]*dts2;
+        double umy = p[1] + charge_over_mass_*E[1]*dts2;
+        double umz = p[2] + charge_over_mass_*E[2]*dts2;
+        double gf  = sqrt( 1.0 + umx*umx + umy*umy + umz*umz );
+
+        // Rotation in the magnetic field
+        double alpha = charge_over_mass_*dts2/gf;
+        double Tx    = alpha * B[0];
+        double Ty    = alpha * B[1];
+        double Tz    = alpha * B[2];
+        double Tx2   = Tx*Tx;
+        double Ty2   = Ty*Ty;
+        double Tz2   = Tz*Tz;
+        double TxTy  = Tx*Ty;
+        double TyTz  = Ty*Tz;
+        double TzTx  = Tz*Tx;
+        double inv_det_T = 1.0/(1.0+Tx2+Ty2+Tz2);
+
+        double upx = (  (1.0+Tx2-Ty2-Tz2)* umx  +      2.0*(TxTy+Tz)* umy  +      2.0*(TzTx-Ty)* umz  )*inv_det_T;
+        double upy = (      2.0*(TxTy-Tz)* umx  +  (1.0-Tx2+Ty2-Tz2)* umy  +      2.0*(TyTz+Tx)* umz  )*inv_det_T;
+        double upz = (      2.0*(TzTx+Ty)* umx  +      2.0*(TyTz-Tx)* umy  +  (1.0-Tx2-Ty2+Tz2)* umz  )*inv_det_T;
+
+        // Half-acceleration in the electric field
+        p[0] = upx + charge_over_mass_*E[0]*dts2;
+        p[1] = upy + charge_over_mass_*E[1]*dts2;
+        p[2] = upz + charge_over_mass_*E[2]*dts2;
+        return sqrt( 1.0 + p[0]*p[0] + p[1]*p[1] + p[2]*p[2] );
+    }
+
+    //! Update of the other particle properties
+    static inline void finalize( Particles &particles, int ipart ) {}
+};
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Non-relativistic Boris scheme (see PusherBorisNR)
+//  --------------------------------------------------------------------------------------------------------------------
+struct BorisNRScheme {
+    //! Push momentum p in the fields E & B, return the Lorentz factor (1)
+    static inline double push( double* p, const double* E, const double* B, double charge_over_mass_, double dts2, double mass_, double one_over_mass_ )
+    {
+        double alpha = charge_over_mass_*dts2;
+
+        // uminus = v + q/m * dt/2 * E
+        double umx = p[0] * one_over_mass_ + alpha * E[0];
+        double umy = p[1] * one_over_mass_ + alpha * E[1];
+        double umz = p[2] * one_over_mass_ + alpha * E[2];
+
+        // Rotation in the magnetic field
+        double Tx    = alpha * B[0];
+        double Ty    = alpha * B[1];
+        double Tz    = alpha * B[2];
+
+        double T2 = Tx*Tx + Ty*Ty + Tz*Tz;
+
+        double Sx = 2*Tx/(1.+T2);
+        double Sy = 2*Ty/(1.+T2);
+        double Sz = 2*Tz/(1.+T2);
+
+        // uplus = uminus + uprims x S
+        double upx = umx + umy*Sz - umz*Sy;
+        double upy = umy + umz*Sx - umx*Sz;
+        double upz = umz + umx*Sy - umy*Sx;
+
+        p[0] = mass_ * (upx + alpha*E[0]);
+        p[1] = mass_ * (upy + alpha*E[1]);
+        p[2] = mass_ * (upz + alpha*E[2]);
+        return 1.;
+    }
+
+    //! Update of the other particle properties
+    static inline void finalize( Particles &particles, int ipart ) {}
+};
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Boris scheme + classical radiation reaction (see PusherRRLL)
+//  --------------------------------------------------------------------------------------------------------------------
+struct RRLLScheme : public BorisScheme {
+    //! Update of the other particle properties
+    static inline void finalize( Particles &particles, int ipart ) {
+        particles.chi(ipart) = 0.5;
+    }
+};
+
+#endif
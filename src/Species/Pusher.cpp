@@ -10,6 +10,7 @@ Pusher::Pusher(Params& params, Species *species)
     dts2           = params.timestep/2.;
 
     nDim_          = params.nDim_particle;
+    vectorized_    = params.vectorization;
 
 }
 
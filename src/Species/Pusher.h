@@ -28,6 +28,8 @@ protected:
     double mass_;
     double one_over_mass_;
     int nDim_;
+    //! Use the vectorized kernel (see Params::vectorization)
+    bool vectorized_;
 
 };//END class
 
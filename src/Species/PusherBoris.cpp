@@ -24,9 +24,15 @@ PusherBoris::~PusherBoris()
 
 void PusherBoris::operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
 {
-    std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
-    std::vector<LocalFields> *Bpart = &(smpi->dynamics_Bpart[ithread]);
+    if (vectorized_) {
+        vectorized_push(particles, smpi, istart, iend, ithread);
+        return;
+    }
+
+    std::vector<double> *Epart = &(smpi->dynamics_Epart[ithread]);
+    std::vector<double> *Bpart = &(smpi->dynamics_Bpart[ithread]);
     std::vector<double> *gf = &(smpi->dynamics_gf[ithread]);
+    int nparts = gf->size();
 
     double charge_over_mass_ ;
     double umx, umy, umz, upx, upy, upz;
@@ -36,17 +42,16 @@ void PusherBoris::operator() (Particles &particles, SmileiMPI* smpi, int istart,
 
     for (int ipart=istart ; ipart<iend; ipart++ ) {
         charge_over_mass_ = static_cast<double>(particles.charge(ipart))*one_over_mass_;
-        //(*this)(particles, ipart, (*Epart)[ipart], (*Bpart)[ipart] , (*gf)[ipart]);
-        umx = particles.momentum(0, ipart) + charge_over_mass_*(*Epart)[ipart].x*dts2;
-        umy = particles.momentum(1, ipart) + charge_over_mass_*(*Epart)[ipart].y*dts2;
-        umz = particles.momentum(2, ipart) + charge_over_mass_*(*Epart)[ipart].z*dts2;
+        umx = particles.momentum(0, ipart) + charge_over_mass_*(*Epart)[ipart]*dts2;
+        umy = particles.momentum(1, ipart) + charge_over_mass_*(*Epart)[ipart+nparts]*dts2;
+        umz = particles.momentum(2, ipart) + charge_over_mass_*(*Epart)[ipart+2*nparts]*dts2;
         (*gf)[ipart]  = sqrt( 1.0 + umx*umx + umy*umy + umz*umz );
 
         // Rotation in the magnetic field
         alpha = charge_over_mass_*dts2/(*gf)[ipart];
-        Tx    = alpha * (*Bpart)[ipart].x;
-        Ty    = alpha * (*Bpart)[ipart].y;
-        Tz    = alpha * (*Bpart)[ipart].z;
+        Tx    = alpha * (*Bpart)[ipart];
+        Ty    = alpha * (*Bpart)[ipart+nparts];
+        Tz    = alpha * (*Bpart)[ipart+2*nparts];
         Tx2   = Tx*Tx;
         Ty2   = Ty*Ty;
         Tz2   = Tz*Tz;
@@ -60,9 +65,9 @@ void PusherBoris::operator() (Particles &particles, SmileiMPI* smpi, int istart,
         upz = (      2.0*(TzTx+Ty)* umx  +      2.0*(TyTz-Tx)* umy  +  (1.0-Tx2-Ty2+Tz2)* umz  )*inv_det_T;
 
         // Half-acceleration in the electric field
-        pxsm = upx + charge_over_mass_*(*Epart)[ipart].x*dts2;
-        pysm = upy + charge_over_mass_*(*Epart)[ipart].y*dts2;
-        pzsm = upz + charge_over_mass_*(*Epart)[ipart].z*dts2;
+        pxsm = upx + charge_over_mass_*(*Epart)[ipart]*dts2;
+        pysm = upy + charge_over_mass_*(*Epart)[ipart+nparts]*dts2;
+        pzsm = upz + charge_over_mass_*(*Epart)[ipart+2*nparts]*dts2;
         (*gf)[ipart] = sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
 
         particles.momentum(0, ipart) = pxsm;
@@ -74,3 +79,75 @@ void PusherBoris::operator() (Particles &particles, SmileiMPI* smpi, int istart,
             particles.position(i, ipart)     += dt*particles.momentum(i, ipart)/(*gf)[ipart];
     }
 }
+
+/***********************************************************************
+	Same scheme, vectorized : loops on the particles columns
+***********************************************************************/
+
+SIMD_CLONES
+void PusherBoris::vectorized_push(Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
+{
+    int nparts = smpi->dynamics_gf[ithread].size();
+
+    const double * __restrict__ Ex = &( smpi->dynamics_Epart[ithread].data()[0*nparts] );
+    const double * __restrict__ Ey = &( smpi->dynamics_Epart[ithread].data()[1*nparts] );
+    const double * __restrict__ Ez = &( smpi->dynamics_Epart[ithread].data()[2*nparts] );
+    const double * __restrict__ Bx = &( smpi->dynamics_Bpart[ithread].data()[0*nparts] );
+    const double * __restrict__ By = &( smpi->dynamics_Bpart[ithread].data()[1*nparts] );
+    const double * __restrict__ Bz = &( smpi->dynamics_Bpart[ithread].data()[2*nparts] );
+    double * __restrict__ gf = smpi->dynamics_gf[ithread].data();
+
+    double * __restrict__ momentum_x = particles.Momentum[0].data();
+    double * __restrict__ momentum_y = particles.Momentum[1].data();
+    double * __restrict__ momentum_z = particles.Momentum[2].data();
+    double * __restrict__ position_x = particles.Position[0].data();
+    const short * __restrict__ charge = particles.Charge.data();
+
+    #pragma omp simd
+    for (int ipart=istart ; ipart<iend; ipart++ ) {
+        double charge_over_mass_ = static_cast<double>(charge[ipart])*one_over_mass_;
+        double umx = momentum_x[ipart] + charge_over_mass_*Ex[ipart]*dts2;
+        double umy = momentum_y[ipart] + charge_over_mass_*Ey[ipart]*dts2;
+        double umz = momentum_z[ipart] + charge_over_mass_*Ez[ipart]*dts2;
+        double gf_minus = sqrt( 1.0 + umx*umx + umy*umy + umz*umz );
+
+        // Rotation in the magnetic field
+        double alpha = charge_over_mass_*dts2/gf_minus;
+        double Tx    = alpha * Bx[ipart];
+        double Ty    = alpha * By[ipart];
+        double Tz    = alpha * Bz[ipart];
+        double Tx2   = Tx*Tx;
+        double Ty2   = Ty*Ty;
+        double Tz2   = Tz*Tz;
+        double TxTy  = Tx*Ty;
+        double TyTz  = Ty*Tz;
+        double TzTx  = Tz*Tx;
+        double inv_det_T = 1.0/(1.0+Tx2+Ty2+Tz2);
+
+        double upx = (  (1.0+Tx2-Ty2-Tz2)* umx  +      2.0*(TxTy+Tz)* umy  +      2.0*(TzTx-Ty)* umz  )*inv_det_T;
+        double upy = (      2.0*(TxTy-Tz)* umx  +  (1.0-Tx2+Ty2-Tz2)* umy  +      2.0*(TyTz+Tx)* umz  )*inv_det_T;
+        double upz = (      2.0*(TzTx+Ty)* umx  +      2.0*(TyTz-Tx)* umy  +  (1.0-Tx2-Ty2+Tz2)* umz  )*inv_det_T;
+
+        // Half-acceleration in the electric field
+        double pxsm = upx + charge_over_mass_*Ex[ipart]*dts2;
+        double pysm = upy + charge_over_mass_*Ey[ipart]*dts2;
+        double pzsm = upz + charge_over_mass_*Ez[ipart]*dts2;
+        gf[ipart] = sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
+
+        momentum_x[ipart] = pxsm;
+        momentum_y[ipart] = pysm;
+        momentum_z[ipart] = pzsm;
+
+        // Move the particle
+        position_x[ipart] += dt*pxsm/gf[ipart];
+    }
+
+    // Move the particle in the other directions
+    for ( int i = 1 ; i<nDim_ ; i++ ) {
+        double * __restrict__ position = particles.Position[i].data();
+        const double * __restrict__ momentum = particles.Momentum[i].data();
+        #pragma omp simd
+        for (int ipart=istart ; ipart<iend; ipart++ )
+            position[ipart] += dt*momentum[ipart]/gf[ipart];
+    }
+}
@@ -21,6 +21,10 @@ public:
     //! Overloading of () operator
     virtual void operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread);
 
+private:
+    //! Vectorized version of the push on the particles [istart, iend[
+    void vectorized_push(Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread);
+
 };
 
 #endif
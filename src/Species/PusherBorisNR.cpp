@@ -22,9 +22,15 @@ PusherBorisNR::~PusherBorisNR()
 
 void PusherBorisNR::operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
 {
-    std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
-    std::vector<LocalFields> *Bpart = &(smpi->dynamics_Bpart[ithread]);
+    if (vectorized_) {
+        vectorized_push(particles, smpi, istart, iend, ithread);
+        return;
+    }
+
+    std::vector<double> *Epart = &(smpi->dynamics_Epart[ithread]);
+    std::vector<double> *Bpart = &(smpi->dynamics_Bpart[ithread]);
     std::vector<double> *gf = &(smpi->dynamics_gf[ithread]);
+    int nparts = gf->size();
 
     double charge_over_mass_ ;
     double umx, umy, umz;
@@ -41,16 +47,16 @@ void PusherBorisNR::operator() (Particles &particles, SmileiMPI* smpi, int istar
         alpha = charge_over_mass_*dts2;
 
         // uminus = v + q/m * dt/2 * E
-        umx = particles.momentum(0, ipart) * one_over_mass_ + alpha * (*Epart)[ipart].x;
-        umy = particles.momentum(1, ipart) * one_over_mass_ + alpha * (*Epart)[ipart].y;
-        umz = particles.momentum(2, ipart) * one_over_mass_ + alpha * (*Epart)[ipart].z;
+        umx = particles.momentum(0, ipart) * one_over_mass_ + alpha * (*Epart)[ipart];
+        umy = particles.momentum(1, ipart) * one_over_mass_ + alpha * (*Epart)[ipart+nparts];
+        umz = particles.momentum(2, ipart) * one_over_mass_ + alpha * (*Epart)[ipart+2*nparts];
 
 
         // Rotation in the magnetic field
 
-        Tx    = alpha * (*Bpart)[ipart].x;
-        Ty    = alpha * (*Bpart)[ipart].y;
-        Tz    = alpha * (*Bpart)[ipart].z;
+        Tx    = alpha * (*Bpart)[ipart];
+        Ty    = alpha * (*Bpart)[ipart+nparts];
+        Tz    = alpha * (*Bpart)[ipart+2*nparts];
 
         T2 = Tx*Tx + Ty*Ty + Tz*Tz;
 
@@ -69,12 +75,82 @@ void PusherBorisNR::operator() (Particles &particles, SmileiMPI* smpi, int istar
         upz = umz + umx*Sy - umy*Sx;
 
 
-        particles.momentum(0, ipart) = mass_ * (upx + alpha*(*Epart)[ipart].x);
-        particles.momentum(1, ipart) = mass_ * (upy + alpha*(*Epart)[ipart].y);
-        particles.momentum(2, ipart) = mass_ * (upz + alpha*(*Epart)[ipart].z);
+        particles.momentum(0, ipart) = mass_ * (upx + alpha*(*Epart)[ipart]);
+        particles.momentum(1, ipart) = mass_ * (upy + alpha*(*Epart)[ipart+nparts]);
+        particles.momentum(2, ipart) = mass_ * (upz + alpha*(*Epart)[ipart+2*nparts]);
+
+        // Non-relativistic : no Lorentz factor (also used by the projector)
+        (*gf)[ipart] = 1.;
 
         // Move the particle
         for ( int i = 0 ; i<nDim_ ; i++ )
             particles.position(i, ipart)     += dt*particles.momentum(i, ipart)/(*gf)[ipart];
     }
 }
+
+/***********************************************************************
+    Same scheme, vectorized : loops on the particles columns
+***********************************************************************/
+
+SIMD_CLONES
+void PusherBorisNR::vectorized_push(Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
+{
+    int nparts = smpi->dynamics_gf[ithread].size();
+
+    const double * __restrict__ Ex = &( smpi->dynamics_Epart[ithread].data()[0*nparts] );
+    const double * __restrict__ Ey = &( smpi->dynamics_Epart[ithread].data()[1*nparts] );
+    const double * __restrict__ Ez = &( smpi->dynamics_Epart[ithread].data()[2*nparts] );
+    const double * __restrict__ Bx = &( smpi->dynamics_Bpart[ithread].data()[0*nparts] );
+    const double * __restrict__ By = &( smpi->dynamics_Bpart[ithread].data()[1*nparts] );
+    const double * __restrict__ Bz = &( smpi->dynamics_Bpart[ithread].data()[2*nparts] );
+    double * __restrict__ gf = smpi->dynamics_gf[ithread].data();
+
+    double * __restrict__ momentum_x = particles.Momentum[0].data();
+    double * __restrict__ momentum_y = particles.Momentum[1].data();
+    double * __restrict__ momentum_z = particles.Momentum[2].data();
+    const short * __restrict__ charge = particles.Charge.data();
+
+    #pragma omp simd
+    for (int ipart=istart ; ipart<iend; ipart++ ) {
+
+        double charge_over_mass_ = static_cast<double>(charge[ipart])*one_over_mass_;
+        double alpha = charge_over_mass_*dts2;
+
+        // uminus = v + q/m * dt/2 * E
+        double umx = momentum_x[ipart] * one_over_mass_ + alpha * Ex[ipart];
+        double umy = momentum_y[ipart] * one_over_mass_ + alpha * Ey[ipart];
+        double umz = momentum_z[ipart] * one_over_mass_ + alpha * Ez[ipart];
+
+        // Rotation in the magnetic field
+        double Tx    = alpha * Bx[ipart];
+        double Ty    = alpha * By[ipart];
+        double Tz    = alpha * Bz[ipart];
+
+        double T2 = Tx*Tx + Ty*Ty + Tz*Tz;
+
+        double Sx = 2*Tx/(1.+T2);
+        double Sy = 2*Ty/(1.+T2);
+        double Sz = 2*Tz/(1.+T2);
+
+        // uplus = uminus + uprims x S
+        double upx = umx + umy*Sz - umz*Sy;
+        double upy = umy + umz*Sx - umx*Sz;
+        double upz = umz + umx*Sy - umy*Sx;
+
+        momentum_x[ipart] = mass_ * (upx + alpha*Ex[ipart]);
+        momentum_y[ipart] = mass_ * (upy + alpha*Ey[ipart]);
+        momentum_z[ipart] = mass_ * (upz + alpha*Ez[ipart]);
+
+        // Non-relativistic : no Lorentz factor (also used by the projector)
+        gf[ipart] = 1.;
+    }
+
+    // Move the particle
+    for ( int i = 0 ; i<nDim_ ; i++ ) {
+        double * __restrict__ position = particles.Position[i].data();
+        const double * __restrict__ momentum = particles.Momentum[i].data();
+        #pragma omp simd
+        for (int ipart=istart ; ipart<iend; ipart++ )
+            position[ipart] += dt*momentum[ipart]/gf[ipart];
+    }
+}
@@ -22,6 +22,10 @@ public:
     //! Overriding operator()
     virtual void operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread);
 
+private:
+    //! Vectorized version of the push on the particles [istart, iend[
+    void vectorized_push(Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread);
+
 };
 
 #endif
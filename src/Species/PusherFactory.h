@@ -5,6 +5,7 @@
 #include "PusherBoris.h"
 #include "PusherBorisNR.h"
 #include "PusherRRLL.h"
+#include "PusherPonderomotiveBoris.h"
 
 #include "Params.h"
 #include "Species.h"
@@ -26,7 +27,12 @@ public:
         Pusher* Push = NULL;
 
         // assign the correct Pusher to Push
-        if ( species->dynamics_type == "norm" )
+        if ( species->ponderomotive_dynamics )
+        {
+            // ponderomotive_dynamics requires dynamics_type = "norm" (checked by SpeciesFactory)
+            Push = new PusherPonderomotiveBoris( params, species );
+        }
+        else if ( species->dynamics_type == "norm" )
         {
             Push = new PusherBoris( params, species );
         }
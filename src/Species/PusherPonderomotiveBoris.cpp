@@ -0,0 +1,102 @@
+#include "PusherPonderomotiveBoris.h"
+
+#include <iostream>
+#include <cmath>
+
+#include "Species.h"
+
+#include "Particles.h"
+
+using namespace std;
+
+PusherPonderomotiveBoris::PusherPonderomotiveBoris(Params& params, Species *species)
+    : Pusher(params, species)
+{
+}
+
+PusherPonderomotiveBoris::~PusherPonderomotiveBoris()
+{
+}
+
+/***********************************************************************
+	Lorentz Force + ponderomotive force -- leap-frog (Boris) scheme
+	(loops on the particles columns, as PusherBoris::vectorized_push)
+***********************************************************************/
+
+void PusherPonderomotiveBoris::operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
+{
+    int nparts = smpi->dynamics_gf[ithread].size();
+
+    const double * __restrict__ Ex = &( smpi->dynamics_Epart[ithread].data()[0*nparts] );
+    const double * __restrict__ Ey = &( smpi->dynamics_Epart[ithread].data()[1*nparts] );
+    const double * __restrict__ Ez = &( smpi->dynamics_Epart[ithread].data()[2*nparts] );
+    const double * __restrict__ Bx = &( smpi->dynamics_Bpart[ithread].data()[0*nparts] );
+    const double * __restrict__ By = &( smpi->dynamics_Bpart[ithread].data()[1*nparts] );
+    const double * __restrict__ Bz = &( smpi->dynamics_Bpart[ithread].data()[2*nparts] );
+    const double * __restrict__ Phi      = smpi->dynamics_PHIpart[ithread].data();
+    const double * __restrict__ GradPhix = &( smpi->dynamics_GradPHIpart[ithread].data()[0*nparts] );
+    const double * __restrict__ GradPhiy = &( smpi->dynamics_GradPHIpart[ithread].data()[1*nparts] );
+    const double * __restrict__ GradPhiz = &( smpi->dynamics_GradPHIpart[ithread].data()[2*nparts] );
+    double * __restrict__ gf = smpi->dynamics_gf[ithread].data();
+
+    double * __restrict__ momentum_x = particles.Momentum[0].data();
+    double * __restrict__ momentum_y = particles.Momentum[1].data();
+    double * __restrict__ momentum_z = particles.Momentum[2].data();
+    double * __restrict__ position_x = particles.Position[0].data();
+    const short * __restrict__ charge = particles.Charge.data();
+
+    #pragma omp simd
+    for (int ipart=istart ; ipart<iend; ipart++ ) {
+        double charge_over_mass_ = static_cast<double>(charge[ipart])*one_over_mass_;
+        double charge_sq_over_mass_sq_ = charge_over_mass_*charge_over_mass_;
+
+        // Cycle-averaged Lorentz factor at the beginning of the step, ponderomotive half-acceleration
+        double gf_pond = sqrt( 1.0 + momentum_x[ipart]*momentum_x[ipart] + momentum_y[ipart]*momentum_y[ipart]
+                             + momentum_z[ipart]*momentum_z[ipart] + charge_sq_over_mass_sq_*Phi[ipart] );
+        double pond = 0.5*charge_sq_over_mass_sq_*dts2/gf_pond;
+
+        double umx = momentum_x[ipart] + charge_over_mass_*Ex[ipart]*dts2 - pond*GradPhix[ipart];
+        double umy = momentum_y[ipart] + charge_over_mass_*Ey[ipart]*dts2 - pond*GradPhiy[ipart];
+        double umz = momentum_z[ipart] + charge_over_mass_*Ez[ipart]*dts2 - pond*GradPhiz[ipart];
+        double gf_minus = sqrt( 1.0 + umx*umx + umy*umy + umz*umz + charge_sq_over_mass_sq_*Phi[ipart] );
+
+        // Rotation in the magnetic field
+        double alpha = charge_over_mass_*dts2/gf_minus;
+        double Tx    = alpha * Bx[ipart];
+        double Ty    = alpha * By[ipart];
+        double Tz    = alpha * Bz[ipart];
+        double Tx2   = Tx*Tx;
+        double Ty2   = Ty*Ty;
+        double Tz2   = Tz*Tz;
+        double TxTy  = Tx*Ty;
+        double TyTz  = Ty*Tz;
+        double TzTx  = Tz*Tx;
+        double inv_det_T = 1.0/(1.0+Tx2+Ty2+Tz2);
+
+        double upx = (  (1.0+Tx2-Ty2-Tz2)* umx  +      2.0*(TxTy+Tz)* umy  +      2.0*(TzTx-Ty)* umz  )*inv_det_T;
+        double upy = (      2.0*(TxTy-Tz)* umx  +  (1.0-Tx2+Ty2-Tz2)* umy  +      2.0*(TyTz+Tx)* umz  )*inv_det_T;
+        double upz = (      2.0*(TzTx+Ty)* umx  +      2.0*(TyTz-Tx)* umy  +  (1.0-Tx2-Ty2+Tz2)* umz  )*inv_det_T;
+
+        // Half-acceleration in the electric field and the ponderomotive force
+        double pxsm = upx + charge_over_mass_*Ex[ipart]*dts2 - pond*GradPhix[ipart];
+        double pysm = upy + charge_over_mass_*Ey[ipart]*dts2 - pond*GradPhiy[ipart];
+        double pzsm = upz + charge_over_mass_*Ez[ipart]*dts2 - pond*GradPhiz[ipart];
+        gf[ipart] = sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm + charge_sq_over_mass_sq_*Phi[ipart] );
+
+        momentum_x[ipart] = pxsm;
+        momentum_y[ipart] = pysm;
+        momentum_z[ipart] = pzsm;
+
+        // Move the particle
+        position_x[ipart] += dt*pxsm/gf[ipart];
+    }
+
+    // Move the particle in the other directions
+    for ( int i = 1 ; i<nDim_ ; i++ ) {
+        double * __restrict__ position = particles.Position[i].data();
+        const double * __restrict__ momentum = particles.Momentum[i].data();
+        #pragma omp simd
+        for (int ipart=istart ; ipart<iend; ipart++ )
+            position[ipart] += dt*momentum[ipart]/gf[ipart];
+    }
+}
@@ -0,0 +1,28 @@
+/*! @file PusherPonderomotiveBoris.h
+
+ @brief PusherPonderomotiveBoris.h  relativistic Boris pusher with the ponderomotive force of the laser envelope
+
+ */
+
+#ifndef PUSHERPONDEROMOTIVEBORIS_H
+#define PUSHERPONDEROMOTIVEBORIS_H
+
+#include "Pusher.h"
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class PusherPonderomotiveBoris
+//!   - the Lorentz factor includes the quiver motion in the laser : gamma = sqrt( 1 + u^2 + (q/m)^2 Phi )
+//!   - the ponderomotive force -(q/m)^2 grad(Phi) / (2 gamma) is added to the two half-accelerations of the Boris scheme
+//!   - Phi and grad(Phi) are those interpolated at the particle position (Interpolator::envelope)
+//  --------------------------------------------------------------------------------------------------------------------
+class PusherPonderomotiveBoris : public Pusher {
+public:
+    //! Creator for Pusher
+    PusherPonderomotiveBoris(Params& params, Species *species);
+    ~PusherPonderomotiveBoris();
+    //! Overloading of () operator
+    virtual void operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread);
+
+};
+
+#endif
@@ -3,6 +3,7 @@
 #include <cmath>
 #include <ctime>
 #include <cstdlib>
+#include <algorithm>
 
 #include <iostream>
 
@@ -12,6 +13,8 @@
 #include <cstring>
 // IDRIS
 #include "PusherFactory.h"
+#include "FusedDynamicsFactory.h"
+#include "MergingFactory.h"
 #include "IonizationFactory.h"
 #include "PartBoundCond.h"
 #include "PartWall.h"
@@ -41,21 +44,29 @@ using namespace std;
 // input: simulation parameters & Species index
 // ---------------------------------------------------------------------------------------------------------------------
 Species::Species(Params& params, Patch* patch) :
-c_part_max(1),
+c_part_max(1.2),
 dynamics_type("norm"), 
 time_frozen(0), 
 radiating(false), 
+ponderomotive_dynamics(false),
 ionization_model("none"),
+merge_every(0),
+merge_max_ppc(0),
+merge_momentum_cells(8),
+merge_min_particles(4),
+velocityProfile(3,NULL),
+temperatureProfile(3,NULL),
 particles(&particles_sorted[0]),
+Merge(NULL),
+electron_species(NULL),
 clrw(params.clrw),  
 oversize(params.oversize), 
 cell_length(params.cell_length), 
-velocityProfile(3,NULL),
-temperatureProfile(3,NULL),
-electron_species(NULL),
-nDim_particle(params.nDim_particle),
 min_loc_vec(patch->getDomainLocalMin()), 
 partBoundCond(NULL),
+Fused(NULL),
+random(params.random_seed, patch->Hindex()),
+nDim_particle(params.nDim_particle),
 min_loc(patch->getDomainLocalMin(0)) 
 {
     DEBUG(species_type);
@@ -68,6 +79,7 @@ min_loc(patch->getDomainLocalMin(0))
     initCluster(params);
     nDim_field = params.nDim_field;
     inv_nDim_field = 1./((double)nDim_field);
+    rz = ( params.geometry == "3drz" );
 
 }//END Species creator
 
@@ -92,7 +104,7 @@ void Species::initCluster(Params& params)
     // Arrays of the min and max indices of the particle bins
     bmin.resize(params.n_space[0]/clrw);
     bmax.resize(params.n_space[0]/clrw);
-    if (nDim_particle == 3){
+    if (params.nDim_field == 3){
         bmin.resize(params.n_space[0]/clrw*params.n_space[1]);
         bmax.resize(params.n_space[0]/clrw*params.n_space[1]);
     }
@@ -106,14 +118,14 @@ void Species::initCluster(Params& params)
     f_dim2 =  params.n_space[2] + 2 * oversize[2] +1;
 
     b_dim.resize(params.nDim_field, 1);
-    if (nDim_particle == 1){
+    if (params.nDim_field == 1){
         b_dim[0] =  (1 + clrw) + 2 * oversize[0];
     }
-    if (nDim_particle == 2){
+    if (params.nDim_field == 2){
         b_dim[0] =  (1 + clrw) + 2 * oversize[0]; // There is a primal number of bins.
         b_dim[1] =  f_dim1;
     }
-    if (nDim_particle == 3){
+    if (params.nDim_field == 3){
         b_dim[0] =  (1 + clrw) + 2 * oversize[0]; // There is a primal number of bins.
         b_dim[1] = f_dim1;
         b_dim[2] = f_dim2;
@@ -126,6 +138,7 @@ void Species::initCluster(Params& params)
     nrj_bc_lost = 0.;
     nrj_mw_lost = 0.;
     nrj_new_particles = 0.;
+    weight_merged = 0.;
    
 }//END initCluster
 
@@ -152,6 +165,12 @@ void Species::initOperators(Params& params, Patch* patch)
     
     // define limits for BC and functions applied and for domain decomposition
     partBoundCond = new PartBoundCond(params, this, patch);
+
+    // Fused interpolation - push - projection if available for this species
+    Fused = FusedDynamicsFactory::create(params, this);
+
+    // Merging of the macro-particles if requested
+    Merge = MergingFactory::create(params, this);
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -162,6 +181,8 @@ Species::~Species()
     delete Push;
     if (Ionize) delete Ionize;
     if (partBoundCond) delete partBoundCond;
+    if (Fused) delete Fused;
+    if (Merge) delete Merge;
     if (chargeProfile) delete chargeProfile;
     if (densityProfile) delete densityProfile;
     for (unsigned int i=0; i<velocityProfile.size(); i++)
@@ -182,6 +203,12 @@ void Species::initWeight(unsigned int nPart, unsigned int iPart, double density)
     for (unsigned  p= iPart; p<iPart+nPart; p++) {
         (*particles).weight(p) = density / nPart;
     }
+    // 3drz : a particle stands for a ring of radius r
+    if (rz) {
+        for (unsigned  p= iPart; p<iPart+nPart; p++) {
+            (*particles).weight(p) *= (*particles).distance_to_axis(p);
+        }
+    }
 }
 
 
@@ -240,7 +267,7 @@ void Species::initPosition(unsigned int nPart, unsigned int iPart, double *index
         coeff = 1./coeff;
         for (int  p=iPart; p<iPart+nPart; p++) {
             int i = p-iPart;
-            for(int idim=0; idim<nDim_particle; idim++) {
+            for(int idim=0; idim<nDim_field; idim++) {
                 (*particles).position(idim,p) = indexes[idim] + cell_length[idim] * coeff * (0.5 + i%coeff_);
                 i /= coeff_; // integer division
             }
@@ -249,12 +276,23 @@ void Species::initPosition(unsigned int nPart, unsigned int iPart, double *index
     } else if (initPosition_type == "random") {
         
         for (unsigned  p= iPart; p<iPart+nPart; p++) {
-            for (unsigned  i=0; i<nDim_particle ; i++) {
-                (*particles).position(i,p)=indexes[i]+(((double)rand() / RAND_MAX))*cell_length[i];
+            for (unsigned  i=0; i<nDim_field ; i++) {
+                (*particles).position(i,p)=indexes[i]+random.uniform()*cell_length[i];
             }
         }
         
     }
+    
+    // 3drz : the particles placed in (x,r) are spread in theta, y = r cos(theta) and z = r sin(theta)
+    if (rz) {
+        for (unsigned  p= iPart; p<iPart+nPart; p++) {
+            double r = (*particles).position(1,p);
+            double theta = (initPosition_type == "regular") ? PI2*(double)(p-iPart)/(double)nPart
+                                                            : PI2*random.uniform();
+            (*particles).position(1,p) = r*cos(theta);
+            (*particles).position(2,p) = r*sin(theta);
+        }
+    }
 }
 
 
@@ -264,7 +302,7 @@ void Species::initPosition(unsigned int nPart, unsigned int iPart, double *index
 //   - at zero (init_momentum_type = cold)
 //   - using random distribution (init_momentum_type = maxwell-juettner)
 // ---------------------------------------------------------------------------------------------------------------------
-void Species::initMomentum(unsigned int nPart, unsigned int iPart, double *temp, double *vel, vector<double>& max_jutt_cumul)
+void Species::initMomentum(unsigned int nPart, unsigned int iPart, double *temp, double *vel)
 {
     
     // average mean-momentum (used to center the distribution)
@@ -280,37 +318,42 @@ void Species::initMomentum(unsigned int nPart, unsigned int iPart, double *temp,
         
     } else if (initMomentum_type == "maxwell-juettner")
     {
-        // initialize using the Maxwell-Juettner distribution function
+        // Temperatures in units of the rest mass energy
+        double theta[3], stretch[3];
+        double theta_max = std::max( temp[0], std::max(temp[1], temp[2]) ) / mass;
+        for (unsigned int i=0; i<3 ; i++) {
+            theta[i]   = std::max( temp[i]/mass, 1.e-12*theta_max );
+            stretch[i] = sqrt( theta[i]/theta_max );
+        }
         
-        for (unsigned int p= iPart; p<iPart+nPart; p++)
+        // initialize using the Maxwell-Juettner distribution function, generalized to anisotropic temperatures :
+        //   f(p) ~ exp( -(gamma-1) sum_i (p_i/|p|)^2/theta_i ), i.e. the temperature theta_i along each axis in the
+        //   non-relativistic limit and the isotropic Maxwell-Juettner distribution when all theta_i are equal
+        // An isotropic momentum at the largest temperature, stretched along the colder axes, is accepted with
+        //   the ratio (<= 1) of the two distributions (always accepted if isotropic)
+        for (unsigned int p= iPart; p<iPart+nPart && theta_max>0.; p++)
         {
-            double Renergy=(double)rand() / RAND_MAX;
-            double phi=acos(1.0-2.0*(double)rand() / RAND_MAX);
-            double theta=2.0*M_PI*(double)rand() / RAND_MAX;
-            
-            int il=0;
-            int ir=max_jutt_cumul.size();
-            while (ir > il+1)  {
-                int im=(il+ir)/2;
-                if (Renergy > max_jutt_cumul[im]) {
-                    il=im;
-                } else {
-                    ir=im;
+            double q, u[3], accept;
+            do {
+                q = maxwellJuttnerMomentum( theta_max );
+                double cosphi = 1.0-2.0*random.uniform();
+                double sinphi = sqrt( 1.0-cosphi*cosphi );
+                double theta_ = 2.0*M_PI*random.uniform();
+                u[0] = q*cos(theta_)*sinphi*stretch[0];
+                u[1] = q*sin(theta_)*sinphi*stretch[1];
+                u[2] = q*cosphi            *stretch[2];
+                double u2 = 0., S = 0.;
+                for (unsigned int i=0; i<3 ; i++) {
+                    u2 += u[i]*u[i];
+                    S  += u[i]*u[i]/theta[i];
                 }
-
-            }
-
-            double right_w=(Renergy-max_jutt_cumul[il])/(max_jutt_cumul[il+1]);
-            double left_w=1-right_w;
+                // (gamma-1)/u^2 = 1/(gamma+1)
+                accept = exp( -S * ( 1.0/(sqrt(1.0+u2)+1.0) - 1.0/(sqrt(1.0+q*q)+1.0) ) );
+            } while ( random.uniform() >= accept );
             
-            double Ener=left_w*il*dE +right_w*(il+1)*dE;
-            double psm = sqrt(pow(1.0+Ener,2)-1.0);
-
-            (*particles).momentum(0,p) = psm*cos(theta)*sin(phi);
-            (*particles).momentum(1,p) = psm*sin(theta)*sin(phi);
-            (*particles).momentum(2,p) = psm*cos(phi);
             for (unsigned int i=0; i<3 ; i++)
             {
+                (*particles).momentum(i,p) = u[i];
                 pMean[i] += (*particles).momentum(i,p);
             }
         }//p
@@ -323,19 +366,13 @@ void Species::initMomentum(unsigned int nPart, unsigned int iPart, double *temp,
                 }
             }
         
-        for (unsigned int p= iPart; p<iPart+nPart; p++) {
-            (*particles).momentum(1,p) *= sqrt(temp[1]/temp[0]);
-            (*particles).momentum(2,p) *= sqrt(temp[2]/temp[0]);
-        }
-
-        
-    // Rectangular distribution
+        // Rectangular distribution
     } else if (initMomentum_type == "rectangular") {
         
         for (unsigned int p= iPart; p<iPart+nPart; p++) {
-            (*particles).momentum(0,p) = (2.*(double)rand() / RAND_MAX - 1.) * sqrt(temp[0]/mass);
-            (*particles).momentum(1,p) = (2.*(double)rand() / RAND_MAX - 1.) * sqrt(temp[1]/mass);
-            (*particles).momentum(2,p) = (2.*(double)rand() / RAND_MAX - 1.) * sqrt(temp[2]/mass);
+            (*particles).momentum(0,p) = (2.*random.uniform() - 1.) * sqrt(temp[0]/mass);
+            (*particles).momentum(1,p) = (2.*random.uniform() - 1.) * sqrt(temp[1]/mass);
+            (*particles).momentum(2,p) = (2.*random.uniform() - 1.) * sqrt(temp[2]/mass);
         }
     }//END if initMomentum_type
     
@@ -379,6 +416,44 @@ void Species::initMomentum(unsigned int nPart, unsigned int iPart, double *temp,
 }//END initMomentum
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Momentum modulus of a particle in an isotropic Maxwell-Juettner distribution, theta = T/mc^2 (exact rejection methods)
+//   - theta > 1 : Sobol's method (Zenitani, Phys. Plasmas 22, 042116 (2015))
+//   - otherwise : the density of the kinetic energy K, (1+K) sqrt(K(K+2)) exp(-K/theta), is bounded using
+//     sqrt(K+2) <= sqrt(2) (1+K/4) by a mixture of Gamma distributions of shapes 3/2, 5/2 and 7/2
+// Both accept more than 80% of the trials in their range
+// ---------------------------------------------------------------------------------------------------------------------
+double Species::maxwellJuttnerMomentum(double theta)
+{
+    if (theta > 1.) {
+        double u, eta;
+        do {
+            double X1 = 1.0-random.uniform();
+            double X2 = 1.0-random.uniform();
+            double X3 = 1.0-random.uniform();
+            double X4 = 1.0-random.uniform();
+            u   = -theta*log( X1*X2*X3 );
+            eta = u - theta*log( X4 );
+        } while ( eta*eta - u*u <= 1.0 );
+        return u;
+    }
+    
+    // weights of the Gamma distributions of shapes 3/2, 5/2, 7/2 in the bound
+    double w2 = 15./8.*theta, w3 = 15./16.*theta*theta;
+    double K;
+    do {
+        double r = random.uniform()*(1.0+w2+w3);
+        int k = r<1.0 ? 1 : ( r<1.0+w2 ? 2 : 3 );
+        // Gamma(k+1/2) = sum of k exponential variates + half the square of a normal variate
+        double prod = 1.0;
+        for (int i=0; i<k; i++) prod *= 1.0-random.uniform();
+        double c = cos( 2.0*M_PI*random.uniform() );
+        K = theta*( -log(prod) - log(1.0-random.uniform())*c*c );
+    } while ( random.uniform()*sqrt(2.0)*(1.0+0.25*K) >= sqrt(K+2.0) );
+    return sqrt( K*(K+2.0) );
+}
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // For all particles of the species
 //   - interpolate the fields at the particle position
@@ -387,7 +462,7 @@ void Species::initMomentum(unsigned int nPart, unsigned int iPart, double *temp,
 //   - apply the boundary conditions
 //   - increment the currents (projection)
 // ---------------------------------------------------------------------------------------------------------------------
-void Species::dynamics(double time_dual, unsigned int ispec, ElectroMagn* EMfields, Interpolator* Interp,
+void Species::dynamics(double time_dual, int itime, unsigned int ispec, ElectroMagn* EMfields, Interpolator* Interp,
                        Projector* Proj, Params &params, int diag_flag, PartWalls* partWalls, Patch* patch, SmileiMPI* smpi)
 {
     int ithread;
@@ -404,6 +479,14 @@ void Species::dynamics(double time_dual, unsigned int ispec, ElectroMagn* EMfiel
     
     // Reset list of particles to exchange
     clearExchList();
+    
+    // Random numbers of this species, patch and timestep : the Hindex of the patch changes when the window moves
+    random.setKey( params.random_seed, patch->Hindex() );
+    random.seek( Random::STREAM_DYNAMICS + ispec, itime );
+
+    // Merge the macro-particles, bin per bin, before they are moved
+    if ( Merge && itime%merge_every == 0 )
+        (*Merge)( *particles, bmin, bmax, min_loc, (nDim_particle>1) ? min_loc_vec[1] : 0., weight_merged );
 
     int tid(0);
     double ener_iPart(0.);
@@ -414,17 +497,32 @@ void Species::dynamics(double time_dual, unsigned int ispec, ElectroMagn* EMfiel
     // -------------------------------
     if (time_dual>time_frozen) { // moving particle
     
-        smpi->dynamics_resize(ithread, nDim_particle, bmax.back());
+        smpi->dynamics_resize(ithread, nDim_particle, bmax.back(), ponderomotive_dynamics);
 
         //Point to local thread dedicated buffers
         //Still needed for ionization
-        std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
+        std::vector<double> *Epart = &(smpi->dynamics_Epart[ithread]);
+        int nparts = Epart->size()/3;
+        LocalFields Eion;
 
         for (unsigned int ibin = 0 ; ibin < bmin.size() ; ibin++) {
 
+            // Interpolate, push, apply BC and project particle per particle
+            if (Fused) {
+                (*Fused)(EMfields, *particles, this, partWalls, patch, ibin, diag_flag, ispec, nrj_lost_per_thd[tid]);
+                continue;
+            }
+
             // Interpolate the fields at the particle position
             (*Interp)(EMfields, *particles, smpi, bmin[ibin], bmax[ibin], ithread );
 
+            // Ponderomotive potential of the laser envelope, susceptibility of the particles before the push
+            if (ponderomotive_dynamics) {
+                Interp->envelope(EMfields, *particles, smpi, bmin[ibin], bmax[ibin], ithread );
+                if (!(*particles).isTest)
+                    Proj->susceptibility(EMfields, *particles, mass, smpi, bmin[ibin], bmax[ibin], ithread );
+            }
+
             //Ionization
             if (Ionize){                                
                 for (iPart=bmin[ibin] ; iPart<bmax[ibin]; iPart++ ) {
@@ -434,7 +532,10 @@ void Species::dynamics(double time_dual, unsigned int ispec, ElectroMagn* EMfiel
                         Jion.x=0.0;
                         Jion.y=0.0;
                         Jion.z=0.0;
-                        (*Ionize)(*particles, iPart, (*Epart)[iPart], Jion);
+                        Eion.x = (*Epart)[iPart];
+                        Eion.y = (*Epart)[iPart+nparts];
+                        Eion.z = (*Epart)[iPart+2*nparts];
+                        (*Ionize)(*particles, iPart, Eion, Jion);
                         (*Proj)(EMfields->Jx_, EMfields->Jy_, EMfields->Jz_, *particles, iPart, Jion);
                     }
                 }
@@ -476,29 +577,9 @@ void Species::dynamics(double time_dual, unsigned int ispec, ElectroMagn* EMfiel
         for (int ithd=0 ; ithd<nrj_lost_per_thd.size() ; ithd++)
             nrj_bc_lost += nrj_lost_per_thd[tid];
 
-        // Needs to be reviewed 
+        // Move the electrons created by ionization in their bins of the electron species
         if (Ionize) {
-            for (unsigned int i=0; i < Ionize->new_electrons.size(); i++) {
-                // electron_species->(*particles).push_back(Ionize->new_electrons[i]);
-                                
-                int ibin = (int) ((Ionize->new_electrons).position(0,i) / cell_length[0]) - ( patch->getCellStartingGlobalIndex(0) + oversize[0] );
-                DEBUG("here " << ibin << " " << (Ionize->new_electrons).position(0,i)/(2*M_PI));
-
-                // Copy Ionize->new_electrons(i) in electron_species->particles at position electron_species->bmin[ibin]
-                Ionize->new_electrons.cp_particle(i, (*electron_species->particles), electron_species->bmin[ibin] );
-                                
-                // Update bins status
-                // (ugly update, memory is allocated anywhere, OK with vectors per particles parameters)
-                electron_species->bmax[ibin]++;
-                DEBUG("e- " << i << " to bin " << ibin << " (" <<bmin.size() << "," <<bmax.size()<<")" );
-                for (unsigned int ii=ibin+1; ii<bmin.size(); ii++) {
-                    electron_species->bmin[ii]++;
-                    electron_species->bmax[ii]++;
-                }
-            }
-            
-            // if (Ionize->new_electrons.size())
-            //      DEBUG("number of electrons " << electron_species->(*particles).size() << " " << );
+            electron_species->importParticles( Ionize->new_electrons );
             Ionize->new_electrons.clear();
         }
     }
@@ -508,9 +589,9 @@ void Species::dynamics(double time_dual, unsigned int ispec, ElectroMagn* EMfiel
             for (unsigned int ibin = 0 ; ibin < bmin.size() ; ibin ++) { //Loop for projection on buffer_proj
 
                 if (nDim_field==2)
-                    b_rho = &(*EMfields->rho_s[ispec])(ibin*clrw*f_dim1);    
+                    b_rho = &(*EMfields->rho_diag(ispec))(ibin*clrw*f_dim1);    
                 else if (nDim_field==1)
-                    b_rho = &(*EMfields->rho_s[ispec])(ibin*clrw);    
+                    b_rho = &(*EMfields->rho_diag(ispec))(ibin*clrw);    
                 for (iPart=bmin[ibin] ; iPart<bmax[ibin]; iPart++ ) {
                     (*Proj)(b_rho, (*particles), iPart, ibin*clrw, b_dim);
                 } //End loop on particles
@@ -522,6 +603,62 @@ void Species::dynamics(double time_dual, unsigned int ispec, ElectroMagn* EMfiel
 }//END dynamic
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Insert the particles of source_particles (e.g. electrons created by ionization) at the end of their bin
+//   - particles are bucketed per bin, the bins are moved once and their bounds shifted by a prefix sum
+//   - indexes of particles to exchange (if this species was already moved) are updated
+// ---------------------------------------------------------------------------------------------------------------------
+void Species::importParticles( Particles &source_particles )
+{
+    int npart = source_particles.size();
+    if (npart == 0) return;
+    int nbin = bmin.size();
+    int ibin, iPart, shift, n_particles, nmove, lmove;
+
+    // Bin of each new particle, number of new particles per bin
+    import_bins.resize(npart);
+    import_shifts.assign(nbin+1, 0);
+    for (int i=0 ; i<npart ; i++) {
+        ibin = (int)floor( (source_particles.position(0,i)-min_loc) * dx_inv_ ) / (int)clrw;
+        ibin = min( max(ibin, 0), nbin-1 );
+        import_bins[i] = ibin;
+        import_shifts[ibin+1]++;
+    }
+    // Shift of each bin = number of new particles in the previous bins
+    for (ibin=1 ; ibin<=nbin ; ibin++)
+        import_shifts[ibin] += import_shifts[ibin-1];
+
+    // Particles of a bin shifted by shift : the min(n_particles,shift) first ones move by max(n_particles,shift)
+    for (unsigned int i=0 ; i<indexes_of_particles_to_exchange.size() ; i++) {
+        iPart = indexes_of_particles_to_exchange[i];
+        ibin = upper_bound( bmax.begin(), bmax.end(), iPart ) - bmax.begin();
+        shift = import_shifts[ibin];
+        n_particles = bmax[ibin]-bmin[ibin];
+        if ( iPart < bmin[ibin] + min(n_particles, shift) )
+            indexes_of_particles_to_exchange[i] += max(n_particles, shift);
+    }
+    sort( indexes_of_particles_to_exchange.begin(), indexes_of_particles_to_exchange.end() );
+
+    // Make room for the new particles, bins moved from the last one
+    (*particles).create_particles(npart);
+    for (ibin=nbin-1 ; ibin>=0 ; ibin--) {
+        shift = import_shifts[ibin];
+        n_particles = bmax[ibin]-bmin[ibin];
+        nmove = min(n_particles, shift);
+        lmove = max(n_particles, shift);
+        if (nmove > 0) (*particles).overwrite_part(bmin[ibin], bmin[ibin]+lmove, nmove);
+        bmin[ibin] += shift;
+        bmax[ibin] += shift;
+    }
+
+    // Copy the new particles at the end of their bin
+    for (int i=0 ; i<npart ; i++) {
+        source_particles.overwrite_part(i, (*particles), bmax[import_bins[i]]);
+        bmax[import_bins[i]]++;
+    }
+
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Sort particles
 // ---------------------------------------------------------------------------------------------------------------------
@@ -585,70 +722,58 @@ void Species::sort_part()
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
-// Sort particles
+// Sort particles per cell (counting sort in the other particles_sorted buffer), bins bounds are recomputed
 // ---------------------------------------------------------------------------------------------------------------------
 void Species::count_sort_part(Params &params)
 {
-    unsigned int ip, npart, ixy,tot, oc, nxy, token;
-    int ix,iy;
-    double x,y;
+    unsigned int ip, npart, ixy, tot, oc, nx, ny, token;
+    int ix, iy;
 
-    nxy = params.n_space[0]*params.n_space[1];
+    // Cells are numbered column by column (y fastest), so that a bin of clrw columns is a range of cells
+    nx = params.n_space[0];
+    ny = (nDim_field > 1) ? params.n_space[1] : 1;
     token = (particles == &particles_sorted[0]);
 
-    int indices[nxy];
     npart = (*particles).size();
-    //particles_sorted = particles ;
     particles_sorted[token].initialize(npart, *particles);
 
-    for (unsigned int i=0; i < nxy ; i++) indices[i] = 0 ;
+    cell_keys.resize(npart);
+    cell_offsets.assign(nx*ny+1, 0);
 
-    // first loop counts the # of particles in each cell
-    for (ip=0; ip < npart; ip++)
-        {
-            x = (*particles).position(0,ip)-min_loc;
-            y = (*particles).position(1,ip)-min_loc_vec[1];
-
-            ix = floor(x * dx_inv_) ;
-            iy = floor(y * dy_inv_) ;
-
-            ixy = iy + ix*params.n_space[1];
-
-
-            indices[ixy] ++;
+    // first loop computes the cell of each particle and counts the # of particles in each cell
+    for (ip=0; ip < npart; ip++) {
+        ix = floor( ((*particles).position(0,ip)-min_loc) * dx_inv_ );
+        // Particles exactly on the upper border belong to the last cell
+        ix = min( max(ix, 0), (int)nx-1 );
+        iy = 0;
+        if (ny > 1) {
+            double y = rz ? (*particles).distance_to_axis(ip) : (*particles).position(1,ip);
+            iy = floor( (y-min_loc_vec[1]) * dy_inv_ );
+            iy = min( max(iy, 0), (int)ny-1 );
         }
+        ixy = iy + ix*ny;
+        cell_keys[ip] = ixy;
+        cell_offsets[ixy] ++;
+    }
 
-    // second loop convert the count array in cumulative sum
+    // second loop converts the count array in cumulative sum
     tot=0;
-    for (unsigned int ixy=0; ixy < nxy; ixy++)
-        {
-            oc = indices[ixy];
-            indices[ixy] = tot;
-            tot += oc;
-        }
-
-    //Bookmarking is not needed if normal sort is called before.
-    //bmin[0] = 0;    
-    //for (bin=0; bin<bmin.size()-1; bin++) { //Loop on the bins. 
-    //
-    //    bmin[bin+1] = indices[(bin+1)*params.n_space[1]*clrw] ;   
-    //    bmax[bin] = bmin[bin+1];   
-    //}
-    //bin = bmin.size()-1 ;
-    //bmax[bin] = npart;   
-
-    // last loop puts the particles and update the count array
-    for (ip=0; ip < npart; ip++) {
-        x = (*particles).position(0,ip)-min_loc;
-        y = (*particles).position(1,ip)-min_loc_vec[1];
-
-        ix = floor(x * dx_inv_) ;
-        iy = floor(y * dy_inv_) ;
+    for (ixy=0; ixy <= nx*ny; ixy++) {
+        oc = cell_offsets[ixy];
+        cell_offsets[ixy] = tot;
+        tot += oc;
+    }
 
-        ixy = iy + ix*params.n_space[1];
+    // Bins bounds from the cell offsets
+    for (unsigned int bin=0; bin<bmin.size(); bin++) {
+        bmin[bin] = cell_offsets[ bin   *clrw*ny];
+        bmax[bin] = cell_offsets[(bin+1)*clrw*ny];
+    }
 
-        (*particles).overwrite_part(ip, particles_sorted[token] , indices[ixy]);
-        indices[ixy]++;
+    // last loop puts the particles (stable) and updates the count array
+    for (ip=0; ip < npart; ip++) {
+        (*particles).overwrite_part(ip, particles_sorted[token] , cell_offsets[cell_keys[ip]]);
+        cell_offsets[cell_keys[ip]]++;
     }
 
     particles = &particles_sorted[token] ;
@@ -696,18 +821,34 @@ int Species::createParticles(vector<unsigned int> n_space_to_create, Params& par
     int npart_effective = 0;
     double remainder, nppc;
     
+    // Coordinates of the cell centers : each profile is evaluated once on arrays of cells
+    // (a single call of the python function when it accepts numpy arrays)
+    unsigned int ncells = n_space_to_create[0]*n_space_to_create[1]*n_space_to_create[2];
+    vector<vector<double> > x_cells(nDim_field, vector<double>(ncells));
+    unsigned int icell = 0;
     for (unsigned int i=0; i<n_space_to_create[0]; i++) {
         for (unsigned int j=0; j<n_space_to_create[1]; j++) {
             for (unsigned int k=0; k<n_space_to_create[2]; k++) {
-                n_part_in_cell(i,j,k) = 0.;
-                
-                vector<double> x_cell(3,0);
-                x_cell[0] = cell_position[0] + (i+0.5)*cell_length[0];
-                x_cell[1] = cell_position[1] + (j+0.5)*cell_length[1];
-                x_cell[2] = cell_position[2] + (k+0.5)*cell_length[2];
-                
-                // Obtain the number of particles per cell
-                nppc = ppcProfile->valueAt(x_cell);
+                unsigned int ijk[3] = {i, j, k};
+                for (unsigned int idim=0; idim<nDim_field; idim++)
+                    x_cells[idim][icell] = cell_position[idim] + (ijk[idim]+0.5)*cell_length[idim];
+                icell++;
+            }
+        }
+    }
+    
+    // Obtain the number of particles per cell
+    vector<double> nppc_cells(ncells);
+    ppcProfile->valuesAt(x_cells, nppc_cells);
+    
+    // Cells which contain particles, and their coordinates
+    vector<unsigned int> populated;
+    populated.reserve(ncells);
+    icell = 0;
+    for (unsigned int i=0; i<n_space_to_create[0]; i++) {
+        for (unsigned int j=0; j<n_space_to_create[1]; j++) {
+            for (unsigned int k=0; k<n_space_to_create[2]; k++) {
+                nppc = nppc_cells[icell++];
                 
                 n_part_in_cell(i,j,k) = floor(nppc);
                 // if nb of particle per cell is not an integer value
@@ -728,36 +869,60 @@ int Species::createParticles(vector<unsigned int> n_space_to_create, Params& par
                     continue;
                 }
                 
-                // assign charge its correct value in the cell
-                charge(i,j,k) = chargeProfile->valueAt(x_cell);
-                if( charge(i,j,k)>max_charge ) max_charge=charge(i,j,k);
-                // assign density its correct value in the cell
-                density(i,j,k) = densityProfile->valueAt(x_cell);
-                if(density(i,j,k)!=0. && densityProfileType=="charge") {
-                    if(charge(i,j,k)==0.) ERROR("Encountered non-zero charge density and zero charge at the same location");
-                    density(i,j,k) /= charge(i,j,k);
-                }
-                density(i,j,k) = abs(density(i,j,k));
-                
-                // for non-zero density define temperature & mean-velocity and increment the nb of particles
-                if (density(i,j,k)!=0.0) {
-                    
-                    // assign the temperature & mean-velocity their correct value in the cell
-                    for (unsigned int m=0; m<3; m++) {
-                        temperature[m](i,j,k) = temperatureProfile[m]->valueAt(x_cell);
-                        //MESSAGE("temp 1 :" <<  temperature[m](i,j,k))
-                        velocity[m](i,j,k) = velocityProfile[m]->valueAt(x_cell);
-                    }
-                    
-                    // increment the effective number of particle by n_part_in_cell(i,j,k)
-                    // for each cell with as non-zero density
-                    npart_effective += n_part_in_cell(i,j,k);
-                    
-                }//ENDif non-zero density
-                
-            }//i
-        }//j
-    }//k end the loop on all cells
+                populated.push_back(icell-1);
+            }
+        }
+    }
+    
+    unsigned int npopulated = populated.size();
+    vector<vector<double> > x_populated(nDim_field, vector<double>(npopulated));
+    for (unsigned int idim=0; idim<nDim_field; idim++)
+        for (unsigned int ipop=0; ipop<npopulated; ipop++)
+            x_populated[idim][ipop] = x_cells[idim][populated[ipop]];
+    
+    // Evaluate the other profiles in the populated cells
+    vector<double> charge_cells(npopulated), density_cells(npopulated), temperature_cells[3], velocity_cells[3];
+    chargeProfile ->valuesAt(x_populated, charge_cells );
+    densityProfile->valuesAt(x_populated, density_cells);
+    for (unsigned int m=0; m<3; m++) {
+        temperature_cells[m].resize(npopulated);
+        velocity_cells   [m].resize(npopulated);
+        temperatureProfile[m]->valuesAt(x_populated, temperature_cells[m]);
+        velocityProfile   [m]->valuesAt(x_populated, velocity_cells   [m]);
+    }
+    
+    for (unsigned int ipop=0; ipop<npopulated; ipop++) {
+        icell = populated[ipop];
+        unsigned int k = icell % n_space_to_create[2];
+        unsigned int j = (icell / n_space_to_create[2]) % n_space_to_create[1];
+        unsigned int i = icell / (n_space_to_create[2]*n_space_to_create[1]);
+        
+        // assign charge its correct value in the cell
+        charge(i,j,k) = charge_cells[ipop];
+        if( charge(i,j,k)>max_charge ) max_charge=charge(i,j,k);
+        // assign density its correct value in the cell
+        density(i,j,k) = density_cells[ipop];
+        if(density(i,j,k)!=0. && densityProfileType=="charge") {
+            if(charge(i,j,k)==0.) ERROR("Encountered non-zero charge density and zero charge at the same location");
+            density(i,j,k) /= charge(i,j,k);
+        }
+        density(i,j,k) = abs(density(i,j,k));
+        
+        // for non-zero density define temperature & mean-velocity and increment the nb of particles
+        if (density(i,j,k)!=0.0) {
+            
+            // assign the temperature & mean-velocity their correct value in the cell
+            for (unsigned int m=0; m<3; m++) {
+                temperature[m](i,j,k) = temperature_cells[m][ipop];
+                velocity[m](i,j,k) = velocity_cells[m][ipop];
+            }
+            
+            // increment the effective number of particle by n_part_in_cell(i,j,k)
+            // for each cell with as non-zero density
+            npart_effective += n_part_in_cell(i,j,k);
+            
+        }//ENDif non-zero density
+    }//end the loop on the populated cells
     
     // defines npart_effective for the Species & create the corresponding particles
     // -----------------------------------------------------------------------
@@ -773,38 +938,6 @@ int Species::createParticles(vector<unsigned int> n_space_to_create, Params& par
     int n_existing_particles = (*particles).size();
     (*particles).initialize(n_existing_particles+npart_effective, nDim_particle);
     
-    // define Maxwell-Juettner related quantities
-    // ------------------------------------------
-    
-    // Maxwell-Juettner cumulative function (array)
-    std::vector<double> max_jutt_cumul;
-    
-    /*
-    if (initMomentum_type=="maxwell-juettner") {
-        //! \todo{Pass this parameters in a code constants class (MG)}
-        nE     = 20000;
-        muEmax = 20.0;
-        
-        max_jutt_cumul.resize(nE);
-        double mu=mass/temperature[0];
-        //double mu=mass/temperature[m](i,j,k);
-        double Emax=muEmax/mu;
-        dE=Emax/nE;
-        
-        double fl=0;
-        double fr=0;
-        max_jutt_cumul[0]=0.0;
-        for (unsigned  i=1; i<nE; i++ ) {
-            //! \todo{this is just the isotropic case, generalise to non-isotropic (MG)}
-            fr=(1+i*dE)*sqrt(pow(1.0+i*dE,2)-1.0) * exp(-mu*i*dE);
-            max_jutt_cumul[i]=max_jutt_cumul[i-1] + 0.5*dE*(fr+fl);
-            fl=fr;
-        }
-        for (unsigned int i=0; i<nE; i++) max_jutt_cumul[i]/=max_jutt_cumul[nE-1];
-        
-    }
-    */
-    
     // Initialization of the particles properties
     // ------------------------------------------
     unsigned int nPart;
@@ -813,6 +946,11 @@ int Species::createParticles(vector<unsigned int> n_space_to_create, Params& par
     double *temp=new double[3];
     double *vel=new double[3];
     
+    // Random numbers of the initialization : keyed by the first global cell of the patch, which also
+    // distinguishes the patches created at the same Hindex when the window moves
+    random.setKey( params.random_seed, patch->Hindex() );
+    random.seek( Random::STREAM_INIT + speciesNumber, patch->getCellStartingGlobalIndex(0) + oversize[0] );
+    
     // start a loop on all cells
     
     //bmin[bin] point to begining of bin (first particle)
@@ -826,33 +964,6 @@ int Species::createParticles(vector<unsigned int> n_space_to_create, Params& par
                 // initialize particles in meshes where the density is non-zero
                 if (density(i,j,k)>0) {
                     
-                    if (initMomentum_type=="maxwell-juettner") {
-                        
-                        // Computes the cumulative MJ distribution only when needed
-                        // --------------------------------------------------------
-                        if ((max_jutt_cumul.size()==0)||(temperatureProfile[0]->profileName!="constant")) {
-                            //! \todo{Pass this parameters in a code constants class (MG)}
-                            nE     = 20000;
-                            muEmax = 20.0;
-                            
-                            max_jutt_cumul.resize(nE);
-                            double mu=mass/temperature[0](i,j,k); // For Temperature profile
-                            double Emax=muEmax/mu;
-                            dE=Emax/nE;
-                            
-                            double fl=0;
-                            double fr=0;
-                            max_jutt_cumul[0]=0.0;
-                            for (unsigned int l=1; l<nE; l++ ) {
-                                //! \todo{this is just the isotropic case, generalise to non-isotropic (MG)}
-                                fr=(1.+l*dE)*sqrt(pow(1.0+l*dE,2)-1.0) * exp(-mu*l*dE);
-                                max_jutt_cumul[l]=max_jutt_cumul[l-1] + 0.5*dE*(fr+fl);
-                                fl=fr;
-                            }
-                            for (unsigned int l=0; l<nE; l++) max_jutt_cumul[l]/=max_jutt_cumul[nE-1];
-                        }
-                    }
-                    
                     temp[0] = temperature[0](i,j,k);
                     vel[0]  = velocity[0](i,j,k);
                     temp[1] = temperature[1](i,j,k);
@@ -862,16 +973,16 @@ int Species::createParticles(vector<unsigned int> n_space_to_create, Params& par
                     nPart = n_part_in_cell(i,j,k);
                     
                     indexes[0]=i*cell_length[0]+cell_position[0];
-                    if (nDim_particle > 1) {
+                    if (nDim_field > 1) {
                         indexes[1]=j*cell_length[1]+cell_position[1];
-                        if (nDim_particle > 2) {
+                        if (nDim_field > 2) {
                             indexes[2]=k*cell_length[2]+cell_position[2];
-                        }//nDim_particle > 2
-                    }//nDim_particle > 1
+                        }//nDim_field > 2
+                    }//nDim_field > 1
                     
                     initPosition(nPart, iPart, indexes);
                     
-                    initMomentum(nPart,iPart, temp, vel, max_jutt_cumul);
+                    initMomentum(nPart,iPart, temp, vel);
                     
                     initWeight(nPart, iPart, density(i,j,k));
                     initCharge(nPart, iPart, charge(i,j,k));
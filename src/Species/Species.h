@@ -15,12 +15,15 @@
 #include "ElectroMagn.h"
 #include "Profile.h"
 #include "SpeciesMPI.h"
+#include "Random.h"
 
 class ElectroMagn;
 class Pusher;
 class Interpolator;
 class Projector;
 class PartBoundCond;
+class FusedDynamics;
+class Merging;
 class PartWalls;
 class Field3D;
 class Patch;
@@ -84,6 +87,9 @@ public:
     //! logical true if particles radiate
     bool radiating;
     
+    //! logical true if particles feel the ponderomotive force of the laser envelope and contribute to its susceptibility
+    bool ponderomotive_dynamics;
+    
     //! Boundary conditions for particules
     std::string bc_part_type_west;
     std::string bc_part_type_east;
@@ -95,6 +101,15 @@ public:
     //! Ionization model per Specie (tunnel)
     std::string ionization_model;
     
+    //! Number of timesteps between two mergings of the macro-particles (0 : no merging)
+    unsigned int merge_every;
+    //! Maximum number of macro-particles per cell above which a cell is merged (0 : all cells are merged)
+    unsigned int merge_max_ppc;
+    //! Number of momentum cells per direction used to group the particles to merge
+    unsigned int merge_momentum_cells;
+    //! Minimum number of particles in a momentum cell to merge them
+    unsigned int merge_min_particles;
+    
     //! Type of density profile ("nb" or "charge")
     std::string densityProfileType;
     
@@ -133,7 +148,7 @@ public:
     }
     
     //! Method calculating the Particle dynamics (interpolation, pusher, projection)
-    virtual void dynamics(double time, unsigned int ispec, ElectroMagn* EMfields, Interpolator* interp,
+    virtual void dynamics(double time, int itime, unsigned int ispec, ElectroMagn* EMfields, Interpolator* interp,
                           Projector* proj, Params &params, int diag_flag,
                           PartWalls* partWalls, Patch* patch, SmileiMPI* smpi);
 
@@ -141,7 +156,7 @@ public:
     void initPosition(unsigned int, unsigned int, double *);
     
     //! Method used to initialize the Particle 3d momentum in a given cell
-    void initMomentum(unsigned int, unsigned int, double *, double *, std::vector<double>&);
+    void initMomentum(unsigned int, unsigned int, double *, double *);
     
     //! Method used to initialize the Particle weight (equivalent to a charge density) in a given cell
     void initWeight(unsigned int,  unsigned int, double);
@@ -152,10 +167,14 @@ public:
     //! Maximum charge at initialization
     double max_charge;
 
-    //! Method used to sort particles
+    //! Method used to sort particles (incremental, keeps particles binned by clrw columns)
     void sort_part();
+    //! Method used to sort particles per cell (full counting sort, recomputes bmin/bmax)
     void count_sort_part(Params& param);
 
+    //! Method used to insert particles (e.g. created by ionization) in their bins
+    void importParticles( Particles &source_particles );
+
     void updateMvWinLimits(double x_moved);
 
     //! Vector containing all Particles of the considered Species
@@ -166,6 +185,9 @@ public:
     //! Ionization method
     Ionization* Ionize;
     
+    //! Merging of the macro-particles (NULL if no merging)
+    Merging* Merge;
+    
     //! Pointer to the species where field-ionized electrons go
     Species *electron_species;
     //! Index of the species where field-ionized electrons go
@@ -214,10 +236,12 @@ public:
     double getLostNrjMW() const {return mass*nrj_mw_lost;}
     
     double getNewParticlesNRJ() const {return mass*nrj_new_particles;}
+    double getMergedWeight() const {return weight_merged;}
     void reinitDiags() { 
     nrj_bc_lost = 0;
     nrj_mw_lost = 0;
     nrj_new_particles = 0;
+    weight_merged = 0;
     }
     inline void storeNRJlost( double nrj ) { nrj_mw_lost = nrj; };
 
@@ -250,16 +274,24 @@ public:
     //! Particles pusher (change momentum & change position)
     Pusher* Push;
 
+    //! Fused interpolation - push - projection kernel (NULL if the separate operators are used)
+    FusedDynamics* Fused;
+
+    //! Random numbers of the species in this patch (initialization, ionization, thermalizing boundaries)
+    Random random;
+
 private:    
-    //! Number of steps for Maxwell-Juettner cumulative function integration
-    //! \todo{Put in a code constant class}
-    unsigned int nE;
-    
-    //! Parameter used when defining the Maxwell-Juettner function (corresponds to a Maximum energy)
-    double muEmax;
-    
-    //! Parameter used when defining the Maxwell-Juettner function (corresponds to a discretization step in energy)
-    double dE;
+    //! Cell index of each particle, buffer of count_sort_part
+    std::vector<unsigned int> cell_keys;
+    //! Number of particles, then first particle, per cell, buffer of count_sort_part
+    std::vector<unsigned int> cell_offsets;
+    //! Bin of each imported particle, buffer of importParticles
+    std::vector<int> import_bins;
+    //! Number of imported particles in the previous bins, buffer of importParticles
+    std::vector<int> import_shifts;
+
+    //! Momentum modulus drawn from an isotropic Maxwell-Juettner distribution of temperature theta (units of mc^2)
+    double maxwellJuttnerMomentum(double theta);
     
     //! Number of spatial dimension for the particles
     unsigned int nDim_particle;
@@ -270,6 +302,9 @@ private:
     //! Inverse of the number of spatial dimension for the fields
     double inv_nDim_field;
     
+    //! 3drz geometry : the particles are placed in (x,r) and spread in theta, their weight is proportional to r
+    bool rz;
+    
     //! Local minimum of MPI domain
     double min_loc;
 
@@ -282,6 +317,8 @@ private:
     double nrj_mw_lost;
     //! Accumulate nrj added with new particles
     double nrj_new_particles;
+    //! Accumulate weight of the merged particles
+    double weight_merged;
 };
 
 #endif
@@ -72,6 +72,11 @@ public:
         }
         
         PyTools::extract("c_part_max",thisSpecies->c_part_max,"Species",ispec);
+        if (thisSpecies->c_part_max < 1.) {
+            ERROR("For species '" << species_type << "' c_part_max must be >= 1");
+        }
+        thisSpecies->particles_sorted[0].c_part_max = thisSpecies->c_part_max;
+        thisSpecies->particles_sorted[1].c_part_max = thisSpecies->c_part_max;
         
         if( !PyTools::extract("mass",thisSpecies->mass ,"Species",ispec) ) {
             ERROR("For species '" << species_type << "' mass not defined.");
@@ -88,12 +93,27 @@ public:
             thisSpecies->radiating=true;
         }
         
+        PyTools::extract("ponderomotive_dynamics",thisSpecies->ponderomotive_dynamics ,"Species",ispec);
+        if (thisSpecies->ponderomotive_dynamics) {
+            if (!params.envelope_model)
+                ERROR("For species '" << species_type << "', ponderomotive_dynamics requires a Laser with envelope = True");
+            if (thisSpecies->dynamics_type!="norm")
+                ERROR("For species '" << species_type << "', ponderomotive_dynamics requires dynamics_type = 'norm'");
+        }
+        
         if (!PyTools::extract("bc_part_type_west",thisSpecies->bc_part_type_west,"Species",ispec) )
             ERROR("For species '" << species_type << "', bc_part_type_west not defined");
         if (!PyTools::extract("bc_part_type_east",thisSpecies->bc_part_type_east,"Species",ispec) )
             ERROR("For species '" << species_type << "', bc_part_type_east not defined");
         
-        if (params.nDim_particle>1) {
+        if (params.geometry=="3drz") {
+            // the lower border in r is the axis, which the particles do not cross
+            thisSpecies->bc_part_type_south = "none";
+            if (!PyTools::extract("bc_part_type_north",thisSpecies->bc_part_type_north,"Species",ispec) )
+                ERROR("For species '" << species_type << "', bc_part_type_north not defined");
+            if (thisSpecies->bc_part_type_north=="thermalize")
+                ERROR("For species '" << species_type << "', bc_part_type_north = 'thermalize' is not available in 3drz");
+        } else if (params.nDim_particle>1) {
             if (!PyTools::extract("bc_part_type_south",thisSpecies->bc_part_type_south,"Species",ispec) )
                 ERROR("For species '" << species_type << "', bc_part_type_south not defined");
             if (!PyTools::extract("bc_part_type_north",thisSpecies->bc_part_type_north,"Species",ispec) )
@@ -161,6 +181,26 @@ public:
             if( thisSpecies->atomic_number==0 ) {
                 ERROR("For species '" << species_type << "' undefined atomic_number (required for ionization)");
             }
+            
+            if( params.geometry=="3drz" ) {
+                ERROR("For species '" << species_type << "' ionization is not available in 3drz");
+            }
+        }
+        
+        // Manage the merging parameters
+        PyTools::extract("merge_every", thisSpecies->merge_every, "Species",ispec);
+        if( thisSpecies->merge_every > 0 ) {
+            if( params.geometry=="3drz" )
+                ERROR("For species '" << species_type << "' merging is not available in 3drz");
+            PyTools::extract("merge_max_ppc", thisSpecies->merge_max_ppc, "Species",ispec);
+            PyTools::extract("merge_momentum_cells", thisSpecies->merge_momentum_cells, "Species",ispec);
+            PyTools::extract("merge_min_particles", thisSpecies->merge_min_particles, "Species",ispec);
+            if( thisSpecies->merge_momentum_cells < 1 )
+                ERROR("For species '" << species_type << "' merge_momentum_cells must be at least 1");
+            if( thisSpecies->merge_min_particles < 3 )
+                ERROR("For species '" << species_type << "' merge_min_particles must be at least 3");
+            if( thisSpecies->merge_max_ppc > 0 && thisSpecies->merge_max_ppc < 2 )
+                ERROR("For species '" << species_type << "' merge_max_ppc must be 0 or at least 2");
         }
         
         // Species geometry
@@ -176,29 +216,29 @@ public:
         if( ok1 ) thisSpecies->densityProfileType = "nb";
         if( ok2 ) thisSpecies->densityProfileType = "charge";
         
-        thisSpecies->densityProfile = new Profile(profile1, params.nDim_particle, thisSpecies->densityProfileType+"_density "+species_type);
+        thisSpecies->densityProfile = new Profile(profile1, params.nDim_field, thisSpecies->densityProfileType+"_density "+species_type);
         
         // Number of particles per cell
         if( !PyTools::extract_pyProfile("n_part_per_cell", profile1, "Species", ispec))
             ERROR("For species '" << species_type << "', n_part_per_cell not found or not understood");
-        thisSpecies->ppcProfile = new Profile(profile1, params.nDim_particle, "n_part_per_cell "+species_type);
+        thisSpecies->ppcProfile = new Profile(profile1, params.nDim_field, "n_part_per_cell "+species_type);
         
         // Charge
         if( !PyTools::extract_pyProfile("charge", profile1, "Species", ispec))
             ERROR("For species '" << species_type << "', charge not found or not understood");
-        thisSpecies->chargeProfile = new Profile(profile1, params.nDim_particle, "charge "+species_type);
+        thisSpecies->chargeProfile = new Profile(profile1, params.nDim_field, "charge "+species_type);
         
         // Mean velocity
         PyTools::extract3Profiles("mean_velocity", ispec, profile1, profile2, profile3);
-        thisSpecies->velocityProfile[0] = new Profile(profile1, params.nDim_particle, "mean_velocity[0] "+species_type);
-        thisSpecies->velocityProfile[1] = new Profile(profile2, params.nDim_particle, "mean_velocity[1] "+species_type);
-        thisSpecies->velocityProfile[2] = new Profile(profile3, params.nDim_particle, "mean_velocity[2] "+species_type);
+        thisSpecies->velocityProfile[0] = new Profile(profile1, params.nDim_field, "mean_velocity[0] "+species_type);
+        thisSpecies->velocityProfile[1] = new Profile(profile2, params.nDim_field, "mean_velocity[1] "+species_type);
+        thisSpecies->velocityProfile[2] = new Profile(profile3, params.nDim_field, "mean_velocity[2] "+species_type);
         
         // Temperature
         PyTools::extract3Profiles("temperature", ispec, profile1, profile2, profile3);
-        thisSpecies->temperatureProfile[0] = new Profile(profile1, params.nDim_particle, "temperature[0] "+species_type);
-        thisSpecies->temperatureProfile[1] = new Profile(profile2, params.nDim_particle, "temperature[1] "+species_type);
-        thisSpecies->temperatureProfile[2] = new Profile(profile3, params.nDim_particle, "temperature[2] "+species_type);
+        thisSpecies->temperatureProfile[0] = new Profile(profile1, params.nDim_field, "temperature[0] "+species_type);
+        thisSpecies->temperatureProfile[1] = new Profile(profile2, params.nDim_field, "temperature[1] "+species_type);
+        thisSpecies->temperatureProfile[2] = new Profile(profile3, params.nDim_field, "temperature[2] "+species_type);
         
         
         // CALCULATE USEFUL VALUES
@@ -276,9 +316,12 @@ public:
         newSpecies->initPosition_type     = species->initPosition_type;
         newSpecies->initMomentum_type     = species->initMomentum_type;
         newSpecies->c_part_max            = species->c_part_max;
+        newSpecies->particles_sorted[0].c_part_max = species->c_part_max;
+        newSpecies->particles_sorted[1].c_part_max = species->c_part_max;
         newSpecies->mass                  = species->mass;
         newSpecies->time_frozen           = species->time_frozen;
         newSpecies->radiating             = species->radiating;
+        newSpecies->ponderomotive_dynamics = species->ponderomotive_dynamics;
         newSpecies->bc_part_type_west     = species->bc_part_type_west;
         newSpecies->bc_part_type_east     = species->bc_part_type_east;
         newSpecies->bc_part_type_south    = species->bc_part_type_south;
@@ -291,6 +334,10 @@ public:
         newSpecies->thermalMomentum       = species->thermalMomentum;
         newSpecies->atomic_number         = species->atomic_number;
         newSpecies->ionization_model      = species->ionization_model;
+        newSpecies->merge_every           = species->merge_every;
+        newSpecies->merge_max_ppc         = species->merge_max_ppc;
+        newSpecies->merge_momentum_cells  = species->merge_momentum_cells;
+        newSpecies->merge_min_particles   = species->merge_min_particles;
         newSpecies->densityProfileType    = species->densityProfileType;
         newSpecies->densityProfile        = new Profile(species->densityProfile);
         newSpecies->ppcProfile            = new Profile(species->ppcProfile);
@@ -0,0 +1,72 @@
+#ifndef ALIGNEDALLOCATOR_H
+#define ALIGNEDALLOCATOR_H
+
+#include <cstdlib>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+//! Default alignment (in bytes) of the particles and fields data : one cache line, one AVX-512 register
+#define SMILEI_ALIGNMENT 64
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class AlignedAllocator : std allocator returning memory aligned on Alignment bytes
+//!   - used to store the particles properties (SoA) so that each column starts on a cache line
+//!   - allows the compiler to use aligned vector loads/stores in the particle loops
+//  --------------------------------------------------------------------------------------------------------------------
+template <typename T, std::size_t Alignment = SMILEI_ALIGNMENT>
+class AlignedAllocator {
+public:
+    typedef T              value_type;
+    typedef T*             pointer;
+    typedef const T*       const_pointer;
+    typedef T&             reference;
+    typedef const T&       const_reference;
+    typedef std::size_t    size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template <typename U>
+    struct rebind { typedef AlignedAllocator<U, Alignment> other; };
+
+    AlignedAllocator() {}
+    AlignedAllocator(const AlignedAllocator&) {}
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+    ~AlignedAllocator() {}
+
+    pointer       address(reference x)       const { return &x; }
+    const_pointer address(const_reference x) const { return &x; }
+
+    //! Allocate n objects of type T, the first one aligned on Alignment bytes
+    pointer allocate(size_type n, const void* = 0) {
+        if (n==0) return 0;
+        if (n > max_size()) throw std::bad_alloc();
+        void* p(0);
+        if ( posix_memalign(&p, Alignment, n*sizeof(T)) != 0 )
+            throw std::bad_alloc();
+        return static_cast<pointer>(p);
+    }
+
+    //! Free memory allocated by allocate
+    void deallocate(pointer p, size_type) {
+        free(p);
+    }
+
+    size_type max_size() const {
+        return static_cast<size_type>(-1) / sizeof(T);
+    }
+
+    void construct(pointer p, const T& val) { new(static_cast<void*>(p)) T(val); }
+    void destroy(pointer p) { p->~T(); }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const { return true; }
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const { return false; }
+};
+
+//! std::vector whose data is aligned on SMILEI_ALIGNMENT bytes
+template <typename T>
+using aligned_vector = std::vector<T, AlignedAllocator<T> >;
+
+#endif
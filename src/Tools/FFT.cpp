@@ -0,0 +1,115 @@
+#include "FFT.h"
+
+#include <cmath>
+
+using namespace std;
+
+
+FFT1D::FFT1D( unsigned int n ) :
+    n_( n )
+{
+    m_ = 1;
+    while ( m_ < n_ ) m_ *= 2;
+    if ( m_ != n_ ) {
+        // Bluestein : linear convolution of size 2n-1 computed by a cyclic one of size m_
+        m_ = 1;
+        while ( m_ < 2*n_-1 ) m_ *= 2;
+    }
+
+    twiddles_.resize( m_/2 );
+    for (unsigned int k=0 ; k<m_/2 ; k++)
+        twiddles_[k] = polar( 1., -2.*M_PI*(double)k/(double)m_ );
+
+    if ( m_ != n_ ) {
+        chirp_.resize( n_ );
+        for (unsigned int k=0 ; k<n_ ; k++) {
+            // k^2 modulo 2n keeps the angle accurate for large k
+            unsigned long long k2 = ( (unsigned long long)k*k ) % ( 2*(unsigned long long)n_ );
+            chirp_[k] = polar( 1., -M_PI*(double)k2/(double)n_ );
+        }
+        chirp_fft_.assign( m_, complex<double>(0.,0.) );
+        chirp_fft_[0] = conj( chirp_[0] );
+        for (unsigned int k=1 ; k<n_ ; k++)
+            chirp_fft_[k] = chirp_fft_[m_-k] = conj( chirp_[k] );
+        radix2( &chirp_fft_[0], m_, twiddles_, true );
+        // the normalization of the inverse cyclic convolution is included here
+        for (unsigned int k=0 ; k<m_ ; k++)
+            chirp_fft_[k] /= (double)m_;
+        work_.resize( m_ );
+    }
+}
+
+
+void FFT1D::radix2( complex<double>* data, unsigned int m, vector<complex<double> >& w, bool forward )
+{
+    // Bit reversal permutation
+    for (unsigned int i=1, j=0 ; i<m ; i++) {
+        unsigned int bit = m >> 1;
+        for ( ; j & bit ; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) swap( data[i], data[j] );
+    }
+
+    // Butterflies
+    for (unsigned int len=2 ; len<=m ; len<<=1) {
+        unsigned int half = len >> 1;
+        unsigned int step = m / len;
+        for (unsigned int i=0 ; i<m ; i+=len) {
+            for (unsigned int k=0 ; k<half ; k++) {
+                complex<double> wk = forward ? w[k*step] : conj( w[k*step] );
+                complex<double> t = wk * data[i+k+half];
+                data[i+k+half] = data[i+k] - t;
+                data[i+k]     += t;
+            }
+        }
+    }
+}
+
+
+void FFT1D::transform( complex<double>* data, bool forward )
+{
+    if ( m_ == n_ ) {
+        radix2( data, n_, twiddles_, forward );
+        return;
+    }
+
+    // Bluestein : X_k = c_k sum_j (x_j c_j) conj(c_{k-j}), with the chirp c_k = exp(-i pi k^2/n)
+    // the backward transform is the conjugate of the forward transform of the conjugate
+    for (unsigned int k=0 ; k<n_ ; k++)
+        work_[k] = ( forward ? data[k] : conj(data[k]) ) * chirp_[k];
+    for (unsigned int k=n_ ; k<m_ ; k++)
+        work_[k] = 0.;
+    radix2( &work_[0], m_, twiddles_, true );
+    for (unsigned int k=0 ; k<m_ ; k++)
+        work_[k] *= chirp_fft_[k];
+    radix2( &work_[0], m_, twiddles_, false );
+    for (unsigned int k=0 ; k<n_ ; k++)
+        data[k] = forward ? work_[k] * chirp_[k] : conj( work_[k] * chirp_[k] );
+}
+
+
+FFT2D::FFT2D( unsigned int nx, unsigned int ny ) :
+    nx_( nx ),
+    ny_( ny ),
+    fftx_( nx ),
+    ffty_( ny )
+{
+    column_.resize( nx_ );
+}
+
+
+void FFT2D::transform( complex<double>* data, bool forward )
+{
+    // Rows are contiguous
+    for (unsigned int i=0 ; i<nx_ ; i++)
+        ffty_.transform( &data[i*ny_], forward );
+
+    // Columns are copied in a contiguous buffer
+    for (unsigned int j=0 ; j<ny_ ; j++) {
+        for (unsigned int i=0 ; i<nx_ ; i++)
+            column_[i] = data[i*ny_+j];
+        fftx_.transform( &column_[0], forward );
+        for (unsigned int i=0 ; i<nx_ ; i++)
+            data[i*ny_+j] = column_[i];
+    }
+}
@@ -0,0 +1,65 @@
+/*! @file FFT.h
+
+ @brief FFT.h  complex fast Fourier transforms of any size, in 1D and 2D
+
+ Powers of 2 use an iterative radix-2 transform. Other sizes use Bluestein's algorithm
+ (chirp z-transform computed with a radix-2 transform of size >= 2n-1).
+ The transforms are not normalized : a forward then backward transform multiplies by n.
+ */
+
+#ifndef FFT_H
+#define FFT_H
+
+#include <complex>
+#include <vector>
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class FFT1D : transforms of size n, the tables are computed once by the constructor
+//  --------------------------------------------------------------------------------------------------------------------
+class FFT1D
+{
+public:
+    FFT1D( unsigned int n );
+    ~FFT1D() {};
+
+    //! In-place transform of data[0..n-1] (exp(-2i pi jk/n) if forward, exp(+2i pi jk/n) otherwise)
+    void transform( std::complex<double>* data, bool forward );
+
+    inline unsigned int size() { return n_; }
+
+private:
+    //! In-place radix-2 transform of size m (power of 2), with the twiddles w (size m/2) of the forward transform
+    static void radix2( std::complex<double>* data, unsigned int m, std::vector<std::complex<double> >& w, bool forward );
+
+    unsigned int n_;
+    //! Size of the radix-2 transforms (n_ if it is a power of 2)
+    unsigned int m_;
+    //! Twiddle factors exp(-2i pi k/m_), k<m_/2
+    std::vector<std::complex<double> > twiddles_;
+    //! Bluestein's chirp exp(-i pi k^2/n_), and the forward transform of its padded conjugate
+    std::vector<std::complex<double> > chirp_, chirp_fft_;
+    //! Work array of size m_ (Bluestein only)
+    std::vector<std::complex<double> > work_;
+};
+
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class FFT2D : transforms of nx x ny arrays stored by rows (data[i*ny+j]), one instance per thread
+//  --------------------------------------------------------------------------------------------------------------------
+class FFT2D
+{
+public:
+    FFT2D( unsigned int nx, unsigned int ny );
+    ~FFT2D() {};
+
+    //! In-place transform of the nx*ny array data
+    void transform( std::complex<double>* data, bool forward );
+
+private:
+    unsigned int nx_, ny_;
+    FFT1D fftx_, ffty_;
+    //! One column of the array
+    std::vector<std::complex<double> > column_;
+};
+
+#endif
@@ -19,6 +19,17 @@
 
 
 #include <Python.h>
+
+#ifdef SMILEI_USE_NUMPY
+// numpy C API (python profiles evaluated on arrays), imported once in Params.cpp
+#define NPY_NO_DEPRECATED_API NPY_1_7_API_VERSION
+#define PY_ARRAY_UNIQUE_SYMBOL SMILEI_ARRAY_API
+#ifndef SMILEI_IMPORT_ARRAY
+#define NO_IMPORT_ARRAY
+#endif
+#include <numpy/arrayobject.h>
+#endif
+
 #include <vector>
 #include <sstream>
 #include "Tools.h"
@@ -0,0 +1,133 @@
+/*! @file Random.h
+
+ @brief Random.h  counter-based random number generator (Philox4x32-10)
+
+ Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC'11 (http://dx.doi.org/10.1145/2063384.2063405)
+
+ The random numbers are a pure function of (seed, patch Hindex, stream, timestep, counter) :
+ a given patch draws the same numbers whatever the number of MPI processes and OpenMP threads,
+ and whatever the order in which the patches are treated.
+ */
+
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class Random
+//!   - the key is (random_seed, patch Hindex), the counter is (block index, stream, timestep)
+//!   - the Hindex of a patch changes when the window moves : set the key again before each seek
+//!   - each block of the Philox bijection gives 4 x 32 random bits, i.e. 2 doubles with 53 random bits
+//!   - one instance must be used by one thread at a time (one per species, one per collisions object ...)
+//  --------------------------------------------------------------------------------------------------------------------
+class Random
+{
+public:
+    //! Streams of a patch : species are offset by their index, collisions by the index of the Collisions block
+    enum {
+        STREAM_INIT       = 0,
+        STREAM_DYNAMICS   = 1<<16,
+        STREAM_COLLISIONS = 2<<16
+    };
+
+    Random() {
+        setKey( 0, 0 );
+        seek( 0, 0 );
+    }
+    Random( unsigned int seed, unsigned int hindex ) {
+        setKey( seed, hindex );
+        seek( 0, 0 );
+    }
+
+    //! Key the generator with the seed of the simulation and the index of the patch
+    inline void setKey( unsigned int seed, unsigned int hindex ) {
+        key_[0] = seed;
+        key_[1] = hindex;
+    }
+
+    //! Select the stream and the timestep, restart the sequence from its beginning
+    inline void seek( unsigned int stream, unsigned int timestep ) {
+        block_    = 0;
+        stream_   = stream;
+        timestep_ = timestep;
+        nbuf_     = 0;
+    }
+
+    //! Uniform random number in [0,1)
+    inline double uniform() {
+        if (nbuf_==0) {
+            uint32_t x[4];
+            philox( block_++, stream_, timestep_, key_[0], key_[1], x );
+            buf_[0] = toDouble( x[0], x[1] );
+            buf_[1] = toDouble( x[2], x[3] );
+            nbuf_ = 2;
+        }
+        return buf_[2-(nbuf_--)];
+    }
+
+    //! Fill r[0..n-1] with uniform random numbers in [0,1) (the numbers left from the current block are dropped)
+    void uniform( double* __restrict__ r, unsigned int n ) {
+        unsigned int nblocks = n/2;
+        uint64_t block0 = block_;
+        uint32_t stream = stream_, timestep = timestep_, k0 = key_[0], k1 = key_[1];
+        #pragma omp simd
+        for (unsigned int ib=0 ; ib<nblocks ; ib++) {
+            uint32_t x[4];
+            philox( block0+ib, stream, timestep, k0, k1, x );
+            r[2*ib  ] = toDouble( x[0], x[1] );
+            r[2*ib+1] = toDouble( x[2], x[3] );
+        }
+        block_ += nblocks;
+        nbuf_ = 0;
+        if (n%2) r[n-1] = uniform();
+    }
+
+    //! Uniform random integer in [0,n)
+    inline unsigned int integer( unsigned int n ) {
+        unsigned int i = (unsigned int)( uniform()*(double)n );
+        return i<n ? i : n-1;
+    }
+
+    //! Random permutation of v (Fisher-Yates), replaces std::random_shuffle
+    template <class T>
+    void shuffle( std::vector<T>& v ) {
+        for (unsigned int i=v.size() ; i>1 ; i--)
+            std::swap( v[i-1], v[integer(i)] );
+    }
+
+private:
+    //! Philox4x32 with 10 rounds : counter (block, stream, timestep), key (k0, k1), 128 random bits in x
+    static inline void philox( uint64_t block, uint32_t stream, uint32_t timestep, uint32_t k0, uint32_t k1, uint32_t* x ) {
+        uint32_t c0 = (uint32_t)block, c1 = (uint32_t)(block>>32), c2 = stream, c3 = timestep;
+        for (int iround=0 ; iround<10 ; iround++) {
+            uint64_t p0 = (uint64_t)0xD2511F53 * c0;
+            uint64_t p1 = (uint64_t)0xCD9E8D57 * c2;
+            uint32_t hi0 = (uint32_t)(p0>>32), lo0 = (uint32_t)p0;
+            uint32_t hi1 = (uint32_t)(p1>>32), lo1 = (uint32_t)p1;
+            c0 = hi1 ^ c1 ^ k0;
+            c1 = lo1;
+            c2 = hi0 ^ c3 ^ k1;
+            c3 = lo0;
+            k0 += 0x9E3779B9;
+            k1 += 0xBB67AE85;
+        }
+        x[0] = c0; x[1] = c1; x[2] = c2; x[3] = c3;
+    }
+
+    //! 53 random bits from two 32 bits integers, as a double in [0,1)
+    static inline double toDouble( uint32_t a, uint32_t b ) {
+        uint64_t u = ( ((uint64_t)a<<32) | b ) >> 11;
+        return (double)u * (1.0/9007199254740992.0);
+    }
+
+    uint32_t key_[2];
+    uint64_t block_;
+    uint32_t stream_, timestep_;
+    double buf_[2];
+    unsigned int nbuf_;
+};
+
+#endif
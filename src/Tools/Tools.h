@@ -100,6 +100,13 @@ if (__i==__rk) {std::cout << "Proc [" << __i << "] " <<__txt << std::endl;} MPI_
 
 #endif // __DEBUG
 
+//! Vectorized kernels are compiled for AVX-512, AVX2 and the default ISA, the best one is selected at runtime
+#if defined(__GNUC__) && (__GNUC__ >= 6) && !defined(__INTEL_COMPILER) && !defined(__clang__) && defined(__x86_64__)
+#define SIMD_CLONES __attribute__((target_clones("avx512f","avx2","default")))
+#else
+#define SIMD_CLONES
+#endif
+
 class Tools {
  public:
   static void printMemFootPrint(std::string tag);
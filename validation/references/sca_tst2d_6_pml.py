@@ -0,0 +1,111 @@
+# 1 time
+# 2 Utot
+# 3 Uexp
+# 4 Ubal
+# 5 Ubal_norm
+# 6 Uelm
+# 7 Ukin
+# 8 Uelm_bnd
+# 9 Ukin_bnd
+# 10 Uelm_inj_mvw
+# 11 Uelm_out_mvw
+# 12 Ukin_inj_mvw
+# 13 Ukin_out_mvw
+# 14 Uelm_Ex
+# 15 Uelm_Ey
+# 16 Uelm_Ez
+# 17 Uelm_Bx_m
+# 18 Uelm_By_m
+# 19 Uelm_Bz_m
+# 20 ExMin
+# 21 ExMinCell
+# 22 ExMax
+# 23 ExMaxCell
+# 24 EyMin
+# 25 EyMinCell
+# 26 EyMax
+# 27 EyMaxCell
+# 28 EzMin
+# 29 EzMinCell
+# 30 EzMax
+# 31 EzMaxCell
+# 32 Bx_mMin
+# 33 Bx_mMinCell
+# 34 Bx_mMax
+# 35 Bx_mMaxCell
+# 36 By_mMin
+# 37 By_mMinCell
+# 38 By_mMax
+# 39 By_mMaxCell
+# 40 Bz_mMin
+# 41 Bz_mMinCell
+# 42 Bz_mMax
+# 43 Bz_mMaxCell
+# 44 JxMin
+# 45 JxMinCell
+# 46 JxMax
+# 47 JxMaxCell
+# 48 JyMin
+# 49 JyMinCell
+# 50 JyMax
+# 51 JyMaxCell
+# 52 JzMin
+# 53 JzMinCell
+# 54 JzMax
+# 55 JzMaxCell
+# 56 RhoMin
+# 57 RhoMinCell
+# 58 RhoMax
+# 59 RhoMaxCell
+# 60 PoyEast
+# 61 PoyEastInst
+# 62 PoySouth
+# 63 PoySouthInst
+# 64 PoyWest
+# 65 PoyWestInst
+# 66 PoyNorth
+# 67 PoyNorthInst
+#
+#               time                Utot                Uexp                Ubal           Ubal_norm                Uelm                Ukin            Uelm_bnd            Ukin_bnd        Uelm_inj_mvw        Uelm_out_mvw        Ukin_inj_mvw        Ukin_out_mvw             Uelm_Ex             Uelm_Ey             Uelm_Ez           Uelm_Bx_m           Uelm_By_m           Uelm_Bz_m               ExMin           ExMinCell               ExMax           ExMaxCell               EyMin           EyMinCell               EyMax           EyMaxCell               EzMin           EzMinCell               EzMax           EzMaxCell             Bx_mMin         Bx_mMinCell             Bx_mMax         Bx_mMaxCell             By_mMin         By_mMinCell             By_mMax         By_mMaxCell             Bz_mMin         Bz_mMinCell             Bz_mMax         Bz_mMaxCell               JxMin           JxMinCell               JxMax           JxMaxCell               JyMin           JyMinCell               JyMax           JyMaxCell               JzMin           JzMinCell               JzMax           JzMaxCell              RhoMin          RhoMinCell              RhoMax          RhoMaxCell             PoyEast         PoyEastInst            PoySouth        PoySouthInst             PoyWest         PoyWestInst            PoyNorth        PoyNorthInst
+    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00
+    6.2831853072e+00    4.9781041361e-02    3.9623134421e-02    1.0157906941e-02    0.0000000000e+00    4.9781041361e-02    0.0000000000e+00    3.9623134421e-02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    7.2949517823e-03    1.6758374920e-02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.5727714659e-02   -5.9307885111e-02    3.9200000000e+02    6.1455970691e-02    6.9400000000e+02   -8.0771437256e-02    5.5900000000e+02    1.0319220960e-01    3.5600000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.0583782610e-01    5.7600000000e+02    1.0292535412e-01    5.6000000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    3.9621157549e-02    1.2707454827e-04    1.9768722305e-06    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.6292406072e-40    0.0000000000e+00
+    1.2566370614e+01    2.8981293442e-01    2.5388445353e-01    3.5928480885e-02    0.0000000000e+00    2.8981293442e-01    0.0000000000e+00    2.5388445353e-01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.2686908740e-02    1.0061874714e-01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.4650727855e-01   -1.0846686980e-01    1.2530000000e+03    1.1728279304e-01    1.5360000000e+03   -1.7102637389e-01    9.8000000000e+02    1.8820459887e-01    1.3910000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.0791341888e-01    1.4500000000e+03    1.9826492162e-01    1.2850000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.5372223274e-01    5.9304469992e-04    1.6222079449e-04   -4.3056856592e-20    0.0000000000e+00    0.0000000000e+00    1.2132844433e-39    1.5593128578e-55
+    1.8849555922e+01    1.0740464959e+00    9.7366799921e-01    1.0037849674e-01    0.0000000000e+00    1.0740464959e+00    0.0000000000e+00    9.7366799921e-01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.5027459443e-01    3.8142123948e-01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    5.4235066204e-01   -1.8227538867e-01    1.7530000000e+03    1.9674682549e-01    3.0880000000e+03   -3.0665436386e-01    3.4130000000e+03    3.2182769919e-01    1.6200000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.7176961527e-01    3.6930000000e+03    3.8656738426e-01    1.9850000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    9.7311598599e-01    1.8320488144e-03    5.5201322238e-04   -8.3204906940e-07    0.0000000000e+00    0.0000000000e+00   -5.5464525972e-36    1.8444905212e-42
+    2.5132741229e+01    3.0569045545e+00    2.8520250857e+00    2.0487946873e-01    0.0000000000e+00    3.0569045545e+00    0.0000000000e+00    2.8520250857e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    3.9192351697e-01    1.1258445654e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.5391364721e+00   -3.0865051726e-01    2.3270000000e+03    3.0915585540e-01    4.7600000000e+03   -5.7159393045e-01    3.2160000000e+03    5.8809168632e-01    3.2750000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.6204764707e-01    4.9870000000e+03    6.8431805667e-01    2.6180000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.8508773338e+00    4.1783803040e-03    1.1477519738e-03   -5.2609172897e-06    0.0000000000e+00    0.0000000000e+00   -2.9394787256e-32    7.2572529787e-36
+    3.1415926536e+01    6.8672998029e+00    6.5604727726e+00    3.0682703030e-01    0.0000000000e+00    6.8672998029e+00    0.0000000000e+00    6.5604727726e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    7.8877769918e-01    2.6340283561e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    3.4444937477e+00   -4.5871944674e-01    2.6070000000e+03    4.3114583149e-01    6.7250000000e+03   -8.5878009699e-01    6.7070000000e+03    8.9993361990e-01    3.5030000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -9.6576378347e-01    7.8130000000e+03    1.0425169558e+00    2.8210000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    6.5586471055e+00    7.4073938548e-03    1.8256670981e-03   -9.9472875555e-06    0.0000000000e+00    0.0000000000e+00   -2.6960524120e-29    2.0729965439e-31
+    3.7699111843e+01    1.2283366505e+01    1.1970403688e+01    3.1296281686e-01    0.0000000000e+00    1.2283366505e+01    0.0000000000e+00    1.1970403688e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.2632599115e+00    4.8871760114e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    6.1329305820e+00   -5.9094616919e-01    2.8170000000e+03    5.6556417560e-01    7.5990000000e+03   -1.2038528135e+00    9.1060000000e+03    1.1752679953e+00    4.7410000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.3404610010e+00    9.9230000000e+03    1.3552843081e+00    3.8810000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.1967900332e+01    1.0077969891e-02    2.5033556867e-03   -1.3128953755e-05    0.0000000000e+00    0.0000000000e+00   -3.8188858072e-27    5.9093804803e-29
+    4.3982297150e+01    1.7820994177e+01    1.7640122974e+01    1.8087120316e-01    0.0000000000e+00    1.7820994177e+01    0.0000000000e+00    1.7640122974e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.6709513351e+00    7.2910286067e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    8.8590142353e+00   -7.0384399503e-01    4.4200000000e+03    7.1014433925e-01    9.4100000000e+03   -1.4902715243e+00    1.1510000000e+04    1.4399002942e+00    6.8340000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.6617104751e+00    1.2012000000e+04    1.6054490165e+00    5.5590000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.7636916710e+01    9.9926649486e-03    3.2062635179e-03   -1.4331533812e-05    0.0000000000e+00    0.0000000000e+00   -2.4244922131e-25    1.2271531033e-27
+    5.0265482457e+01    2.1801742213e+01    2.1813430949e+01   -1.1688736402e-02    0.0000000000e+00    2.1801742213e+01    0.0000000000e+00    2.1813430949e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9185013502e+00    9.0826831013e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.0800557761e+01   -8.1929068300e-01    7.5960000000e+03    8.5613328632e-01    1.1857000000e+04   -1.8193899592e+00    1.6452000000e+04    1.7277495351e+00    1.0489000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.9972935007e+00    1.5987000000e+04    1.9106017678e+00    8.7940000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.1809439124e+01    6.8243783815e-03    3.9918251519e-03   -1.3857851373e-05    0.0000000000e+00    0.0000000000e+00   -3.1660315396e-24    2.1975694518e-26
+    5.6548667765e+01    2.3778429099e+01    2.3933507879e+01   -1.5507878049e-01    0.0000000000e+00    2.3778429099e+01    0.0000000000e+00    2.3933507879e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0231445473e+00    9.9999775922e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.1755306959e+01   -9.0746313403e-01    1.0391000000e+04    9.5528878645e-01    1.3955000000e+04   -2.0875958810e+00    1.6968000000e+04    2.0625963302e+00    1.2323000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.2807254394e+00    1.9200000000e+04    2.2341309163e+00    1.1504000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.3928542070e+01    3.1081233883e-03    4.9658095019e-03   -9.9585241373e-06    0.0000000000e+00    0.0000000000e+00   -3.2234546314e-23    8.7427026159e-26
+    6.2831853072e+01    2.4447700507e+01    2.4667471701e+01   -2.1977119350e-01    0.0000000000e+00    2.4447700507e+01    0.0000000000e+00    2.4667471701e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0535397562e+00    1.0318730186e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.2075430565e+01   -9.8326729927e-01    1.3500000000e+04    1.0201196347e+00    1.8060000000e+04   -2.2393503006e+00    2.2772000000e+04    2.2086429637e+00    1.3027000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.3764038956e+00    2.4178000000e+04    2.3880445924e+00    1.3782000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4661251029e+01    9.2687813478e-04    6.2206718712e-03   -6.7083087689e-06    0.0000000000e+00    0.0000000000e+00   -2.8986979785e-22    1.9744624841e-24
+    6.9115038379e+01    2.4600910808e+01    2.4839817314e+01   -2.3890650581e-01    0.0000000000e+00    2.4600910808e+01    0.0000000000e+00    2.4839817314e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0595353815e+00    1.0393341509e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.2148033918e+01   -1.0281275385e+00    1.4502000000e+04    1.0454092718e+00    1.9295000000e+04   -2.2744880601e+00    2.4153000000e+04    2.3075433812e+00    1.4520000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.4698770051e+00    2.6011000000e+04    2.4956331214e+00    1.4558000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4831990794e+01    1.7966264041e-04    7.8265205929e-03   -3.4105225149e-06  -1.4453003599e-204   2.2930310277e-206   -2.0693098447e-21    6.2347595511e-24
+    7.5398223686e+01    2.4624744900e+01    2.4868461063e+01   -2.4371616264e-01    0.0000000000e+00    2.4624744900e+01    0.0000000000e+00    2.4868461063e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0603245037e+00    1.0405166734e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.2159253663e+01   -1.0326126830e+00    1.6800000000e+04    1.0673810470e+00    1.9952000000e+04   -2.3406749657e+00    2.6822000000e+04    2.3558525885e+00    1.8013000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.5246193236e+00    2.7070000000e+04    2.5418814307e+00    1.7287000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4858589055e+01    2.2634136348e-05    9.8720078942e-03    4.0252151314e-06  -6.2589713111e-162   8.3200566030e-164   -1.1157475094e-20    3.0056296796e-23
+    8.1681408993e+01    2.4627592095e+01    2.4873718582e+01   -2.4612648610e-01    0.0000000000e+00    2.4627592095e+01    0.0000000000e+00    2.4873718582e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0603863510e+00    1.0406594816e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.2160610929e+01   -1.0472023740e+00    1.8505000000e+04    1.0430220079e+00    2.2537000000e+04   -2.3015022153e+00    3.1923000000e+04    2.3774029610e+00    2.0184000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.4963953743e+00    3.1456000000e+04    2.5667868595e+00    1.9276000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861337374e+01    1.8571390681e-06    1.2381207419e-02    8.2653045842e-06  -4.2626219349e-129   3.1173937852e-131   -4.4553590782e-20    1.1038206631e-22
+    8.7964594301e+01    2.4628202128e+01    2.4876903892e+01   -2.4870176355e-01    0.0000000000e+00    2.4628202128e+01    0.0000000000e+00    2.4876903892e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0603828012e+00    1.0406896528e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.2160922799e+01   -1.0816142629e+00    2.0710000000e+04    1.0137849585e+00    2.4235000000e+04   -2.3689489764e+00    3.1133000000e+04    2.4631532935e+00    2.2130000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.5253791187e+00    3.2335000000e+04    2.6858048713e+00    2.1248000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861521716e+01    9.4680891789e-08    1.5382176117e-02    1.4646430910e-05  -2.3393224747e-102   6.4318791624e-105   -1.3430173726e-19    2.5805526652e-22
+    9.4247779608e+01    2.4628646876e+01    2.4880441971e+01   -2.5179509505e-01    0.0000000000e+00    2.4628646876e+01    0.0000000000e+00    2.4880441971e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0603771250e+00    1.0407114267e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.2161155483e+01   -1.0918281729e+00    2.2834000000e+04    1.0187873800e+00    2.8833000000e+04   -2.5050606168e+00    3.5372000000e+04    2.5136928098e+00    2.4158000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.6629970992e+00    3.3492000000e+04    2.7327998580e+00    2.3634000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861526969e+01   -2.1670196212e-09    1.8915002106e-02    1.9494747447e-05   -3.7693467752e-80    3.6429021508e-83   -3.7338781691e-19    8.7131797937e-22
+    1.0053096491e+02    2.4629091661e+01    2.4884457532e+01   -2.5536587127e-01    0.0000000000e+00    2.4629091661e+01    0.0000000000e+00    2.4884457532e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0603721848e+00    1.0407333213e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.2161386263e+01   -1.0590141737e+00    2.3467000000e+04    1.0454098556e+00    2.7856000000e+04   -2.5691476809e+00    3.5544000000e+04    2.5166007760e+00    2.6713000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.7407777090e+00    3.3807000000e+04    2.7390333912e+00    2.6069000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861524571e+01   -5.6665214561e-09    2.2932961669e-02    2.2234229450e-05   -1.1919832781e-61    5.5505232725e-65   -2.2585170362e-18    8.6807923147e-21
+    1.0681415022e+02    2.4629561450e+01    2.4888955015e+01   -2.5939356483e-01    0.0000000000e+00    2.4629561450e+01    0.0000000000e+00    2.4888955015e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0603658046e+00    1.0407568399e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.2161627246e+01   -1.0614790197e+00    2.5727000000e+04    1.0640092415e+00    3.3006000000e+04   -2.5956325005e+00    3.7942000000e+04    2.5895480432e+00    2.8059000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.7842306115e+00    3.8254000000e+04    2.7983887064e+00    2.7817000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861522371e+01   -5.4451432988e-09    2.7432643903e-02    2.9357227090e-05   -2.2413568638e-46    7.1484491714e-50   -1.1355216205e-17    5.6073937905e-20
+    1.1309733553e+02    2.4630062424e+01    2.4893928360e+01   -2.6386593544e-01    0.0000000000e+00    2.4630062424e+01    0.0000000000e+00    2.4893928360e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0603524304e+00    1.0407828403e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.2161881590e+01   -1.0804463664e+00    2.8814000000e+04    1.0766417374e+00    3.1179000000e+04   -2.5144516760e+00    3.8041000000e+04    2.6421379618e+00    3.3624000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.7074261922e+00    3.6689000000e+04    2.8460289638e+00    3.1568000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861520510e+01   -5.6082620622e-09    3.2407849967e-02    2.8537753039e-05   -4.5683527266e-34    1.2224457555e-37   -4.8270559813e-17    1.9953992187e-19
+    1.1938052084e+02    2.4630581117e+01    2.4899307504e+01   -2.6872638723e-01    0.0000000000e+00    2.4630581117e+01    0.0000000000e+00    2.4899307504e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0603219554e+00    1.0408116384e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.2162142777e+01   -1.0706594126e+00    3.2225000000e+04    1.0653650827e+00    3.2424000000e+04   -2.4460741715e+00    3.7151000000e+04    2.5675618442e+00    3.5031000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.6539292223e+00    3.5582000000e+04    2.8060718904e+00    3.3891000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861518926e+01   -5.1427770667e-09    3.7788578229e-02    2.8941743876e-05   -1.1579392428e-24    3.8821671096e-28   -1.7984245664e-16    4.8274556248e-19
+    1.2566370614e+02    2.4630799650e+01    2.4905089921e+01   -2.7429027073e-01    0.0000000000e+00    2.4630799650e+01    0.0000000000e+00    2.4905089921e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0602591901e+00    1.0408287163e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.2162253297e+01   -1.0583104456e+00    3.2927000000e+04    1.0753165599e+00    3.3556000000e+04   -2.4863093607e+00    3.5724000000e+04    2.4948918555e+00    3.7678000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.7072251056e+00    3.6272000000e+04    2.7183798909e+00    3.4750000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861517559e+01   -4.0420411866e-09    4.3572361798e-02    3.3350991480e-05   -2.1186511422e-18    2.9315877231e-21   -5.9362892275e-16    1.3228443718e-18
+    1.3194689145e+02    2.4628348555e+01    2.4911168634e+01   -2.8282007920e-01    0.0000000000e+00    2.4628348555e+01    0.0000000000e+00    2.4911168634e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0601232417e+00    1.0407181616e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.2161043697e+01   -1.0822337385e+00    3.5219000000e+04    1.0677895632e+00    3.4653000000e+04   -2.4738790499e+00    3.7564000000e+04    2.5039393889e+00    4.0009000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.7245019395e+00    3.8977000000e+04    2.6860733616e+00    3.9358000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861516387e+01   -2.7233253960e-09    4.9652247156e-02    2.8683780697e-05   -4.7508866712e-16    8.9127344058e-19   -1.7730694448e-15    9.6501330701e-19
+    1.3823007676e+02    2.4611513045e+01    2.4917050977e+01   -3.0553793174e-01    0.0000000000e+00    2.4611513045e+01    0.0000000000e+00    2.4917050977e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0596984119e+00    1.0399065119e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.2152749514e+01   -1.0991018190e+00    3.7487000000e+04    1.0743140300e+00    3.6340000000e+04   -2.4436636877e+00    4.0177000000e+04    2.5024374224e+00    4.0273000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.7127053819e+00    4.0646000000e+04    2.6892978336e+00    4.0819000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861515421e+01   -1.6017667225e-09    5.5535555145e-02    2.1645952989e-05   -2.9175490773e-15    8.4090312797e-18   -4.9784959570e-15    1.1280445174e-17
+    1.4451326207e+02    2.4564877035e+01    2.4921775553e+01   -3.5689851835e-01    0.0000000000e+00    2.4564877035e+01    0.0000000000e+00    2.4921775553e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0580568682e+00    1.0377061050e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.2129759116e+01   -1.1043653491e+00    3.9208000000e+04    1.0883268687e+00    3.8313000000e+04   -2.4571567032e+00    4.2718000000e+04    2.5215735729e+00    4.2344000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.6920229519e+00    4.1489000000e+04    2.7083764344e+00    4.1987000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861514675e+01   -7.7822476665e-10    6.0260878759e-02    1.2901857571e-05   -1.3879826965e-14    3.0977668866e-17   -1.3673161549e-14    2.7944431466e-17
+    1.5079644737e+02    2.4411509217e+01    2.4924835639e+01   -5.1332642224e-01    0.0000000000e+00    2.4411509217e+01    0.0000000000e+00    2.4924835639e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0510621217e+00    1.0306275809e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.2054171286e+01   -1.0703249824e+00    4.0517000000e+04    1.0702125968e+00    4.0372000000e+04   -2.4248869439e+00    4.4267000000e+04    2.4061604041e+00    4.3484000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.6306004798e+00    4.4479000000e+04    2.5814137588e+00    4.3404000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861514124e+01   -4.9542346807e-10    6.3321515037e-02    5.0290422665e-06   -6.3470011280e-14    1.9689950299e-16   -3.7141185547e-14    9.2424350304e-17
+    1.5707963268e+02    2.3836676842e+01    2.4926324747e+01   -1.0896479048e+00    0.0000000000e+00    2.3836676842e+01    0.0000000000e+00    2.4926324747e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0204095165e+00    1.0045590521e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.1770676805e+01   -1.0156148294e+00    4.3836000000e+04    1.0273082540e+00    4.1036000000e+04   -2.2869126264e+00    4.5777000000e+04    2.2567467402e+00    4.4984000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.4786686665e+00    4.5824000000e+04    2.4450142451e+00    4.6602000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861513716e+01   -4.4703350919e-10    6.4811030509e-02    1.1915818383e-06   -3.1846211647e-13    1.2315805342e-15   -1.0119181915e-13    5.2531312834e-17
+    1.6336281799e+02    2.2081624129e+01    2.4926847351e+01   -2.8452232217e+00    0.0000000000e+00    2.2081624129e+01    0.0000000000e+00    2.4926847351e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9159557088e+00    9.2611247385e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.0904543682e+01   -9.3932413223e-01    4.3777000000e+04    9.4934964570e-01    4.2452000000e+04   -2.0752634305e+00    4.6801000000e+04    2.0717143021e+00    4.6501000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.2619015844e+00    4.7394000000e+04    2.2359319970e+00    4.7105000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861513394e+01   -4.3926094960e-10    6.5333956712e-02    2.4448876973e-07   -1.5802951555e-12    6.2139294191e-15   -2.6535219649e-13    4.9074162382e-16
+    1.6964600329e+02    1.8330955942e+01    2.4926975382e+01   -6.5960194399e+00    0.0000000000e+00    1.8330955942e+01    0.0000000000e+00    2.4926975382e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.6684546941e+00    7.6098225429e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    9.0526787055e+00   -8.2987813377e-01    4.4947000000e+04    8.2626656081e-01    4.2568000000e+04   -1.7650380141e+00    4.7770000000e+04    1.7466362492e+00    4.7211000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.9206878085e+00    4.8661000000e+04    1.9095296083e+00    4.8190000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861513124e+01   -4.3736522736e-10    6.5462258382e-02    1.7739099619e-08   -5.7747480367e-12    1.7500843520e-14   -6.8231753322e-13    1.4169741755e-15
+    1.7592918860e+02    1.2819188870e+01    2.4926996877e+01   -1.2107808006e+01    0.0000000000e+00    1.2819188870e+01    0.0000000000e+00    2.4926996877e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.2602961242e+00    5.2284828907e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    6.3304098555e+00   -6.8308567010e-01    4.5253000000e+04    6.7727186623e-01    4.2379000000e+04   -1.4258512308e+00    4.8376000000e+04    1.3952137172e+00    4.8143000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.5614458370e+00    4.9668000000e+04    1.5280379073e+00    4.8055000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861512891e+01   -3.6922387434e-10    6.5483985470e-02    1.4848012141e-09   -1.5294710083e-11    3.2870271593e-14   -1.7795439913e-12    4.1081359305e-15
+    1.8221237391e+02    7.2079189692e+00    2.4926999141e+01   -1.7719080172e+01    0.0000000000e+00    7.2079189692e+00    0.0000000000e+00    2.4926999141e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    7.8656595491e-01    2.8626762849e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    3.5586767293e+00   -5.1881929869e-01    4.4152000000e+04    4.9727072784e-01    4.2312000000e+04   -1.0268413875e+00    4.8078000000e+04    1.0255824265e+00    4.7538000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.1305758800e+00    4.7500000000e+04    1.1285620416e+00    4.9006000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861512689e+01   -3.4082000306e-10    6.5486452639e-02    4.0810061663e-10   -3.0558202124e-11    4.2609423009e-14   -4.4811610012e-12    7.9380352366e-15
+    1.8849555922e+02    3.1828196303e+00    2.4926999154e+01   -2.1744179524e+01    0.0000000000e+00    3.1828196303e+00    0.0000000000e+00    2.4926999154e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    3.9305033890e-01    1.2190303303e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.5707389612e+00   -3.5412731116e-01    4.4626000000e+04    3.3809265189e-01    4.1649000000e+04   -6.3813377044e-01    4.8488000000e+04    6.5882426098e-01    4.8836000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -7.1381643872e-01    4.8609000000e+04    7.3777249653e-01    4.9046000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861512513e+01   -2.8615365180e-10    6.5486641824e-02   -1.9143620058e-11   -4.8257923079e-11    3.8741900483e-14   -9.6376920316e-12    1.0079833666e-14
+    1.9477874452e+02    1.0978119917e+00    2.4926999004e+01   -2.3829187012e+01    0.0000000000e+00    1.0978119917e+00    0.0000000000e+00    2.4926999004e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.5432804958e-01    4.0204377341e-01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    5.4144016875e-01   -2.1466347067e-01    4.5156000000e+04    2.0737710442e-01    4.1642000000e+04   -3.6796172215e-01    4.7300000000e+04    3.7299434308e-01    4.8306000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.1904970443e-01    4.8324000000e+04    4.2447964026e-01    4.8587000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861512359e+01   -2.5526207848e-10    6.5486644981e-02   -2.9600627349e-11   -6.3296717448e-11    2.4714032274e-14   -1.6560500925e-11    8.2554753546e-15
+    2.0106192983e+02    2.9575495747e-01    2.4926998861e+01   -2.4631243903e+01    0.0000000000e+00    2.9575495747e-01    0.0000000000e+00    2.4926998861e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.6829611504e-02    1.0316281544e-01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.4576253053e-01   -1.1712344787e-01    4.3051000000e+04    1.0761759133e-01    4.0228000000e+04   -1.8590896204e-01    4.7944000000e+04    1.8217833377e-01    4.6820000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.1308133647e-01    4.8998000000e+04    2.1414972805e-01    4.8769000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861512224e+01   -2.1652140142e-10    6.5486636667e-02   -1.0043884550e-11   -7.2684029066e-11    1.0926768530e-14   -2.2955029292e-11    4.3641571225e-15
+    2.0734511514e+02    6.1712391718e-02    2.4926998733e+01   -2.4865286341e+01    0.0000000000e+00    6.1712391718e-02    0.0000000000e+00    2.4926998733e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.0746600029e-02    2.0575556344e-02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    3.0390235345e-02   -5.7879886195e-02    4.3865000000e+04    4.6844968460e-02    3.9774000000e+04   -8.2890100010e-02    4.8501000000e+04    8.4328292915e-02    4.7802000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -9.3923899556e-02    4.8018000000e+04    1.0167338408e-01    4.9191000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861512106e+01   -1.9742549248e-10    6.5486626736e-02   -1.4103721169e-11   -7.6950567999e-11    3.2780372985e-15   -2.6956940055e-11    1.4966239151e-15
+    2.1362830044e+02    9.8016215703e-03    2.4926998619e+01   -2.4917196997e+01    0.0000000000e+00    9.8016215703e-03    0.0000000000e+00    2.4926998619e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.8206619664e-03    3.1643024209e-03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.8166571830e-03   -2.5437281249e-02    4.3910000000e+04    1.7487155785e-02    3.8258000000e+04   -3.4621752577e-02    4.6922000000e+04    3.6985074748e-02    4.7465000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.7341649710e-02    4.7835000000e+04    4.3809406425e-02    4.8041000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861512003e+01   -1.6841233170e-10    6.5486616509e-02   -2.8469074232e-11   -7.8338542038e-11    6.5249304106e-16   -2.8627688972e-11    2.8799653748e-16
+    2.1991148575e+02    1.2153767426e-03    2.4926998518e+01   -2.4925783141e+01    0.0000000000e+00    1.2153767426e-03    0.0000000000e+00    2.4926998518e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.2856582668e-04    3.9813811139e-04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    5.8867280455e-04   -1.0982689371e-02    4.2926000000e+04    5.9916043498e-03    3.8570000000e+04   -1.6244090779e-02    4.5796000000e+04    1.6610417160e-02    4.6339000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.6259889826e-02    4.7517000000e+04    1.8893964154e-02    4.8381000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861511912e+01   -1.4798389555e-10    6.5486606553e-02   -3.1703112534e-11   -7.8655409478e-11    8.4561615957e-17   -2.9093792169e-11    3.8173934302e-17
+    2.2619467106e+02    1.8276161187e-04    2.4926998429e+01   -2.4926815667e+01    0.0000000000e+00    1.8276161187e-04    0.0000000000e+00    2.4926998429e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.8180886334e-05    7.3883601367e-05    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    8.0697124167e-05   -5.6194485412e-03    4.1902000000e+04    1.7139135891e-03    3.8910000000e+04   -1.0265363170e-02    4.6256000000e+04    9.3151557825e-03    4.6880000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -8.9877565078e-03    4.6455000000e+04    9.9830974668e-03    4.7455000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861511832e+01   -1.3426400317e-10    6.5486597151e-02   -2.2795871336e-11   -7.8705260060e-11    7.0292247856e-18   -2.9182396387e-11   -4.1944025183e-18
+    2.3247785637e+02    8.9314073165e-05    2.4926998349e+01   -2.4926909035e+01    0.0000000000e+00    8.9314073165e-05    0.0000000000e+00    2.4926998349e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.0173816768e-05    4.3792921942e-05    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    3.5347334456e-05   -3.9669670119e-03    4.1679000000e+04    4.1773266235e-04    3.6856000000e+04   -8.4006323566e-03    4.4430000000e+04    7.1346141854e-03    4.8521000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.7396622103e-03    4.5450000000e+04    7.2648318705e-03    4.6557000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861511761e+01   -1.1026676517e-10    6.5486588430e-02   -1.5452530094e-11   -7.8710584896e-11    3.6930774992e-19   -2.9193074698e-11    7.8354605731e-20
+    2.3876104167e+02    7.7594736533e-05    2.4926998279e+01   -2.4926920684e+01    0.0000000000e+00    7.7594736533e-05    0.0000000000e+00    2.4926998279e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    8.4732486678e-06    3.8901792596e-05    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    3.0219695269e-05   -3.5067742026e-03    4.1506000000e+04    8.6640779909e-05    3.6429000000e+04   -7.7487326449e-03    4.4115000000e+04    6.4890730924e-03    4.5546000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.0571626893e-03    4.5990000000e+04    6.5163835681e-03    4.3831000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861511698e+01   -1.0795715559e-10    6.5486580534e-02   -8.8515720191e-12   -7.8710966697e-11    1.1912933912e-20   -2.9198592939e-11    8.1417169559e-18
+    2.4504422698e+02    7.1414649890e-05    2.4926998216e+01   -2.4926926801e+01    0.0000000000e+00    7.1414649890e-05    0.0000000000e+00    2.4926998216e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    7.8054286050e-06    3.5912475732e-05    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.7696745554e-05   -3.3221807047e-03    4.1315000000e+04    3.4974093528e-05    3.5619000000e+04   -7.5155309388e-03    4.4471000000e+04    6.1590072069e-03    4.4550000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.8126586340e-03    4.3835000000e+04    6.2221164284e-03    4.7391000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861511643e+01   -8.7244633914e-11    6.5486573429e-02   -9.4273320352e-12   -7.8710984945e-11    1.9579044721e-22   -2.9204145622e-11    1.3817225508e-17
+    2.5132741229e+02    6.6098530967e-05    2.4926998160e+01   -2.4926932062e+01    0.0000000000e+00    6.6098530967e-05    0.0000000000e+00    2.4926998160e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    7.2265905102e-06    3.3344534423e-05    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.5527406033e-05   -3.1874986022e-03    4.3032000000e+04    4.1202032399e-05    3.6770000000e+04   -7.3438846427e-03    4.4556000000e+04    5.8987542246e-03    4.4946000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.6436915702e-03    4.5437000000e+04    5.9886879244e-03    4.7313000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861511593e+01   -8.3322231093e-11    6.5486567067e-02   -1.7268092348e-11   -7.8710985548e-11    5.4263968891e-23   -2.9212121933e-11    1.0892763922e-17
+    2.5132741229e+02    6.6098530967e-05    2.4926998158e+01   -2.4926932059e+01    0.0000000000e+00    6.6098530967e-05    0.0000000000e+00    2.4926998158e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    7.2265905102e-06    3.3344534423e-05    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.5527406033e-05   -3.1874986022e-03    4.3032000000e+04    4.1202032399e-05    3.6770000000e+04   -7.3438846427e-03    4.4556000000e+04    5.8987542246e-03    4.4946000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.6436915702e-03    4.5437000000e+04    5.9886879244e-03    4.7313000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4861511591e+01   -8.3322231093e-11    6.5486566741e-02   -1.7268092348e-11   -7.8710985552e-11    5.4263968891e-23   -2.9212555665e-11    1.0892763922e-17
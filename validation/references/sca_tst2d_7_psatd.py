@@ -0,0 +1,86 @@
+# 1 time
+# 2 Utot
+# 3 Uexp
+# 4 Ubal
+# 5 Ubal_norm
+# 6 Uelm
+# 7 Ukin
+# 8 Uelm_bnd
+# 9 Ukin_bnd
+# 10 Uelm_inj_mvw
+# 11 Uelm_out_mvw
+# 12 Ukin_inj_mvw
+# 13 Ukin_out_mvw
+# 14 Ntot_ion
+# 15 Zavg_ion
+# 16 Ukin_ion
+# 17 Ntot_eon
+# 18 Zavg_eon
+# 19 Ukin_eon
+# 20 Uelm_Ex
+# 21 Uelm_Ey
+# 22 Uelm_Ez
+# 23 Uelm_Bx_m
+# 24 Uelm_By_m
+# 25 Uelm_Bz_m
+# 26 ExMin
+# 27 ExMinCell
+# 28 ExMax
+# 29 ExMaxCell
+# 30 EyMin
+# 31 EyMinCell
+# 32 EyMax
+# 33 EyMaxCell
+# 34 EzMin
+# 35 EzMinCell
+# 36 EzMax
+# 37 EzMaxCell
+# 38 Bx_mMin
+# 39 Bx_mMinCell
+# 40 Bx_mMax
+# 41 Bx_mMaxCell
+# 42 By_mMin
+# 43 By_mMinCell
+# 44 By_mMax
+# 45 By_mMaxCell
+# 46 Bz_mMin
+# 47 Bz_mMinCell
+# 48 Bz_mMax
+# 49 Bz_mMaxCell
+# 50 JxMin
+# 51 JxMinCell
+# 52 JxMax
+# 53 JxMaxCell
+# 54 JyMin
+# 55 JyMinCell
+# 56 JyMax
+# 57 JyMaxCell
+# 58 JzMin
+# 59 JzMinCell
+# 60 JzMax
+# 61 JzMaxCell
+# 62 RhoMin
+# 63 RhoMinCell
+# 64 RhoMax
+# 65 RhoMaxCell
+# 66 PoyEast
+# 67 PoyEastInst
+# 68 PoySouth
+# 69 PoySouthInst
+# 70 PoyWest
+# 71 PoyWestInst
+# 72 PoyNorth
+# 73 PoyNorthInst
+#
+#               time                Utot                Uexp                Ubal           Ubal_norm                Uelm                Ukin            Uelm_bnd            Ukin_bnd        Uelm_inj_mvw        Uelm_out_mvw        Ukin_inj_mvw        Ukin_out_mvw            Ntot_ion            Zavg_ion            Ukin_ion            Ntot_eon            Zavg_eon            Ukin_eon             Uelm_Ex             Uelm_Ey             Uelm_Ez           Uelm_Bx_m           Uelm_By_m           Uelm_Bz_m               ExMin           ExMinCell               ExMax           ExMaxCell               EyMin           EyMinCell               EyMax           EyMaxCell               EzMin           EzMinCell               EzMax           EzMaxCell             Bx_mMin         Bx_mMinCell             Bx_mMax         Bx_mMaxCell             By_mMin         By_mMinCell             By_mMax         By_mMaxCell             Bz_mMin         Bz_mMinCell             Bz_mMax         Bz_mMaxCell               JxMin           JxMinCell               JxMax           JxMaxCell               JyMin           JyMinCell               JyMax           JyMaxCell               JzMin           JzMinCell               JzMax           JzMaxCell              RhoMin          RhoMinCell              RhoMax          RhoMaxCell             PoyEast         PoyEastInst            PoySouth        PoySouthInst             PoyWest         PoyWestInst            PoyNorth        PoyNorthInst
+    0.0000000000e+00    1.4573742014e+01    2.9012372094e+01   -1.4438630080e+01   -9.9072908432e-01    1.3511193337e-01    1.4438630080e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.4438630080e+01    0.0000000000e+00    2.5600000000e+04    1.6000000000e+01    0.0000000000e+00    2.5600000000e+04   -1.6000000000e+01    1.4438630080e+01    8.9461451442e-03    1.4334284214e-02    1.1183150401e-01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.0505155021e-01    1.1105000000e+04    1.3026665991e-01    1.1577000000e+04   -1.5179577572e-01    1.1165000000e+04    8.0566564722e-02    1.0955000000e+04    3.5588373915e-11    5.6620000000e+03    3.8980364064e-01    1.0222000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.3430984289e-01    1.0931000000e+04    3.0679979334e-01    1.2498000000e+04   -3.2581197174e-01    1.0220000000e+04    2.9772286706e-01    1.0255000000e+04   -3.4427706965e-01    1.1208000000e+04    3.4723787367e-01    1.1046000000e+04   -5.2925365445e-01    1.1911000000e+04    5.2277368758e-01    1.0469000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00
+    5.7757478196e+00    1.4699149133e+01    1.4573742014e+01    1.2540711953e-01    8.6050047688e-03    6.6156108938e-01    1.4037588044e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.5600000000e+04    1.6000000000e+01    0.0000000000e+00    2.5600000000e+04   -1.6000000000e+01    1.4037588044e+01    2.7897835319e-01    2.8872287838e-01    1.9258720347e-02    2.3782575624e-02    2.4640744341e-02    2.6177817507e-02   -7.0656651909e-01    1.1183000000e+04    7.0421129925e-01    1.0823000000e+04   -6.8224712893e-01    1.0129000000e+04    6.8449395345e-01    1.1076000000e+04   -1.3544540611e-01    1.0489000000e+04    1.6010624626e-01    1.0777000000e+04   -1.7198209351e-01    1.1324000000e+04    1.7337899931e-01    1.1774000000e+04   -1.7463054450e-01    1.2206000000e+04    1.8321149113e-01    1.1486000000e+04   -2.0906333566e-01    1.2441000000e+04    2.1182843508e-01    1.3815000000e+04   -5.4454641408e-01    1.0673000000e+04    5.2602680905e-01    1.2082000000e+04   -5.1143954116e-01    1.0334000000e+04    5.3644085149e-01    1.0512000000e+04   -5.8767302132e-01    1.2110000000e+04    5.1402257662e-01    1.1480000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00
+    1.1551495639e+01    1.4741356092e+01    1.4573742014e+01    1.6761407852e-01    1.1501100978e-02    7.5014039319e-01    1.3991215699e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.5600000000e+04    1.6000000000e+01    0.0000000000e+00    2.5600000000e+04   -1.6000000000e+01    1.3991215699e+01    2.9869210727e-01    2.9195075101e-01    7.5408972437e-02    2.2407569202e-02    2.3394656402e-02    3.8286336870e-02   -7.4249039421e-01    1.3061000000e+04    7.0440768739e-01    1.0159000000e+04   -7.1430001795e-01    1.1980000000e+04    6.7781521775e-01    1.2268000000e+04   -2.4922364799e-01    1.0862000000e+04    1.2084114473e-01    8.9870000000e+03   -1.7708113346e-01    1.1993000000e+04    1.9030274953e-01    1.3060000000e+04   -1.9496821920e-01    1.2535000000e+04    1.9707938575e-01    1.0767000000e+04   -2.6184098073e-01    1.1412000000e+04    2.3613674472e-01    1.3488000000e+04   -5.4935208061e-01    1.2164000000e+04    5.7324928559e-01    1.1351000000e+04   -5.7854784847e-01    9.7450000000e+03    5.1803398865e-01    1.1677000000e+04   -5.3070185786e-01    1.1072000000e+04    5.9722904866e-01    1.0996000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00
+    1.7327243459e+01    1.4737762855e+01    1.4573742014e+01    1.6402084119e-01    1.1254545403e-02    7.8587916313e-01    1.3951883692e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.5600000000e+04    1.6000000000e+01    0.0000000000e+00    2.5600000000e+04   -1.6000000000e+01    1.3951883692e+01    3.1288524981e-01    3.0833524421e-01    7.0730127284e-02    2.7029784871e-02    2.5486828317e-02    4.1411928637e-02   -7.5033960371e-01    1.1514000000e+04    7.4761839539e-01    1.1639000000e+04   -7.3867790011e-01    1.2935000000e+04    7.5299524041e-01    1.1099000000e+04   -1.3862896825e-01    1.2025000000e+04    1.9501296766e-01    9.1380000000e+03   -2.0185781954e-01    1.1970000000e+04    1.9437902017e-01    1.1489000000e+04   -1.9812315645e-01    1.1874000000e+04    2.0426792606e-01    1.0822000000e+04   -2.6122967636e-01    1.1919000000e+04    2.5728100708e-01    1.1880000000e+04   -5.5002892096e-01    1.1610000000e+04    5.4142525201e-01    1.2959000000e+04   -5.4838615935e-01    1.1037000000e+04    5.6714309451e-01    1.1567000000e+04   -5.6689650568e-01    1.1795000000e+04    5.6551125806e-01    1.1748000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00
+    2.3102991278e+01    1.4739088122e+01    1.4573742014e+01    1.6534610788e-01    1.1345480640e-02    7.5824267781e-01    1.3980845444e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.5600000000e+04    1.6000000000e+01    0.0000000000e+00    2.5600000000e+04   -1.6000000000e+01    1.3980845444e+01    3.0567724947e-01    3.0308158194e-01    4.8492225808e-02    3.0129253164e-02    2.8138669825e-02    4.2723697610e-02   -7.1823334140e-01    1.2654000000e+04    7.0769780881e-01    1.0953000000e+04   -7.1874379387e-01    1.1396000000e+04    7.3280208904e-01    1.1340000000e+04   -2.0724891898e-01    9.3730000000e+03    1.5637941150e-01    1.1333000000e+04   -2.1126516888e-01    1.1035000000e+04    2.1532289714e-01    1.1508000000e+04   -1.8270765158e-01    9.7440000000e+03    2.0251502544e-01    1.2651000000e+04   -2.5148391517e-01    9.9410000000e+03    2.6172895043e-01    1.1582000000e+04   -5.4034239483e-01    1.2193000000e+04    5.6288236064e-01    1.0047000000e+04   -5.4201726626e-01    1.3335000000e+04    5.5821244458e-01    1.3284000000e+04   -5.9143949542e-01    1.1613000000e+04    5.2766428209e-01    1.1565000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00
+    2.8878739098e+01    1.4762418212e+01    1.4573742014e+01    1.8867619849e-01    1.2946311134e-02    7.8358497244e-01    1.3978833240e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.5600000000e+04    1.6000000000e+01    0.0000000000e+00    2.5600000000e+04   -1.6000000000e+01    1.3978833240e+01    3.0848377636e-01    3.0850314109e-01    6.3010598687e-02    3.0267938820e-02    2.8486290354e-02    4.4833227123e-02   -7.3476779249e-01    1.1988000000e+04    6.9909085947e-01    1.0766000000e+04   -7.3560925105e-01    1.2833000000e+04    7.4249773780e-01    1.0977000000e+04   -1.9258557898e-01    1.0138000000e+04    2.1220613421e-01    1.1383000000e+04   -2.2020260281e-01    1.1560000000e+04    2.1137850775e-01    1.2211000000e+04   -2.0956266948e-01    1.1662000000e+04    1.9315452876e-01    1.2074000000e+04   -2.6587465748e-01    1.2097000000e+04    2.5894098507e-01    1.0228000000e+04   -5.5586203341e-01    1.1886000000e+04    5.7389305440e-01    1.1157000000e+04   -6.2109456567e-01    1.2460000000e+04    5.3117248224e-01    1.0774000000e+04   -5.7391274157e-01    1.0455000000e+04    5.7801110489e-01    1.2008000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00
+    3.4654486918e+01    1.4770817491e+01    1.4573742014e+01    1.9707547762e-01    1.3522640749e-02    8.0881404176e-01    1.3962003450e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.5600000000e+04    1.6000000000e+01    0.0000000000e+00    2.5600000000e+04   -1.6000000000e+01    1.3962003450e+01    3.1871373030e-01    3.1908115412e-01    6.9061258977e-02    2.8424441875e-02    2.8524950844e-02    4.5008505643e-02   -7.0584773486e-01    1.1620000000e+04    7.8047519470e-01    1.1273000000e+04   -7.7709037578e-01    1.1894000000e+04    6.8898499066e-01    1.0103000000e+04   -1.9161021565e-01    9.1990000000e+03    2.0698615671e-01    1.0738000000e+04   -2.0928161722e-01    1.1260000000e+04    2.1347659287e-01    1.2604000000e+04   -1.9270432040e-01    1.2759000000e+04    2.0425119781e-01    1.0183000000e+04   -2.6362626287e-01    1.1950000000e+04    2.6693767245e-01    1.2174000000e+04   -5.6918633396e-01    1.1462000000e+04    5.5884437716e-01    1.1428000000e+04   -5.7586567206e-01    1.1943000000e+04    5.8966574235e-01    1.1634000000e+04   -6.1050019311e-01    1.1197000000e+04    5.1800020784e-01    1.1787000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00
+    4.0430234737e+01    1.4781687924e+01    1.4573742014e+01    2.0794591032e-01    1.4268532414e-02    8.0644275140e-01    1.3975245173e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.5600000000e+04    1.6000000000e+01    0.0000000000e+00    2.5600000000e+04   -1.6000000000e+01    1.3975245173e+01    3.2114956355e-01    3.2664721258e-01    5.4012580235e-02    2.9600338051e-02    2.9874901513e-02    4.5158155472e-02   -7.6193302570e-01    1.0347000000e+04    6.8591907363e-01    1.1844000000e+04   -7.1739852423e-01    1.2996000000e+04    7.9914278746e-01    1.0552000000e+04   -2.2188549143e-01    1.1187000000e+04    1.6823874081e-01    1.1099000000e+04   -1.9947701917e-01    1.1504000000e+04    2.0891642329e-01    1.0677000000e+04   -2.0808838937e-01    1.1491000000e+04    1.9723018425e-01    1.1869000000e+04   -2.5875230397e-01    1.3595000000e+04    2.6292651493e-01    1.0719000000e+04   -5.5245008106e-01    1.1944000000e+04    6.0841138894e-01    9.8610000000e+03   -5.5356329835e-01    1.2124000000e+04    5.6322626553e-01    1.2037000000e+04   -5.4555655591e-01    1.0027000000e+04    5.5482113542e-01    1.0916000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00
+    4.6205982557e+01    1.4801543543e+01    1.4573742014e+01    2.2780152874e-01    1.5630956588e-02    8.0704283204e-01    1.3994500710e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.5600000000e+04    1.6000000000e+01    0.0000000000e+00    2.5600000000e+04   -1.6000000000e+01    1.3994500710e+01    3.1268339761e-01    3.1901675330e-01    6.8114448827e-02    2.9688280646e-02    2.9422939485e-02    4.8117012172e-02   -6.8128287677e-01    1.0462000000e+04    7.4475071131e-01    1.2246000000e+04   -7.4986226561e-01    9.8290000000e+03    7.2984131095e-01    1.2171000000e+04   -2.3654335286e-01    1.0670000000e+04    2.2245476026e-01    1.0663000000e+04   -2.1581203755e-01    1.2229000000e+04    2.0772998114e-01    1.0917000000e+04   -2.1013564390e-01    1.1849000000e+04    2.0098800561e-01    1.2818000000e+04   -2.5714548521e-01    1.0430000000e+04    2.8193805104e-01    1.0773000000e+04   -5.6273105364e-01    1.1719000000e+04    5.4618638530e-01    1.0952000000e+04   -5.9079260743e-01    1.1821000000e+04    5.2845297464e-01    1.2008000000e+04   -5.4931081324e-01    1.2369000000e+04    5.9635584091e-01    1.0930000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00
+    5.1981730376e+01    1.4800579157e+01    1.4573742014e+01    2.2683714306e-01    1.5564783763e-02    7.9873734189e-01    1.4001841815e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.5600000000e+04    1.6000000000e+01    0.0000000000e+00    2.5600000000e+04   -1.6000000000e+01    1.4001841815e+01    3.1550590110e-01    3.1159915867e-01    5.9898414387e-02    2.9763781404e-02    3.0476945662e-02    5.1493140673e-02   -7.3995781616e-01    9.5960000000e+03    7.3823458743e-01    1.1393000000e+04   -7.8058762271e-01    1.0997000000e+04    7.1869992481e-01    1.0081000000e+04   -1.8541527194e-01    9.3050000000e+03    2.0725620032e-01    9.8280000000e+03   -2.0112093682e-01    1.1263000000e+04    2.0310620919e-01    1.1078000000e+04   -2.0804780671e-01    1.1150000000e+04    2.1112226364e-01    1.2625000000e+04   -2.8286418302e-01    1.1961000000e+04    2.7430048680e-01    1.1872000000e+04   -6.2786137220e-01    1.0410000000e+04    5.5315808250e-01    1.1195000000e+04   -6.1305245557e-01    1.1526000000e+04    6.0282319011e-01    1.0166000000e+04   -5.5399646049e-01    1.2155000000e+04    5.6406975387e-01    1.0907000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00
+    5.7757478196e+01    1.4821385184e+01    1.4573742014e+01    2.4764316974e-01    1.6992421679e-02    8.4672500577e-01    1.3974660178e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.5600000000e+04    1.6000000000e+01    0.0000000000e+00    2.5600000000e+04   -1.6000000000e+01    1.3974660178e+01    3.3540688164e-01    3.2885540513e-01    6.9578198101e-02    2.9359743386e-02    3.0226626214e-02    5.3298151299e-02   -8.1619140015e-01    1.0590000000e+04    7.8434093327e-01    1.1924000000e+04   -7.3697814061e-01    1.1496000000e+04    7.7588075737e-01    1.1620000000e+04   -2.1822403962e-01    9.4970000000e+03    2.0725312168e-01    1.0748000000e+04   -2.1489376033e-01    1.1322000000e+04    2.0627623135e-01    1.2596000000e+04   -1.9999850858e-01    1.0567000000e+04    2.1467358095e-01    1.0632000000e+04   -2.8997116605e-01    1.1326000000e+04    2.8860734544e-01    1.1922000000e+04   -5.9022153360e-01    9.4650000000e+03    6.0811493855e-01    1.0419000000e+04   -5.9826969768e-01    1.0805000000e+04    6.3037889193e-01    1.2162000000e+04   -5.3490642482e-01    1.1869000000e+04    5.5682742411e-01    1.0011000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00
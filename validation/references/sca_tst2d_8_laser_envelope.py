@@ -0,0 +1,92 @@
+# 1 time
+# 2 Utot
+# 3 Uexp
+# 4 Ubal
+# 5 Ubal_norm
+# 6 Uelm
+# 7 Ukin
+# 8 Uelm_bnd
+# 9 Ukin_bnd
+# 10 Uelm_inj_mvw
+# 11 Uelm_out_mvw
+# 12 Ukin_inj_mvw
+# 13 Ukin_out_mvw
+# 14 Ntot_ion
+# 15 Zavg_ion
+# 16 Ukin_ion
+# 17 Ntot_electron
+# 18 Zavg_electron
+# 19 Ukin_electron
+# 20 Uelm_Ex
+# 21 Uelm_Ey
+# 22 Uelm_Ez
+# 23 Uelm_Bx_m
+# 24 Uelm_By_m
+# 25 Uelm_Bz_m
+# 26 ExMin
+# 27 ExMinCell
+# 28 ExMax
+# 29 ExMaxCell
+# 30 EyMin
+# 31 EyMinCell
+# 32 EyMax
+# 33 EyMaxCell
+# 34 EzMin
+# 35 EzMinCell
+# 36 EzMax
+# 37 EzMaxCell
+# 38 Bx_mMin
+# 39 Bx_mMinCell
+# 40 Bx_mMax
+# 41 Bx_mMaxCell
+# 42 By_mMin
+# 43 By_mMinCell
+# 44 By_mMax
+# 45 By_mMaxCell
+# 46 Bz_mMin
+# 47 Bz_mMinCell
+# 48 Bz_mMax
+# 49 Bz_mMaxCell
+# 50 JxMin
+# 51 JxMinCell
+# 52 JxMax
+# 53 JxMaxCell
+# 54 JyMin
+# 55 JyMinCell
+# 56 JyMax
+# 57 JyMaxCell
+# 58 JzMin
+# 59 JzMinCell
+# 60 JzMax
+# 61 JzMaxCell
+# 62 RhoMin
+# 63 RhoMinCell
+# 64 RhoMax
+# 65 RhoMaxCell
+# 66 PoyEast
+# 67 PoyEastInst
+# 68 PoySouth
+# 69 PoySouthInst
+# 70 PoyWest
+# 71 PoyWestInst
+# 72 PoyNorth
+# 73 PoyNorthInst
+#
+#               time                Utot                Uexp                Ubal           Ubal_norm                Uelm                Ukin            Uelm_bnd            Ukin_bnd        Uelm_inj_mvw        Uelm_out_mvw        Ukin_inj_mvw        Ukin_out_mvw            Ntot_ion            Zavg_ion            Ukin_ion       Ntot_electron       Zavg_electron       Ukin_electron             Uelm_Ex             Uelm_Ey             Uelm_Ez           Uelm_Bx_m           Uelm_By_m           Uelm_Bz_m               ExMin           ExMinCell               ExMax           ExMaxCell               EyMin           EyMinCell               EyMax           EyMaxCell               EzMin           EzMinCell               EzMax           EzMaxCell             Bx_mMin         Bx_mMinCell             Bx_mMax         Bx_mMaxCell             By_mMin         By_mMinCell             By_mMax         By_mMaxCell             Bz_mMin         Bz_mMinCell             Bz_mMax         Bz_mMaxCell               JxMin           JxMinCell               JxMax           JxMaxCell               JyMin           JyMinCell               JyMax           JyMaxCell               JzMin           JzMinCell               JzMax           JzMaxCell              RhoMin          RhoMinCell              RhoMax          RhoMaxCell             PoyEast         PoyEastInst            PoySouth        PoySouthInst             PoyWest         PoyWestInst            PoyNorth        PoyNorthInst
+    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0736000000e+04    2.8000000000e+01    0.0000000000e+00    2.0736000000e+04   -2.8000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.6945812118e-17    8.4490000000e+03    3.2260520346e-17    1.7840000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00
+    1.0000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0736000000e+04    2.8000000000e+01    0.0000000000e+00    2.0736000000e+04   -2.8000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00
+    2.0000000000e+01    4.5446720726e-08   -4.1735512534e-21    4.5446720726e-08    0.0000000000e+00    4.0999660034e-10    4.5036724126e-08   -4.1735512534e-21    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0736000000e+04    2.8000000000e+01    0.0000000000e+00    2.0736000000e+04   -2.8000000000e+01    4.5036724126e-08    4.0844058879e-10    6.7607461319e-13    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    8.7993693884e-13   -7.6002733153e-09    2.0730000000e+03    1.2471227487e-05    1.7670000000e+03   -2.4497888403e-07    1.4740000000e+03    2.4497888409e-07    1.4230000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.3919950102e-07    1.4710000000e+03    2.3920056284e-07    1.4570000000e+03   -1.0631730002e-05    5.1000000000e+02    5.3540852454e-32    1.3510000000e+03   -2.0552909852e-07    3.2000000000e+02    2.0552909850e-07    9.1300000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.3011128310e-21   -1.4432147642e-25    0.0000000000e+00    0.0000000000e+00   -8.7243842246e-22    3.3625399890e-26
+    3.0000000000e+01    8.4554016259e-03   -7.0680854604e-14    8.4554016260e-03    0.0000000000e+00    5.5479212794e-04    7.9006094980e-03   -7.0680854604e-14    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0736000000e+04    2.8000000000e+01    0.0000000000e+00    2.0736000000e+04   -2.8000000000e+01    7.9006094980e-03    5.4085788363e-04    7.0997117354e-06    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    6.8345325814e-06   -1.4534227605e-04    2.9540000000e+03    1.0132732188e-02    1.9280000000e+03   -6.3884736052e-04    1.9170000000e+03    6.2656103463e-04    2.1180000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.8428178084e-04    1.9430000000e+03    5.9315317282e-04    1.9360000000e+03   -3.3902594123e-03    6.0900000000e+02    1.4685215826e-31    9.5000000000e+02   -3.2915132081e-04    5.6200000000e+02    3.2930780297e-04    5.3700000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.9754466538e-27   -8.1451727067e-29   -5.2451075780e-14   -5.5228098955e-16    0.0000000000e+00    0.0000000000e+00   -1.8229778825e-14    2.0277347895e-16
+    4.0000000000e+01    2.8098948225e-01   -4.0958513132e-10    2.8098948266e-01    0.0000000000e+00    5.0006488422e-02    2.3098299383e-01   -4.0958513132e-10    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0736000000e+04    2.8000000000e+01    0.0000000000e+00    2.0736000000e+04   -2.8000000000e+01    2.3098299383e-01    4.5815495639e-02    2.3715956544e-03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.8193971291e-03   -4.4954766998e-03    4.2940000000e+03    8.2483257242e-02    2.1430000000e+03   -1.1722121920e-02    2.2030000000e+03    1.0890275144e-02    2.5420000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -9.8932080014e-03    3.2030000000e+03    1.0508768266e-02    2.5430000000e+03   -1.5051563013e-02    8.9200000000e+02    1.3886742605e-07    1.8810000000e+03   -3.2242803751e-03    1.0850000000e+03    3.3047064580e-03    9.8100000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.3885057954e-12   -1.1326179838e-13   -2.7650434160e-10   -5.8150647145e-12    0.0000000000e+00    0.0000000000e+00   -1.2669228393e-10    2.7463342836e-12
+    5.0000000000e+01    9.9194760104e-01   -5.2078788967e-06    9.9195280892e-01    0.0000000000e+00    3.6458597386e-01    6.2736162718e-01   -5.2078788967e-06    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0736000000e+04    2.8000000000e+01    0.0000000000e+00    2.0736000000e+04   -2.8000000000e+01    6.2736162718e-01    2.8647315070e-01    4.9872069900e-02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.8240753255e-02   -2.1298982163e-02    5.6680000000e+03    2.3125867862e-01    2.4650000000e+03   -5.9676648103e-02    3.0920000000e+03    5.6397617787e-02    3.0720000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.2670513702e-02    3.7170000000e+03    4.6030386157e-02    3.1780000000e+03   -2.1159539170e-02    1.6710000000e+03    3.1651316308e-03    2.9460000000e+03   -1.0490336024e-02    1.4460000000e+03    1.0115295185e-02    1.3420000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.9880613578e-06   -7.2649273751e-08   -1.4202244150e-07   -2.5291631324e-09    0.0000000000e+00    0.0000000000e+00   -7.7795097414e-08    1.4183977676e-09
+    6.0000000000e+01    1.8561384549e+00   -8.4337534755e-04    1.8569818302e+00    0.0000000000e+00    9.0472480786e-01    9.5141364701e-01   -8.4337534755e-04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0736000000e+04    2.8000000000e+01    0.0000000000e+00    2.0736000000e+04   -2.8000000000e+01    9.5141364701e-01    5.0716852607e-01    2.8521431907e-01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.1234196272e-01   -5.2728151411e-02    6.9560000000e+03    3.1564726494e-01    2.7120000000e+03   -1.4739941436e-01    3.0460000000e+03    1.4778586834e-01    3.5120000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -8.8334161089e-02    3.9320000000e+03    9.3813103825e-02    3.6750000000e+03   -1.9008215695e-02    1.1670000000e+03    1.8437737297e-02    2.8430000000e+03   -1.3935766156e-02    1.9820000000e+03    1.3040665066e-02    2.0270000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -8.1600668961e-04   -9.8538732553e-06   -1.6736281882e-05   -2.0656848313e-07    0.0000000000e+00    0.0000000000e+00   -1.0632376059e-05    1.3575255131e-07
+    7.0000000000e+01    2.8193732077e+00   -1.2169190707e-02    2.8315423984e+00    0.0000000000e+00    1.5125694944e+00    1.3068037133e+00   -1.2169190707e-02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0736000000e+04    2.8000000000e+01    0.0000000000e+00    2.0736000000e+04   -2.8000000000e+01    1.3068037133e+00    6.4774206482e-01    6.9312900304e-01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.7169842655e-01   -1.1728942436e-01    6.8530000000e+03    3.8677774678e-01    3.0480000000e+03   -2.3216132646e-01    3.2100000000e+03    2.3955132055e-01    3.8550000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.0189913740e-01    4.8750000000e+03    1.0856683585e-01    3.8070000000e+03   -1.6961838675e-02    1.9790000000e+03    3.0403066245e-02    2.7570000000e+03   -1.6473071405e-02    3.4340000000e+03    1.6314858763e-02    3.4950000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.1341962096e-02   -8.3465120048e-05   -4.7624910232e-04   -3.4545659356e-06  -3.0642971815e-137   5.8229852186e-139   -3.5097950829e-04    2.7014378027e-06
+    8.0000000000e+01    3.7415952932e+00   -5.8232548938e-02    3.7998278421e+00    0.0000000000e+00    2.1546212192e+00    1.5869740740e+00   -5.8232548938e-02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0736000000e+04    2.8000000000e+01    0.0000000000e+00    2.0736000000e+04   -3.2000000000e+01    1.5869740740e+00    1.0803653859e+00    9.4114054963e-01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.3311528368e-01   -2.7395197134e-01    6.3750000000e+03    3.7914055236e-01    3.4070000000e+03   -2.8250894444e-01    3.9380000000e+03    2.8807846012e-01    3.9070000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -9.1580025201e-02    4.9080000000e+03    1.0188567946e-01    4.0510000000e+03   -1.9900828316e-02    2.3440000000e+03    4.3745658629e-02    4.8200000000e+03   -2.5543516837e-02    3.9430000000e+03    2.7024828121e-02    4.3210000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.2156008541e-02   -2.0457965190e-04   -3.3000402543e-03   -1.0117016395e-05   -5.0705152319e-94    1.1234996847e-95   -2.7765001422e-03    9.4313004590e-06
+    9.0000000000e+01    4.6263755442e+00   -1.1912220041e-01    4.7454977447e+00    0.0000000000e+00    2.5426759603e+00    2.0836995839e+00   -1.1912220041e-01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0736000000e+04    2.8000000000e+01    0.0000000000e+00    2.0736000000e+04   -3.2000000000e+01    2.0836995839e+00    1.5561040432e+00    8.6052605309e-01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.2604586408e-01   -3.9798650115e-01    6.7840000000e+03    3.0934028927e-01    4.0080000000e+03   -3.0140560845e-01    3.6710000000e+03    2.7488077109e-01    4.6000000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.3567925447e-01    4.5300000000e+03    1.4501125622e-01    3.7970000000e+03   -2.2329961105e-02    3.5330000000e+03    3.6015170121e-02    5.2220000000e+03   -3.5537494279e-02    4.2020000000e+03    3.7974164210e-02    4.6600000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.0381023719e-01   -8.9278996748e-05   -7.9956476710e-03   -7.0168870239e-06   -2.2430835811e-64    5.4721501177e-66   -7.3163155552e-03    7.5285259570e-06
+    1.0000000000e+02    5.5509871974e+00   -1.3637522465e-01    5.6873624220e+00    0.0000000000e+00    2.6399780027e+00    2.9110091947e+00   -1.3568448684e-01    6.9073780401e-04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0736000000e+04    2.8000000000e+01    0.0000000000e+00    2.0706000000e+04   -3.2000000000e+01    2.9110091947e+00    1.5935364101e+00    7.7175904558e-01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.7468254696e-01   -4.9279087221e-01    6.3870000000e+03    3.1624280849e-01    4.3980000000e+03   -3.2215831445e-01    4.3920000000e+03    2.9714422955e-01    4.4690000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.8221402316e-01    4.4100000000e+03    1.8700373784e-01    3.8580000000e+03   -8.2753460950e-02    3.7170000000e+03    3.4282443913e-02    5.5910000000e+03   -5.0352992340e-02    4.9760000000e+03    5.1314415517e-02    5.4030000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.1443783133e-01   -8.2229342754e-05   -1.0838275989e-02   -1.3115749587e-06   -2.2203501262e-42    5.6702302750e-44   -1.0408379527e-02    1.8976219481e-06
+    1.1000000000e+02    6.4516893300e+00   -2.0580445198e-01    6.6574937820e+00    0.0000000000e+00    3.2942985363e+00    3.1573907937e+00   -1.8920529047e-01    1.6599161515e-02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0736000000e+04    2.8000000000e+01    0.0000000000e+00    2.0666000000e+04   -3.2000000000e+01    3.1573907937e+00    2.0211358941e+00    1.0012083368e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.7195430535e-01   -5.3905086470e-01    5.6670000000e+03    6.0976900589e-01    4.8540000000e+03   -4.2176099877e-01    4.3300000000e+03    4.3224579734e-01    4.1380000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.9090431751e-01    5.7320000000e+03    2.0157081173e-01    4.5750000000e+03   -1.8205280094e-01    4.8140000000e+03    3.4035905873e-02    5.6170000000e+03   -5.8423436911e-02    5.0660000000e+03    5.6645626144e-02    5.5600000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.6580555593e-01   -2.4407796699e-04   -1.1865571487e-02   -2.1367817679e-06   -3.7984796134e-27    1.1001374374e-28   -1.1534163051e-02    1.9743009172e-06
+    1.2000000000e+02    7.2731074439e+00   -2.8378106976e-01    7.5568885137e+00    0.0000000000e+00    4.0173729904e+00    3.2557344535e+00   -2.6747792003e-01    1.6303149732e-02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0736000000e+04    2.8000000000e+01    0.0000000000e+00    2.0630000000e+04   -3.2000000000e+01    3.2557344535e+00    2.4160665224e+00    1.3223721900e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.7893427793e-01   -6.3368405026e-01    5.7890000000e+03    6.2088261449e-01    5.5210000000e+03   -4.6504826592e-01    4.5060000000e+03    4.7151204535e-01    4.7070000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.0296967236e-01    5.1240000000e+03    2.1605110197e-01    4.6430000000e+03   -1.3983754448e-01    5.0940000000e+03    6.2282340991e-02    5.0890000000e+03   -6.7053291053e-02    5.1440000000e+03    5.7191490957e-02    5.4240000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.3880916477e-01   -2.4386851455e-04   -1.4670278795e-02   -9.0524990173e-06   -2.2372505466e-16    6.1973738609e-18   -1.3998476468e-02    8.1894184147e-06
+    1.3000000000e+02    8.1164177164e+00   -3.2945754823e-01    8.4458752646e+00    0.0000000000e+00    4.0533972996e+00    4.0630204168e+00   -3.2426523302e-01    5.1923152039e-03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0736000000e+04    2.8000000000e+01    0.0000000000e+00    2.0610000000e+04   -3.2000000000e+01    4.0630204168e+00    2.4776999315e+00    1.2582094521e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    3.1748791604e-01   -5.3510484525e-01    5.6820000000e+03    8.0728204390e-01    4.9410000000e+03   -5.2725130436e-01    5.1270000000e+03    5.2995060982e-01    5.2470000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.7304053017e-01    4.3660000000e+03    2.8851946903e-01    4.7170000000e+03   -1.2764699799e-01    5.0380000000e+03    9.2926605155e-02    5.1530000000e+03   -5.8027387200e-02    5.0770000000e+03    5.8569166979e-02    5.2800000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.8298020628e-01   -8.4348375475e-05   -2.1231531173e-02   -1.6142581961e-05   -5.2245138236e-10    1.2191557316e-11   -2.0053495047e-02    1.5172933808e-05
+    1.4000000000e+02    8.9592680832e+00   -3.7224460198e-01    9.3315126851e+00    0.0000000000e+00    4.2615188812e+00    4.6977492019e+00   -3.5877468724e-01    1.3469914734e-02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0736000000e+04    2.8000000000e+01    0.0000000000e+00    2.0520000000e+04   -3.2000000000e+01    4.6977492019e+00    2.5726018720e+00    1.3656110877e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    3.2330592153e-01   -5.9590124766e-01    4.6160000000e+03    6.6580477244e-01    5.9730000000e+03   -5.4778350861e-01    5.4420000000e+03    5.7916790311e-01    5.5980000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.3713712920e-01    5.3490000000e+03    2.7942576716e-01    5.0110000000e+03   -1.3398795844e-01    5.5870000000e+03    1.0262358495e-01    4.4710000000e+03   -7.2928223772e-02    5.6320000000e+03    6.9581095265e-02    6.0010000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.9967429816e-01   -3.8177335644e-05   -3.0245034134e-02   -1.6989813729e-05   -2.0214926109e-05    2.8619609252e-07   -2.8835140028e-02    1.7334038618e-05
+    1.5000000000e+02    9.9403127935e+00   -4.4010796053e-01    1.0380420754e+01    0.0000000000e+00    4.7689424473e+00    5.1713703462e+00   -3.8645644693e-01    5.3651513606e-02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0736000000e+04    2.8000000000e+01    0.0000000000e+00    2.0428000000e+04   -3.2000000000e+01    5.1713703462e+00    2.6142880770e+00    1.8029060954e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    3.5174827485e-01   -7.9877725633e-01    5.2400000000e+03    5.9730480354e-01    5.7890000000e+03   -6.3115430133e-01    6.1620000000e+03    6.2580471026e-01    6.5150000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.7926492790e-01    5.9160000000e+03    2.8857589154e-01    5.6750000000e+03   -1.0091700183e-01    5.1550000000e+03    1.0863635432e-01    5.7320000000e+03   -7.6804631875e-02    5.9940000000e+03    7.5052091101e-02    6.4310000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.0670214269e-01   -2.9064923733e-05   -3.5425285902e-02   -7.8273019487e-06   -9.8379902127e-03    9.0132513604e-05   -3.4491028127e-02    6.4846867814e-06
+    1.5000000000e+02    9.9403127935e+00   -3.8860193363e-01    1.0328914727e+01    0.0000000000e+00    4.7689424473e+00    5.1713703462e+00   -3.8860193363e-01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.0736000000e+04    2.8000000000e+01    0.0000000000e+00    2.0428000000e+04   -3.2000000000e+01    5.1713703462e+00    2.6142880770e+00    1.8029060954e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    3.5174827485e-01   -7.9877725633e-01    5.2400000000e+03    5.9730480354e-01    5.7890000000e+03   -6.3115430133e-01    6.1620000000e+03    6.2580471026e-01    6.5150000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.7926492790e-01    5.9160000000e+03    2.8857589154e-01    5.6750000000e+03   -1.0091700183e-01    5.1550000000e+03    1.0863635432e-01    5.7320000000e+03   -7.6804631875e-02    5.9940000000e+03    7.5052091101e-02    6.4310000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.0693587517e-01   -2.9064923733e-05   -3.5582529772e-02   -7.8273019487e-06   -1.1449754899e-02    9.0132513604e-05   -3.4633773781e-02    6.4846867814e-06
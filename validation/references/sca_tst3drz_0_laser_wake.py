@@ -0,0 +1,83 @@
+# 1 time
+# 2 Utot
+# 3 Uexp
+# 4 Ubal
+# 5 Ubal_norm
+# 6 Uelm
+# 7 Ukin
+# 8 Uelm_bnd
+# 9 Ukin_bnd
+# 10 Uelm_inj_mvw
+# 11 Uelm_out_mvw
+# 12 Ukin_inj_mvw
+# 13 Ukin_out_mvw
+# 14 Ntot_electron
+# 15 Zavg_electron
+# 16 Ukin_electron
+# 17 Uelm_Ex
+# 18 Uelm_Ey
+# 19 Uelm_Ez
+# 20 Uelm_Bx_m
+# 21 Uelm_By_m
+# 22 Uelm_Bz_m
+# 23 ExMin
+# 24 ExMinCell
+# 25 ExMax
+# 26 ExMaxCell
+# 27 EyMin
+# 28 EyMinCell
+# 29 EyMax
+# 30 EyMaxCell
+# 31 EzMin
+# 32 EzMinCell
+# 33 EzMax
+# 34 EzMaxCell
+# 35 Bx_mMin
+# 36 Bx_mMinCell
+# 37 Bx_mMax
+# 38 Bx_mMaxCell
+# 39 By_mMin
+# 40 By_mMinCell
+# 41 By_mMax
+# 42 By_mMaxCell
+# 43 Bz_mMin
+# 44 Bz_mMinCell
+# 45 Bz_mMax
+# 46 Bz_mMaxCell
+# 47 JxMin
+# 48 JxMinCell
+# 49 JxMax
+# 50 JxMaxCell
+# 51 JyMin
+# 52 JyMinCell
+# 53 JyMax
+# 54 JyMaxCell
+# 55 JzMin
+# 56 JzMinCell
+# 57 JzMax
+# 58 JzMaxCell
+# 59 RhoMin
+# 60 RhoMinCell
+# 61 RhoMax
+# 62 RhoMaxCell
+# 63 PoyEast
+# 64 PoyEastInst
+# 65 PoySouth
+# 66 PoySouthInst
+# 67 PoyWest
+# 68 PoyWestInst
+# 69 PoyNorth
+# 70 PoyNorthInst
+#
+#               time                Utot                Uexp                Ubal           Ubal_norm                Uelm                Ukin            Uelm_bnd            Ukin_bnd        Uelm_inj_mvw        Uelm_out_mvw        Ukin_inj_mvw        Ukin_out_mvw       Ntot_electron       Zavg_electron       Ukin_electron             Uelm_Ex             Uelm_Ey             Uelm_Ez           Uelm_Bx_m           Uelm_By_m           Uelm_Bz_m               ExMin           ExMinCell               ExMax           ExMaxCell               EyMin           EyMinCell               EyMax           EyMaxCell               EzMin           EzMinCell               EzMax           EzMaxCell             Bx_mMin         Bx_mMinCell             Bx_mMax         Bx_mMaxCell             By_mMin         By_mMinCell             By_mMax         By_mMaxCell             Bz_mMin         Bz_mMinCell             Bz_mMax         Bz_mMaxCell               JxMin           JxMinCell               JxMax           JxMaxCell               JyMin           JyMinCell               JyMax           JyMaxCell               JzMin           JzMinCell               JzMax           JzMaxCell              RhoMin          RhoMinCell              RhoMax          RhoMaxCell             PoyEast         PoyEastInst            PoySouth        PoySouthInst             PoyWest         PoyWestInst            PoyNorth        PoyNorthInst
+    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.0960000000e+04   -1.4000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -7.1346153846e-02    1.1361000000e+04   -1.3568725586e-02    5.2110000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00
+    1.7586411630e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.0960000000e+04   -1.4000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00
+    3.5172823260e+01    2.0164186342e-02   -1.6729416823e-13    2.0164186343e-02    0.0000000000e+00    3.5316828330e-07    2.0163833174e-02   -1.6729416823e-13    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.0960000000e+04   -1.4000000000e+01    2.0163833174e-02    3.0363908324e-07    3.9002596325e-08    2.5479675782e-11    7.6308047181e-11    1.5052062878e-11    1.0409763949e-08   -2.6204641248e-05    2.7950000000e+03    1.7314316147e-04    3.0640000000e+03   -6.6571216610e-05    3.2630000000e+03    7.2009330848e-05    3.4180000000e+03   -2.6632183598e-06    3.1110000000e+03    2.8350090040e-06    3.0370000000e+03   -3.8272151496e-06    3.3420000000e+03    3.4586661430e-06    3.5170000000e+03   -2.6864490812e-06    3.2950000000e+03    1.9003283967e-06    3.1000000000e+03   -2.8491040002e-05    3.0760000000e+03    2.3981035347e-05    3.1780000000e+03   -9.8914721154e-05    8.7800000000e+02    2.4813760485e-06    9.2000000000e+02   -6.2122395577e-05    9.6600000000e+02    3.9595109196e-05    1.5640000000e+03   -1.2099235867e-05    1.2640000000e+03    1.4920202258e-05    8.8400000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.4477177242e-26   -1.9701885371e-48    0.0000000000e+00    0.0000000000e+00   -1.6729416823e-13    3.0283545216e-18
+    5.2759234891e+01    6.6099374236e-01   -2.4084003907e-10    6.6099374260e-01    0.0000000000e+00    4.9482120633e-04    6.6049892115e-01   -2.4084003907e-10    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.0960000000e+04   -1.4000000000e+01    6.6049892115e-01    4.1517045396e-04    5.3594100395e-05    1.8333436128e-09    3.3589288902e-09    1.2111117461e-09    2.6050248594e-05   -1.8176530295e-03    2.5690000000e+03    5.4575887408e-03    3.1380000000e+03   -7.9128237076e-04    2.7360000000e+03    1.8932653765e-03    3.2740000000e+03   -2.9098824028e-05    4.3010000000e+03    2.9396518770e-05    3.6510000000e+03   -3.1579802453e-05    4.1340000000e+03    3.0638994292e-05    4.1290000000e+03   -2.5067996697e-05    3.8190000000e+03    2.2950819638e-05    4.1690000000e+03   -1.5277102058e-03    3.1510000000e+03    4.6755195217e-04    2.8150000000e+03   -1.5831385763e-03    1.1860000000e+03    7.0389144874e-05    1.1240000000e+03   -5.6842677459e-04    1.3410000000e+03    4.0439554463e-04    1.7980000000e+03   -7.2342270378e-04    1.6530000000e+03    6.7070038955e-04    1.5960000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.4503556693e-14   -2.7465838553e-16   -2.2307037661e-23   -2.4998180769e-50    0.0000000000e+00    0.0000000000e+00   -2.4078553551e-10    2.4910721676e-13
+    7.0345646521e+01    1.9684584770e+00   -3.1099416759e-07    1.9684587880e+00    0.0000000000e+00    1.0361344998e-02    1.9580971320e+00   -3.1099416759e-07    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.0960000000e+04   -1.4000000000e+01    1.9580971320e+00    5.7296154960e-03    3.9744026474e-03    2.2765217521e-07    3.6268614091e-07    1.3165145191e-07    6.5660486438e-04   -1.1571571576e-02    4.6150000000e+03    1.9620842563e-02    3.6640000000e+03   -4.6408656073e-03    3.0150000000e+03    1.7078820277e-02    3.1510000000e+03   -2.8162507262e-04    5.7480000000e+03    2.8140981465e-04    3.5110000000e+03   -3.3426000057e-04    4.7580000000e+03    2.3210928621e-04    5.3910000000e+03   -2.7042546329e-04    4.4650000000e+03    1.9935106484e-04    4.2790000000e+03   -8.0046930029e-03    3.4530000000e+03    1.6565043283e-03    4.9100000000e+03   -2.5046547118e-03    2.7030000000e+03    5.0288095427e-04    2.1630000000e+03   -2.0037194013e-03    1.3310000000e+03    8.2012370589e-04    1.8370000000e+03   -9.5396558652e-04    1.5160000000e+03    1.2691796918e-03    3.3800000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.0359995668e-07   -8.7225675636e-10    1.3961268234e-22   -4.7610251290e-54    0.0000000000e+00    0.0000000000e+00   -7.3942109074e-09    2.2384028851e-11
+    8.7932058151e+01    2.2328494835e+00   -5.2715097499e-05    2.2329021986e+00    0.0000000000e+00    4.5225247335e-02    2.1876242362e+00   -5.2715097499e-05    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.0960000000e+04   -1.4000000000e+01    2.1876242362e+00    1.8660162021e-02    2.5749574152e-02    3.9016742951e-07    8.3995273214e-07    2.6376120476e-07    8.1401728030e-04   -2.5216601438e-02    6.4140000000e+03    2.7611181220e-02    4.3180000000e+03   -1.0645365125e-02    4.3800000000e+03    4.7733558791e-02    3.4280000000e+03   -4.8699425574e-04    3.9260000000e+03    4.3854938271e-04    4.7250000000e+03   -5.5293201357e-04    6.7290000000e+03    4.5749036204e-04    5.3850000000e+03   -3.4191208528e-04    4.6820000000e+03    4.0119901409e-04    5.5110000000e+03   -9.1615254605e-03    3.0390000000e+03    2.1871919058e-03    3.4620000000e+03   -2.7431733047e-03    2.2980000000e+03    1.2156441005e-03    1.8210000000e+03   -2.3664023823e-03    3.2310000000e+03    7.2795078883e-04    4.2200000000e+03   -1.1794554198e-03    3.5880000000e+03    1.3496871593e-03    5.0290000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.9843024256e-05   -1.2977097389e-07   -2.6535033212e-22   -3.8236318546e-26    0.0000000000e+00    0.0000000000e+00   -2.8720732433e-06    5.1618443203e-09
+    1.0551846978e+02    2.3677033530e+00   -3.1493601995e-04    2.3680182890e+00    0.0000000000e+00    7.5844253329e-02    2.2918590996e+00   -3.1493601995e-04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.0960000000e+04   -1.4000000000e+01    2.2918590996e+00    2.7609077146e-02    4.7836556709e-02    2.5920180983e-07    4.2746548923e-07    1.6942398034e-07    3.9776338275e-04   -3.8402188622e-02    3.6460000000e+03    3.0057682592e-02    4.4450000000e+03   -1.6441126158e-02    4.2350000000e+03    6.6782162671e-02    3.9630000000e+03   -3.9892105098e-04    5.9120000000e+03    4.2495370394e-04    7.5950000000e+03   -3.9973022198e-04    6.0940000000e+03    3.5352022281e-04    6.3800000000e+03   -3.2498458473e-04    7.0890000000e+03    3.0388822083e-04    6.4420000000e+03   -6.0513380029e-03    3.7860000000e+03    5.6619972690e-03    5.9560000000e+03   -3.6456632645e-03    3.9270000000e+03    1.4986260773e-03    2.3940000000e+03   -2.0604883002e-03    3.9410000000e+03    2.4618324150e-03    4.2060000000e+03   -9.9225107924e-04    6.5880000000e+03    1.2364454344e-03    5.6220000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.6374448607e-04   -2.1462822550e-07   -8.6388784321e-22    5.3720921795e-24    0.0000000000e+00    0.0000000000e+00   -5.1191533885e-05    2.4329877241e-08
+    1.2310488141e+02    2.8522776465e+00   -4.7599684432e-04    2.8527536434e+00    0.0000000000e+00    6.7443528725e-02    2.7848341178e+00   -4.2881291639e-04    4.7183927925e-05    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.0954000000e+04   -1.4000000000e+01    2.7848341178e+00    2.5281748587e-02    3.9792521275e-02    2.3321168456e-07    3.3664670341e-07    1.5329515425e-07    2.3685357095e-03   -3.6862906258e-02    4.8050000000e+03    3.6938174889e-02    6.3360000000e+03   -2.1501315001e-02    2.5190000000e+03    6.3485187308e-02    5.6170000000e+03   -3.2965943050e-04    7.6100000000e+03    3.6822919442e-04    7.6050000000e+03   -3.8846371802e-04    8.0740000000e+03    3.9873077590e-04    7.6280000000e+03   -3.1406112443e-04    9.3080000000e+03    2.7048593765e-04    6.3110000000e+03   -7.6565994131e-03    5.0100000000e+03    1.6195619548e-02    5.1190000000e+03   -5.6427830179e-03    4.3570000000e+03    1.7359499088e-03    4.7790000000e+03   -2.0364172567e-03    3.5810000000e+03    7.4086725090e-03    4.4300000000e+03   -1.3622232115e-03    7.3900000000e+03    9.5331936791e-04    8.0900000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.3695957460e-04   -7.8626767479e-08   -8.5711442055e-22    5.3194949410e-24    0.0000000000e+00    0.0000000000e+00   -9.1853341794e-05    4.3111547506e-09
+    1.4069129304e+02    2.9530151422e+00   -6.9889311197e-04    2.9537140353e+00    0.0000000000e+00    1.3652310110e-01    2.8164920411e+00   -6.8913972517e-04    9.7533868003e-06    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.0946000000e+04   -1.4000000000e+01    2.8164920411e+00    5.9367532479e-02    7.5588556948e-02    2.0047647394e-07    2.3670684004e-07    1.2716059663e-07    1.5664473260e-03   -5.1676491934e-02    7.3050000000e+03    7.6564878907e-02    5.5460000000e+03   -7.6112906079e-02    4.3110000000e+03    9.3468967953e-02    6.9200000000e+03   -3.4524637524e-04    8.6750000000e+03    3.7569192099e-04    9.7060000000e+03   -3.5556787096e-04    8.3500000000e+03    3.0687978819e-04    1.0558000000e+04   -2.8786372325e-04    8.2930000000e+03    2.8375793036e-04    7.8110000000e+03   -9.2341121649e-03    7.0500000000e+03    1.4070757969e-02    5.9670000000e+03   -1.1881832065e-02    4.8610000000e+03    1.4038570417e-02    6.2190000000e+03   -1.8820072379e-03    5.3220000000e+03    1.1235356083e-02    4.5630000000e+03   -1.2719556565e-03    7.5320000000e+03    1.2795456220e-03    8.1910000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.6304008151e-04   -3.6549209510e-07   -1.1817125341e-21   -2.8499316177e-24   -7.6841157048e-50    1.6610300265e-51   -1.2609964366e-04    1.7120104157e-08
+    1.5827770467e+02    3.1731565881e+00   -1.0175228607e-03    3.1741741110e+00    0.0000000000e+00    1.4267014843e-01    3.0304864397e+00   -1.0098458606e-03    7.6770001221e-06    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.0942000000e+04   -1.5000000000e+01    3.0304864397e+00    5.6558506004e-02    8.3851179791e-02    1.8164705770e-07    1.5786673683e-07    1.0909707226e-07    2.2600140200e-03   -6.4703283414e-02    8.3760000000e+03    1.1492953704e-01    7.3270000000e+03   -1.0390423762e-01    5.1700000000e+03    1.0997188190e-01    7.3470000000e+03   -3.2986588659e-04    9.9190000000e+03    3.9065556946e-04    7.3550000000e+03   -2.6898140973e-04    7.0870000000e+03    3.0453402353e-04    9.2810000000e+03   -2.7906191812e-04    9.1960000000e+03    2.5533132274e-04    8.6830000000e+03   -3.0177741796e-02    8.1240000000e+03    2.6132655604e-02    8.1530000000e+03   -1.4026510451e-02    5.9860000000e+03    7.1722915856e-02    6.5130000000e+03   -5.6572992612e-03    9.0930000000e+03    7.9473282584e-03    5.7540000000e+03   -2.0963223913e-03    8.0960000000e+03    3.8104361313e-03    9.4440000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -8.3362004505e-04   -1.8425908869e-07    9.8738899816e-21   -1.5210602571e-23   -6.3194900792e-10    3.0358211106e-13   -1.7622518355e-04    1.0354208257e-08
+    1.7586411630e+02    3.1005235499e+00   -1.6258907422e-02    3.1167824573e+00    0.0000000000e+00    1.3715852607e-01    2.9633650238e+00   -1.1137904817e-03    1.5145116940e-02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.0890000000e+04   -1.5000000000e+01    2.9633650238e+00    6.4228553513e-02    7.1191929956e-02    1.7217754985e-07    1.0311917907e-07    9.4885894434e-08    1.7376724181e-03   -7.0516656147e-02    8.7400000000e+03    7.5619989091e-02    8.1870000000e+03   -8.0172336719e-02    5.1630000000e+03    9.6017051651e-02    8.5230000000e+03   -3.3761938797e-04    8.6310000000e+03    2.9680250510e-04    6.9430000000e+03   -2.4430822878e-04    9.7890000000e+03    2.1403193208e-04    8.4400000000e+03   -2.0936058428e-04    1.0487000000e+04    2.7040030813e-04    1.0824000000e+04   -2.1253160195e-02    8.8540000000e+03    1.3210384199e-02    7.8480000000e+03   -1.2031167095e-02    8.1800000000e+03    2.7998976414e-02    7.3690000000e+03   -7.4885070480e-03    9.2380000000e+03    5.6836191185e-03    7.9940000000e+03   -7.7849297899e-04    7.6090000000e+03    1.0614921665e-03    8.8670000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -8.9571608712e-04   -4.2186846001e-08   -4.6085771064e-21   -6.0156438105e-23   -8.0567787299e-06    1.1894676680e-08   -2.1001761586e-04    7.9160789437e-09